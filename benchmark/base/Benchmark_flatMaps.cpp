@@ -0,0 +1,130 @@
+#include "gdl/base/container/flatHashMap.h"
+#include "gdl/base/container/flatMap.h"
+#include "gdl/base/container/map.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+using MapType = Map<U64, U64>;
+using UnorderedMapType = std::unordered_map<U64, U64>;
+using FlatHashMapType = FlatHashMap<U64, U64>;
+using FlatMapType = FlatMap<U64, U64>;
+
+
+
+//! @brief Creates unique keys in random order
+//! @param numKeys: Number of keys
+//! @return Keys
+Vector<U64> CreateKeys(U32 numKeys)
+{
+    std::mt19937_64 generator(42);
+    Vector<U64> keys(numKeys);
+    for (auto& key : keys)
+        key = generator();
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    std::shuffle(keys.begin(), keys.end(), generator);
+    return keys;
+}
+
+
+
+//! @brief Creates a map that contains the passed keys
+//! @tparam _map: Map type
+//! @param keys: Keys
+//! @return Map
+template <typename _map>
+_map CreateMap(const Vector<U64>& keys)
+{
+    _map map;
+    for (U64 key : keys)
+        map.emplace(key, key);
+    return map;
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Looks up every key of the map once. Every second lookup searches a key that doesn't exist.
+template <typename _map>
+void Lookup(benchmark::State& state)
+{
+    const Vector<U64> keys = CreateKeys(static_cast<U32>(state.range(0)));
+    const _map map = CreateMap<_map>(keys);
+
+    for (auto _ : state)
+    {
+        U64 sum = 0;
+        for (U64 key : keys)
+        {
+            auto iterator = map.find(key);
+            sum += iterator->second;
+            sum += map.count(key + 1);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * state.range(0) * 2);
+}
+BENCHMARK_TEMPLATE(Lookup, MapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Lookup, UnorderedMapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Lookup, FlatHashMapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Lookup, FlatMapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+
+
+
+//! @brief Inserts all keys into an empty map
+template <typename _map>
+void Insert(benchmark::State& state)
+{
+    const Vector<U64> keys = CreateKeys(static_cast<U32>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        _map map = CreateMap<_map>(keys);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * state.range(0));
+}
+BENCHMARK_TEMPLATE(Insert, MapType)->Arg(64)->Arg(4096)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(Insert, UnorderedMapType)->Arg(64)->Arg(4096)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(Insert, FlatHashMapType)->Arg(64)->Arg(4096)->Arg(1 << 14);
+BENCHMARK_TEMPLATE(Insert, FlatMapType)->Arg(64)->Arg(4096)->Arg(1 << 14);
+
+
+
+//! @brief Sums up all values of the map
+template <typename _map>
+void Iterate(benchmark::State& state)
+{
+    const Vector<U64> keys = CreateKeys(static_cast<U32>(state.range(0)));
+    const _map map = CreateMap<_map>(keys);
+
+    for (auto _ : state)
+    {
+        U64 sum = 0;
+        for (const auto& element : map)
+            sum += element.second;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * state.range(0));
+}
+BENCHMARK_TEMPLATE(Iterate, MapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Iterate, UnorderedMapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Iterate, FlatHashMapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(Iterate, FlatMapType)->Arg(64)->Arg(4096)->Arg(1 << 16);
+
+
+
+BENCHMARK_MAIN();
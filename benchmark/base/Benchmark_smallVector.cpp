@@ -0,0 +1,144 @@
+#include "gdl/base/container/smallVector.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/generalPurposeAllocator.h"
+#include "gdl/resources/memory/memoryManager.h"
+#include "gdl/resources/memory/stackAllocator.h"
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Number of allocations of all counting allocators
+inline U64 numAllocations = 0;
+
+
+
+//! @brief Allocator that counts the allocations of another allocator
+//! @tparam _type: Type of the allocated objects
+//! @tparam _allocator: Allocator that performs the allocations
+template <typename _type, template <typename> class _allocator>
+struct CountingAllocator : _allocator<_type>
+{
+    using value_type = _type;
+
+    template <typename _typeOther>
+    struct rebind
+    {
+        using other = CountingAllocator<_typeOther, _allocator>;
+    };
+
+    CountingAllocator() noexcept = default;
+
+    template <typename _typeOther>
+    CountingAllocator(const CountingAllocator<_typeOther, _allocator>&) noexcept
+    {
+    }
+
+    _type* allocate(std::size_t numInstances)
+    {
+        ++numAllocations;
+        return _allocator<_type>::allocate(numInstances);
+    }
+};
+
+
+using VectorType = std::vector<I32, CountingAllocator<I32, GeneralPurposeAllocator>>;
+using VectorSType = std::vector<I32, CountingAllocator<I32, StackAllocator>>;
+using SmallVectorType = SmallVectorTemplate<I32, 16, CountingAllocator<I32, GeneralPurposeAllocator>>;
+using SmallVectorSType = SmallVectorTemplate<I32, 16, CountingAllocator<I32, StackAllocator>>;
+
+
+
+//! @brief Sets up and initializes the memory manager once
+void SetupMemoryManager()
+{
+    static const bool initialized = []() {
+        MemoryManager& memoryManager = MemoryManager::Instance();
+        memoryManager.CreateGeneralPurposeMemory(16_MB);
+        memoryManager.CreateMemoryStack(16_MB);
+        memoryManager.Initialize();
+        return true;
+    }();
+    benchmark::DoNotOptimize(initialized);
+}
+
+
+
+//! @brief Adds the number of allocations per iteration to the benchmark results
+void ReportAllocations(benchmark::State& state, U64 numAllocationsBefore)
+{
+    state.counters["allocations"] = benchmark::Counter(static_cast<F64>(numAllocations - numAllocationsBefore),
+                                                       benchmark::Counter::kAvgIterations);
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Creates a temporary vector, fills it and sums up its elements
+template <typename _vector>
+void Temporary(benchmark::State& state)
+{
+    SetupMemoryManager();
+    const I32 numElements = static_cast<I32>(state.range(0));
+
+    const U64 numAllocationsBefore = numAllocations;
+    for (auto _ : state)
+    {
+        _vector vector;
+        for (I32 i = 0; i < numElements; ++i)
+            vector.push_back(i);
+        benchmark::DoNotOptimize(vector.data());
+
+        I32 sum = 0;
+        for (I32 value : vector)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    ReportAllocations(state, numAllocationsBefore);
+}
+BENCHMARK_TEMPLATE(Temporary, VectorType)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(Temporary, VectorSType)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(Temporary, SmallVectorType)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(Temporary, SmallVectorSType)->Arg(4)->Arg(16)->Arg(64);
+
+
+
+//! @brief Builds short lists for many objects, like the contacts of rigid bodies, and sums them up
+template <typename _vector>
+void ManyLists(benchmark::State& state)
+{
+    SetupMemoryManager();
+    constexpr I32 numLists = 1024;
+    const I32 maxListSize = static_cast<I32>(state.range(0));
+
+    const U64 numAllocationsBefore = numAllocations;
+    for (auto _ : state)
+    {
+        Vector<_vector> lists(numLists);
+        for (I32 i = 0; i < numLists; ++i)
+            for (I32 j = 0; j < (i * 7) % (maxListSize + 1); ++j)
+                lists[static_cast<size_t>(i)].push_back(j);
+
+        I32 sum = 0;
+        for (const auto& list : lists)
+            for (I32 value : list)
+                sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    ReportAllocations(state, numAllocationsBefore);
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numLists);
+}
+BENCHMARK_TEMPLATE(ManyLists, VectorType)->Arg(8)->Arg(16);
+BENCHMARK_TEMPLATE(ManyLists, SmallVectorType)->Arg(8)->Arg(16);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,194 @@
+#include "gdl/base/container/soaVector.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/intrinsics.h"
+#include "gdl/math/simd/vec3fSSE.h"
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+
+using namespace GDL;
+using namespace GDL::simd;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr F32 timeStep = 0.01f;
+constexpr F32 gravity = -9.81f;
+
+//! @brief Column indices of the structure of arrays particles
+enum Column : U32
+{
+    POSITION_X,
+    POSITION_Y,
+    POSITION_Z,
+    VELOCITY_X,
+    VELOCITY_Y,
+    VELOCITY_Z,
+    NUM_COLUMNS
+};
+
+
+
+//! @brief Particle with SSE vectors. Each vector wastes one register lane.
+struct ParticleSSE
+{
+    Vec3fSSE<> mPosition;
+    Vec3fSSE<> mVelocity;
+};
+
+
+
+//! @brief Particle with plain floats
+struct Particle
+{
+    F32 mPosition[3];
+    F32 mVelocity[3];
+};
+
+
+
+//! @brief Creates the initial values of a particle
+//! @param index: Index of the particle
+//! @return Values of the particle
+std::array<F32, NUM_COLUMNS> CreateParticle(U32 index)
+{
+    const F32 value = static_cast<F32>(index % 100);
+    return {{value, 2 * value, 3 * value, 1, 2, 3}};
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Explicit Euler step of particles stored as array of SSE vector structures
+void AoS_Vec3fSSE(benchmark::State& state)
+{
+    const U32 numParticles = static_cast<U32>(state.range(0));
+    Vector<ParticleSSE> particles(numParticles);
+    for (U32 i = 0; i < numParticles; ++i)
+    {
+        const auto values = CreateParticle(i);
+        particles[i].mPosition = Vec3fSSE<>(values[0], values[1], values[2]);
+        particles[i].mVelocity = Vec3fSSE<>(values[3], values[4], values[5]);
+    }
+
+    const Vec3fSSE<> acceleration(0, 0, gravity * timeStep);
+    for (auto _ : state)
+    {
+        for (auto& particle : particles)
+        {
+            particle.mVelocity += acceleration;
+            particle.mPosition += particle.mVelocity * timeStep;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numParticles);
+}
+BENCHMARK(AoS_Vec3fSSE)->Arg(1024)->Arg(1024 * 1024);
+
+
+
+//! @brief Explicit Euler step of particles stored as array of float structures. The compiler is free to vectorize it.
+void AoS_F32(benchmark::State& state)
+{
+    const U32 numParticles = static_cast<U32>(state.range(0));
+    Vector<Particle> particles(numParticles);
+    for (U32 i = 0; i < numParticles; ++i)
+    {
+        const auto values = CreateParticle(i);
+        for (U32 j = 0; j < 3; ++j)
+        {
+            particles[i].mPosition[j] = values[j];
+            particles[i].mVelocity[j] = values[j + 3];
+        }
+    }
+
+    for (auto _ : state)
+    {
+        for (auto& particle : particles)
+        {
+            particle.mVelocity[2] += gravity * timeStep;
+            for (U32 j = 0; j < 3; ++j)
+                particle.mPosition[j] += particle.mVelocity[j] * timeStep;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numParticles);
+}
+BENCHMARK(AoS_F32)->Arg(1024)->Arg(1024 * 1024);
+
+
+
+//! @brief Explicit Euler step of particles stored as structure of arrays
+template <typename _registerType>
+void SoA(benchmark::State& state)
+{
+    const U32 numParticles = static_cast<U32>(state.range(0));
+    SoAVector<_registerType, NUM_COLUMNS> particles;
+    for (U32 i = 0; i < numParticles; ++i)
+        particles.PushBack(CreateParticle(i));
+
+    const _registerType step = _mm_set1<_registerType>(timeStep);
+    const _registerType acceleration = _mm_set1<_registerType>(gravity * timeStep);
+    for (auto _ : state)
+    {
+        for (U32 i = 0; i < particles.GetNumRegisters(); ++i)
+        {
+            const _registerType velocityZ = _mm_add(particles.LoadRegister(i, VELOCITY_Z), acceleration);
+            particles.StoreRegister(i, VELOCITY_Z, velocityZ);
+
+            for (U32 j = 0; j < 3; ++j)
+                particles.StoreRegister(i, POSITION_X + j,
+                                        _mm_fmadd(particles.LoadRegister(i, VELOCITY_X + j), step,
+                                                  particles.LoadRegister(i, POSITION_X + j)));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numParticles);
+}
+BENCHMARK_TEMPLATE(SoA, __m128)->Arg(1024)->Arg(1024 * 1024);
+#ifdef __AVX2__
+BENCHMARK_TEMPLATE(SoA, __m256)->Arg(1024)->Arg(1024 * 1024);
+#endif // __AVX2__
+
+
+
+//! @brief Converts particle positions from an array of SSE vectors to a structure of arrays and back
+void Transpose_AoS_SoA(benchmark::State& state)
+{
+    const U32 numParticles = static_cast<U32>(state.range(0));
+    Vector<Vec3fSSE<>> positions(numParticles);
+    for (U32 i = 0; i < numParticles; ++i)
+    {
+        const auto values = CreateParticle(i);
+        positions[i] = Vec3fSSE<>(values[0], values[1], values[2]);
+    }
+
+    SoAVector<__m128, 3> particles(numParticles);
+    for (auto _ : state)
+    {
+        for (U32 i = 0; i < particles.GetNumRegisters(); ++i)
+        {
+            SoAVector<__m128, 3>::AoSBlock block;
+            for (U32 j = 0; j < block.size(); ++j)
+                block[j] = positions[4 * i + j].DataSSE();
+            particles.StoreAoSBlock(i, block);
+        }
+        for (U32 i = 0; i < particles.GetNumRegisters(); ++i)
+        {
+            const SoAVector<__m128, 3>::AoSBlock block = particles.LoadAoSBlock(i);
+            for (U32 j = 0; j < block.size(); ++j)
+                positions[4 * i + j] = Vec3fSSE<>(block[j]);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numParticles);
+}
+BENCHMARK(Transpose_AoS_SoA)->Arg(1024)->Arg(1024 * 1024);
+
+
+
+BENCHMARK_MAIN();
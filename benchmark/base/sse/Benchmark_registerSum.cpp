@@ -9,7 +9,11 @@
 
 
 #ifndef REGISTER
+#ifdef __AVX2__
 #define REGISTER __m256
+#else
+#define REGISTER __m128
+#endif
 #endif
 
 
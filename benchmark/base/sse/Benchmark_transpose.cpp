@@ -6,7 +6,11 @@
 #include <array>
 
 #ifndef REGISTER
+#ifdef __AVX2__
 #define REGISTER __m256
+#else
+#define REGISTER __m128
+#endif
 #endif
 
 #ifndef ROWS
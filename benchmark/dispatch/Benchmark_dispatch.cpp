@@ -0,0 +1,146 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/instructionSet.h"
+#include "gdl/dispatch/kernels.h"
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <vector>
+
+
+using namespace GDL;
+using namespace GDL::simd;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Selects the instruction set of the dispatched kernels. Returns FALSE and marks the benchmark as skipped if
+//! the CPU doesn't support it.
+template <InstructionSet _instructionSet>
+bool SelectInstructionSet(benchmark::State& state)
+{
+    if (!IsSupported(_instructionSet))
+    {
+        state.SkipWithError("Instruction set not supported by this CPU");
+        return false;
+    }
+    Dispatch::SetInstructionSet(_instructionSet);
+    return true;
+}
+
+
+
+//! @brief Creates a diagonally dominant matrix
+template <typename _type, U32 _size>
+std::array<_type, _size * _size> CreateMatrix()
+{
+    std::array<_type, _size * _size> data;
+    for (U32 i = 0; i < data.size(); ++i)
+        data[i] = static_cast<_type>(static_cast<I32>((i * 7) % 11) - 5);
+    for (U32 i = 0; i < _size; ++i)
+        data[i * _size + i] = static_cast<_type>(6 * _size);
+    return data;
+}
+
+
+
+//! @brief Creates a vector
+template <typename _type, U32 _size>
+std::array<_type, _size> CreateVector()
+{
+    std::array<_type, _size> data;
+    for (U32 i = 0; i < _size; ++i)
+        data[i] = static_cast<_type>(i % 5);
+    return data;
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <InstructionSet _instructionSet, typename _type, U32 _size>
+void Multiply(benchmark::State& state)
+{
+    if (!SelectInstructionSet<_instructionSet>(state))
+        return;
+
+    const auto lhs = CreateMatrix<_type, _size>();
+    const auto rhs = CreateMatrix<_type, _size>();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Dispatch::Multiply<_type, _size>(lhs, rhs));
+}
+BENCHMARK_TEMPLATE(Multiply, InstructionSet::SSE4_2, F32, 16);
+BENCHMARK_TEMPLATE(Multiply, InstructionSet::AVX2, F32, 16);
+BENCHMARK_TEMPLATE(Multiply, InstructionSet::AVX512, F32, 16);
+BENCHMARK_TEMPLATE(Multiply, InstructionSet::SSE4_2, F64, 32);
+BENCHMARK_TEMPLATE(Multiply, InstructionSet::AVX2, F64, 32);
+BENCHMARK_TEMPLATE(Multiply, InstructionSet::AVX512, F64, 32);
+
+
+
+template <InstructionSet _instructionSet, typename _type, U32 _size>
+void Transpose(benchmark::State& state)
+{
+    if (!SelectInstructionSet<_instructionSet>(state))
+        return;
+
+    const auto matrix = CreateMatrix<_type, _size>();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Dispatch::Transpose<_type, _size>(matrix));
+}
+BENCHMARK_TEMPLATE(Transpose, InstructionSet::SSE4_2, F32, 16);
+BENCHMARK_TEMPLATE(Transpose, InstructionSet::AVX2, F32, 16);
+BENCHMARK_TEMPLATE(Transpose, InstructionSet::AVX512, F32, 16);
+BENCHMARK_TEMPLATE(Transpose, InstructionSet::SSE4_2, F64, 32);
+BENCHMARK_TEMPLATE(Transpose, InstructionSet::AVX2, F64, 32);
+BENCHMARK_TEMPLATE(Transpose, InstructionSet::AVX512, F64, 32);
+
+
+
+template <InstructionSet _instructionSet, typename _type, U32 _size>
+void LU(benchmark::State& state)
+{
+    if (!SelectInstructionSet<_instructionSet>(state))
+        return;
+
+    const auto A = CreateMatrix<_type, _size>();
+    const auto r = CreateVector<_type, _size>();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Dispatch::LU<Solver::Pivot::PARTIAL, _type, _size>(A, r));
+}
+BENCHMARK_TEMPLATE(LU, InstructionSet::SSE4_2, F32, 16);
+BENCHMARK_TEMPLATE(LU, InstructionSet::AVX2, F32, 16);
+BENCHMARK_TEMPLATE(LU, InstructionSet::AVX512, F32, 16);
+BENCHMARK_TEMPLATE(LU, InstructionSet::SSE4_2, F64, 32);
+BENCHMARK_TEMPLATE(LU, InstructionSet::AVX2, F64, 32);
+BENCHMARK_TEMPLATE(LU, InstructionSet::AVX512, F64, 32);
+
+
+
+template <InstructionSet _instructionSet>
+void PointInsideSphere(benchmark::State& state)
+{
+    if (!SelectInstructionSet<_instructionSet>(state))
+        return;
+
+    constexpr U32 numPoints = 1024;
+    const std::array<std::array<F32, 3>, 4> sphere = {{{{0, 2, 0}}, {{2, 0, 0}}, {{-2, 0, 0}}, {{0, 0, 2}}}};
+    std::vector<std::array<F32, 3>> points(numPoints);
+    for (U32 i = 0; i < numPoints; ++i)
+        points[i] = {{static_cast<F32>(i % 7) - 3, static_cast<F32>(i % 5) - 2, static_cast<F32>(i % 3) - 1}};
+    std::vector<F32> results(numPoints);
+
+    for (auto _ : state)
+    {
+        Dispatch::PointInsideSphere(sphere, points.data(), numPoints, results.data());
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numPoints);
+}
+BENCHMARK_TEMPLATE(PointInsideSphere, InstructionSet::SSE4_2);
+BENCHMARK_TEMPLATE(PointInsideSphere, InstructionSet::AVX2);
+BENCHMARK_TEMPLATE(PointInsideSphere, InstructionSet::AVX512);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,171 @@
+#include "gdl/math/serial/matSerial.h"
+#include "gdl/math/serial/vecSerial.h"
+#include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/vecSIMD.h"
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+using namespace GDL;
+
+// SETUP %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Compares chained operations that are evaluated eagerly by the operators of the matrix classes with the same
+// operations evaluated lazily by the expression templates. Since the matrix classes provide no matrix-vector product,
+// the eager versions use single column matrices as vectors.
+
+using Type = F32;
+
+//#define DISABLE_BENCHMARK_SUM
+//#define DISABLE_BENCHMARK_MATRIX_VECTOR
+//#define DISABLE_BENCHMARK_MATRIX_MATRIX
+
+
+
+// Fixture declaration %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <template <typename, U32, U32> class _matrix, template <typename, U32, bool> class _vector, U32 _size>
+class Fixture
+{
+    template <U32 _numValues>
+    static std::array<Type, _numValues> CreateValues(U32 seed)
+    {
+        std::array<Type, _numValues> values;
+        for (U32 i = 0; i < _numValues; ++i)
+            values[i] = static_cast<Type>((i * 7 + seed * 3) % 11);
+        return values;
+    }
+
+public:
+    _matrix<Type, _size, _size> A = _matrix<Type, _size, _size>(CreateValues<_size * _size>(1));
+    _matrix<Type, _size, _size> B = _matrix<Type, _size, _size>(CreateValues<_size * _size>(2));
+    _matrix<Type, _size, _size> C = _matrix<Type, _size, _size>(CreateValues<_size * _size>(3));
+    _matrix<Type, _size, _size> D = _matrix<Type, _size, _size>(CreateValues<_size * _size>(4));
+    _matrix<Type, _size, 1> xMat = _matrix<Type, _size, 1>(CreateValues<_size>(5));
+    _matrix<Type, _size, 1> bMat = _matrix<Type, _size, 1>(CreateValues<_size>(6));
+    _vector<Type, _size, true> x = _vector<Type, _size, true>(CreateValues<_size>(5));
+    _vector<Type, _size, true> b = _vector<Type, _size, true>(CreateValues<_size>(6));
+};
+
+template <U32 _size>
+using SIMD = Fixture<MatSIMD, VecSIMD, _size>;
+
+template <U32 _size>
+using Serial = Fixture<MatSerial, VecSerial, _size>;
+
+
+
+// Sum %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef DISABLE_BENCHMARK_SUM
+
+template <template <U32> class _fixture, U32 _size>
+static void SumEager(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(f.A + f.B + f.C + f.D);
+}
+
+template <template <U32> class _fixture, U32 _size>
+static void SumLazy(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(decltype(f.A)(Lazy(f.A) + f.B + f.C + f.D));
+}
+
+BENCHMARK_TEMPLATE(SumEager, SIMD, 4);
+BENCHMARK_TEMPLATE(SumLazy, SIMD, 4);
+BENCHMARK_TEMPLATE(SumEager, SIMD, 16);
+BENCHMARK_TEMPLATE(SumLazy, SIMD, 16);
+BENCHMARK_TEMPLATE(SumEager, SIMD, 64);
+BENCHMARK_TEMPLATE(SumLazy, SIMD, 64);
+BENCHMARK_TEMPLATE(SumEager, Serial, 4);
+BENCHMARK_TEMPLATE(SumLazy, Serial, 4);
+BENCHMARK_TEMPLATE(SumEager, Serial, 16);
+BENCHMARK_TEMPLATE(SumLazy, Serial, 16);
+BENCHMARK_TEMPLATE(SumEager, Serial, 64);
+BENCHMARK_TEMPLATE(SumLazy, Serial, 64);
+
+#endif // DISABLE_BENCHMARK_SUM
+
+
+
+// Matrix - vector %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef DISABLE_BENCHMARK_MATRIX_VECTOR
+
+template <template <U32> class _fixture, U32 _size>
+static void MatrixVectorEager(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(f.A * f.xMat + f.bMat);
+}
+
+template <template <U32> class _fixture, U32 _size>
+static void MatrixVectorLazy(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(decltype(f.x)(Lazy(f.A) * f.x + f.b));
+}
+
+BENCHMARK_TEMPLATE(MatrixVectorEager, SIMD, 4);
+BENCHMARK_TEMPLATE(MatrixVectorLazy, SIMD, 4);
+BENCHMARK_TEMPLATE(MatrixVectorEager, SIMD, 16);
+BENCHMARK_TEMPLATE(MatrixVectorLazy, SIMD, 16);
+BENCHMARK_TEMPLATE(MatrixVectorEager, SIMD, 64);
+BENCHMARK_TEMPLATE(MatrixVectorLazy, SIMD, 64);
+BENCHMARK_TEMPLATE(MatrixVectorEager, Serial, 4);
+BENCHMARK_TEMPLATE(MatrixVectorLazy, Serial, 4);
+BENCHMARK_TEMPLATE(MatrixVectorEager, Serial, 16);
+BENCHMARK_TEMPLATE(MatrixVectorLazy, Serial, 16);
+BENCHMARK_TEMPLATE(MatrixVectorEager, Serial, 64);
+BENCHMARK_TEMPLATE(MatrixVectorLazy, Serial, 64);
+
+#endif // DISABLE_BENCHMARK_MATRIX_VECTOR
+
+
+
+// Matrix - matrix %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef DISABLE_BENCHMARK_MATRIX_MATRIX
+
+template <template <U32> class _fixture, U32 _size>
+static void MatrixMatrixEager(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(f.A * f.B + f.C);
+}
+
+template <template <U32> class _fixture, U32 _size>
+static void MatrixMatrixLazy(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(decltype(f.A)(Lazy(f.A) * f.B + f.C));
+}
+
+BENCHMARK_TEMPLATE(MatrixMatrixEager, SIMD, 4);
+BENCHMARK_TEMPLATE(MatrixMatrixLazy, SIMD, 4);
+BENCHMARK_TEMPLATE(MatrixMatrixEager, SIMD, 16);
+BENCHMARK_TEMPLATE(MatrixMatrixLazy, SIMD, 16);
+BENCHMARK_TEMPLATE(MatrixMatrixEager, SIMD, 64);
+BENCHMARK_TEMPLATE(MatrixMatrixLazy, SIMD, 64);
+BENCHMARK_TEMPLATE(MatrixMatrixEager, Serial, 4);
+BENCHMARK_TEMPLATE(MatrixMatrixLazy, Serial, 4);
+BENCHMARK_TEMPLATE(MatrixMatrixEager, Serial, 16);
+BENCHMARK_TEMPLATE(MatrixMatrixLazy, Serial, 16);
+BENCHMARK_TEMPLATE(MatrixMatrixEager, Serial, 64);
+BENCHMARK_TEMPLATE(MatrixMatrixLazy, Serial, 64);
+
+#endif // DISABLE_BENCHMARK_MATRIX_MATRIX
+
+
+
+// Main %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+BENCHMARK_MAIN();
@@ -1,7 +1,11 @@
+#include "gdl/math/gemm/gemm.h"
 #include "gdl/math/simd/matSIMD.h"
 #include "gdl/math/serial/matSerial.h"
 #include <benchmark/benchmark.h>
 
+#include <memory>
+#include <vector>
+
 #ifdef EIGEN3_FOUND
 #include <eigen3/Eigen/Core>
 #endif
@@ -21,6 +25,7 @@ constexpr U32 M = N - 1;
 //#define DISABLE_BENCHMARK_ADDITION
 //#define DISABLE_BENCHMARK_MULTIPLICATION
 //#define DISABLE_BENCHMARK_EXPRESSION
+//#define DISABLE_BENCHMARK_GEMM
 
 
 
@@ -371,6 +376,67 @@ BENCHMARK_F(Eigen3, Expression)(benchmark::State& state)
 #endif // DISABLE_BENCHMARK_EXPRESSION
 
 
+// GEMM %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+#ifndef DISABLE_BENCHMARK_GEMM
+
+//! @brief Adds the achieved floating point operations per second of a square matrix multiplication to the results
+void ReportFLOPS(benchmark::State& state, U32 size)
+{
+    state.counters["FLOPS"] = benchmark::Counter(2. * size * size * size,
+                                                 benchmark::Counter::kIsIterationInvariantRate,
+                                                 benchmark::Counter::kIs1000);
+}
+
+
+
+template <template <typename, U32, U32> class _matrix, U32 _size>
+void MatrixMultiplication(benchmark::State& state)
+{
+    std::array<Type, _size * _size> values;
+    for (U32 i = 0; i < _size * _size; ++i)
+        values[i] = static_cast<Type>(i % 7);
+
+    // Large matrices don't fit on the stack
+    const auto A = std::make_unique<_matrix<Type, _size, _size>>(values);
+    const auto C = std::make_unique<_matrix<Type, _size, _size>>();
+    for (auto _ : state)
+    {
+        *C = *A * *A;
+        benchmark::DoNotOptimize(C.get());
+    }
+    ReportFLOPS(state, _size);
+}
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSerial, 16);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSerial, 64);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSerial, 128);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSerial, 256);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSIMD, 16);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSIMD, 32);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSIMD, 64);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSIMD, 96);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSIMD, 128);
+BENCHMARK_TEMPLATE(MatrixMultiplication, MatSIMD, 256);
+
+
+
+void GEMM(benchmark::State& state)
+{
+    const U32 size = static_cast<U32>(state.range(0));
+    const std::vector<Type> A(size * size, 1);
+    std::vector<Type> C(size * size, 0);
+    for (auto _ : state)
+    {
+        GDL::GEMM<Type>(size, size, size, A.data(), size, A.data(), size, C.data(), size);
+        benchmark::DoNotOptimize(C.data());
+    }
+    ReportFLOPS(state, size);
+}
+BENCHMARK(GEMM)->Arg(16)->Arg(32)->Arg(64)->Arg(96)->Arg(128)->Arg(256)->Arg(512)->Arg(1024);
+
+#endif // DISABLE_BENCHMARK_GEMM
+
+
+
 // Main %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 BENCHMARK_MAIN();
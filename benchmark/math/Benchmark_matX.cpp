@@ -0,0 +1,166 @@
+#include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/matX.h"
+#include "gdl/math/simd/vecSIMD.h"
+#include "gdl/math/simd/vecX.h"
+#include "gdl/math/solver/gauss.h"
+#include "gdl/math/solver/lu.h"
+#include "gdl/math/solver/qr.h"
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+using namespace GDL;
+using namespace GDL::Solver;
+
+// SETUP %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Compares the statically sized types with the runtime sized ones to show the overhead of the runtime loop boundaries.
+
+using Type = F32;
+
+//#define DISABLE_BENCHMARK_MULTIPLICATION
+//#define DISABLE_BENCHMARK_LU
+//#define DISABLE_BENCHMARK_GAUSS
+//#define DISABLE_BENCHMARK_QR
+
+
+
+// Fixture declaration %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+template <U32 _size>
+class Data
+{
+public:
+    std::array<Type, _size * _size> matValues;
+    std::array<Type, _size> vecValues;
+
+    Data()
+    {
+        for (U32 i = 0; i < _size; ++i)
+        {
+            vecValues[i] = static_cast<Type>(i % 5 + 1);
+            for (U32 j = 0; j < _size; ++j)
+                matValues[j * _size + i] = static_cast<Type>((i * 7 + j * 3) % 11) + ((i == j) ? _size * 10 : 0);
+        }
+    }
+};
+
+
+
+template <U32 _size>
+class Static : public Data<_size>
+{
+public:
+    MatSIMD<Type, _size, _size> A = MatSIMD<Type, _size, _size>(this->matValues);
+    MatSIMD<Type, _size, _size> B = MatSIMD<Type, _size, _size>(this->matValues);
+    VecSIMD<Type, _size, true> b = VecSIMD<Type, _size, true>(this->vecValues);
+};
+
+
+
+template <U32 _size>
+class Dynamic : public Data<_size>
+{
+public:
+    MatX<Type> A = MatX<Type>(_size, _size, this->matValues.data());
+    MatX<Type> B = MatX<Type>(_size, _size, this->matValues.data());
+    VecX<Type> b = VecX<Type>(_size, this->vecValues.data());
+};
+
+
+
+// Multiplication %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef DISABLE_BENCHMARK_MULTIPLICATION
+
+template <template <U32> class _fixture, U32 _size>
+static void Multiplication(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(f.A * f.B);
+}
+
+BENCHMARK_TEMPLATE(Multiplication, Static, 4);
+BENCHMARK_TEMPLATE(Multiplication, Dynamic, 4);
+BENCHMARK_TEMPLATE(Multiplication, Static, 16);
+BENCHMARK_TEMPLATE(Multiplication, Dynamic, 16);
+BENCHMARK_TEMPLATE(Multiplication, Static, 64);
+BENCHMARK_TEMPLATE(Multiplication, Dynamic, 64);
+
+#endif // DISABLE_BENCHMARK_MULTIPLICATION
+
+
+
+// LU %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef DISABLE_BENCHMARK_LU
+
+template <template <U32> class _fixture, U32 _size>
+static void LUPartialPivot(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(LU<Pivot::PARTIAL>(f.A, f.b));
+}
+
+BENCHMARK_TEMPLATE(LUPartialPivot, Static, 4);
+BENCHMARK_TEMPLATE(LUPartialPivot, Dynamic, 4);
+BENCHMARK_TEMPLATE(LUPartialPivot, Static, 16);
+BENCHMARK_TEMPLATE(LUPartialPivot, Dynamic, 16);
+BENCHMARK_TEMPLATE(LUPartialPivot, Static, 64);
+BENCHMARK_TEMPLATE(LUPartialPivot, Dynamic, 64);
+
+#endif // DISABLE_BENCHMARK_LU
+
+
+
+// Gauss %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef DISABLE_BENCHMARK_GAUSS
+
+template <template <U32> class _fixture, U32 _size>
+static void GaussPartialPivot(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Gauss<Pivot::PARTIAL>(f.A, f.b));
+}
+
+BENCHMARK_TEMPLATE(GaussPartialPivot, Static, 4);
+BENCHMARK_TEMPLATE(GaussPartialPivot, Dynamic, 4);
+BENCHMARK_TEMPLATE(GaussPartialPivot, Static, 16);
+BENCHMARK_TEMPLATE(GaussPartialPivot, Dynamic, 16);
+BENCHMARK_TEMPLATE(GaussPartialPivot, Static, 64);
+BENCHMARK_TEMPLATE(GaussPartialPivot, Dynamic, 64);
+
+#endif // DISABLE_BENCHMARK_GAUSS
+
+
+
+// QR %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+#ifndef DISABLE_BENCHMARK_QR
+
+template <template <U32> class _fixture, U32 _size>
+static void QRPartialPivot(benchmark::State& state)
+{
+    _fixture<_size> f;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(QR<Pivot::PARTIAL>(f.A, f.b));
+}
+
+BENCHMARK_TEMPLATE(QRPartialPivot, Static, 4);
+BENCHMARK_TEMPLATE(QRPartialPivot, Dynamic, 4);
+BENCHMARK_TEMPLATE(QRPartialPivot, Static, 16);
+BENCHMARK_TEMPLATE(QRPartialPivot, Dynamic, 16);
+BENCHMARK_TEMPLATE(QRPartialPivot, Static, 64);
+BENCHMARK_TEMPLATE(QRPartialPivot, Dynamic, 64);
+
+#endif // DISABLE_BENCHMARK_QR
+
+
+
+// Main %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+BENCHMARK_MAIN();
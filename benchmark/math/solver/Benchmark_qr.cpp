@@ -32,9 +32,6 @@
 // Run benchmark ------------------------------------------------------------------------------------------------------
 
 
-#define DISABLE_BENCHMARK_SIMD // REMOVE IF SIMD VERSION IS IMPLEMENTED !!!!!!!!!!!!!!!!!!!!!!!!!
-
-
 #define SOLVER_NAME QR
 #include "gdl/math/solver/qr.h"
 
@@ -15,7 +15,10 @@ using namespace GDL::Solver;
 #define BENCHMARK_N 64
 #endif // BENCHMARK_N
 
-#ifdef __AVX2__
+#if defined(__AVX512F__)
+#define SIMD_F32 AVX512_F32
+#define SIMD_F64 AVX512_F64
+#elif defined(__AVX2__)
 #define SIMD_F32 AVX_F32
 #define SIMD_F64 AVX_F64
 #else
@@ -2,14 +2,20 @@
 #include "gdl/base/time.h"
 #include "gdl/base/timer.h"
 #include "gdl/resources/memory/memoryManager.h"
+#include "gdl/resources/memory/memoryPool.h"
 #include "gdl/resources/memory/generalPurposeAllocator.h"
 #include "gdl/resources/memory/stackAllocator.h"
 #include "gdl/resources/memory/poolAllocator.h"
 #include "gdl/resources/memory/threadPrivateStackAllocator.h"
 
 
+#include <array>
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <thread>
+#include <vector>
 
 using namespace GDL;
 using namespace std::chrono_literals;
@@ -212,6 +218,88 @@ void RunAllocationBenchmarks3()
     PrintAndResetResults(sizeof(_type), allocatorResults);
 }
 
+// Multi-threaded churn -------------------------------------------------------------------------------------------
+
+//! @brief Each thread repeatedly allocates a batch of memory blocks and frees them in a different order. Returns the
+//! average wall time per allocation and deallocation pair.
+//! @tparam _allocate: Type of the allocation function
+//! @tparam _deallocate: Type of the deallocation function
+//! @param numThreads: Number of threads
+//! @param allocate: Allocation function with signature void*()
+//! @param deallocate: Deallocation function with signature void(void*)
+//! @return Average time per allocation and deallocation pair
+template <typename _allocate, typename _deallocate>
+F64 ChurnBenchmark(U32 numThreads, _allocate allocate, _deallocate deallocate)
+{
+    constexpr U32 numRuns = 2000;
+    constexpr U32 batchSize = 64;
+
+    std::atomic<U32> numReadyThreads = 0;
+    std::atomic_bool kickoff = false;
+    std::vector<std::thread> threads;
+    for (U32 i = 0; i < numThreads; ++i)
+        threads.emplace_back([&]() {
+            std::array<void*, batchSize> addresses;
+            ++numReadyThreads;
+            while (!kickoff)
+                std::this_thread::yield();
+
+            for (U32 run = 0; run < numRuns; ++run)
+            {
+                for (auto& address : addresses)
+                    address = allocate();
+                for (U32 j = 0; j < batchSize; ++j)
+                    deallocate(addresses[(j * 7 + run) % batchSize]);
+            }
+        });
+
+    while (numReadyThreads != numThreads)
+        std::this_thread::yield();
+
+    Timer timer;
+    kickoff = true;
+    for (auto& thread : threads)
+        thread.join();
+    Nanoseconds time = timer.GetElapsedTime<Nanoseconds>();
+
+    return static_cast<F64>(time.count()) / static_cast<F64>(numThreads * numRuns * batchSize);
+}
+
+
+
+//! @brief Compares a plain memory pool, a memory pool with thread caches and malloc under multi-threaded churn
+void RunChurnBenchmarks()
+{
+    constexpr MemorySize elementSize = 64_B;
+    constexpr U32 maxNumThreads = 8;
+    constexpr U32 numElements = maxNumThreads * 64 * 2;
+
+    MemoryPool plainPool(elementSize, numElements, 64);
+    MemoryPool magazinePool(elementSize, numElements, 64, 64);
+    plainPool.Initialize();
+    magazinePool.Initialize();
+
+    std::cout << "Multi-threaded churn - allocation size: " << elementSize.GetNumBytes() << " Bytes" << std::endl;
+    std::cout << "Threads | Pool [ns] | Magazine pool [ns] | malloc [ns]" << std::endl;
+    for (U32 numThreads = 1; numThreads <= maxNumThreads; numThreads *= 2)
+    {
+        F64 plain = ChurnBenchmark(numThreads, [&]() { return plainPool.Allocate(elementSize.GetNumBytes()); },
+                                   [&](void* address) { plainPool.Deallocate(address); });
+        F64 magazine = ChurnBenchmark(numThreads, [&]() { return magazinePool.Allocate(elementSize.GetNumBytes()); },
+                                      [&](void* address) { magazinePool.Deallocate(address); });
+        F64 malloc = ChurnBenchmark(numThreads, [&]() { return std::malloc(elementSize.GetNumBytes()); },
+                                    [](void* address) { std::free(address); });
+
+        std::cout << numThreads << " | " << plain << " | " << magazine << " | " << malloc << std::endl;
+    }
+    std::cout << std::endl;
+
+    plainPool.Deinitialize();
+    magazinePool.Deinitialize();
+}
+
+
+
 int main()
 {
     constexpr U32 maxNumAllocations = 10000;
@@ -249,6 +337,8 @@ int main()
     //    RunAllocationBenchmarks3<std::array<F32, 64>, 10000>();
     //    RunAllocationBenchmarks3<std::array<F32, 128>, 10000>();
 
+    RunChurnBenchmarks();
+
     mm.DeletePrivateMemoryStackForThisThread();
     mm.Deinitialize();
 }
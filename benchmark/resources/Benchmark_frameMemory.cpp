@@ -0,0 +1,215 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/frameMemory.h"
+#include "gdl/resources/memory/sizeClassMemory.h"
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr U32 numAllocationsPerThread = 2000;
+constexpr size_t memorySize = 32 * 1024 * 1024;
+constexpr size_t alignment = 16;
+
+
+
+//! @brief Pregenerated allocation sizes of a thread during a single frame. They resemble transient per-frame data like
+//! command list entries, culling results and temporary matrices.
+const std::vector<U32>& GetAllocationSizes()
+{
+    static const std::vector<U32> sizes = []() {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<F64> logSizeDistribution(std::log(16.), std::log(512.));
+
+        std::vector<U32> newSizes;
+        for (U32 i = 0; i < numAllocationsPerThread; ++i)
+            newSizes.push_back(static_cast<U32>(std::exp(logSizeDistribution(generator))));
+        return newSizes;
+    }();
+    return sizes;
+}
+
+
+
+//! @brief Adds the number of threads to a benchmark
+void ThreadArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (I64 numThreads : {1, 2, 4, 8})
+        benchmark->Arg(numThreads);
+    benchmark->ArgName("threads");
+    benchmark->UseRealTime();
+}
+
+
+
+//! @brief Memory system wrapper for the frame memory. Memory is released in bulk at the end of the frame.
+struct Frame
+{
+    static constexpr bool FreeEachAllocation = false;
+
+    FrameMemory mMemory{memorySize * 1_B, 2};
+
+    Frame()
+    {
+        mMemory.Initialize();
+    }
+
+    ~Frame()
+    {
+        mMemory.Deinitialize();
+    }
+
+    void* Allocate(size_t size)
+    {
+        return mMemory.Allocate(size, alignment);
+    }
+
+    void Deallocate(void*)
+    {
+    }
+
+    void EndFrame()
+    {
+        mMemory.NextFrame();
+    }
+};
+
+
+
+//! @brief Memory system wrapper for the size class memory. Each allocation is freed separately.
+struct SizeClass
+{
+    static constexpr bool FreeEachAllocation = true;
+
+    SizeClassMemory mMemory{memorySize * 1_B};
+
+    SizeClass()
+    {
+        mMemory.Initialize();
+    }
+
+    ~SizeClass()
+    {
+        mMemory.Deinitialize();
+    }
+
+    void* Allocate(size_t size)
+    {
+        return mMemory.Allocate(size, alignment);
+    }
+
+    void Deallocate(void* address)
+    {
+        mMemory.Deallocate(address, alignment);
+    }
+
+    void EndFrame()
+    {
+    }
+};
+
+
+
+//! @brief Memory system wrapper for malloc and free. Each allocation is freed separately.
+struct Malloc
+{
+    static constexpr bool FreeEachAllocation = true;
+
+    void* Allocate(size_t size)
+    {
+        return std::malloc(size);
+    }
+
+    void Deallocate(void* address)
+    {
+        std::free(address);
+    }
+
+    void EndFrame()
+    {
+    }
+};
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Each benchmark iteration is a frame. All worker threads allocate their transient data concurrently and touch
+//! it. The data of the previous frame is freed at the start of the next one, if the memory system needs single frees.
+//! The main thread waits for all workers and ends the frame.
+template <typename _memory>
+void Frames(benchmark::State& state)
+{
+    const U32 numThreads = static_cast<U32>(state.range(0));
+    const std::vector<U32>& sizes = GetAllocationSizes();
+
+    _memory memory;
+    std::atomic<U32> frame = 0;
+    std::atomic<U32> numFinished = 0;
+    std::atomic_bool close = false;
+
+    std::vector<std::thread> threads;
+    for (U32 i = 0; i < numThreads; ++i)
+        threads.emplace_back([&]() {
+            std::vector<void*> addresses;
+            addresses.reserve(numAllocationsPerThread);
+            U32 lastFrame = 0;
+
+            while (true)
+            {
+                while (frame == lastFrame && !close)
+                    std::this_thread::yield();
+                if (close)
+                    break;
+                ++lastFrame;
+
+                if constexpr (_memory::FreeEachAllocation)
+                    for (void* address : addresses)
+                        memory.Deallocate(address);
+                addresses.clear();
+
+                for (U32 size : sizes)
+                {
+                    addresses.push_back(memory.Allocate(size));
+                    *static_cast<U8*>(addresses.back()) = 1;
+                }
+                ++numFinished;
+            }
+
+            if constexpr (_memory::FreeEachAllocation)
+                for (void* address : addresses)
+                    memory.Deallocate(address);
+        });
+
+    for (auto _ : state)
+    {
+        numFinished = 0;
+        ++frame;
+        while (numFinished != numThreads)
+            std::this_thread::yield();
+        memory.EndFrame();
+    }
+
+    close = true;
+    for (auto& thread : threads)
+        thread.join();
+
+    state.SetItemsProcessed(state.iterations() * numThreads * numAllocationsPerThread);
+}
+BENCHMARK_TEMPLATE(Frames, Frame)->Apply(ThreadArguments);
+BENCHMARK_TEMPLATE(Frames, SizeClass)->Apply(ThreadArguments);
+BENCHMARK_TEMPLATE(Frames, Malloc)->Apply(ThreadArguments);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,262 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/generalPurposeMemory.h"
+#include "gdl/resources/memory/sizeClassMemory.h"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr size_t memorySize = 128 * 1024 * 1024;
+constexpr size_t alignment = 16;
+constexpr U32 numLiveAllocations = 10000;
+constexpr U32 numChurnOperations = 100000;
+
+
+
+//! @brief Pregenerated allocation sizes and deallocation order, so that all memory systems process the same workload
+struct Workload
+{
+    std::vector<U32> mInitialSizes;
+    std::vector<U32> mSizes;
+    std::vector<U32> mIndices;
+};
+
+
+
+//! @brief Creates a workload with a size distribution that resembles typical applications: Many small objects (nodes,
+//! strings, small vectors), fewer medium sized buffers and rare large ones. Sizes are log-uniformly distributed within
+//! each bucket.
+//! @return Workload
+const Workload& GetWorkload()
+{
+    static const Workload workload = []() {
+        struct Bucket
+        {
+            F64 mProbability;
+            F64 mMinSize;
+            F64 mMaxSize;
+        };
+        constexpr std::array<Bucket, 4> buckets{{{0.60, 8, 64}, {0.25, 64, 256}, {0.12, 256, 4096},
+                                                 {0.03, 4096, 65536}}};
+
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<F64> uniform(0., 1.);
+        std::uniform_int_distribution<U32> indexDistribution(0, numLiveAllocations - 1);
+
+        auto randomSize = [&]() {
+            F64 bucketValue = uniform(generator);
+            for (const Bucket& bucket : buckets)
+            {
+                if (bucketValue < bucket.mProbability)
+                {
+                    F64 logSize = std::log(bucket.mMinSize) +
+                                  uniform(generator) * (std::log(bucket.mMaxSize) - std::log(bucket.mMinSize));
+                    return static_cast<U32>(std::exp(logSize));
+                }
+                bucketValue -= bucket.mProbability;
+            }
+            return static_cast<U32>(buckets.back().mMaxSize);
+        };
+
+        Workload newWorkload;
+        for (U32 i = 0; i < numLiveAllocations; ++i)
+            newWorkload.mInitialSizes.push_back(randomSize());
+        for (U32 i = 0; i < numChurnOperations; ++i)
+        {
+            newWorkload.mSizes.push_back(randomSize());
+            newWorkload.mIndices.push_back(indexDistribution(generator));
+        }
+        return newWorkload;
+    }();
+    return workload;
+}
+
+
+
+//! @brief Memory system wrapper for the first fit general purpose memory
+struct FirstFit
+{
+    GeneralPurposeMemory mMemory{memorySize * 1_B};
+
+    void Initialize()
+    {
+        mMemory.Initialize();
+    }
+
+    void Deinitialize()
+    {
+        mMemory.Deinitialize();
+    }
+
+    void* Allocate(size_t size)
+    {
+        return mMemory.Allocate(size, alignment);
+    }
+
+    void Deallocate(void* address)
+    {
+        mMemory.Deallocate(address, alignment);
+    }
+
+    void AddFragmentationCounters(benchmark::State& state)
+    {
+        state.counters["free_blocks"] = mMemory.CountFreeMemoryBlocks();
+    }
+};
+
+
+
+//! @brief Memory system wrapper for the size class memory
+struct SizeClass
+{
+    SizeClassMemory mMemory{memorySize * 1_B};
+
+    void Initialize()
+    {
+        mMemory.Initialize();
+    }
+
+    void Deinitialize()
+    {
+        mMemory.Deinitialize();
+    }
+
+    void* Allocate(size_t size)
+    {
+        return mMemory.Allocate(size, alignment);
+    }
+
+    void Deallocate(void* address)
+    {
+        mMemory.Deallocate(address, alignment);
+    }
+
+    void AddFragmentationCounters(benchmark::State& state)
+    {
+        state.counters["free_blocks"] = mMemory.CountFreeMemoryBlocks();
+        state.counters["fragmentation"] = 1. - static_cast<F64>(mMemory.GetLargestFreeMemoryBlockSize()) /
+                                                       static_cast<F64>(mMemory.GetFreeMemorySize());
+    }
+};
+
+
+
+//! @brief Memory system wrapper for malloc and free
+struct Malloc
+{
+    void Initialize()
+    {
+    }
+
+    void Deinitialize()
+    {
+    }
+
+    void* Allocate(size_t size)
+    {
+        return std::malloc(size);
+    }
+
+    void Deallocate(void* address)
+    {
+        std::free(address);
+    }
+
+    void AddFragmentationCounters(benchmark::State&)
+    {
+    }
+};
+
+
+
+//! @brief Adds the 50th, 99th and 99.9th percentile of the passed latencies to the benchmark counters
+//! @param state: Benchmark state
+//! @param name: Name prefix of the counters
+//! @param latencies: Latencies in nanoseconds. The order is modified.
+void AddPercentileCounters(benchmark::State& state, const std::string& name, std::vector<U32>& latencies)
+{
+    for (auto [percentile, suffix] : {std::pair{0.5, "_p50_ns"}, {0.99, "_p99_ns"}, {0.999, "_p999_ns"}})
+    {
+        auto position = latencies.begin() + static_cast<std::ptrdiff_t>(percentile * (latencies.size() - 1));
+        std::nth_element(latencies.begin(), position, latencies.end());
+        state.counters[name + suffix] = *position;
+    }
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Fills the memory with a live set of allocations and replaces random allocations afterwards. The latency of
+//! each single allocation and deallocation is measured and the percentiles are reported as counters. The replacement
+//! of random allocations fragments the memory over time. The fragmentation counters are taken at the end of the run.
+//! @remark The latencies contain the overhead of reading the clock twice.
+template <typename _memory>
+void Churn(benchmark::State& state)
+{
+    using Clock = std::chrono::steady_clock;
+
+    const Workload& workload = GetWorkload();
+    std::vector<U32> allocationLatencies;
+    std::vector<U32> deallocationLatencies;
+    std::vector<void*> addresses(numLiveAllocations, nullptr);
+
+    auto measure = [](auto&& function) {
+        Clock::time_point start = Clock::now();
+        function();
+        return static_cast<U32>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    };
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        _memory memory;
+        memory.Initialize();
+        allocationLatencies.clear();
+        deallocationLatencies.clear();
+        for (U32 i = 0; i < numLiveAllocations; ++i)
+            addresses[i] = memory.Allocate(workload.mInitialSizes[i]);
+        state.ResumeTiming();
+
+        for (U32 i = 0; i < numChurnOperations; ++i)
+        {
+            void*& address = addresses[workload.mIndices[i]];
+            const size_t size = workload.mSizes[i];
+
+            deallocationLatencies.push_back(measure([&]() { memory.Deallocate(address); }));
+            allocationLatencies.push_back(measure([&]() { address = memory.Allocate(size); }));
+            benchmark::DoNotOptimize(address);
+        }
+
+        state.PauseTiming();
+        memory.AddFragmentationCounters(state);
+        for (void* address : addresses)
+            memory.Deallocate(address);
+        memory.Deinitialize();
+        state.ResumeTiming();
+    }
+
+    AddPercentileCounters(state, "alloc", allocationLatencies);
+    AddPercentileCounters(state, "free", deallocationLatencies);
+    state.SetItemsProcessed(state.iterations() * numChurnOperations * 2);
+}
+BENCHMARK_TEMPLATE(Churn, FirstFit)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Churn, SizeClass)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Churn, Malloc)->Unit(benchmark::kMillisecond);
+
+
+
+BENCHMARK_MAIN();
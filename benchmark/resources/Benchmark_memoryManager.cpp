@@ -0,0 +1,121 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/memoryManager.h"
+#include "gdl/resources/memory/memoryPool.h"
+#include "gdl/resources/memory/threadPrivateStackAllocator.h"
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Sets up and initializes the memory manager once. It is called by every benchmark thread.
+void SetupMemoryManager()
+{
+    static const bool initialized = []() {
+        MemoryManager& memoryManager = MemoryManager::Instance();
+        memoryManager.CreateGeneralPurposeMemory(16_MB);
+        memoryManager.CreateMemoryStack(16_MB);
+        for (size_t elementSize : {8, 16, 32, 64, 128, 256})
+            memoryManager.CreateMemoryPool(elementSize * 1_B, 1024);
+        memoryManager.EnableThreadPrivateMemory();
+        memoryManager.Initialize();
+        return true;
+    }();
+    benchmark::DoNotOptimize(initialized);
+}
+
+
+
+//! @brief Adds thread counts from 1 to 8 to a benchmark
+void ThreadArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ThreadRange(1, 8);
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Measures the lookup of the calling threads private memory stack
+void GetThreadPrivateMemoryStack(benchmark::State& state)
+{
+    SetupMemoryManager();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    memoryManager.CreatePrivateMemoryStackForThisThread(1_MB);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(memoryManager.GetThreadPrivateMemoryStack());
+
+    memoryManager.DeletePrivateMemoryStackForThisThread();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(GetThreadPrivateMemoryStack)->Apply(ThreadArguments);
+
+
+
+//! @brief Measures the lookup of memory pools for varying element sizes and alignments
+void GetMemoryPool(benchmark::State& state)
+{
+    SetupMemoryManager();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    std::vector<std::pair<size_t, size_t>> requests;
+    for (size_t elementSize = 1; elementSize <= 256; elementSize += 7)
+        requests.emplace_back(elementSize, size_t(1) << (elementSize % 5));
+
+    for (auto _ : state)
+        for (const auto& [elementSize, alignment] : requests)
+            benchmark::DoNotOptimize(memoryManager.GetMemoryPool(elementSize, alignment));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<I64>(requests.size()));
+}
+BENCHMARK(GetMemoryPool)->Apply(ThreadArguments);
+
+
+
+//! @brief Measures the construction of thread private stack allocators, which happens for every STL container that
+//! uses them
+void ConstructThreadPrivateStackAllocator(benchmark::State& state)
+{
+    SetupMemoryManager();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    memoryManager.CreatePrivateMemoryStackForThisThread(1_MB);
+
+    for (auto _ : state)
+    {
+        ThreadPrivateStackAllocator<F32> allocator;
+        benchmark::DoNotOptimize(allocator);
+    }
+
+    memoryManager.DeletePrivateMemoryStackForThisThread();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ConstructThreadPrivateStackAllocator)->Apply(ThreadArguments);
+
+
+
+//! @brief Measures a short lived container with a thread private stack allocator, including the allocator construction
+void ThreadPrivateStackVector(benchmark::State& state)
+{
+    SetupMemoryManager();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    memoryManager.CreatePrivateMemoryStackForThisThread(1_MB);
+
+    for (auto _ : state)
+    {
+        std::vector<F32, ThreadPrivateStackAllocator<F32>> vector(16);
+        benchmark::DoNotOptimize(vector.data());
+    }
+
+    memoryManager.DeletePrivateMemoryStackForThisThread();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(ThreadPrivateStackVector)->Apply(ThreadArguments);
+
+
+
+BENCHMARK_MAIN();
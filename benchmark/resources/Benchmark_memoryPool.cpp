@@ -0,0 +1,88 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/memoryPool.h"
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+#include <vector>
+
+#include <unistd.h>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr size_t elementSize = 64;
+constexpr U32 numElements = 16 * 1024 * 1024;
+constexpr U32 numAccessesPerIteration = 1024 * 1024;
+constexpr F64 bytesPerMB = 1024. * 1024.;
+
+
+
+//! @brief Gets the resident set size of the process
+//! @return Resident set size in bytes
+size_t GetResidentSetSize()
+{
+    size_t numPages = 0;
+    size_t numResidentPages = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> numPages >> numResidentPages;
+    return numResidentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+
+
+//! @brief Simple xorshift generator, so that the random number generation doesn't dominate the memory accesses
+//! @param state: State of the generator
+//! @return Random number
+inline U64 XorShift(U64& state)
+{
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Fills a 1 GiB memory pool and increments randomly selected elements. Nearly every access hits a different
+//! page, so the throughput is limited by TLB misses, which huge pages reduce. The counters show the resident memory
+//! after the initialization of the pool and after all elements were allocated.
+template <MemoryBacking _backing>
+void RandomAccess(benchmark::State& state)
+{
+    const size_t initialResidentSetSize = GetResidentSetSize();
+
+    MemoryPool memoryPool(elementSize * 1_B, numElements, elementSize, 0, _backing);
+    memoryPool.Initialize();
+    const size_t initializedResidentSetSize = GetResidentSetSize();
+
+    // Elements are handed out in order, so all elements can be addressed relative to the first one
+    U8* firstElement = static_cast<U8*>(memoryPool.Allocate(elementSize));
+    *reinterpret_cast<U64*>(firstElement) = 0;
+    for (U32 i = 1; i < numElements; ++i)
+        *static_cast<U64*>(memoryPool.Allocate(elementSize)) = 0;
+    const size_t filledResidentSetSize = GetResidentSetSize();
+
+    U64 randomState = 88172645463325252ull;
+    for (auto _ : state)
+        for (U32 i = 0; i < numAccessesPerIteration; ++i)
+            ++*reinterpret_cast<U64*>(firstElement + (XorShift(randomState) % numElements) * elementSize);
+
+    benchmark::DoNotOptimize(*firstElement);
+    state.counters["rss_init_MB"] = static_cast<F64>(initializedResidentSetSize - initialResidentSetSize) / bytesPerMB;
+    state.counters["rss_filled_MB"] = static_cast<F64>(filledResidentSetSize - initialResidentSetSize) / bytesPerMB;
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numAccessesPerIteration);
+}
+BENCHMARK_TEMPLATE(RandomAccess, MemoryBacking::HEAP)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(RandomAccess, MemoryBacking::MAPPED)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(RandomAccess, MemoryBacking::TRANSPARENT_HUGE_PAGES)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(RandomAccess, MemoryBacking::HUGE_PAGES)->Unit(benchmark::kMillisecond);
+
+
+
+BENCHMARK_MAIN();
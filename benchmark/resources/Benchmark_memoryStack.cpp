@@ -0,0 +1,171 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/memoryStack.h"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include <unistd.h>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr U32 numFrames = 64;
+constexpr U32 spikeFrameInterval = 16;
+constexpr size_t frameMemorySize = 2 * 1024 * 1024;
+constexpr size_t spikeFrameMemorySize = 16 * 1024 * 1024;
+constexpr size_t worstCaseMemorySize = 64 * 1024 * 1024;
+constexpr size_t blockSize = 1024 * 1024;
+constexpr size_t alignment = 16;
+constexpr F64 bytesPerMB = 1024. * 1024.;
+
+
+
+//! @brief Pregenerated allocation sizes of all frames, so that all memory systems process the same workload. Most
+//! frames need a similar amount of memory, but every 16th frame needs much more.
+const std::vector<std::vector<U32>>& GetFrames()
+{
+    static const std::vector<std::vector<U32>> frames = []() {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<F64> logSizeDistribution(std::log(16.), std::log(1024.));
+
+        std::vector<std::vector<U32>> newFrames(numFrames);
+        for (U32 i = 0; i < numFrames; ++i)
+        {
+            const size_t memorySize = (i % spikeFrameInterval == spikeFrameInterval - 1) ? spikeFrameMemorySize
+                                                                                          : frameMemorySize;
+            size_t totalSize = 0;
+            while (totalSize < memorySize)
+            {
+                newFrames[i].push_back(static_cast<U32>(std::exp(logSizeDistribution(generator))));
+                totalSize += newFrames[i].back();
+            }
+        }
+        return newFrames;
+    }();
+    return frames;
+}
+
+
+
+//! @brief Gets the resident set size of the process
+//! @return Resident set size in bytes
+size_t GetResidentSetSize()
+{
+    size_t numPages = 0;
+    size_t numResidentPages = 0;
+    std::ifstream statm("/proc/self/statm");
+    statm >> numPages >> numResidentPages;
+    return numResidentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+
+
+//! @brief Memory system wrapper for a memory stack. Each frame is released by a memory stack deallocator.
+template <bool _growable>
+struct Stack
+{
+    MemoryStack mMemory{(_growable ? blockSize : worstCaseMemorySize) * 1_B, _growable};
+
+    Stack()
+    {
+        mMemory.Initialize();
+    }
+
+    ~Stack()
+    {
+        mMemory.Deinitialize();
+    }
+
+    template <typename _function>
+    void Frame(_function&& frame)
+    {
+        auto stackDeallocator = mMemory.CreateMemoryStackDeallocator();
+        frame([this](size_t size) { return mMemory.Allocate(size, alignment); });
+    }
+
+    void AddCounters(benchmark::State& state)
+    {
+        MemoryStackStatistics statistics = mMemory.GetStatistics();
+        state.counters["reserved_MB"] = static_cast<F64>(statistics.mReservedMemorySize) / bytesPerMB;
+        state.counters["high_water_MB"] = static_cast<F64>(statistics.mHighWaterMark) / bytesPerMB;
+    }
+};
+
+
+
+//! @brief Memory system wrapper for malloc and free. All allocations of a frame are freed at its end.
+struct Malloc
+{
+    std::vector<void*> mAddresses;
+
+    template <typename _function>
+    void Frame(_function&& frame)
+    {
+        frame([this](size_t size) {
+            mAddresses.push_back(std::malloc(size));
+            return mAddresses.back();
+        });
+        for (void* address : mAddresses)
+            std::free(address);
+        mAddresses.clear();
+    }
+
+    void AddCounters(benchmark::State&)
+    {
+    }
+};
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Processes a sequence of frames. Each frame allocates its memory and touches every allocation before the
+//! whole frame is released. The peak increase of the resident set size is sampled after each frame.
+template <typename _memory>
+void Frames(benchmark::State& state)
+{
+    const std::vector<std::vector<U32>>& frames = GetFrames();
+    const size_t initialResidentSetSize = GetResidentSetSize();
+    size_t peakResidentSetSize = initialResidentSetSize;
+    size_t numAllocations = 0;
+
+    _memory memory;
+
+    for (auto _ : state)
+        for (const std::vector<U32>& frame : frames)
+        {
+            memory.Frame([&](auto&& allocate) {
+                for (U32 size : frame)
+                {
+                    U8* address = static_cast<U8*>(allocate(size));
+                    *address = 1;
+                    benchmark::DoNotOptimize(address);
+                }
+            });
+            numAllocations += frame.size();
+
+            state.PauseTiming();
+            peakResidentSetSize = std::max(peakResidentSetSize, GetResidentSetSize());
+            state.ResumeTiming();
+        }
+
+    memory.AddCounters(state);
+    state.counters["rss_MB"] = static_cast<F64>(peakResidentSetSize - initialResidentSetSize) / bytesPerMB;
+    state.SetItemsProcessed(static_cast<I64>(numAllocations));
+}
+BENCHMARK_TEMPLATE(Frames, Stack<false>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Frames, Stack<true>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Frames, Malloc)->Unit(benchmark::kMillisecond);
+
+
+
+BENCHMARK_MAIN();
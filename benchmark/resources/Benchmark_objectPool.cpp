@@ -0,0 +1,184 @@
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/uniquePtr.h"
+#include "gdl/resources/memory/objectPool.h"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr U32 numObjects = 100000;
+constexpr U32 numLookupsPerIteration = 100000;
+
+
+
+//! @brief Typical object of a physics system
+struct RigidBody
+{
+    F32 mPosition[3] = {0, 0, 0};
+    F32 mVelocity[3] = {1, 1, 1};
+    F32 mMass = 1;
+    F32 mPadding[9];
+};
+
+
+
+//! @brief Pregenerated sequence of creations and destructions, so that both containers process the same workload. The
+//! objects are created and destroyed randomly for a while, so that they are not stored in creation order.
+//! @return Pairs of object indices and flags if the object is created or destroyed
+const std::vector<std::pair<U32, bool>>& GetChurn()
+{
+    static const std::vector<std::pair<U32, bool>> churn = []() {
+        std::mt19937 generator(42);
+        std::vector<U32> indices(numObjects);
+        for (U32 i = 0; i < numObjects; ++i)
+            indices[i] = i;
+
+        std::vector<std::pair<U32, bool>> newChurn;
+        for (U32 round = 0; round < 4; ++round)
+        {
+            std::shuffle(indices.begin(), indices.end(), generator);
+            for (U32 i = 0; i < numObjects / 2; ++i)
+                newChurn.emplace_back(indices[i], false);
+            std::shuffle(indices.begin(), indices.begin() + numObjects / 2, generator);
+            for (U32 i = 0; i < numObjects / 2; ++i)
+                newChurn.emplace_back(indices[i], true);
+        }
+        return newChurn;
+    }();
+    return churn;
+}
+
+
+
+//! @brief Random object indices for the lookup benchmarks
+const std::vector<U32>& GetLookups()
+{
+    static const std::vector<U32> lookups = []() {
+        std::mt19937 generator(7);
+        std::uniform_int_distribution<U32> distribution(0, numObjects - 1);
+        std::vector<U32> newLookups(numLookupsPerIteration);
+        for (U32& lookup : newLookups)
+            lookup = distribution(generator);
+        return newLookups;
+    }();
+    return lookups;
+}
+
+
+
+//! @brief Object pool filled with the workload of GetChurn
+struct ObjectPoolSetup
+{
+    ObjectPool<RigidBody> mObjectPool{numObjects};
+    std::vector<ObjectHandle<RigidBody>> mHandles;
+
+    ObjectPoolSetup()
+    {
+        for (U32 i = 0; i < numObjects; ++i)
+            mHandles.push_back(mObjectPool.Create());
+        for (const auto& [index, create] : GetChurn())
+            if (create)
+                mHandles[index] = mObjectPool.Create();
+            else
+                mObjectPool.Destroy(mHandles[index]);
+    }
+};
+
+
+
+//! @brief Vector of unique pointers filled with the workload of GetChurn
+struct UniquePtrSetup
+{
+    Vector<UniquePtr<RigidBody>> mObjects;
+
+    UniquePtrSetup()
+    {
+        for (U32 i = 0; i < numObjects; ++i)
+            mObjects.push_back(MakeUnique<RigidBody>());
+        for (const auto& [index, create] : GetChurn())
+            if (create)
+                mObjects[index] = MakeUnique<RigidBody>();
+            else
+                mObjects[index].reset();
+    }
+};
+
+
+
+//! @brief Integrates the position of a rigid body
+//! @param rigidBody: Rigid body
+inline void Integrate(RigidBody& rigidBody)
+{
+    for (U32 i = 0; i < 3; ++i)
+        rigidBody.mPosition[i] += rigidBody.mVelocity[i] * 0.01f;
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Updates all objects of the object pool in memory order
+void Iteration_ObjectPool(benchmark::State& state)
+{
+    ObjectPoolSetup setup;
+    for (auto _ : state)
+        setup.mObjectPool.ForEach([](RigidBody& rigidBody) { Integrate(rigidBody); });
+
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numObjects);
+}
+BENCHMARK(Iteration_ObjectPool);
+
+
+
+//! @brief Updates all objects of the vector in the order of their pointers
+void Iteration_VectorUniquePtr(benchmark::State& state)
+{
+    UniquePtrSetup setup;
+    for (auto _ : state)
+        for (auto& object : setup.mObjects)
+            Integrate(*object);
+
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numObjects);
+}
+BENCHMARK(Iteration_VectorUniquePtr);
+
+
+
+//! @brief Accesses random objects of the object pool by their handle
+void Lookup_ObjectPool(benchmark::State& state)
+{
+    ObjectPoolSetup setup;
+    for (auto _ : state)
+        for (U32 index : GetLookups())
+            Integrate(*setup.mObjectPool.Get(setup.mHandles[index]));
+
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numLookupsPerIteration);
+}
+BENCHMARK(Lookup_ObjectPool);
+
+
+
+//! @brief Accesses random objects of the vector by their index
+void Lookup_VectorUniquePtr(benchmark::State& state)
+{
+    UniquePtrSetup setup;
+    for (auto _ : state)
+        for (U32 index : GetLookups())
+            Integrate(*setup.mObjects[index]);
+
+    state.SetItemsProcessed(static_cast<I64>(state.iterations()) * numLookupsPerIteration);
+}
+BENCHMARK(Lookup_VectorUniquePtr);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,185 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/parallelFor.h"
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Memory bound: 2 x 64 MB - does not fit into any cache
+constexpr U64 numMemoryBoundValues = 1 << 24;
+constexpr U64 grainSizeMemoryBound = 1 << 14;
+
+// Compute bound: few values with an expensive loop body
+constexpr U64 numComputeBoundValues = 1 << 12;
+constexpr U64 grainSizeComputeBound = 1 << 6;
+constexpr U32 numComputeBoundIterations = 256;
+
+
+
+//! @brief Adds the number of worker threads (1st argument) and the partitioner (2nd argument) to a benchmark. The
+//! calling thread participates, so the total number of threads is the number of worker threads + 1.
+void ParallelArguments(benchmark::internal::Benchmark* benchmark)
+{
+    const I64 maxNumWorkers = std::max<I64>(3, std::thread::hardware_concurrency() - 1);
+    for (I64 partitioner = 0; partitioner < 4; ++partitioner)
+        for (I64 numWorkers = 0; numWorkers <= maxNumWorkers; ++numWorkers)
+            benchmark->Args({numWorkers, partitioner});
+    benchmark->ArgNames({"workers", "partitioner"});
+    benchmark->UseRealTime();
+}
+
+
+
+// Fixtures %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+class MemoryBound : public benchmark::Fixture
+{
+public:
+    Vector<F32> X;
+    Vector<F32> Y;
+
+    void SetUp(const benchmark::State&) override
+    {
+        X.assign(numMemoryBoundValues, 1.f);
+        Y.assign(numMemoryBoundValues, 2.f);
+    }
+
+    void TearDown(const benchmark::State&) override
+    {
+        X.clear();
+        X.shrink_to_fit();
+        Y.clear();
+        Y.shrink_to_fit();
+    }
+
+    //! @brief Calculates y = a * x + y for the passed range
+    void Saxpy(U64 begin, U64 end)
+    {
+        constexpr F32 a = 0.5f;
+        for (U64 i = begin; i < end; ++i)
+            Y[i] = a * X[i] + Y[i];
+    }
+};
+
+
+
+class ComputeBound : public benchmark::Fixture
+{
+public:
+    Vector<F64> Values;
+
+    void SetUp(const benchmark::State&) override
+    {
+        Values.assign(numComputeBoundValues, 0.);
+    }
+
+    //! @brief Calculates an expensive series for each value of the passed range
+    void Series(U64 begin, U64 end)
+    {
+        for (U64 i = begin; i < end; ++i)
+        {
+            F64 result = 0.;
+            for (U32 j = 1; j <= numComputeBoundIterations; ++j)
+                result += std::sin(static_cast<F64>(i * j)) / std::sqrt(static_cast<F64>(j));
+            Values[i] = result;
+        }
+    }
+};
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+BENCHMARK_DEFINE_F(MemoryBound, Serial)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Saxpy(0, numMemoryBoundValues);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * numMemoryBoundValues * 3 * sizeof(F32));
+}
+BENCHMARK_REGISTER_F(MemoryBound, Serial)->UseRealTime();
+
+
+BENCHMARK_DEFINE_F(MemoryBound, ParallelFor)(benchmark::State& state)
+{
+    ThreadPool<1, true> tp(static_cast<U32>(state.range(0)));
+    const auto partitioner = static_cast<Partitioner>(state.range(1));
+
+    for (auto _ : state)
+    {
+        ParallelFor(tp, 0, numMemoryBoundValues, grainSizeMemoryBound,
+                    [this](U64 begin, U64 end) { Saxpy(begin, end); }, partitioner);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * numMemoryBoundValues * 3 * sizeof(F32));
+    tp.Deinitialize();
+}
+BENCHMARK_REGISTER_F(MemoryBound, ParallelFor)->Apply(ParallelArguments);
+
+
+BENCHMARK_DEFINE_F(ComputeBound, Serial)(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Series(0, numComputeBoundValues);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numComputeBoundValues);
+}
+BENCHMARK_REGISTER_F(ComputeBound, Serial)->UseRealTime();
+
+
+BENCHMARK_DEFINE_F(ComputeBound, ParallelFor)(benchmark::State& state)
+{
+    ThreadPool<1, true> tp(static_cast<U32>(state.range(0)));
+    const auto partitioner = static_cast<Partitioner>(state.range(1));
+
+    for (auto _ : state)
+    {
+        ParallelFor(tp, 0, numComputeBoundValues, grainSizeComputeBound,
+                    [this](U64 begin, U64 end) { Series(begin, end); }, partitioner);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * numComputeBoundValues);
+    tp.Deinitialize();
+}
+BENCHMARK_REGISTER_F(ComputeBound, ParallelFor)->Apply(ParallelArguments);
+
+
+BENCHMARK_DEFINE_F(ComputeBound, ParallelReduce)(benchmark::State& state)
+{
+    ThreadPool<1, true> tp(static_cast<U32>(state.range(0)));
+    const auto partitioner = static_cast<Partitioner>(state.range(1));
+
+    for (auto _ : state)
+    {
+        F64 sum = ParallelReduce(tp, 0, numComputeBoundValues, grainSizeComputeBound, 0.,
+                                 [this](U64 begin, U64 end) {
+                                     Series(begin, end);
+                                     F64 partialSum = 0.;
+                                     for (U64 i = begin; i < end; ++i)
+                                         partialSum += Values[i];
+                                     return partialSum;
+                                 },
+                                 [](const F64& lhs, const F64& rhs) { return lhs + rhs; }, partitioner);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * numComputeBoundValues);
+    tp.Deinitialize();
+}
+BENCHMARK_REGISTER_F(ComputeBound, ParallelReduce)->Apply(ParallelArguments);
+
+
+
+BENCHMARK_MAIN();
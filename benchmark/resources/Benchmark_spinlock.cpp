@@ -0,0 +1,104 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/spinlock.h"
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Previous spinlock implementation that spins on test_and_set without pausing. Used as baseline.
+class TASSpinLock
+{
+    std::atomic_flag mLocked = ATOMIC_FLAG_INIT;
+
+public:
+    void lock()
+    {
+        while (mLocked.test_and_set(std::memory_order_acquire))
+            ;
+    }
+
+    void unlock()
+    {
+        mLocked.clear(std::memory_order_release);
+    }
+};
+
+
+
+//! @brief Lock and counter shared by all benchmark threads. The counter shares the cache line with the lock, like the
+//! data protected by the spinlocks of the memory systems.
+template <typename _lock>
+struct SharedState
+{
+    alignas(64) _lock mLock;
+    U64 mCounter = 0;
+};
+
+template <typename _lock>
+SharedState<_lock> sharedState;
+
+
+
+//! @brief Resets the shared state before each run
+template <typename _lock>
+void ResetSharedState(const benchmark::State&)
+{
+    sharedState<_lock>.mCounter = 0;
+    if constexpr (std::is_base_of_v<SpinLockStatisticsCounter<true>, _lock>)
+        sharedState<_lock>.mLock.ResetStatistics();
+}
+
+
+
+//! @brief Adds the number of threads to a benchmark
+template <typename _lock>
+void ThreadArguments(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ThreadRange(1, 16)->UseRealTime()->Setup(ResetSharedState<_lock>);
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Each thread repeatedly acquires the lock and increments the shared counter. The items per second are the
+//! total lock throughput of all threads.
+template <typename _lock>
+void Contended_Increment(benchmark::State& state)
+{
+    auto& shared = sharedState<_lock>;
+    for (auto _ : state)
+    {
+        std::lock_guard<_lock> lock(shared.mLock);
+        ++shared.mCounter;
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if constexpr (std::is_base_of_v<SpinLockStatisticsCounter<true>, _lock>)
+        if (state.thread_index() == 0)
+        {
+            const SpinLockStatistics statistics = shared.mLock.GetStatistics();
+            state.counters["contended"] = static_cast<F64>(statistics.mNumContendedAcquisitions) /
+                                          static_cast<F64>(statistics.mNumAcquisitions);
+            state.counters["spin_cycles"] = static_cast<F64>(statistics.mNumSpinCycles) /
+                                            static_cast<F64>(statistics.mNumAcquisitions);
+        }
+}
+BENCHMARK_TEMPLATE(Contended_Increment, std::mutex)->Apply(ThreadArguments<std::mutex>);
+BENCHMARK_TEMPLATE(Contended_Increment, TASSpinLock)->Apply(ThreadArguments<TASSpinLock>);
+BENCHMARK_TEMPLATE(Contended_Increment, TTASSpinLockTemplate<false>)->Apply(ThreadArguments<TTASSpinLockTemplate<false>>);
+BENCHMARK_TEMPLATE(Contended_Increment, TicketSpinLockTemplate<false>)->Apply(ThreadArguments<TicketSpinLockTemplate<false>>);
+BENCHMARK_TEMPLATE(Contended_Increment, TTASSpinLockTemplate<true>)->Apply(ThreadArguments<TTASSpinLockTemplate<true>>);
+BENCHMARK_TEMPLATE(Contended_Increment, TicketSpinLockTemplate<true>)->Apply(ThreadArguments<TicketSpinLockTemplate<true>>);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,97 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/cpuTopology.h"
+#include "gdl/resources/cpu/threadPool.h"
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <numeric>
+#include <thread>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+// Each worker owns 16 MB - exceeds the private caches, so the bandwidth to the memory of the node is measured
+constexpr U64 numValuesPerThread = 1 << 22;
+constexpr U32 numTasksPerThread = 8;
+
+//! @brief Buffer of the worker thread. It is allocated and first touched by the initialization function of the
+//! worker, so that its pages are placed on the NUMA node the worker is running on.
+thread_local Vector<F32> workerBuffer;
+
+
+
+//! @brief Adds the placement (0: unpinned, 1: one core per thread, 2: one NUMA node per thread with interleaved
+//! nodes) to a benchmark. The number of threads matches the number of physical cores.
+void PlacementArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (I64 placement = 0; placement < 3; ++placement)
+        benchmark->Arg(placement);
+    benchmark->ArgName("placement");
+    benchmark->UseRealTime();
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Each task sums up the buffer of the worker that executes it. Unpinned workers may be migrated by the
+//! operating system and end up reading memory of a remote NUMA node or a cold cache.
+void Stream_Local_Buffers(benchmark::State& state)
+{
+    const CpuTopology topology;
+    const U32 numThreads = topology.GetNumCores();
+
+    ThreadPool tp;
+    tp.SetThreadName("bench");
+    if (state.range(0) == 1)
+        tp.SetThreadAffinities(topology.GetCpuSets(CpuSetGranularity::CORE, true));
+    else if (state.range(0) == 2)
+        tp.SetThreadAffinities(topology.GetCpuSets(CpuSetGranularity::NODE));
+
+    std::atomic<U32> numReadyThreads = 0;
+    tp.StartThreads(numThreads,
+                    [&tp, numIdleIterations = U32{0}]() mutable {
+                        if (tp.TryExecuteTask())
+                            numIdleIterations = 0;
+                        else
+                            tp.WaitForTasks(numIdleIterations);
+                    },
+                    [&numReadyThreads]() {
+                        workerBuffer.assign(numValuesPerThread, 1.f);
+                        ++numReadyThreads;
+                    },
+                    []() {
+                        workerBuffer.clear();
+                        workerBuffer.shrink_to_fit();
+                    });
+    while (numReadyThreads != numThreads)
+        std::this_thread::yield();
+
+    const U32 numTasks = numThreads * numTasksPerThread;
+    for (auto _ : state)
+    {
+        std::atomic<U32> numFinishedTasks = 0;
+        for (U32 i = 0; i < numTasks; ++i)
+            tp.Submit([&numFinishedTasks]() {
+                F32 sum = std::accumulate(workerBuffer.begin(), workerBuffer.end(), 0.f);
+                benchmark::DoNotOptimize(sum);
+                ++numFinishedTasks;
+            });
+        while (numFinishedTasks != numTasks)
+            std::this_thread::yield();
+    }
+    state.SetBytesProcessed(state.iterations() * numTasks * numValuesPerThread * sizeof(F32));
+    state.counters["threads"] = numThreads;
+    state.counters["nodes"] = topology.GetNumNodes();
+    tp.Deinitialize();
+}
+BENCHMARK(Stream_Local_Buffers)->Apply(PlacementArguments);
+
+
+
+BENCHMARK_MAIN();
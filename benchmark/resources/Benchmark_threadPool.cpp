@@ -2,10 +2,17 @@
 #include "gdl/base/time.h"
 #include "gdl/base/timer.h"
 #include "gdl/resources/cpu/threadPool.h"
+#include "gdl/resources/memory/memoryManager.h"
+#include "gdl/resources/memory/memoryPool.h"
+#include "gdl/resources/memory/utility/heapAllocationCounter.h"
 
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <ctime>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 
@@ -18,6 +25,21 @@ constexpr U32 numSubmits = 10000;
 constexpr U32 numLoopIterations = 1000000;
 constexpr U32 maxNumThreads = 4;
 
+constexpr U32 numFineGrainedRootTasks = 64;
+constexpr U32 numFineGrainedSubTasks = 2048;
+constexpr U32 numFineGrainedTasks = numFineGrainedRootTasks * (numFineGrainedSubTasks + 1);
+
+constexpr U32 numOverheadTasks = 1 << 16;
+constexpr U32 numOverheadRepetitions = 5;
+constexpr U32 largeCaptureSize = 128;
+
+constexpr MemorySize taskPoolElementSize = 256_B;
+constexpr size_t taskPoolAlignment = 16;
+
+constexpr U32 numWakeUps = 200;
+constexpr U32 numIdleThreads = 4;
+constexpr U32 maxU32 = std::numeric_limits<U32>::max();
+
 // Helper Functions %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 void SubmitToThreadpool(ThreadPool<1>& tp, std::vector<U32>& val, std::vector<U32>& res)
@@ -47,10 +69,215 @@ Microseconds GetThreadPoolPerformance(ThreadPool<1>& tp, Timer& timer, std::vect
 
 
 
+// Fine-grained task throughput %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Submits root tasks which submit a lot of sub-microsecond tasks from inside the worker threads
+template <bool _workStealing>
+void SubmitFineGrainedTasks(ThreadPool<1, _workStealing>& tp, std::atomic<U32>& counter)
+{
+    for (U32 i = 0; i < numFineGrainedRootTasks; ++i)
+        tp.Submit([&tp, &counter]() {
+            for (U32 j = 0; j < numFineGrainedSubTasks; ++j)
+                tp.Submit([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+            counter.fetch_add(1, std::memory_order_relaxed);
+        });
+}
+
+
+
+template <bool _workStealing>
+void RunFineGrainedBenchmark(const char* modeName)
+{
+    const U32 numThreadsMax = std::max(maxNumThreads, std::thread::hardware_concurrency());
+
+    ThreadPool<1, _workStealing> tp(0);
+    Timer timer;
+
+    std::cout << std::endl << "Fine-grained tasks - " << modeName << std::endl << "----------------------" << std::endl;
+    for (U32 i = 0; i < numThreadsMax; ++i)
+    {
+        tp.StartThreads(1);
+        std::this_thread::sleep_for(10ms);
+
+        std::atomic<U32> counter = 0;
+        timer.Reset();
+        SubmitFineGrainedTasks(tp, counter);
+        while (counter.load(std::memory_order_relaxed) < numFineGrainedTasks)
+            std::this_thread::yield();
+        Nanoseconds time = timer.GetElapsedTime<Nanoseconds>();
+
+        const F64 nsPerTask = static_cast<F64>(time.count()) / numFineGrainedTasks;
+        std::cout << tp.GetNumThreads() << " Threads : " << nsPerTask << " ns/task | " << 1000. / nsPerTask
+                  << " Mtasks/s" << std::endl;
+    }
+}
+
+
+
+// Submission overhead %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Measures the cost of submitting and executing a task and the number of allocations per task. All tasks are
+//! submitted first and executed afterwards by the same thread. Without work stealing, the main thread submits the
+//! tasks to the shared queue. With work stealing, a worker thread submits them to its local queue. The allocation
+//! count includes heap allocations and elements that are taken from the memory pool.
+template <bool _workStealing, typename _function>
+void RunSubmissionOverheadBenchmark(const char* name, const _function& function)
+{
+    using ThreadPoolType = ThreadPool<1, _workStealing>;
+
+    // Worker-local tasks that don't fit into the local queue are pushed to the shared queue
+    constexpr U32 numTasks = (_workStealing) ? ThreadPoolType::LocalQueueCapacity : numOverheadTasks;
+
+    const MemoryPool& taskPool =
+            *MemoryManager::Instance().GetMemoryPool(taskPoolElementSize.GetNumBytes(), taskPoolAlignment);
+
+    ThreadPoolType tp(0);
+    Timer timer;
+    Nanoseconds minTime = Nanoseconds::max();
+    F64 numAllocationsPerTask = 0;
+
+    auto runBenchmark = [&]() {
+        for (U32 i = 0; i < numOverheadRepetitions; ++i)
+        {
+            timer.Reset();
+            for (U32 j = 0; j < numTasks; ++j)
+                tp.Submit(function);
+            while (tp.TryExecuteTask())
+                ;
+            minTime = std::min(minTime, timer.GetElapsedTime<Nanoseconds>());
+        }
+
+        // Pool elements are counted while all tasks are alive, since the pool doesn't count allocations itself
+        HeapAllocationCounter hac;
+        for (U32 j = 0; j < numTasks; ++j)
+            tp.Submit(function);
+        const U32 numPoolAllocations = taskPool.GetNumAllocatedElements();
+        while (tp.TryExecuteTask())
+            ;
+        const I32 numAllocations = hac.GetNumNewCalls() + static_cast<I32>(numPoolAllocations);
+        numAllocationsPerTask = static_cast<F64>(numAllocations) / numTasks;
+    };
+
+    if constexpr (_workStealing)
+    {
+        std::atomic_bool finished = false;
+        tp.StartThreads(1);
+        tp.Submit([&]() {
+            runBenchmark();
+            finished = true;
+        });
+        while (!finished)
+            std::this_thread::yield();
+        tp.Deinitialize();
+    }
+    else
+        runBenchmark();
+
+    std::cout << name << " : " << static_cast<F64>(minTime.count()) / numTasks << " ns/task | "
+              << numAllocationsPerTask << " allocations/task" << std::endl;
+}
+
+
+
+template <bool _workStealing>
+void RunSubmissionOverheadBenchmarks(const char* modeName)
+{
+    std::atomic<U32> counter = 0;
+    std::array<U8, largeCaptureSize> largeCapture = {{0}};
+
+    std::cout << std::endl << "Submission overhead - " << modeName << std::endl << "---------------------" << std::endl;
+    RunSubmissionOverheadBenchmark<_workStealing>("Small capture",
+                                                  [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+    RunSubmissionOverheadBenchmark<_workStealing>("Large capture", [&counter, largeCapture]() {
+        counter.fetch_add(largeCapture[0] + 1, std::memory_order_relaxed);
+    });
+}
+
+
+
+// Idle strategy %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Measures the time between submitting a task to an idle thread pool and the start of its execution
+void RunWakeUpLatencyBenchmark(const char* name, U32 numSpins, U32 numYields)
+{
+    ThreadPool tp(0);
+    tp.SetIdleThresholds(numSpins, numYields);
+    tp.StartThreads(1);
+    Timer timer;
+
+    std::vector<Nanoseconds> latencies;
+    for (U32 i = 0; i < numWakeUps; ++i)
+    {
+        // Give the worker enough time to become idle
+        if (numSpins == maxU32)
+            std::this_thread::sleep_for(1ms);
+        else
+            while (tp.GetNumSleepingThreads() == 0)
+                std::this_thread::sleep_for(100us);
+
+        std::atomic_bool executed = false;
+        Nanoseconds latency{0};
+        timer.Reset();
+        tp.Submit([&]() {
+            latency = timer.GetElapsedTime<Nanoseconds>();
+            executed = true;
+        });
+        while (!executed)
+            std::this_thread::yield();
+        latencies.push_back(latency);
+    }
+    tp.Deinitialize();
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << name << " : median " << latencies[latencies.size() / 2].count() / 1000. << " us | p99 "
+              << latencies[latencies.size() * 99 / 100].count() / 1000. << " us" << std::endl;
+}
+
+
+
+//! @brief Measures the CPU time that is consumed by idle worker threads
+void RunIdleCpuUsageBenchmark(const char* name, U32 numSpins, U32 numYields)
+{
+    ThreadPool tp(0);
+    tp.SetIdleThresholds(numSpins, numYields);
+    tp.StartThreads(numIdleThreads);
+    std::this_thread::sleep_for(50ms);
+
+    Timer timer;
+    const std::clock_t cpuTimeStart = std::clock();
+    std::this_thread::sleep_for(500ms);
+    const F64 cpuTime = static_cast<F64>(std::clock() - cpuTimeStart) / CLOCKS_PER_SEC;
+    const F64 wallTime = static_cast<F64>(timer.GetElapsedTime<Microseconds>().count()) / 1.e6;
+    tp.Deinitialize();
+
+    std::cout << name << " : " << 100. * cpuTime / wallTime << " % of one core (" << numIdleThreads << " threads)"
+              << std::endl;
+}
+
+
+
+void RunIdleStrategyBenchmarks()
+{
+    std::cout << std::endl << "Wake-up latency" << std::endl << "---------------" << std::endl;
+    RunWakeUpLatencyBenchmark("Busy waiting", maxU32, 0);
+    RunWakeUpLatencyBenchmark("Adaptive    ", ThreadPool<>::DefaultNumIdleSpins, ThreadPool<>::DefaultNumIdleYields);
+
+    std::cout << std::endl << "Idle CPU usage" << std::endl << "--------------" << std::endl;
+    RunIdleCpuUsageBenchmark("Busy waiting", maxU32, 0);
+    RunIdleCpuUsageBenchmark("Adaptive    ", ThreadPool<>::DefaultNumIdleSpins, ThreadPool<>::DefaultNumIdleYields);
+}
+
+
+
 // Main %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
 int main()
 {
+    // Memory pool for larger tasks
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    memoryManager.CreateMemoryPool(taskPoolElementSize, numOverheadTasks + numFineGrainedTasks, taskPoolAlignment);
+    memoryManager.Initialize();
+
     ThreadPool tp(0);
     std::vector<U32> val;
     std::vector<U32> res;
@@ -96,4 +323,13 @@ int main()
     std::cout << std::endl << "Speedup" << std::endl << "-------" << std::endl;
     for (U32 i = 0; i < speedupThreadpool.size(); ++i)
         std::cout << i + 1 << " Threads : " << speedupThreadpool[i] << std::endl;
+
+    RunFineGrainedBenchmark<false>("shared queue");
+    RunFineGrainedBenchmark<true>("work stealing");
+
+    RunSubmissionOverheadBenchmarks<false>("shared queue");
+    RunSubmissionOverheadBenchmarks<true>("work stealing");
+    RunIdleStrategyBenchmarks();
+
+    memoryManager.Deinitialize();
 }
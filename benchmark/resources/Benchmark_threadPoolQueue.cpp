@@ -0,0 +1,117 @@
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/boundedThreadPoolQueue.h"
+#include "gdl/resources/cpu/task.h"
+#include "gdl/resources/cpu/threadPoolQueue.h"
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+using namespace GDL;
+
+
+
+// Setup %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+constexpr U32 numTasksPerProducer = 1 << 14;
+constexpr U64 boundedCapacity = 1024;
+
+using SpinLockQueue = ThreadPoolQueue<Task>;
+using BoundedQueue = BoundedThreadPoolQueue<Task, boundedCapacity, OverflowPolicy::BLOCK>;
+using SpillQueue = BoundedThreadPoolQueue<Task, boundedCapacity, OverflowPolicy::SPILL>;
+
+
+
+//! @brief Adds the number of producers and consumers to a benchmark. Both numbers are always identical. The time is
+//! measured manually to exclude the thread creation.
+void ContentionArguments(benchmark::internal::Benchmark* benchmark)
+{
+    for (I64 numThreads : {1, 2, 4, 8, 16})
+        benchmark->Arg(numThreads);
+    benchmark->ArgName("producers/consumers");
+    benchmark->UseManualTime();
+}
+
+
+
+//! @brief Pushes a task into a growable queue
+void PushTask(SpinLockQueue& queue, Task&& task)
+{
+    queue.Push(std::move(task));
+}
+
+
+
+//! @brief Pushes a task into a bounded queue. If the queue is full, the producer yields until there is free space.
+template <U64 _capacity, OverflowPolicy _overflowPolicy>
+void PushTask(BoundedThreadPoolQueue<Task, _capacity, _overflowPolicy>& queue, Task&& task)
+{
+    while (!queue.TryPush(std::move(task)))
+        std::this_thread::yield();
+}
+
+
+
+// Benchmarks %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Starts the same number of producer and consumer threads that share a single queue. Each producer pushes a
+//! fixed number of small tasks and the consumers execute them until all tasks are processed.
+template <typename _queue>
+void Contention(benchmark::State& state)
+{
+    const U32 numThreads = static_cast<U32>(state.range(0));
+    const U64 numTasks = static_cast<U64>(numThreads) * numTasksPerProducer;
+
+    for (auto _ : state)
+    {
+        _queue queue;
+        std::atomic<U64> numExecuted = 0;
+        std::atomic<U32> numReady = 0;
+        std::atomic_bool start = false;
+        std::vector<std::thread> threads;
+
+        for (U32 i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back([&]() {
+                ++numReady;
+                while (!start)
+                    std::this_thread::yield();
+                for (U32 j = 0; j < numTasksPerProducer; ++j)
+                    PushTask(queue, Task([&numExecuted]() { numExecuted.fetch_add(1, std::memory_order_relaxed); }));
+            });
+            threads.emplace_back([&]() {
+                ++numReady;
+                while (!start)
+                    std::this_thread::yield();
+                Task task;
+                while (numExecuted.load(std::memory_order_relaxed) < numTasks)
+                    if (queue.TryPop(task))
+                        task.Execute();
+                    else
+                        std::this_thread::yield();
+            });
+        }
+
+        while (numReady < 2 * numThreads)
+            std::this_thread::yield();
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        start = true;
+        for (auto& thread : threads)
+            thread.join();
+        auto endTime = std::chrono::high_resolution_clock::now();
+
+        state.SetIterationTime(std::chrono::duration<F64>(endTime - startTime).count());
+    }
+    state.SetItemsProcessed(state.iterations() * numTasks);
+}
+BENCHMARK_TEMPLATE(Contention, SpinLockQueue)->Apply(ContentionArguments);
+BENCHMARK_TEMPLATE(Contention, BoundedQueue)->Apply(ContentionArguments);
+BENCHMARK_TEMPLATE(Contention, SpillQueue)->Apply(ContentionArguments);
+
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,354 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/x86intrin.h"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace GDL
+{
+
+//! @brief Hash map that stores its elements in a single open addressing table instead of separately allocated nodes.
+//! The table is divided into groups of 16 slots. Each slot has a control byte which stores 7 bits of the keys hash or
+//! marks the slot as empty or deleted. A lookup compares the control bytes of a whole group with a single SSE
+//! instruction and only compares the keys of matching slots.
+//! @tparam _keyType: Key type
+//! @tparam _valueType: Value type
+//! @tparam _hash: Hash function
+//! @tparam _keyEqual: Function that compares two keys for equality
+//! @tparam _allocator: Allocator. It is rebound to the internal data types.
+//! @remark The interface follows std::unordered_map. In contrast to std::unordered_map, insertions and deletions
+//! invalidate all iterators, pointers and references to elements. The stored keys must not be modified.
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+class FlatHashMapTemplate
+{
+    static constexpr U32 GroupSize = 16;
+
+    //! @brief Control bytes of a group of slots
+    struct alignas(16) Group
+    {
+        I8 mControl[GroupSize];
+    };
+
+    using AllocatorTraits = std::allocator_traits<_allocator>;
+    using GroupAllocator = typename AllocatorTraits::template rebind_alloc<Group>;
+
+public:
+    using key_type = _keyType;
+    using mapped_type = _valueType;
+    using value_type = std::pair<_keyType, _valueType>;
+    using size_type = size_t;
+    using hasher = _hash;
+    using key_equal = _keyEqual;
+    using allocator_type = _allocator;
+
+private:
+    using SlotAllocator = typename AllocatorTraits::template rebind_alloc<value_type>;
+
+    static constexpr I8 Empty = -128;
+    static constexpr I8 Deleted = -2;
+
+    template <bool _isConst>
+    class Iterator;
+
+public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+private:
+    Group* mGroups;
+    value_type* mSlots;
+    size_t mNumGroups;
+    size_t mSize;
+    size_t mGrowthLeft;
+    _hash mHash;
+    _keyEqual mKeyEqual;
+
+public:
+    FlatHashMapTemplate();
+    FlatHashMapTemplate(const FlatHashMapTemplate& other);
+    FlatHashMapTemplate(FlatHashMapTemplate&& other) noexcept;
+    FlatHashMapTemplate& operator=(const FlatHashMapTemplate& other);
+    FlatHashMapTemplate& operator=(FlatHashMapTemplate&& other) noexcept;
+    ~FlatHashMapTemplate();
+
+    //! @brief Gets the value of a key. If the key doesn't exist, a default constructed value is inserted.
+    //! @param key: Key
+    //! @return Reference to the value
+    _valueType& operator[](const _keyType& key);
+
+    //! @brief Gets the value of a key. Throws if the key doesn't exist.
+    //! @param key: Key
+    //! @return Reference to the value
+    _valueType& at(const _keyType& key);
+
+    //! @brief Gets the value of a key. Throws if the key doesn't exist.
+    //! @param key: Key
+    //! @return Reference to the value
+    const _valueType& at(const _keyType& key) const;
+
+    //! @brief Gets an iterator to the first element
+    //! @return Iterator to the first element
+    iterator begin();
+
+    //! @brief Gets an iterator to the first element
+    //! @return Iterator to the first element
+    const_iterator begin() const;
+
+    //! @brief Gets the number of slots
+    //! @return Number of slots
+    size_t capacity() const;
+
+    //! @brief Removes all elements. The memory is kept.
+    void clear();
+
+    //! @brief Returns if the map contains the passed key
+    //! @param key: Key
+    //! @return TRUE / FALSE
+    bool contains(const _keyType& key) const;
+
+    //! @brief Counts the elements with the passed key
+    //! @param key: Key
+    //! @return 1 if the key exists, 0 otherwise
+    size_t count(const _keyType& key) const;
+
+    //! @brief Inserts a new element if the key doesn't exist
+    //! @tparam _args: Types of the arguments that are passed to the values constructor
+    //! @param key: Key
+    //! @param args: Arguments that are passed to the values constructor
+    //! @return Iterator to the element with the key and TRUE if the element was inserted
+    template <typename... _args>
+    std::pair<iterator, bool> emplace(const _keyType& key, _args&&... args);
+
+    //! @brief Returns if the map is empty
+    //! @return TRUE / FALSE
+    bool empty() const;
+
+    //! @brief Gets an iterator behind the last element
+    //! @return Iterator behind the last element
+    iterator end();
+
+    //! @brief Gets an iterator behind the last element
+    //! @return Iterator behind the last element
+    const_iterator end() const;
+
+    //! @brief Removes the element with the passed key
+    //! @param key: Key
+    //! @return Number of removed elements
+    size_t erase(const _keyType& key);
+
+    //! @brief Removes the element the passed iterator points to
+    //! @param position: Iterator to the element
+    //! @return Iterator to the next element
+    iterator erase(const_iterator position);
+
+    //! @brief Finds the element with the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end() if the key doesn't exist
+    iterator find(const _keyType& key);
+
+    //! @brief Finds the element with the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end() if the key doesn't exist
+    const_iterator find(const _keyType& key) const;
+
+    //! @brief Inserts a new element if the key doesn't exist
+    //! @param value: Key and value of the new element
+    //! @return Iterator to the element with the key and TRUE if the element was inserted
+    std::pair<iterator, bool> insert(const value_type& value);
+
+    //! @brief Inserts a new element if the key doesn't exist
+    //! @param value: Key and value of the new element
+    //! @return Iterator to the element with the key and TRUE if the element was inserted
+    std::pair<iterator, bool> insert(value_type&& value);
+
+    //! @brief Reserves memory, so that the passed number of elements can be stored without rehashing
+    //! @param numElements: Number of elements
+    void reserve(size_t numElements);
+
+    //! @brief Gets the number of elements
+    //! @return Number of elements
+    size_t size() const;
+
+private:
+    //! @brief Destroys all elements and frees the memory
+    void Deallocate();
+
+    //! @brief Finds the slot of the passed key
+    //! @param key: Key
+    //! @param hash: Hash of the key
+    //! @return Slot index or capacity() if the key doesn't exist
+    inline size_t FindSlot(const _keyType& key, size_t hash) const;
+
+    //! @brief Finds the first empty or deleted slot on the probing sequence of the passed hash
+    //! @param hash: Hash of a key
+    //! @return Slot index
+    size_t FindFreeSlot(size_t hash) const;
+
+    //! @brief Calculates the hash of a key. The result of the hash function is mixed, so that hash functions with
+    //! poorly distributed bits like the identity hash of std::hash don't cause clustering.
+    //! @param key: Key
+    //! @return Hash
+    inline size_t Hash(const _keyType& key) const;
+
+    //! @brief Gets the 7 bit hash which is stored in the control bytes
+    //! @param hash: Hash
+    //! @return 7 bit hash
+    static inline I8 H2(size_t hash);
+
+    //! @brief Inserts a new element into the slot of the passed key, if the key doesn't exist
+    //! @tparam _args: Types of the arguments that are passed to the constructor of the element
+    //! @param key: Key
+    //! @param args: Arguments that are passed to the constructor of the element
+    //! @return Slot of the element with the key and TRUE if the element was inserted
+    template <typename... _args>
+    std::pair<size_t, bool> InsertUnique(const _keyType& key, _args&&... args);
+
+    //! @brief Gets the maximal number of elements of a table with the passed number of slots
+    //! @param numSlots: Number of slots
+    //! @return Maximal number of elements
+    static inline size_t MaxLoad(size_t numSlots);
+
+    //! @brief Creates a new table with the passed number of groups and moves all elements into it
+    //! @param numGroups: Number of groups. Must be a power of 2.
+    void Rehash(size_t numGroups);
+
+    //! @brief Gets a bit mask of all slots of a group that are empty
+    //! @param group: Group index
+    //! @return Bit mask with one bit per slot
+    inline U32 MatchEmpty(size_t group) const;
+
+    //! @brief Gets a bit mask of all slots of a group that are empty or deleted
+    //! @param group: Group index
+    //! @return Bit mask with one bit per slot
+    inline U32 MatchFree(size_t group) const;
+
+    //! @brief Gets a bit mask of all slots of a group that contain an element
+    //! @param group: Group index
+    //! @return Bit mask with one bit per slot
+    inline U32 MatchFull(size_t group) const;
+
+    //! @brief Gets a bit mask of all slots of a group that contain an element with the passed 7 bit hash
+    //! @param group: Group index
+    //! @param h2: 7 bit hash
+    //! @return Bit mask with one bit per slot
+    inline U32 MatchH2(size_t group, I8 h2) const;
+
+    //! @brief Sets the control byte of a slot
+    //! @param slot: Slot index
+    //! @param control: Control byte
+    inline void SetControl(size_t slot, I8 control);
+};
+
+
+
+//! @brief Forward iterator of the flat hash map
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+class FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator
+{
+    friend class FlatHashMapTemplate;
+    template <bool>
+    friend class Iterator;
+
+    using MapType = std::conditional_t<_isConst, const FlatHashMapTemplate, FlatHashMapTemplate>;
+
+    MapType* mMap;
+    size_t mSlot;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename FlatHashMapTemplate::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<_isConst, const value_type*, value_type*>;
+    using reference = std::conditional_t<_isConst, const value_type&, value_type&>;
+
+    //! @brief Creates an iterator
+    //! @param map: Map
+    //! @param slot: Slot index. If the slot is not in use, the iterator is moved to the next used slot.
+    Iterator(MapType* map, size_t slot);
+
+    //! @brief Converts a non-const iterator to a const iterator
+    //! @param other: Non-const iterator
+    template <bool _isConstOther, typename = std::enable_if_t<_isConst && !_isConstOther>>
+    Iterator(const Iterator<_isConstOther>& other);
+
+    Iterator() = delete;
+    Iterator(const Iterator&) = default;
+    Iterator(Iterator&&) = default;
+    Iterator& operator=(const Iterator&) = default;
+    Iterator& operator=(Iterator&&) = default;
+    ~Iterator() = default;
+
+    reference operator*() const;
+    pointer operator->() const;
+    Iterator& operator++();
+    Iterator operator++(int);
+    bool operator==(const Iterator& other) const;
+    bool operator!=(const Iterator& other) const;
+
+private:
+    //! @brief Moves the iterator to the next used slot, starting at the current one
+    void SkipUnusedSlots();
+};
+
+} // namespace GDL
+
+
+
+// Aliases ------------------------------------------------------------------------------------------------------------
+
+#ifndef USE_STD_ALLOCATOR
+
+#include "gdl/resources/memory/generalPurposeAllocator.h"
+#include "gdl/resources/memory/stackAllocator.h"
+#include "gdl/resources/memory/threadPrivateStackAllocator.h"
+
+namespace GDL
+{
+
+template <typename _keyType, typename _valueType, typename _hash = std::hash<_keyType>,
+          typename _keyEqual = std::equal_to<_keyType>>
+using FlatHashMap = FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual,
+                                        GeneralPurposeAllocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _hash = std::hash<_keyType>,
+          typename _keyEqual = std::equal_to<_keyType>>
+using FlatHashMapS =
+        FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, StackAllocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _hash = std::hash<_keyType>,
+          typename _keyEqual = std::equal_to<_keyType>>
+using FlatHashMapTPS = FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual,
+                                           ThreadPrivateStackAllocator<std::pair<_keyType, _valueType>>>;
+} // namespace GDL
+
+#else
+
+namespace GDL
+{
+
+template <typename _keyType, typename _valueType, typename _hash = std::hash<_keyType>,
+          typename _keyEqual = std::equal_to<_keyType>>
+using FlatHashMap =
+        FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, std::allocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _hash = std::hash<_keyType>,
+          typename _keyEqual = std::equal_to<_keyType>>
+using FlatHashMapS =
+        FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, std::allocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _hash = std::hash<_keyType>,
+          typename _keyEqual = std::equal_to<_keyType>>
+using FlatHashMapTPS =
+        FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, std::allocator<std::pair<_keyType, _valueType>>>;
+} // namespace GDL
+
+#endif
+
+
+#include "gdl/base/container/flatHashMap.inl"
@@ -0,0 +1,626 @@
+#pragma once
+
+#include "gdl/base/container/flatHashMap.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/bitScan.h"
+
+#include <new>
+#include <tuple>
+
+namespace GDL
+{
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::FlatHashMapTemplate()
+    : mGroups{nullptr}
+    , mSlots{nullptr}
+    , mNumGroups{0}
+    , mSize{0}
+    , mGrowthLeft{0}
+    , mHash{}
+    , mKeyEqual{}
+{
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::FlatHashMapTemplate(
+        const FlatHashMapTemplate& other)
+    : FlatHashMapTemplate()
+{
+    mHash = other.mHash;
+    mKeyEqual = other.mKeyEqual;
+    reserve(other.size());
+    for (const auto& element : other)
+        InsertUnique(element.first, element);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::FlatHashMapTemplate(
+        FlatHashMapTemplate&& other) noexcept
+    : mGroups{std::exchange(other.mGroups, nullptr)}
+    , mSlots{std::exchange(other.mSlots, nullptr)}
+    , mNumGroups{std::exchange(other.mNumGroups, 0)}
+    , mSize{std::exchange(other.mSize, 0)}
+    , mGrowthLeft{std::exchange(other.mGrowthLeft, 0)}
+    , mHash{std::move(other.mHash)}
+    , mKeyEqual{std::move(other.mKeyEqual)}
+{
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>&
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::operator=(const FlatHashMapTemplate& other)
+{
+    if (this != &other)
+        *this = FlatHashMapTemplate(other);
+    return *this;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>&
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::operator=(FlatHashMapTemplate&& other) noexcept
+{
+    if (this != &other)
+    {
+        Deallocate();
+        mGroups = std::exchange(other.mGroups, nullptr);
+        mSlots = std::exchange(other.mSlots, nullptr);
+        mNumGroups = std::exchange(other.mNumGroups, 0);
+        mSize = std::exchange(other.mSize, 0);
+        mGrowthLeft = std::exchange(other.mGrowthLeft, 0);
+        mHash = std::move(other.mHash);
+        mKeyEqual = std::move(other.mKeyEqual);
+    }
+    return *this;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::~FlatHashMapTemplate()
+{
+    Deallocate();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+_valueType& FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::operator[](const _keyType& key)
+{
+    const size_t slot =
+            InsertUnique(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple()).first;
+    return mSlots[slot].second;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+_valueType& FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::at(const _keyType& key)
+{
+    const size_t slot = FindSlot(key, Hash(key));
+    EXCEPTION(slot == capacity(), "Key not found.");
+    return mSlots[slot].second;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+const _valueType& FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::at(
+        const _keyType& key) const
+{
+    const size_t slot = FindSlot(key, Hash(key));
+    EXCEPTION(slot == capacity(), "Key not found.");
+    return mSlots[slot].second;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::iterator
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::begin()
+{
+    return iterator(this, 0);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::const_iterator
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::capacity() const
+{
+    return mNumGroups * GroupSize;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+void FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::clear()
+{
+    for (size_t group = 0; group < mNumGroups; ++group)
+    {
+        for (U32 mask = MatchFull(group); mask != 0; mask &= mask - 1)
+            mSlots[group * GroupSize + IndexOfLeastSignificantBit(mask)].~value_type();
+        _mm_store_si128(reinterpret_cast<__m128i*>(mGroups + group), _mm_set1_epi8(Empty));
+    }
+    mSize = 0;
+    mGrowthLeft = MaxLoad(capacity());
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+bool FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::contains(const _keyType& key) const
+{
+    return FindSlot(key, Hash(key)) != capacity();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::count(const _keyType& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <typename... _args>
+std::pair<typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::iterator, bool>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::emplace(const _keyType& key,
+                                                                                 _args&&... args)
+{
+    const auto [slot, inserted] = InsertUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                                               std::forward_as_tuple(std::forward<_args>(args)...));
+    return {iterator(this, slot), inserted};
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+bool FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::empty() const
+{
+    return mSize == 0;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::iterator
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::end()
+{
+    return iterator(this, capacity());
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::const_iterator
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::end() const
+{
+    return const_iterator(this, capacity());
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::erase(const _keyType& key)
+{
+    const const_iterator position = find(key);
+    if (position == end())
+        return 0;
+    erase(position);
+    return 1;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::iterator
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::erase(const_iterator position)
+{
+    const size_t slot = position.mSlot;
+    DEV_EXCEPTION(slot >= capacity() || mGroups[slot / GroupSize].mControl[slot % GroupSize] < 0,
+                  "Iterator does not point to an element.");
+
+    mSlots[slot].~value_type();
+    --mSize;
+
+    // A lookup stops at the first group with an empty slot. If the group had no empty slot, a key that was inserted
+    // afterwards might have been placed in a later group. The slot must be marked as deleted in this case.
+    if (MatchEmpty(slot / GroupSize) != 0)
+    {
+        SetControl(slot, Empty);
+        ++mGrowthLeft;
+    }
+    else
+        SetControl(slot, Deleted);
+
+    return iterator(this, slot);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::iterator
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::find(const _keyType& key)
+{
+    return iterator(this, FindSlot(key, Hash(key)));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::const_iterator
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::find(const _keyType& key) const
+{
+    return const_iterator(this, FindSlot(key, Hash(key)));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+std::pair<typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::iterator, bool>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::insert(const value_type& value)
+{
+    const auto [slot, inserted] = InsertUnique(value.first, value);
+    return {iterator(this, slot), inserted};
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+std::pair<typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::iterator, bool>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::insert(value_type&& value)
+{
+    const auto [slot, inserted] = InsertUnique(value.first, std::move(value));
+    return {iterator(this, slot), inserted};
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+void FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::reserve(size_t numElements)
+{
+    size_t numGroups = 1;
+    while (MaxLoad(numGroups * GroupSize) < numElements)
+        numGroups *= 2;
+
+    if (numGroups > mNumGroups)
+        Rehash(numGroups);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::size() const
+{
+    return mSize;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+void FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Deallocate()
+{
+    if (mGroups == nullptr)
+        return;
+
+    clear();
+    SlotAllocator().deallocate(mSlots, capacity());
+    GroupAllocator().deallocate(mGroups, mNumGroups);
+    mGroups = nullptr;
+    mSlots = nullptr;
+    mNumGroups = 0;
+    mGrowthLeft = 0;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::FindSlot(const _keyType& key,
+                                                                                                size_t hash) const
+{
+    if (mNumGroups == 0)
+        return capacity();
+
+    const size_t groupMask = mNumGroups - 1;
+    const I8 h2 = H2(hash);
+    size_t group = (hash >> 7) & groupMask;
+    for (size_t step = 1;; ++step)
+    {
+        for (U32 mask = MatchH2(group, h2); mask != 0; mask &= mask - 1)
+        {
+            const size_t slot = group * GroupSize + IndexOfLeastSignificantBit(mask);
+            if (mKeyEqual(mSlots[slot].first, key))
+                return slot;
+        }
+        if (MatchEmpty(group) != 0)
+            return capacity();
+
+        // Triangular probing visits every group once if the number of groups is a power of 2
+        group = (group + step) & groupMask;
+    }
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::FindFreeSlot(size_t hash) const
+{
+    DEV_EXCEPTION(mNumGroups == 0, "Table has no slots.");
+
+    const size_t groupMask = mNumGroups - 1;
+    size_t group = (hash >> 7) & groupMask;
+    for (size_t step = 1;; ++step)
+    {
+        const U32 mask = MatchFree(group);
+        if (mask != 0)
+            return group * GroupSize + IndexOfLeastSignificantBit(mask);
+        group = (group + step) & groupMask;
+    }
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Hash(const _keyType& key) const
+{
+    const U64 hash = static_cast<U64>(mHash(key)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline I8 FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::H2(size_t hash)
+{
+    return static_cast<I8>(hash & 0x7F);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <typename... _args>
+std::pair<size_t, bool>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::InsertUnique(const _keyType& key,
+                                                                                      _args&&... args)
+{
+    const size_t hash = Hash(key);
+    const size_t existingSlot = FindSlot(key, hash);
+    if (existingSlot != capacity())
+        return {existingSlot, false};
+
+    if (mGrowthLeft == 0)
+    {
+        // Only rehash without growing if most of the used up slots are deleted ones
+        if (mNumGroups != 0 && mSize < MaxLoad(capacity()) / 2)
+            Rehash(mNumGroups);
+        else
+            Rehash(mNumGroups == 0 ? 1 : 2 * mNumGroups);
+    }
+
+    const size_t slot = FindFreeSlot(hash);
+    new (mSlots + slot) value_type(std::forward<_args>(args)...);
+    if (mGroups[slot / GroupSize].mControl[slot % GroupSize] == Empty)
+        --mGrowthLeft;
+    SetControl(slot, H2(hash));
+    ++mSize;
+
+    return {slot, true};
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline size_t FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::MaxLoad(size_t numSlots)
+{
+    return numSlots - numSlots / 8;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline U32 FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::MatchEmpty(size_t group) const
+{
+    const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(mGroups + group));
+    return static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(Empty))));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline U32 FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::MatchFree(size_t group) const
+{
+    const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(mGroups + group));
+    return static_cast<U32>(_mm_movemask_epi8(control));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline U32 FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::MatchFull(size_t group) const
+{
+    return ~MatchFree(group) & 0xFFFF;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline U32 FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::MatchH2(size_t group,
+                                                                                           I8 h2) const
+{
+    const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(mGroups + group));
+    return static_cast<U32>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(h2))));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+void FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Rehash(size_t numGroups)
+{
+    DEV_EXCEPTION((numGroups & (numGroups - 1)) != 0, "Number of groups must be a power of 2.");
+    DEV_EXCEPTION(MaxLoad(numGroups * GroupSize) < mSize, "Number of groups is too small.");
+
+    FlatHashMapTemplate other;
+    other.mGroups = GroupAllocator().allocate(numGroups);
+    other.mSlots = SlotAllocator().allocate(numGroups * GroupSize);
+    other.mNumGroups = numGroups;
+    for (size_t group = 0; group < numGroups; ++group)
+        _mm_store_si128(reinterpret_cast<__m128i*>(other.mGroups + group), _mm_set1_epi8(Empty));
+
+    for (size_t group = 0; group < mNumGroups; ++group)
+        for (U32 mask = MatchFull(group); mask != 0; mask &= mask - 1)
+        {
+            const size_t slot = group * GroupSize + IndexOfLeastSignificantBit(mask);
+            const size_t hash = Hash(mSlots[slot].first);
+            const size_t newSlot = other.FindFreeSlot(hash);
+            new (other.mSlots + newSlot) value_type(std::move(mSlots[slot]));
+            other.SetControl(newSlot, H2(hash));
+        }
+    other.mSize = mSize;
+    other.mGrowthLeft = MaxLoad(other.capacity()) - mSize;
+    other.mHash = std::move(mHash);
+    other.mKeyEqual = std::move(mKeyEqual);
+
+    *this = std::move(other);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+inline void FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::SetControl(size_t slot,
+                                                                                               I8 control)
+{
+    mGroups[slot / GroupSize].mControl[slot % GroupSize] = control;
+}
+
+
+
+// Iterator -----------------------------------------------------------------------------------------------------------
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::Iterator(MapType* map,
+                                                                                                     size_t slot)
+    : mMap{map}
+    , mSlot{slot}
+{
+    SkipUnusedSlots();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+template <bool _isConstOther, typename>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::Iterator(
+        const Iterator<_isConstOther>& other)
+    : mMap{other.mMap}
+    , mSlot{other.mSlot}
+{
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::template Iterator<_isConst>::reference
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::operator*() const
+{
+    DEV_EXCEPTION(mSlot >= mMap->capacity(), "Can't dereference end iterator.");
+    return mMap->mSlots[mSlot];
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::template Iterator<_isConst>::pointer
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::operator->() const
+{
+    return &operator*();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::template Iterator<_isConst>&
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::operator++()
+{
+    DEV_EXCEPTION(mSlot >= mMap->capacity(), "Can't increment end iterator.");
+    ++mSlot;
+    SkipUnusedSlots();
+    return *this;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+typename FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::template Iterator<_isConst>
+FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::operator++(int)
+{
+    Iterator copy(*this);
+    ++(*this);
+    return copy;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+bool FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::operator==(
+        const Iterator& other) const
+{
+    return mSlot == other.mSlot && mMap == other.mMap;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+bool FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::operator!=(
+        const Iterator& other) const
+{
+    return !(*this == other);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _hash, typename _keyEqual, typename _allocator>
+template <bool _isConst>
+void FlatHashMapTemplate<_keyType, _valueType, _hash, _keyEqual, _allocator>::Iterator<_isConst>::SkipUnusedSlots()
+{
+    const size_t capacity = mMap->capacity();
+    while (mSlot < capacity)
+    {
+        const U32 mask = mMap->MatchFull(mSlot / GroupSize) >> (mSlot % GroupSize);
+        if (mask != 0)
+        {
+            mSlot += IndexOfLeastSignificantBit(mask);
+            return;
+        }
+        mSlot = (mSlot / GroupSize + 1) * GroupSize;
+    }
+}
+
+} // namespace GDL
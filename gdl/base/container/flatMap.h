@@ -0,0 +1,237 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace GDL
+{
+
+//! @brief Ordered map that stores its elements sorted by key in a single contiguous array instead of separately
+//! allocated tree nodes. Lookups are binary searches and iterating the elements is a linear walk through memory.
+//! Insertions and deletions move all elements behind the modified position, so the container is best suited for maps
+//! that are built once and read often.
+//! @tparam _keyType: Key type
+//! @tparam _valueType: Value type
+//! @tparam _compare: Function that defines the order of the keys
+//! @tparam _allocator: Allocator. It is rebound to the element type.
+//! @remark The interface follows std::map. In contrast to std::map, insertions and deletions invalidate all
+//! iterators, pointers and references to elements behind the modified position. The stored keys must not be modified.
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+class FlatMapTemplate
+{
+public:
+    using key_type = _keyType;
+    using mapped_type = _valueType;
+    using value_type = std::pair<_keyType, _valueType>;
+    using key_compare = _compare;
+    using allocator_type = _allocator;
+
+private:
+    using ContainerType =
+            std::vector<value_type, typename std::allocator_traits<_allocator>::template rebind_alloc<value_type>>;
+
+public:
+    using size_type = typename ContainerType::size_type;
+    using iterator = typename ContainerType::iterator;
+    using const_iterator = typename ContainerType::const_iterator;
+
+private:
+    ContainerType mElements;
+    _compare mCompare;
+
+public:
+    FlatMapTemplate() = default;
+    FlatMapTemplate(const FlatMapTemplate&) = default;
+    FlatMapTemplate(FlatMapTemplate&&) = default;
+    FlatMapTemplate& operator=(const FlatMapTemplate&) = default;
+    FlatMapTemplate& operator=(FlatMapTemplate&&) = default;
+    ~FlatMapTemplate() = default;
+
+    //! @brief Gets the value of a key. If the key doesn't exist, a default constructed value is inserted.
+    //! @param key: Key
+    //! @return Reference to the value
+    _valueType& operator[](const _keyType& key);
+
+    //! @brief Gets the value of a key. Throws if the key doesn't exist.
+    //! @param key: Key
+    //! @return Reference to the value
+    _valueType& at(const _keyType& key);
+
+    //! @brief Gets the value of a key. Throws if the key doesn't exist.
+    //! @param key: Key
+    //! @return Reference to the value
+    const _valueType& at(const _keyType& key) const;
+
+    //! @brief Gets an iterator to the element with the smallest key
+    //! @return Iterator to the first element
+    iterator begin();
+
+    //! @brief Gets an iterator to the element with the smallest key
+    //! @return Iterator to the first element
+    const_iterator begin() const;
+
+    //! @brief Gets the number of elements that can be stored without reallocation
+    //! @return Capacity
+    size_t capacity() const;
+
+    //! @brief Removes all elements. The memory is kept.
+    void clear();
+
+    //! @brief Returns if the map contains the passed key
+    //! @param key: Key
+    //! @return TRUE / FALSE
+    bool contains(const _keyType& key) const;
+
+    //! @brief Counts the elements with the passed key
+    //! @param key: Key
+    //! @return 1 if the key exists, 0 otherwise
+    size_t count(const _keyType& key) const;
+
+    //! @brief Inserts a new element if the key doesn't exist
+    //! @tparam _args: Types of the arguments that are passed to the values constructor
+    //! @param key: Key
+    //! @param args: Arguments that are passed to the values constructor
+    //! @return Iterator to the element with the key and TRUE if the element was inserted
+    template <typename... _args>
+    std::pair<iterator, bool> emplace(const _keyType& key, _args&&... args);
+
+    //! @brief Returns if the map is empty
+    //! @return TRUE / FALSE
+    bool empty() const;
+
+    //! @brief Gets an iterator behind the last element
+    //! @return Iterator behind the last element
+    iterator end();
+
+    //! @brief Gets an iterator behind the last element
+    //! @return Iterator behind the last element
+    const_iterator end() const;
+
+    //! @brief Removes the element with the passed key
+    //! @param key: Key
+    //! @return Number of removed elements
+    size_t erase(const _keyType& key);
+
+    //! @brief Removes the element the passed iterator points to
+    //! @param position: Iterator to the element
+    //! @return Iterator to the next element
+    iterator erase(const_iterator position);
+
+    //! @brief Finds the element with the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end() if the key doesn't exist
+    iterator find(const _keyType& key);
+
+    //! @brief Finds the element with the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end() if the key doesn't exist
+    const_iterator find(const _keyType& key) const;
+
+    //! @brief Inserts a new element if the key doesn't exist
+    //! @param value: Key and value of the new element
+    //! @return Iterator to the element with the key and TRUE if the element was inserted
+    std::pair<iterator, bool> insert(const value_type& value);
+
+    //! @brief Inserts a new element if the key doesn't exist
+    //! @param value: Key and value of the new element
+    //! @return Iterator to the element with the key and TRUE if the element was inserted
+    std::pair<iterator, bool> insert(value_type&& value);
+
+    //! @brief Gets an iterator to the first element whose key is not smaller than the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end()
+    iterator lower_bound(const _keyType& key);
+
+    //! @brief Gets an iterator to the first element whose key is not smaller than the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end()
+    const_iterator lower_bound(const _keyType& key) const;
+
+    //! @brief Reserves memory for the passed number of elements
+    //! @param numElements: Number of elements
+    void reserve(size_t numElements);
+
+    //! @brief Gets the number of elements
+    //! @return Number of elements
+    size_t size() const;
+
+    //! @brief Gets an iterator to the first element whose key is larger than the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end()
+    iterator upper_bound(const _keyType& key);
+
+    //! @brief Gets an iterator to the first element whose key is larger than the passed key
+    //! @param key: Key
+    //! @return Iterator to the element or end()
+    const_iterator upper_bound(const _keyType& key) const;
+
+private:
+    //! @brief Returns if the element at the passed position has the passed key
+    //! @param position: Position of the element. Might be end().
+    //! @param key: Key
+    //! @return TRUE / FALSE
+    bool HasKey(const_iterator position, const _keyType& key) const;
+
+    //! @brief Gets the index of the first element whose key is not smaller than the passed key
+    //! @param key: Key
+    //! @return Index of the element or size() if all keys are smaller
+    size_t LowerBoundIndex(const _keyType& key) const;
+
+    //! @brief Inserts a new element at the sorted position of the passed key, if the key doesn't exist
+    //! @tparam _args: Types of the arguments that are passed to the constructor of the element
+    //! @param key: Key
+    //! @param args: Arguments that are passed to the constructor of the element
+    //! @return Iterator to the element with the key and TRUE if the element was inserted
+    template <typename... _args>
+    std::pair<iterator, bool> InsertUnique(const _keyType& key, _args&&... args);
+};
+
+} // namespace GDL
+
+
+
+// Aliases ------------------------------------------------------------------------------------------------------------
+
+#ifndef USE_STD_ALLOCATOR
+
+#include "gdl/resources/memory/generalPurposeAllocator.h"
+#include "gdl/resources/memory/stackAllocator.h"
+#include "gdl/resources/memory/threadPrivateStackAllocator.h"
+
+namespace GDL
+{
+
+template <typename _keyType, typename _valueType, typename _compare = std::less<_keyType>>
+using FlatMap =
+        FlatMapTemplate<_keyType, _valueType, _compare, GeneralPurposeAllocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _compare = std::less<_keyType>>
+using FlatMapS = FlatMapTemplate<_keyType, _valueType, _compare, StackAllocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _compare = std::less<_keyType>>
+using FlatMapTPS =
+        FlatMapTemplate<_keyType, _valueType, _compare, ThreadPrivateStackAllocator<std::pair<_keyType, _valueType>>>;
+} // namespace GDL
+
+#else
+
+namespace GDL
+{
+
+template <typename _keyType, typename _valueType, typename _compare = std::less<_keyType>>
+using FlatMap = FlatMapTemplate<_keyType, _valueType, _compare, std::allocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _compare = std::less<_keyType>>
+using FlatMapS = FlatMapTemplate<_keyType, _valueType, _compare, std::allocator<std::pair<_keyType, _valueType>>>;
+
+template <typename _keyType, typename _valueType, typename _compare = std::less<_keyType>>
+using FlatMapTPS = FlatMapTemplate<_keyType, _valueType, _compare, std::allocator<std::pair<_keyType, _valueType>>>;
+} // namespace GDL
+
+#endif
+
+
+#include "gdl/base/container/flatMap.inl"
@@ -0,0 +1,288 @@
+#pragma once
+
+#include "gdl/base/container/flatMap.h"
+
+#include "gdl/base/exception.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace GDL
+{
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+_valueType& FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::operator[](const _keyType& key)
+{
+    return InsertUnique(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple())
+            .first->second;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+_valueType& FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::at(const _keyType& key)
+{
+    const iterator position = find(key);
+    EXCEPTION(position == end(), "Key not found.");
+    return position->second;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+const _valueType& FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::at(const _keyType& key) const
+{
+    const const_iterator position = find(key);
+    EXCEPTION(position == end(), "Key not found.");
+    return position->second;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::begin()
+{
+    return mElements.begin();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::const_iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::begin() const
+{
+    return mElements.begin();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+size_t FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::capacity() const
+{
+    return mElements.capacity();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+void FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::clear()
+{
+    mElements.clear();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+bool FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::contains(const _keyType& key) const
+{
+    return HasKey(lower_bound(key), key);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+size_t FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::count(const _keyType& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+template <typename... _args>
+std::pair<typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator, bool>
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::emplace(const _keyType& key, _args&&... args)
+{
+    return InsertUnique(key, std::piecewise_construct, std::forward_as_tuple(key),
+                        std::forward_as_tuple(std::forward<_args>(args)...));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+bool FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::empty() const
+{
+    return mElements.empty();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::end()
+{
+    return mElements.end();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::const_iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::end() const
+{
+    return mElements.end();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+size_t FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::erase(const _keyType& key)
+{
+    const const_iterator position = find(key);
+    if (position == end())
+        return 0;
+    mElements.erase(position);
+    return 1;
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::erase(const_iterator position)
+{
+    DEV_EXCEPTION(position == end(), "Can't erase end iterator.");
+    return mElements.erase(position);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::find(const _keyType& key)
+{
+    const iterator position = lower_bound(key);
+    return HasKey(position, key) ? position : end();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::const_iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::find(const _keyType& key) const
+{
+    const const_iterator position = lower_bound(key);
+    return HasKey(position, key) ? position : end();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+std::pair<typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator, bool>
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::insert(const value_type& value)
+{
+    return InsertUnique(value.first, value);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+std::pair<typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator, bool>
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::insert(value_type&& value)
+{
+    return InsertUnique(value.first, std::move(value));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::lower_bound(const _keyType& key)
+{
+    return mElements.begin() + static_cast<std::ptrdiff_t>(LowerBoundIndex(key));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::const_iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::lower_bound(const _keyType& key) const
+{
+    return mElements.begin() + static_cast<std::ptrdiff_t>(LowerBoundIndex(key));
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+void FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::reserve(size_t numElements)
+{
+    mElements.reserve(numElements);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+size_t FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::size() const
+{
+    return mElements.size();
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::upper_bound(const _keyType& key)
+{
+    return std::upper_bound(mElements.begin(), mElements.end(), key,
+                            [this](const _keyType& value, const value_type& element) {
+                                return mCompare(value, element.first);
+                            });
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::const_iterator
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::upper_bound(const _keyType& key) const
+{
+    return std::upper_bound(mElements.begin(), mElements.end(), key,
+                            [this](const _keyType& value, const value_type& element) {
+                                return mCompare(value, element.first);
+                            });
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+bool FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::HasKey(const_iterator position,
+                                                                       const _keyType& key) const
+{
+    return position != mElements.end() && !mCompare(key, position->first);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+size_t FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::LowerBoundIndex(const _keyType& key) const
+{
+    if (mElements.empty())
+        return 0;
+
+    // The search range is halved without a data dependent branch, so that the compiler can use conditional moves.
+    // Random lookups would otherwise cause a branch misprediction in every second step.
+    const value_type* first = mElements.data();
+    size_t length = mElements.size();
+    while (length > 1)
+    {
+        const size_t half = length / 2;
+        first = mCompare(first[half].first, key) ? first + half : first;
+        length -= half;
+    }
+    return static_cast<size_t>(first - mElements.data()) + (mCompare(first->first, key) ? 1 : 0);
+}
+
+
+
+template <typename _keyType, typename _valueType, typename _compare, typename _allocator>
+template <typename... _args>
+std::pair<typename FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::iterator, bool>
+FlatMapTemplate<_keyType, _valueType, _compare, _allocator>::InsertUnique(const _keyType& key, _args&&... args)
+{
+    const iterator position = lower_bound(key);
+    if (HasKey(position, key))
+        return {position, false};
+    return {mElements.emplace(position, std::forward<_args>(args)...), true};
+}
+
+} // namespace GDL
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+
+namespace GDL
+{
+
+//! @brief Vector that stores up to _numInlineElements elements inside of the object itself. Memory is only allocated
+//! if more elements are added. This avoids allocations for the large number of short-lived containers that usually hold
+//! only a few elements.
+//! @tparam _type: Element type
+//! @tparam _numInlineElements: Number of elements that can be stored without allocating memory
+//! @tparam _allocator: Allocator that is used once the inline storage is exceeded. It is rebound to the element type.
+//! @remark The interface follows std::vector. In contrast to std::vector, moving a vector that uses its inline storage
+//! moves the individual elements and invalidates all iterators, pointers and references to them. The PoolAllocator
+//! can't be used, since it doesn't support arrays.
+template <typename _type, U32 _numInlineElements, typename _allocator>
+class SmallVectorTemplate
+{
+    static_assert(_numInlineElements > 0, "The number of inline elements must be larger than 0.");
+
+    using AllocatorType = typename std::allocator_traits<_allocator>::template rebind_alloc<_type>;
+
+public:
+    using value_type = _type;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = _type&;
+    using const_reference = const _type&;
+    using pointer = _type*;
+    using const_pointer = const _type*;
+    using iterator = _type*;
+    using const_iterator = const _type*;
+    using allocator_type = _allocator;
+
+private:
+    _type* mData;
+    size_t mSize;
+    size_t mCapacity;
+    alignas(_type) U8 mInlineStorage[_numInlineElements * sizeof(_type)];
+
+public:
+    //! @brief Creates an empty vector
+    SmallVectorTemplate();
+
+    //! @brief Creates a vector with <size> value initialized elements
+    //! @param size: Number of elements
+    explicit SmallVectorTemplate(size_t size);
+
+    //! @brief Creates a vector with <size> copies of the passed value
+    //! @param size: Number of elements
+    //! @param value: Value of the elements
+    SmallVectorTemplate(size_t size, const _type& value);
+
+    //! @brief Creates a vector from an initializer list
+    //! @param values: Values of the elements
+    SmallVectorTemplate(std::initializer_list<_type> values);
+
+    SmallVectorTemplate(const SmallVectorTemplate& other);
+    SmallVectorTemplate(SmallVectorTemplate&& other) noexcept(std::is_nothrow_move_constructible_v<_type>);
+    SmallVectorTemplate& operator=(const SmallVectorTemplate& other);
+    SmallVectorTemplate& operator=(SmallVectorTemplate&& other) noexcept(std::is_nothrow_move_constructible_v<_type>);
+    ~SmallVectorTemplate();
+
+    //! @brief Gets an element
+    //! @param index: Index of the element
+    //! @return Reference to the element
+    inline _type& operator[](size_t index);
+
+    //! @brief Gets an element
+    //! @param index: Index of the element
+    //! @return Reference to the element
+    inline const _type& operator[](size_t index) const;
+
+    //! @brief Compares the elements of two vectors
+    //! @param other: Other vector
+    //! @return TRUE if both vectors contain the same elements
+    bool operator==(const SmallVectorTemplate& other) const;
+
+    //! @brief Compares the elements of two vectors
+    //! @param other: Other vector
+    //! @return TRUE if the vectors contain different elements
+    bool operator!=(const SmallVectorTemplate& other) const;
+
+    //! @brief Gets an element. Throws if the index is out of range.
+    //! @param index: Index of the element
+    //! @return Reference to the element
+    _type& at(size_t index);
+
+    //! @brief Gets an element. Throws if the index is out of range.
+    //! @param index: Index of the element
+    //! @return Reference to the element
+    const _type& at(size_t index) const;
+
+    //! @brief Gets the last element
+    //! @return Reference to the last element
+    inline _type& back();
+
+    //! @brief Gets the last element
+    //! @return Reference to the last element
+    inline const _type& back() const;
+
+    //! @brief Gets an iterator to the first element
+    //! @return Iterator to the first element
+    inline iterator begin();
+
+    //! @brief Gets an iterator to the first element
+    //! @return Iterator to the first element
+    inline const_iterator begin() const;
+
+    //! @brief Gets the number of elements that can be stored without allocating memory
+    //! @return Capacity
+    inline size_t capacity() const;
+
+    //! @brief Destroys all elements. The memory is kept.
+    void clear();
+
+    //! @brief Gets a pointer to the first element
+    //! @return Pointer to the first element
+    inline _type* data();
+
+    //! @brief Gets a pointer to the first element
+    //! @return Pointer to the first element
+    inline const _type* data() const;
+
+    //! @brief Constructs a new element at the end of the vector
+    //! @tparam _args: Types of the arguments that are passed to the elements constructor
+    //! @param args: Arguments that are passed to the elements constructor
+    //! @return Reference to the new element
+    template <typename... _args>
+    _type& emplace_back(_args&&... args);
+
+    //! @brief Returns if the vector is empty
+    //! @return TRUE / FALSE
+    inline bool empty() const;
+
+    //! @brief Gets an iterator behind the last element
+    //! @return Iterator behind the last element
+    inline iterator end();
+
+    //! @brief Gets an iterator behind the last element
+    //! @return Iterator behind the last element
+    inline const_iterator end() const;
+
+    //! @brief Removes an element and moves all following elements one position to the front
+    //! @param position: Iterator to the element
+    //! @return Iterator to the element that followed the removed one
+    iterator erase(const_iterator position);
+
+    //! @brief Gets the first element
+    //! @return Reference to the first element
+    inline _type& front();
+
+    //! @brief Gets the first element
+    //! @return Reference to the first element
+    inline const _type& front() const;
+
+    //! @brief Returns if the elements are stored in the inline storage
+    //! @return TRUE / FALSE
+    inline bool is_inline() const;
+
+    //! @brief Removes the last element
+    void pop_back();
+
+    //! @brief Adds a copy of the passed value at the end of the vector
+    //! @param value: Value
+    void push_back(const _type& value);
+
+    //! @brief Moves the passed value to the end of the vector
+    //! @param value: Value
+    void push_back(_type&& value);
+
+    //! @brief Reserves memory for at least <capacity> elements
+    //! @param capacity: Number of elements
+    void reserve(size_t capacity);
+
+    //! @brief Changes the number of elements. New elements are value initialized.
+    //! @param size: New number of elements
+    void resize(size_t size);
+
+    //! @brief Changes the number of elements. New elements are copies of the passed value.
+    //! @param size: New number of elements
+    //! @param value: Value of new elements
+    void resize(size_t size, const _type& value);
+
+    //! @brief Gets the number of elements
+    //! @return Number of elements
+    inline size_t size() const;
+
+private:
+    //! @brief Gets the first element of the inline storage
+    //! @return Pointer to the first element of the inline storage
+    inline _type* InlineData();
+
+    //! @brief Calculates the capacity that should be used if the current one is exceeded
+    //! @param minCapacity: Minimal required capacity
+    //! @return New capacity
+    inline size_t GrowCapacity(size_t minCapacity) const;
+
+    //! @brief Moves all elements into the passed memory and frees the current memory if it was allocated
+    //! @param data: New memory
+    //! @param capacity: Capacity of the new memory
+    void MoveToMemory(_type* data, size_t capacity);
+
+    //! @brief Frees all allocated memory and switches back to the inline storage. The elements must already be
+    //! destroyed.
+    void ResetToInlineStorage();
+
+    //! @brief Takes the elements of another vector. The elements of this vector must already be destroyed and its
+    //! memory must use the inline storage.
+    //! @param other: Other vector. It is empty afterwards and uses its inline storage.
+    void TakeElements(SmallVectorTemplate&& other);
+};
+
+} // namespace GDL
+
+
+
+// Aliases ------------------------------------------------------------------------------------------------------------
+
+#ifndef USE_STD_ALLOCATOR
+
+#include "gdl/resources/memory/frameAllocator.h"
+#include "gdl/resources/memory/generalPurposeAllocator.h"
+#include "gdl/resources/memory/stackAllocator.h"
+#include "gdl/resources/memory/threadPrivateStackAllocator.h"
+
+namespace GDL
+{
+
+template <typename _type, U32 _numInlineElements>
+using SmallVector = SmallVectorTemplate<_type, _numInlineElements, GeneralPurposeAllocator<_type>>;
+
+template <typename _type, U32 _numInlineElements>
+using SmallVectorF = SmallVectorTemplate<_type, _numInlineElements, FrameAllocator<_type>>;
+
+template <typename _type, U32 _numInlineElements>
+using SmallVectorS = SmallVectorTemplate<_type, _numInlineElements, StackAllocator<_type>>;
+
+template <typename _type, U32 _numInlineElements>
+using SmallVectorTPS = SmallVectorTemplate<_type, _numInlineElements, ThreadPrivateStackAllocator<_type>>;
+} // namespace GDL
+
+#else
+
+namespace GDL
+{
+
+template <typename _type, U32 _numInlineElements>
+using SmallVector = SmallVectorTemplate<_type, _numInlineElements, std::allocator<_type>>;
+
+template <typename _type, U32 _numInlineElements>
+using SmallVectorF = SmallVectorTemplate<_type, _numInlineElements, std::allocator<_type>>;
+
+template <typename _type, U32 _numInlineElements>
+using SmallVectorS = SmallVectorTemplate<_type, _numInlineElements, std::allocator<_type>>;
+
+template <typename _type, U32 _numInlineElements>
+using SmallVectorTPS = SmallVectorTemplate<_type, _numInlineElements, std::allocator<_type>>;
+} // namespace GDL
+
+#endif
+
+
+#include "gdl/base/container/smallVector.inl"
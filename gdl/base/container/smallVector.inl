@@ -0,0 +1,472 @@
+#pragma once
+
+#include "gdl/base/container/smallVector.h"
+
+#include "gdl/base/exception.h"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace GDL
+{
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::SmallVectorTemplate()
+    : mData{InlineData()}
+    , mSize{0}
+    , mCapacity{_numInlineElements}
+{
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::SmallVectorTemplate(size_t size)
+    : SmallVectorTemplate()
+{
+    resize(size);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::SmallVectorTemplate(size_t size, const _type& value)
+    : SmallVectorTemplate()
+{
+    resize(size, value);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::SmallVectorTemplate(std::initializer_list<_type> values)
+    : SmallVectorTemplate()
+{
+    reserve(values.size());
+    std::uninitialized_copy(values.begin(), values.end(), mData);
+    mSize = values.size();
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::SmallVectorTemplate(const SmallVectorTemplate& other)
+    : SmallVectorTemplate()
+{
+    reserve(other.mSize);
+    std::uninitialized_copy(other.begin(), other.end(), mData);
+    mSize = other.mSize;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::SmallVectorTemplate(SmallVectorTemplate&& other) noexcept(
+        std::is_nothrow_move_constructible_v<_type>)
+    : SmallVectorTemplate()
+{
+    TakeElements(std::move(other));
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>&
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::operator=(const SmallVectorTemplate& other)
+{
+    if (this != &other)
+    {
+        clear();
+        reserve(other.mSize);
+        std::uninitialized_copy(other.begin(), other.end(), mData);
+        mSize = other.mSize;
+    }
+    return *this;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>&
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::operator=(SmallVectorTemplate&& other) noexcept(
+        std::is_nothrow_move_constructible_v<_type>)
+{
+    if (this != &other)
+    {
+        clear();
+        ResetToInlineStorage();
+        TakeElements(std::move(other));
+    }
+    return *this;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::~SmallVectorTemplate()
+{
+    clear();
+    ResetToInlineStorage();
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline _type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::operator[](size_t index)
+{
+    DEV_EXCEPTION(index >= mSize, "Index out of range.");
+    return mData[index];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline const _type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::operator[](size_t index) const
+{
+    DEV_EXCEPTION(index >= mSize, "Index out of range.");
+    return mData[index];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+bool SmallVectorTemplate<_type, _numInlineElements, _allocator>::operator==(const SmallVectorTemplate& other) const
+{
+    return mSize == other.mSize && std::equal(begin(), end(), other.begin());
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+bool SmallVectorTemplate<_type, _numInlineElements, _allocator>::operator!=(const SmallVectorTemplate& other) const
+{
+    return !(*this == other);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+_type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::at(size_t index)
+{
+    EXCEPTION(index >= mSize, "Index out of range.");
+    return mData[index];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+const _type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::at(size_t index) const
+{
+    EXCEPTION(index >= mSize, "Index out of range.");
+    return mData[index];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline _type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::back()
+{
+    DEV_EXCEPTION(mSize == 0, "Vector is empty.");
+    return mData[mSize - 1];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline const _type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::back() const
+{
+    DEV_EXCEPTION(mSize == 0, "Vector is empty.");
+    return mData[mSize - 1];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline typename SmallVectorTemplate<_type, _numInlineElements, _allocator>::iterator
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::begin()
+{
+    return mData;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline typename SmallVectorTemplate<_type, _numInlineElements, _allocator>::const_iterator
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::begin() const
+{
+    return mData;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline size_t SmallVectorTemplate<_type, _numInlineElements, _allocator>::capacity() const
+{
+    return mCapacity;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::clear()
+{
+    std::destroy(mData, mData + mSize);
+    mSize = 0;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline _type* SmallVectorTemplate<_type, _numInlineElements, _allocator>::data()
+{
+    return mData;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline const _type* SmallVectorTemplate<_type, _numInlineElements, _allocator>::data() const
+{
+    return mData;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+template <typename... _args>
+_type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::emplace_back(_args&&... args)
+{
+    if (mSize < mCapacity)
+        new (mData + mSize) _type(std::forward<_args>(args)...);
+    else
+    {
+        // The new element is constructed before the old ones are moved, since the arguments might reference them
+        const size_t capacity = GrowCapacity(mSize + 1);
+        _type* data = AllocatorType().allocate(capacity);
+        try
+        {
+            new (data + mSize) _type(std::forward<_args>(args)...);
+        }
+        catch (...)
+        {
+            AllocatorType().deallocate(data, capacity);
+            throw;
+        }
+        MoveToMemory(data, capacity);
+    }
+    return mData[mSize++];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline bool SmallVectorTemplate<_type, _numInlineElements, _allocator>::empty() const
+{
+    return mSize == 0;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline typename SmallVectorTemplate<_type, _numInlineElements, _allocator>::iterator
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::end()
+{
+    return mData + mSize;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline typename SmallVectorTemplate<_type, _numInlineElements, _allocator>::const_iterator
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::end() const
+{
+    return mData + mSize;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+typename SmallVectorTemplate<_type, _numInlineElements, _allocator>::iterator
+SmallVectorTemplate<_type, _numInlineElements, _allocator>::erase(const_iterator position)
+{
+    DEV_EXCEPTION(position < begin() || position >= end(), "Iterator does not point to an element.");
+
+    iterator element = mData + (position - mData);
+    std::move(element + 1, end(), element);
+    pop_back();
+    return element;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline _type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::front()
+{
+    DEV_EXCEPTION(mSize == 0, "Vector is empty.");
+    return mData[0];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline const _type& SmallVectorTemplate<_type, _numInlineElements, _allocator>::front() const
+{
+    DEV_EXCEPTION(mSize == 0, "Vector is empty.");
+    return mData[0];
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline bool SmallVectorTemplate<_type, _numInlineElements, _allocator>::is_inline() const
+{
+    return static_cast<const void*>(mData) == static_cast<const void*>(mInlineStorage);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::pop_back()
+{
+    DEV_EXCEPTION(mSize == 0, "Vector is empty.");
+    mData[--mSize].~_type();
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::push_back(const _type& value)
+{
+    emplace_back(value);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::push_back(_type&& value)
+{
+    emplace_back(std::move(value));
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::reserve(size_t capacity)
+{
+    if (capacity > mCapacity)
+        MoveToMemory(AllocatorType().allocate(capacity), capacity);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::resize(size_t size)
+{
+    if (size < mSize)
+        std::destroy(mData + size, mData + mSize);
+    else
+    {
+        if (size > mCapacity)
+            reserve(GrowCapacity(size));
+        std::uninitialized_value_construct(mData + mSize, mData + size);
+    }
+    mSize = size;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::resize(size_t size, const _type& value)
+{
+    if (size < mSize)
+        std::destroy(mData + size, mData + mSize);
+    else
+    {
+        if (size > mCapacity)
+        {
+            // The value might be an element of this vector
+            const _type copy(value);
+            reserve(GrowCapacity(size));
+            std::uninitialized_fill(mData + mSize, mData + size, copy);
+        }
+        else
+            std::uninitialized_fill(mData + mSize, mData + size, value);
+    }
+    mSize = size;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline size_t SmallVectorTemplate<_type, _numInlineElements, _allocator>::size() const
+{
+    return mSize;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline _type* SmallVectorTemplate<_type, _numInlineElements, _allocator>::InlineData()
+{
+    return reinterpret_cast<_type*>(mInlineStorage);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+inline size_t SmallVectorTemplate<_type, _numInlineElements, _allocator>::GrowCapacity(size_t minCapacity) const
+{
+    return std::max(2 * mCapacity, minCapacity);
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::MoveToMemory(_type* data, size_t capacity)
+{
+    for (size_t i = 0; i < mSize; ++i)
+        new (data + i) _type(std::move_if_noexcept(mData[i]));
+    std::destroy(mData, mData + mSize);
+
+    ResetToInlineStorage();
+    mData = data;
+    mCapacity = capacity;
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::ResetToInlineStorage()
+{
+    if (!is_inline())
+    {
+        AllocatorType().deallocate(mData, mCapacity);
+        mData = InlineData();
+        mCapacity = _numInlineElements;
+    }
+}
+
+
+
+template <typename _type, U32 _numInlineElements, typename _allocator>
+void SmallVectorTemplate<_type, _numInlineElements, _allocator>::TakeElements(SmallVectorTemplate&& other)
+{
+    DEV_EXCEPTION(!is_inline() || mSize != 0, "Vector must be empty and use its inline storage.");
+
+    if (other.is_inline())
+    {
+        for (size_t i = 0; i < other.mSize; ++i)
+            new (mData + i) _type(std::move(other.mData[i]));
+        mSize = other.mSize;
+        other.clear();
+    }
+    else
+    {
+        mData = std::exchange(other.mData, other.InlineData());
+        mSize = std::exchange(other.mSize, 0);
+        mCapacity = std::exchange(other.mCapacity, _numInlineElements);
+    }
+}
+
+} // namespace GDL
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/constants.h"
+#include "gdl/base/simd/utility.h"
+#include "gdl/base/simd/x86intrin.h"
+
+#include <array>
+
+namespace GDL
+{
+
+//! @brief Container that stores entries with multiple values of the same type as structure of arrays. Each value of
+//! an entry is stored in a separate column. The columns are aligned and padded to a multiple of the register size, so
+//! that they can be processed with aligned register loads and stores without any special treatment of the last
+//! entries.
+//! @tparam _registerType: Register type that is used to process the columns
+//! @tparam _numColumns: Number of values per entry
+//! @remark All columns share a single memory block which is allocated with the general purpose allocator. The padding
+//! values behind the last entry are always zero.
+template <typename _registerType, U32 _numColumns>
+class SoAVector
+{
+    static_assert(simd::IsRegisterType<_registerType>, "Unsupported register type.");
+    static_assert(_numColumns > 0, "The number of columns must be larger than 0.");
+
+public:
+    using Type = decltype(simd::GetDataType<_registerType>());
+    using Entry = std::array<Type, _numColumns>;
+
+    //! @brief Number of values that are processed per register
+    static constexpr U32 NumRegisterValues = simd::numRegisterValues<_registerType>;
+
+    //! @brief Registers of an array of structures block. Each register stores the values of one entry in its first
+    //! _numColumns elements.
+    using AoSBlock = std::array<_registerType, NumRegisterValues>;
+
+private:
+    Vector<_registerType> mData;
+    U32 mSize;
+    U32 mNumRegistersPerColumn;
+
+public:
+    //! @brief Creates an empty container
+    SoAVector();
+
+    //! @brief Creates a container with <size> zero initialized entries
+    //! @param size: Number of entries
+    explicit SoAVector(U32 size);
+
+    SoAVector(const SoAVector&) = default;
+    SoAVector(SoAVector&& other) noexcept;
+    SoAVector& operator=(const SoAVector&) = default;
+    SoAVector& operator=(SoAVector&& other) noexcept;
+    ~SoAVector() = default;
+
+    //! @brief Gets a reference to a single value
+    //! @param index: Index of the entry
+    //! @param column: Index of the column
+    //! @return Reference to the value
+    inline Type& operator()(U32 index, U32 column);
+
+    //! @brief Gets a single value
+    //! @param index: Index of the entry
+    //! @param column: Index of the column
+    //! @return Value
+    inline Type operator()(U32 index, U32 column) const;
+
+    //! @brief Removes all entries. The memory is kept.
+    void Clear();
+
+    //! @brief Gets an entry
+    //! @param index: Index of the entry
+    //! @return Values of the entry
+    Entry Get(U32 index) const;
+
+    //! @brief Gets the number of entries that can be stored without reallocation
+    //! @return Capacity
+    U32 GetCapacity() const;
+
+    //! @brief Gets the first value of a column. It is aligned to the size of a register.
+    //! @param column: Index of the column
+    //! @return Pointer to the first value of the column
+    inline Type* GetColumn(U32 column);
+
+    //! @brief Gets the first value of a column. It is aligned to the size of a register.
+    //! @param column: Index of the column
+    //! @return Pointer to the first value of the column
+    inline const Type* GetColumn(U32 column) const;
+
+    //! @brief Gets the first register of a column
+    //! @param column: Index of the column
+    //! @return Pointer to the first register of the column
+    inline _registerType* GetColumnRegisters(U32 column);
+
+    //! @brief Gets the first register of a column
+    //! @param column: Index of the column
+    //! @return Pointer to the first register of the column
+    inline const _registerType* GetColumnRegisters(U32 column) const;
+
+    //! @brief Gets the number of registers that are needed to process all entries of a column, including the padded
+    //! last register
+    //! @return Number of registers
+    inline U32 GetNumRegisters() const;
+
+    //! @brief Gets the number of entries
+    //! @return Number of entries
+    inline U32 GetSize() const;
+
+    //! @brief Loads the entries of a register block and transposes them to an array of structures layout
+    //! @param registerIndex: Index of the register block. The block contains the entries with the indices
+    //! [registerIndex * NumRegisterValues, (registerIndex + 1) * NumRegisterValues).
+    //! @return Array of structures block
+    AoSBlock LoadAoSBlock(U32 registerIndex) const;
+
+    //! @brief Loads a register of a column
+    //! @param registerIndex: Index of the register inside of the column
+    //! @param column: Index of the column
+    //! @return Register
+    inline _registerType LoadRegister(U32 registerIndex, U32 column) const;
+
+    //! @brief Adds an entry at the end of the container
+    //! @param entry: Values of the new entry
+    void PushBack(const Entry& entry);
+
+    //! @brief Reserves memory for at least <capacity> entries
+    //! @param capacity: Number of entries
+    void Reserve(U32 capacity);
+
+    //! @brief Changes the number of entries. New entries are zero initialized.
+    //! @param size: New number of entries
+    void Resize(U32 size);
+
+    //! @brief Sets an entry
+    //! @param index: Index of the entry
+    //! @param entry: New values of the entry
+    void Set(U32 index, const Entry& entry);
+
+    //! @brief Transposes an array of structures block and stores it in the entries of a register block
+    //! @param registerIndex: Index of the register block
+    //! @param block: Array of structures block
+    //! @remark Values that belong to padding entries behind the last entry are not stored, so that the padding stays
+    //! zero.
+    void StoreAoSBlock(U32 registerIndex, const AoSBlock& block);
+
+    //! @brief Stores a register in a column
+    //! @param registerIndex: Index of the register inside of the column
+    //! @param column: Index of the column
+    //! @param reg: Register that should be stored
+    //! @remark The caller is responsible for keeping the padding values zero
+    inline void StoreRegister(U32 registerIndex, U32 column, _registerType reg);
+
+private:
+    //! @brief Sets all values of the entries in the range [first, last) to zero
+    //! @param first: Index of the first entry
+    //! @param last: Index behind the last entry
+    void SetZero(U32 first, U32 last);
+};
+
+} // namespace GDL
+
+
+#include "gdl/base/container/soaVector.inl"
@@ -0,0 +1,273 @@
+#pragma once
+
+#include "gdl/base/container/soaVector.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/transpose.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace GDL
+{
+
+template <typename _registerType, U32 _numColumns>
+SoAVector<_registerType, _numColumns>::SoAVector()
+    : mData{}
+    , mSize{0}
+    , mNumRegistersPerColumn{0}
+{
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+SoAVector<_registerType, _numColumns>::SoAVector(U32 size)
+    : SoAVector()
+{
+    Resize(size);
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+SoAVector<_registerType, _numColumns>::SoAVector(SoAVector&& other) noexcept
+    : mData{std::move(other.mData)}
+    , mSize{std::exchange(other.mSize, 0)}
+    , mNumRegistersPerColumn{std::exchange(other.mNumRegistersPerColumn, 0)}
+{
+    other.mData.clear();
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+SoAVector<_registerType, _numColumns>& SoAVector<_registerType, _numColumns>::operator=(SoAVector&& other) noexcept
+{
+    if (this != &other)
+    {
+        mData = std::move(other.mData);
+        mSize = std::exchange(other.mSize, 0);
+        mNumRegistersPerColumn = std::exchange(other.mNumRegistersPerColumn, 0);
+        other.mData.clear();
+    }
+    return *this;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline typename SoAVector<_registerType, _numColumns>::Type& SoAVector<_registerType, _numColumns>::
+operator()(U32 index, U32 column)
+{
+    DEV_EXCEPTION(index >= mSize, "Index out of range.");
+    return GetColumn(column)[index];
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline typename SoAVector<_registerType, _numColumns>::Type SoAVector<_registerType, _numColumns>::
+operator()(U32 index, U32 column) const
+{
+    DEV_EXCEPTION(index >= mSize, "Index out of range.");
+    return GetColumn(column)[index];
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void SoAVector<_registerType, _numColumns>::Clear()
+{
+    Resize(0);
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+typename SoAVector<_registerType, _numColumns>::Entry SoAVector<_registerType, _numColumns>::Get(U32 index) const
+{
+    DEV_EXCEPTION(index >= mSize, "Index out of range.");
+
+    Entry entry;
+    for (U32 i = 0; i < _numColumns; ++i)
+        entry[i] = GetColumn(i)[index];
+    return entry;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+U32 SoAVector<_registerType, _numColumns>::GetCapacity() const
+{
+    return mNumRegistersPerColumn * NumRegisterValues;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline typename SoAVector<_registerType, _numColumns>::Type*
+SoAVector<_registerType, _numColumns>::GetColumn(U32 column)
+{
+    return reinterpret_cast<Type*>(GetColumnRegisters(column));
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline const typename SoAVector<_registerType, _numColumns>::Type*
+SoAVector<_registerType, _numColumns>::GetColumn(U32 column) const
+{
+    return reinterpret_cast<const Type*>(GetColumnRegisters(column));
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline _registerType* SoAVector<_registerType, _numColumns>::GetColumnRegisters(U32 column)
+{
+    DEV_EXCEPTION(column >= _numColumns, "Column index out of range.");
+    return mData.data() + column * mNumRegistersPerColumn;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline const _registerType* SoAVector<_registerType, _numColumns>::GetColumnRegisters(U32 column) const
+{
+    DEV_EXCEPTION(column >= _numColumns, "Column index out of range.");
+    return mData.data() + column * mNumRegistersPerColumn;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline U32 SoAVector<_registerType, _numColumns>::GetNumRegisters() const
+{
+    return simd::CalcMinNumArrayRegisters<_registerType>(mSize);
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline U32 SoAVector<_registerType, _numColumns>::GetSize() const
+{
+    return mSize;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+typename SoAVector<_registerType, _numColumns>::AoSBlock
+SoAVector<_registerType, _numColumns>::LoadAoSBlock(U32 registerIndex) const
+{
+    static_assert(_numColumns <= NumRegisterValues, "An entry must fit into a single register.");
+    DEV_EXCEPTION(registerIndex >= GetNumRegisters(), "Register index out of range.");
+
+    std::array<_registerType, _numColumns> columns;
+    for (U32 i = 0; i < _numColumns; ++i)
+        columns[i] = LoadRegister(registerIndex, i);
+
+    AoSBlock block;
+    simd::Transpose<NumRegisterValues, _numColumns>(columns, block);
+    return block;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline _registerType SoAVector<_registerType, _numColumns>::LoadRegister(U32 registerIndex, U32 column) const
+{
+    DEV_EXCEPTION(registerIndex >= mNumRegistersPerColumn, "Register index out of range.");
+    return GetColumnRegisters(column)[registerIndex];
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void SoAVector<_registerType, _numColumns>::PushBack(const Entry& entry)
+{
+    if (mSize == GetCapacity())
+        Reserve(std::max(2 * GetCapacity(), NumRegisterValues));
+
+    ++mSize;
+    Set(mSize - 1, entry);
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void SoAVector<_registerType, _numColumns>::Reserve(U32 capacity)
+{
+    const U32 numRegistersPerColumn = simd::CalcMinNumArrayRegisters<_registerType>(capacity);
+    if (numRegistersPerColumn <= mNumRegistersPerColumn)
+        return;
+
+    Vector<_registerType> data(static_cast<size_t>(numRegistersPerColumn) * _numColumns);
+    for (U32 i = 0; i < _numColumns; ++i)
+        std::copy(GetColumnRegisters(i), GetColumnRegisters(i) + mNumRegistersPerColumn,
+                  data.data() + i * numRegistersPerColumn);
+
+    mData = std::move(data);
+    mNumRegistersPerColumn = numRegistersPerColumn;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void SoAVector<_registerType, _numColumns>::Resize(U32 size)
+{
+    Reserve(size);
+    if (size < mSize)
+        SetZero(size, mSize);
+    mSize = size;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void SoAVector<_registerType, _numColumns>::Set(U32 index, const Entry& entry)
+{
+    DEV_EXCEPTION(index >= mSize, "Index out of range.");
+
+    for (U32 i = 0; i < _numColumns; ++i)
+        GetColumn(i)[index] = entry[i];
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void SoAVector<_registerType, _numColumns>::StoreAoSBlock(U32 registerIndex, const AoSBlock& block)
+{
+    static_assert(_numColumns <= NumRegisterValues, "An entry must fit into a single register.");
+    DEV_EXCEPTION(registerIndex >= GetNumRegisters(), "Register index out of range.");
+
+    std::array<_registerType, _numColumns> columns;
+    simd::Transpose<_numColumns, NumRegisterValues>(block, columns);
+    for (U32 i = 0; i < _numColumns; ++i)
+        StoreRegister(registerIndex, i, columns[i]);
+
+    // Restore the padding of the last block
+    if ((registerIndex + 1) * NumRegisterValues > mSize)
+        SetZero(mSize, (registerIndex + 1) * NumRegisterValues);
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+inline void SoAVector<_registerType, _numColumns>::StoreRegister(U32 registerIndex, U32 column, _registerType reg)
+{
+    DEV_EXCEPTION(registerIndex >= mNumRegistersPerColumn, "Register index out of range.");
+    GetColumnRegisters(column)[registerIndex] = reg;
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void SoAVector<_registerType, _numColumns>::SetZero(U32 first, U32 last)
+{
+    for (U32 i = 0; i < _numColumns; ++i)
+        std::fill(GetColumn(i) + first, GetColumn(i) + last, Type(0));
+}
+
+} // namespace GDL
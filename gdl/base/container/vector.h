@@ -4,6 +4,7 @@
 
 #ifndef USE_STD_ALLOCATOR
 
+#include "gdl/resources/memory/frameAllocator.h"
 #include "gdl/resources/memory/generalPurposeAllocator.h"
 #include "gdl/resources/memory/stackAllocator.h"
 #include "gdl/resources/memory/threadPrivateStackAllocator.h"
@@ -14,6 +15,9 @@ namespace GDL
 template <typename _type>
 using Vector = std::vector<_type,GeneralPurposeAllocator<_type>>;
 
+template <typename _type>
+using VectorF = std::vector<_type,FrameAllocator<_type>>;
+
 template <typename _type>
 using VectorS = std::vector<_type,StackAllocator<_type>>;
 
@@ -30,6 +34,9 @@ namespace GDL
 template <typename _type>
 using Vector = std::vector<_type>;
 
+template <typename _type>
+using VectorF = std::vector<_type>;
+
 template <typename _type>
 using VectorS = std::vector<_type>;
 
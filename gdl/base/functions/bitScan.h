@@ -0,0 +1,30 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <cassert>
+
+namespace GDL
+{
+
+//! @brief Gets the index of the least significant set bit
+//! @param value: Value that should be checked. Must not be 0.
+//! @return Index of the least significant set bit
+inline U32 IndexOfLeastSignificantBit(U64 value)
+{
+    assert(value != 0);
+    return static_cast<U32>(__builtin_ctzll(value));
+}
+
+
+
+//! @brief Gets the index of the most significant set bit
+//! @param value: Value that should be checked. Must not be 0.
+//! @return Index of the most significant set bit
+inline U32 IndexOfMostSignificantBit(U64 value)
+{
+    assert(value != 0);
+    return static_cast<U32>(63 - __builtin_clzll(value));
+}
+
+} // namespace GDL
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+
+#ifndef USE_STD_ALLOCATOR
+#include "gdl/resources/memory/generalPurposeAllocator.h"
+#endif
+
+
+namespace GDL
+{
+
+template <typename _type>
+using SharedPtr = std::shared_ptr<_type>;
+
+
+
+#ifndef USE_STD_ALLOCATOR
+
+//! @brief Creates a new shared pointer. The managed object and the control block are allocated from the general
+//! purpose memory
+//! @tparam _type: Type of the shared pointer
+//! @tparam _args: Parameter pack of the arguments that should be passed to the managed types constructor
+//! @param args: Arguments that should be passed to the types constructor
+//! @return Shared pointer which uses the general purpose memory
+template <typename _type, typename... _args>
+inline SharedPtr<_type> MakeShared(_args&&... args)
+{
+    return std::allocate_shared<_type>(GeneralPurposeAllocator<_type>(), std::forward<_args>(args)...);
+}
+
+#else
+
+//! @brief Creates a new shared pointer
+//! @tparam _type: Type of the shared pointer
+//! @tparam _args: Parameter pack of the arguments that should be passed to the managed types constructor
+//! @param args: Arguments that should be passed to the types constructor
+//! @return Shared pointer
+template <typename _type, typename... _args>
+inline SharedPtr<_type> MakeShared(_args&&... args)
+{
+    return std::make_shared<_type>(std::forward<_args>(args)...);
+}
+
+#endif
+
+} // namespace GDL
@@ -0,0 +1,40 @@
+#pragma once
+
+
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/x86intrin.h"
+
+
+
+#ifdef __AVX512F__
+
+namespace GDL::simd
+{
+
+//! @brief Transposes a 16x16 matrix
+//! @tparam _firstRowIn: Index of the matrix's first row in each register
+//! @tparam _firstRowOut: Index of the output matrix's first row in each register
+//! @tparam _overwriteUnused: Option that specifies if unused values in the output registers can/should be overwritten
+//! @tparam _unusedSetZero: Option that specifies if unused values in the output registers are set to zero
+//! @param in: Input registers
+//! @param out: Output registers
+//! @remark Only full register transpositions are supported for 512 bit registers. Since all register values are part
+//! of the matrix, the template parameters have no effect besides the static assertions.
+template <U32 _firstRowIn = 0, U32 _firstRowOut = 0, bool _overwriteUnused = true, bool _unusedSetZero = false>
+inline void Transpose16x16(__m512 in_0, __m512 in_1, __m512 in_2, __m512 in_3, __m512 in_4, __m512 in_5, __m512 in_6,
+                           __m512 in_7, __m512 in_8, __m512 in_9, __m512 in_10, __m512 in_11, __m512 in_12,
+                           __m512 in_13, __m512 in_14, __m512 in_15, __m512& out_0, __m512& out_1, __m512& out_2,
+                           __m512& out_3, __m512& out_4, __m512& out_5, __m512& out_6, __m512& out_7, __m512& out_8,
+                           __m512& out_9, __m512& out_10, __m512& out_11, __m512& out_12, __m512& out_13,
+                           __m512& out_14, __m512& out_15) noexcept;
+
+
+
+} // namespace GDL::simd
+
+#endif // __AVX512F__
+
+
+
+#include "gdl/base/simd/_transpose/transpose_m512.inl"
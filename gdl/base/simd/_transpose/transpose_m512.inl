@@ -0,0 +1,103 @@
+#pragma once
+
+#include "gdl/base/simd/_transpose/transpose_m512.h"
+
+#include "gdl/base/simd/_transpose/transpose_utility.h"
+
+
+#ifdef __AVX512F__
+
+namespace GDL::simd
+{
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <U32 _firstRowIn, U32 _firstRowOut, bool _overwriteUnused, bool _unusedSetZero>
+inline void Transpose16x16(__m512 in_0, __m512 in_1, __m512 in_2, __m512 in_3, __m512 in_4, __m512 in_5, __m512 in_6,
+                           __m512 in_7, __m512 in_8, __m512 in_9, __m512 in_10, __m512 in_11, __m512 in_12,
+                           __m512 in_13, __m512 in_14, __m512 in_15, __m512& out_0, __m512& out_1, __m512& out_2,
+                           __m512& out_3, __m512& out_4, __m512& out_5, __m512& out_6, __m512& out_7, __m512& out_8,
+                           __m512& out_9, __m512& out_10, __m512& out_11, __m512& out_12, __m512& out_13,
+                           __m512& out_14, __m512& out_15) noexcept
+{
+    intern::transpose::StaticAssertions<16, 16, _firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero, __m512>();
+
+    // source: https://stackoverflow.com/questions/29519222/how-to-transpose-a-16x16-matrix-using-simd-instructions
+
+    __m512 tmp_0, tmp_1, tmp_2, tmp_3, tmp_4, tmp_5, tmp_6, tmp_7, tmp_8, tmp_9, tmp_10, tmp_11, tmp_12, tmp_13, tmp_14,
+            tmp_15;
+
+    tmp_0 = _mm512_unpacklo_ps(in_0, in_1);
+    tmp_1 = _mm512_unpackhi_ps(in_0, in_1);
+    tmp_2 = _mm512_unpacklo_ps(in_2, in_3);
+    tmp_3 = _mm512_unpackhi_ps(in_2, in_3);
+    tmp_4 = _mm512_unpacklo_ps(in_4, in_5);
+    tmp_5 = _mm512_unpackhi_ps(in_4, in_5);
+    tmp_6 = _mm512_unpacklo_ps(in_6, in_7);
+    tmp_7 = _mm512_unpackhi_ps(in_6, in_7);
+    tmp_8 = _mm512_unpacklo_ps(in_8, in_9);
+    tmp_9 = _mm512_unpackhi_ps(in_8, in_9);
+    tmp_10 = _mm512_unpacklo_ps(in_10, in_11);
+    tmp_11 = _mm512_unpackhi_ps(in_10, in_11);
+    tmp_12 = _mm512_unpacklo_ps(in_12, in_13);
+    tmp_13 = _mm512_unpackhi_ps(in_12, in_13);
+    tmp_14 = _mm512_unpacklo_ps(in_14, in_15);
+    tmp_15 = _mm512_unpackhi_ps(in_14, in_15);
+
+    out_0 = _mm512_shuffle_ps(tmp_0, tmp_2, 0x44);
+    out_1 = _mm512_shuffle_ps(tmp_0, tmp_2, 0xee);
+    out_2 = _mm512_shuffle_ps(tmp_1, tmp_3, 0x44);
+    out_3 = _mm512_shuffle_ps(tmp_1, tmp_3, 0xee);
+    out_4 = _mm512_shuffle_ps(tmp_4, tmp_6, 0x44);
+    out_5 = _mm512_shuffle_ps(tmp_4, tmp_6, 0xee);
+    out_6 = _mm512_shuffle_ps(tmp_5, tmp_7, 0x44);
+    out_7 = _mm512_shuffle_ps(tmp_5, tmp_7, 0xee);
+    out_8 = _mm512_shuffle_ps(tmp_8, tmp_10, 0x44);
+    out_9 = _mm512_shuffle_ps(tmp_8, tmp_10, 0xee);
+    out_10 = _mm512_shuffle_ps(tmp_9, tmp_11, 0x44);
+    out_11 = _mm512_shuffle_ps(tmp_9, tmp_11, 0xee);
+    out_12 = _mm512_shuffle_ps(tmp_12, tmp_14, 0x44);
+    out_13 = _mm512_shuffle_ps(tmp_12, tmp_14, 0xee);
+    out_14 = _mm512_shuffle_ps(tmp_13, tmp_15, 0x44);
+    out_15 = _mm512_shuffle_ps(tmp_13, tmp_15, 0xee);
+
+    tmp_0 = _mm512_shuffle_f32x4(out_0, out_4, 0x88);
+    tmp_1 = _mm512_shuffle_f32x4(out_1, out_5, 0x88);
+    tmp_2 = _mm512_shuffle_f32x4(out_2, out_6, 0x88);
+    tmp_3 = _mm512_shuffle_f32x4(out_3, out_7, 0x88);
+    tmp_4 = _mm512_shuffle_f32x4(out_0, out_4, 0xdd);
+    tmp_5 = _mm512_shuffle_f32x4(out_1, out_5, 0xdd);
+    tmp_6 = _mm512_shuffle_f32x4(out_2, out_6, 0xdd);
+    tmp_7 = _mm512_shuffle_f32x4(out_3, out_7, 0xdd);
+    tmp_8 = _mm512_shuffle_f32x4(out_8, out_12, 0x88);
+    tmp_9 = _mm512_shuffle_f32x4(out_9, out_13, 0x88);
+    tmp_10 = _mm512_shuffle_f32x4(out_10, out_14, 0x88);
+    tmp_11 = _mm512_shuffle_f32x4(out_11, out_15, 0x88);
+    tmp_12 = _mm512_shuffle_f32x4(out_8, out_12, 0xdd);
+    tmp_13 = _mm512_shuffle_f32x4(out_9, out_13, 0xdd);
+    tmp_14 = _mm512_shuffle_f32x4(out_10, out_14, 0xdd);
+    tmp_15 = _mm512_shuffle_f32x4(out_11, out_15, 0xdd);
+
+    out_0 = _mm512_shuffle_f32x4(tmp_0, tmp_8, 0x88);
+    out_1 = _mm512_shuffle_f32x4(tmp_1, tmp_9, 0x88);
+    out_2 = _mm512_shuffle_f32x4(tmp_2, tmp_10, 0x88);
+    out_3 = _mm512_shuffle_f32x4(tmp_3, tmp_11, 0x88);
+    out_4 = _mm512_shuffle_f32x4(tmp_4, tmp_12, 0x88);
+    out_5 = _mm512_shuffle_f32x4(tmp_5, tmp_13, 0x88);
+    out_6 = _mm512_shuffle_f32x4(tmp_6, tmp_14, 0x88);
+    out_7 = _mm512_shuffle_f32x4(tmp_7, tmp_15, 0x88);
+    out_8 = _mm512_shuffle_f32x4(tmp_0, tmp_8, 0xdd);
+    out_9 = _mm512_shuffle_f32x4(tmp_1, tmp_9, 0xdd);
+    out_10 = _mm512_shuffle_f32x4(tmp_2, tmp_10, 0xdd);
+    out_11 = _mm512_shuffle_f32x4(tmp_3, tmp_11, 0xdd);
+    out_12 = _mm512_shuffle_f32x4(tmp_4, tmp_12, 0xdd);
+    out_13 = _mm512_shuffle_f32x4(tmp_5, tmp_13, 0xdd);
+    out_14 = _mm512_shuffle_f32x4(tmp_6, tmp_14, 0xdd);
+    out_15 = _mm512_shuffle_f32x4(tmp_7, tmp_15, 0xdd);
+}
+
+
+
+} // namespace GDL::simd
+
+#endif // __AVX512F__
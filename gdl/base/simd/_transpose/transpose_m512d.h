@@ -0,0 +1,37 @@
+#pragma once
+
+
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/x86intrin.h"
+
+
+
+#ifdef __AVX512F__
+
+namespace GDL::simd
+{
+
+//! @brief Transposes a 8x8 matrix
+//! @tparam _firstRowIn: Index of the matrix's first row in each register
+//! @tparam _firstRowOut: Index of the output matrix's first row in each register
+//! @tparam _overwriteUnused: Option that specifies if unused values in the output registers can/should be overwritten
+//! @tparam _unusedSetZero: Option that specifies if unused values in the output registers are set to zero
+//! @param in: Input registers
+//! @param out: Output registers
+//! @remark Only full register transpositions are supported for 512 bit registers. Since all register values are part
+//! of the matrix, the template parameters have no effect besides the static assertions.
+template <U32 _firstRowIn = 0, U32 _firstRowOut = 0, bool _overwriteUnused = true, bool _unusedSetZero = false>
+inline void Transpose8x8(__m512d in_0, __m512d in_1, __m512d in_2, __m512d in_3, __m512d in_4, __m512d in_5,
+                         __m512d in_6, __m512d in_7, __m512d& out_0, __m512d& out_1, __m512d& out_2, __m512d& out_3,
+                         __m512d& out_4, __m512d& out_5, __m512d& out_6, __m512d& out_7) noexcept;
+
+
+
+} // namespace GDL::simd
+
+#endif // __AVX512F__
+
+
+
+#include "gdl/base/simd/_transpose/transpose_m512d.inl"
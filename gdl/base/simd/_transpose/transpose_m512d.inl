@@ -0,0 +1,56 @@
+#pragma once
+
+#include "gdl/base/simd/_transpose/transpose_m512d.h"
+
+#include "gdl/base/simd/_transpose/transpose_utility.h"
+
+
+#ifdef __AVX512F__
+
+namespace GDL::simd
+{
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <U32 _firstRowIn, U32 _firstRowOut, bool _overwriteUnused, bool _unusedSetZero>
+inline void Transpose8x8(__m512d in_0, __m512d in_1, __m512d in_2, __m512d in_3, __m512d in_4, __m512d in_5,
+                         __m512d in_6, __m512d in_7, __m512d& out_0, __m512d& out_1, __m512d& out_2, __m512d& out_3,
+                         __m512d& out_4, __m512d& out_5, __m512d& out_6, __m512d& out_7) noexcept
+{
+    intern::transpose::StaticAssertions<8, 8, _firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero, __m512d>();
+
+    __m512d tmp_0, tmp_1, tmp_2, tmp_3, tmp_4, tmp_5, tmp_6, tmp_7;
+
+    out_0 = _mm512_unpacklo_pd(in_0, in_1);
+    out_1 = _mm512_unpackhi_pd(in_0, in_1);
+    out_2 = _mm512_unpacklo_pd(in_2, in_3);
+    out_3 = _mm512_unpackhi_pd(in_2, in_3);
+    out_4 = _mm512_unpacklo_pd(in_4, in_5);
+    out_5 = _mm512_unpackhi_pd(in_4, in_5);
+    out_6 = _mm512_unpacklo_pd(in_6, in_7);
+    out_7 = _mm512_unpackhi_pd(in_6, in_7);
+
+    tmp_0 = _mm512_shuffle_f64x2(out_0, out_2, 0x88);
+    tmp_1 = _mm512_shuffle_f64x2(out_1, out_3, 0x88);
+    tmp_2 = _mm512_shuffle_f64x2(out_0, out_2, 0xdd);
+    tmp_3 = _mm512_shuffle_f64x2(out_1, out_3, 0xdd);
+    tmp_4 = _mm512_shuffle_f64x2(out_4, out_6, 0x88);
+    tmp_5 = _mm512_shuffle_f64x2(out_5, out_7, 0x88);
+    tmp_6 = _mm512_shuffle_f64x2(out_4, out_6, 0xdd);
+    tmp_7 = _mm512_shuffle_f64x2(out_5, out_7, 0xdd);
+
+    out_0 = _mm512_shuffle_f64x2(tmp_0, tmp_4, 0x88);
+    out_1 = _mm512_shuffle_f64x2(tmp_1, tmp_5, 0x88);
+    out_2 = _mm512_shuffle_f64x2(tmp_2, tmp_6, 0x88);
+    out_3 = _mm512_shuffle_f64x2(tmp_3, tmp_7, 0x88);
+    out_4 = _mm512_shuffle_f64x2(tmp_0, tmp_4, 0xdd);
+    out_5 = _mm512_shuffle_f64x2(tmp_1, tmp_5, 0xdd);
+    out_6 = _mm512_shuffle_f64x2(tmp_2, tmp_6, 0xdd);
+    out_7 = _mm512_shuffle_f64x2(tmp_3, tmp_7, 0xdd);
+}
+
+
+
+} // namespace GDL::simd
+
+#endif // __AVX512F__
@@ -37,15 +37,25 @@ inline bool CompareAllTrue(_registerType lhs, _registerType rhs, _compFunction c
     static_assert(_numComparedValues > 0 && _numComparedValues <= numRegisterEntries,
                   "Invalid number of compared values ---> [1 ... numRegisterEntries]");
 
-    auto cmpResult = _mm_movemaskEpi8(_mm_castFI(compFunction(lhs, rhs)));
-    constexpr auto refResult = SSECalculateComparisonValueAllTrue<_registerType, _numComparedValues>();
+    if constexpr (HasMaskRegister<_registerType>)
+    {
+        // The comparison already returns a bitmask with one bit per value
+        constexpr U32 refResult = (U32{1} << _numComparedValues) - 1;
+        return (static_cast<U32>(compFunction(lhs, rhs)) & refResult) == refResult;
+    }
+    else
+    {
+        auto cmpResult = _mm_movemaskEpi8(_mm_castFI(compFunction(lhs, rhs)));
+        constexpr auto refResult = SSECalculateComparisonValueAllTrue<_registerType, _numComparedValues>();
 
-    static_assert(std::is_same_v<const decltype(cmpResult), decltype(refResult)>, "Mismatching types for comparison");
+        static_assert(std::is_same_v<const decltype(cmpResult), decltype(refResult)>,
+                      "Mismatching types for comparison");
 
-    if constexpr (_numComparedValues != numRegisterEntries)
-        cmpResult &= refResult; // Set bits of elemts that should not be compared to zero
+        if constexpr (_numComparedValues != numRegisterEntries)
+            cmpResult &= refResult; // Set bits of elemts that should not be compared to zero
 
-    return cmpResult >= refResult;
+        return cmpResult >= refResult;
+    }
 }
 
 
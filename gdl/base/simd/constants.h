@@ -24,6 +24,14 @@ inline constexpr const U32 alignmentBytes<__m256d> = 32;
 template <>
 inline constexpr const U32 alignmentBytes<__m256i> = 32;
 #endif // __AVX2__
+#ifdef __AVX512F__
+template <>
+inline constexpr const U32 alignmentBytes<__m512> = 64;
+template <>
+inline constexpr const U32 alignmentBytes<__m512d> = 64;
+template <>
+inline constexpr const U32 alignmentBytes<__m512i> = 64;
+#endif // __AVX512F__
 
 
 
@@ -41,6 +49,12 @@ inline constexpr const U32 numRegisterValues<__m256> = 8;
 template <>
 inline constexpr const U32 numRegisterValues<__m256d> = 4;
 #endif // __AVX2__
+#ifdef __AVX512F__
+template <>
+inline constexpr const U32 numRegisterValues<__m512> = 16;
+template <>
+inline constexpr const U32 numRegisterValues<__m512d> = 8;
+#endif // __AVX512F__
 
 
 
@@ -58,6 +72,12 @@ inline constexpr const U32 numValuesPerLane<__m256> = 4;
 template <>
 inline constexpr const U32 numValuesPerLane<__m256d> = 2;
 #endif // __AVX2__
+#ifdef __AVX512F__
+template <>
+inline constexpr const U32 numValuesPerLane<__m512> = 4;
+template <>
+inline constexpr const U32 numValuesPerLane<__m512d> = 2;
+#endif // __AVX512F__
 
 
 
@@ -75,6 +95,12 @@ inline constexpr const U32 numLanes<__m256> = 2;
 template <>
 inline constexpr const U32 numLanes<__m256d> = 2;
 #endif // __AVX2__
+#ifdef __AVX512F__
+template <>
+inline constexpr const U32 numLanes<__m512> = 4;
+template <>
+inline constexpr const U32 numLanes<__m512d> = 4;
+#endif // __AVX512F__
 
 
 
@@ -92,6 +118,27 @@ inline constexpr const bool IsRegisterType<__m256> = true;
 template <>
 inline constexpr const bool IsRegisterType<__m256d> = true;
 #endif // __AVX2__
+#ifdef __AVX512F__
+template <>
+inline constexpr const bool IsRegisterType<__m512> = true;
+template <>
+inline constexpr const bool IsRegisterType<__m512d> = true;
+#endif // __AVX512F__
+
+
+
+//! @brief Template constant is only true if the register type has a corresponding mask register type (AVX-512).
+//! Comparisons of such registers return a bit mask instead of a register and masked operations can be used to process
+//! partially filled registers.
+//! @tparam _registerType: RegisterType
+template <typename _registerType>
+inline constexpr const bool HasMaskRegister = false;
+#ifdef __AVX512F__
+template <>
+inline constexpr const bool HasMaskRegister<__m512> = true;
+template <>
+inline constexpr const bool HasMaskRegister<__m512d> = true;
+#endif // __AVX512F__
 
 
 
@@ -166,4 +213,43 @@ inline constexpr const bool Is__m256i<__m256i> = true;
 #endif // __AVX2__
 
 
+
+//! @brief Template constant is only true for __m512
+//! @tparam _registerType: RegisterType
+//! @remark One can achieve the same result with std::is_same but the synthax is longer and it needs to be wrapped into
+//! #ifdef blocks in case the architecture does not support SSE/AVX.
+template <typename _registerType>
+inline constexpr const bool Is__m512 = false;
+#ifdef __AVX512F__
+template <>
+inline constexpr const bool Is__m512<__m512> = true;
+#endif // __AVX512F__
+
+
+
+//! @brief Template constant is only true for __m512d
+//! @tparam _registerType: RegisterType
+//! @remark One can achieve the same result with std::is_same but the synthax is longer and it needs to be wrapped into
+//! #ifdef blocks in case the architecture does not support SSE/AVX.
+template <typename _registerType>
+inline constexpr const bool Is__m512d = false;
+#ifdef __AVX512F__
+template <>
+inline constexpr const bool Is__m512d<__m512d> = true;
+#endif // __AVX512F__
+
+
+
+//! @brief Template constant is only true for __m512i
+//! @tparam _registerType: RegisterType
+//! @remark One can achieve the same result with std::is_same but the synthax is longer and it needs to be wrapped into
+//! #ifdef blocks in case the architecture does not support SSE/AVX.
+template <typename _registerType>
+inline constexpr const bool Is__m512i = false;
+#ifdef __AVX512F__
+template <>
+inline constexpr const bool Is__m512i<__m512i> = true;
+#endif // __AVX512F__
+
+
 } // namespace GDL::simd
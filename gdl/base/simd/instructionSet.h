@@ -0,0 +1,44 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <string>
+
+
+
+namespace GDL::simd
+{
+
+//! @brief Instruction sets for which GDL kernels can be compiled. Each instruction set includes all lower ones.
+enum class InstructionSet : U32
+{
+    SSE4_2 = 0, //!< SSE up to version 4.2 (128 bit registers)
+    AVX2 = 1,   //!< AVX2 and FMA (256 bit registers)
+    AVX512 = 2  //!< AVX-512 F, VL, BW and DQ (512 bit registers)
+};
+
+
+
+//! @brief Gets the highest instruction set that is supported by the CPU and the operating system
+//! @return Highest supported instruction set
+[[nodiscard]] inline InstructionSet GetSupportedInstructionSet();
+
+//! @brief Returns if an instruction set is supported by the CPU and the operating system
+//! @param instructionSet: Instruction set
+//! @return TRUE / FALSE
+[[nodiscard]] inline bool IsSupported(InstructionSet instructionSet);
+
+//! @brief Gets the name of an instruction set
+//! @param instructionSet: Instruction set
+//! @return Name of the instruction set
+[[nodiscard]] inline std::string GetName(InstructionSet instructionSet);
+
+//! @brief Gets the instruction set with the passed name. Throws if the name is unknown.
+//! @param name: Name of the instruction set as returned by GetName
+//! @return Instruction set
+[[nodiscard]] inline InstructionSet GetInstructionSet(const std::string& name);
+
+} // namespace GDL::simd
+
+
+#include "gdl/base/simd/instructionSet.inl"
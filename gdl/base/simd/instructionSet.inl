@@ -0,0 +1,57 @@
+#pragma once
+
+#include "gdl/base/simd/instructionSet.h"
+
+#include "gdl/base/exception.h"
+
+namespace GDL::simd
+{
+
+inline InstructionSet GetSupportedInstructionSet()
+{
+    // The builtins query CPUID and also check that the operating system saves the extended register states
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") &&
+        __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx2") &&
+        __builtin_cpu_supports("fma"))
+        return InstructionSet::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return InstructionSet::AVX2;
+    return InstructionSet::SSE4_2;
+}
+
+
+
+inline bool IsSupported(InstructionSet instructionSet)
+{
+    return static_cast<U32>(instructionSet) <= static_cast<U32>(GetSupportedInstructionSet());
+}
+
+
+
+inline std::string GetName(InstructionSet instructionSet)
+{
+    switch (instructionSet)
+    {
+    case InstructionSet::SSE4_2:
+        return "SSE4_2";
+    case InstructionSet::AVX2:
+        return "AVX2";
+    case InstructionSet::AVX512:
+        return "AVX512";
+    }
+    THROW("Unknown instruction set.");
+}
+
+
+
+inline InstructionSet GetInstructionSet(const std::string& name)
+{
+    for (InstructionSet instructionSet : {InstructionSet::SSE4_2, InstructionSet::AVX2, InstructionSet::AVX512})
+        if (name == GetName(instructionSet))
+            return instructionSet;
+    THROW("Unknown instruction set \"" + name + "\".");
+}
+
+} // namespace GDL::simd
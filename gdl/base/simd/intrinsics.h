@@ -17,6 +17,22 @@ namespace GDL
 template <typename _type, typename _registerType>
 inline void _mm_store(_type* ptr, _registerType reg);
 
+//! @brief Stores the values of a register to a given memory location that doesn't need to be aligned
+//! @tparam _type: Type of the registers values
+//! @tparam _registerType: Register type
+//! @param ptr: Pointer to a piece of memory where the data should be stored
+//! @param reg: Register that provides the data
+template <typename _type, typename _registerType>
+inline void _mm_storeu(_type* ptr, _registerType reg);
+
+//! @brief Loads a register from memory that doesn't need to be aligned
+//! @tparam _registerType: Register type
+//! @tparam _type: Type of the registers values
+//! @param ptr: Pointer to the memory that provides the data
+//! @return Register with the loaded values
+template <typename _registerType, typename _type>
+inline _registerType _mmx_loadu_p(const _type* ptr);
+
 //! @brief Template to create a register with all entries set to zero
 //! @tparam _registerType: Register type
 //! @return Register with all entries set to zero
@@ -57,8 +73,8 @@ inline auto _mm_castFI(_registerType src);
 template <typename _registerType, typename _intRegisterType>
 inline _registerType _mm_castIF(_intRegisterType src);
 
-//! @brief Extracts the lowest element of a register. In case of 256 bit registers, the lowest element of the first
-//! 128bit is returned.
+//! @brief Extracts the lowest element of a register. In case of 256 and 512 bit registers, the lowest element of the
+//! first 128bit is returned.
 //! @tparam _registerType: Register type
 //! @param reg: Source register
 //! @return Lowest element of a register
@@ -172,7 +188,7 @@ inline _registerType _mm_rsqrt(_registerType reg);
 //! @tparam _registerType: Register type
 //! @param lhs: Left hand side register
 //! @param rhs: Right hand side register
-//! @return Register which stores the results of the comparison
+//! @return Register which stores the results of the comparison. Registers with mask support return a bitmask.
 template <typename _registerType>
 inline auto _mm_cmpeq(_registerType lhs, _registerType rhs);
 
@@ -180,7 +196,7 @@ inline auto _mm_cmpeq(_registerType lhs, _registerType rhs);
 //! @tparam _registerType: Register type
 //! @param lhs: Left hand side register
 //! @param rhs: Right hand side register
-//! @return Register which stores the results of the comparison
+//! @return Register which stores the results of the comparison. Registers with mask support return a bitmask.
 template <typename _registerType>
 inline auto _mm_cmple(_registerType lhs, _registerType rhs);
 
@@ -188,7 +204,7 @@ inline auto _mm_cmple(_registerType lhs, _registerType rhs);
 //! @tparam _registerType: Register type
 //! @param lhs: Left hand side register
 //! @param rhs: Right hand side register
-//! @return Register which stores the results of the comparison
+//! @return Register which stores the results of the comparison. Registers with mask support return a bitmask.
 template <typename _registerType>
 inline auto _mm_cmpgt(_registerType lhs, _registerType rhs);
 
@@ -196,7 +212,7 @@ inline auto _mm_cmpgt(_registerType lhs, _registerType rhs);
 //! @tparam _registerType: Register type
 //! @param lhs: Left hand side register
 //! @param rhs: Right hand side register
-//! @return Register which stores the results of the comparison
+//! @return Register which stores the results of the comparison. Registers with mask support return a bitmask.
 template <typename _registerType>
 inline auto _mm_cmplt(_registerType lhs, _registerType rhs);
 
@@ -258,7 +274,7 @@ inline auto _mm_movemaskEpi8(_registerType reg);
 //! @brief Creates a new register where each value is selected from the two source registers values at the same
 //! position.
 //! @tparam _blendMask: Bitmask that determines the value composition. Have a look at Intels documentation of
-//! _mm_blend_ps, _mm_blend_pd, _mm256_blend_ps or _mm256_blend_ps for detailed informations.
+//! _mm_blend_ps, _mm_blend_pd, _mm256_blend_ps, _mm256_blend_ps or _mm512_mask_blend_ps for detailed informations.
 //! @tparam _registerType: Register type
 //! @param src0: First source register
 //! @param src1: second source register
@@ -269,12 +285,13 @@ inline auto _mm_blend(_registerType src0, _registerType src1);
 //! @brief Creates a new register where each value is selected from the two source registers values at the same
 //! position.
 //! @tparam _registerType: Register type
+//! @tparam _maskType: Mask type. Must be the register type or the bitmask type of registers with mask support.
 //! @param src0: First source register
 //! @param src1: second source register
-//! @param _blendMask: Register that determines which value is selected from which source register.
+//! @param _blendMask: Register or bitmask that determines which value is selected from which source register.
 //! @return Register with blended values
-template <typename _registerType>
-inline auto _mm_blendv(_registerType src0, _registerType src1, _registerType _blendMask);
+template <typename _registerType, typename _maskType>
+inline auto _mm_blendv(_registerType src0, _registerType src1, _maskType _blendMask);
 
 #ifdef __AVX2__
 
@@ -28,9 +28,15 @@ inline void _mm_store(_type* ptr, _registerType reg)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType> && std::is_same<_type, F32>::value)
         _mm256_store_ps(ptr, reg);
-    else
+    else if constexpr (Is__m256d<_registerType> && std::is_same<_type, F64>::value)
         _mm256_store_pd(ptr, reg);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType> && std::is_same<_type, F32>::value)
+        _mm512_store_ps(ptr, reg);
+    else
+        _mm512_store_pd(ptr, reg);
+#endif // __AVX512F__
 }
 
 
@@ -38,7 +44,7 @@ inline void _mm_store(_type* ptr, _registerType reg)
 // --------------------------------------------------------------------------------------------------------------------
 
 template <typename _registerType, typename _type>
-inline _registerType _mmx_load_p(_type* ptr)
+inline _registerType _mmx_load_p(const _type* ptr)
 {
     using namespace GDL::simd;
     static_assert(IsRegisterType<_registerType>, "Function can only be used with compatible register types.");
@@ -50,9 +56,71 @@ inline _registerType _mmx_load_p(_type* ptr)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType> && std::is_same<_type, F32>::value)
         return _mm256_load_ps(ptr);
-    else
+    else if constexpr (Is__m256d<_registerType> && std::is_same<_type, F64>::value)
         return _mm256_load_pd(ptr);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType> && std::is_same<_type, F32>::value)
+        return _mm512_load_ps(ptr);
+    else
+        return _mm512_load_pd(ptr);
+#endif // __AVX512F__
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type, typename _registerType>
+inline void _mm_storeu(_type* ptr, _registerType reg)
+{
+    using namespace GDL::simd;
+    static_assert(IsRegisterType<_registerType>, "Function can only be used with compatible register types.");
+
+    if constexpr (Is__m128<_registerType> && std::is_same<_type, F32>::value)
+        _mm_storeu_ps(ptr, reg);
+    else if constexpr (Is__m128d<_registerType> && std::is_same<_type, F64>::value)
+        _mm_storeu_pd(ptr, reg);
+#ifdef __AVX2__
+    else if constexpr (Is__m256<_registerType> && std::is_same<_type, F32>::value)
+        _mm256_storeu_ps(ptr, reg);
+    else if constexpr (Is__m256d<_registerType> && std::is_same<_type, F64>::value)
+        _mm256_storeu_pd(ptr, reg);
+#endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType> && std::is_same<_type, F32>::value)
+        _mm512_storeu_ps(ptr, reg);
+    else
+        _mm512_storeu_pd(ptr, reg);
+#endif // __AVX512F__
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, typename _type>
+inline _registerType _mmx_loadu_p(const _type* ptr)
+{
+    using namespace GDL::simd;
+    static_assert(IsRegisterType<_registerType>, "Function can only be used with compatible register types.");
+
+    if constexpr (Is__m128<_registerType> && std::is_same<_type, F32>::value)
+        return _mm_loadu_ps(ptr);
+    else if constexpr (Is__m128d<_registerType> && std::is_same<_type, F64>::value)
+        return _mm_loadu_pd(ptr);
+#ifdef __AVX2__
+    else if constexpr (Is__m256<_registerType> && std::is_same<_type, F32>::value)
+        return _mm256_loadu_ps(ptr);
+    else if constexpr (Is__m256d<_registerType> && std::is_same<_type, F64>::value)
+        return _mm256_loadu_pd(ptr);
+#endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType> && std::is_same<_type, F32>::value)
+        return _mm512_loadu_ps(ptr);
+    else
+        return _mm512_loadu_pd(ptr);
+#endif // __AVX512F__
 }
 
 
@@ -72,9 +140,15 @@ inline _registerType _mm_setzero()
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_setzero_ps();
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_setzero_pd();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_setzero_ps();
+    else
+        return _mm512_setzero_pd();
+#endif // __AVX512F__
 }
 
 
@@ -94,9 +168,15 @@ inline _registerType _mm_set1(_type value)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_set1_ps(static_cast<F32>(value));
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_set1_pd(static_cast<F64>(value));
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_set1_ps(static_cast<F32>(value));
+    else
+        return _mm512_set1_pd(static_cast<F64>(value));
+#endif // __AVX512F__
 }
 
 
@@ -116,9 +196,23 @@ inline _registerType _mm_setr(_args... args)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_setr_ps(std::forward<_args>(args)...);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_setr_pd(std::forward<_args>(args)...);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    // _mm512_setr_ps and _mm512_setr_pd are implemented as macros by some compilers and can't be used with parameter
+    // packs
+    else if constexpr (Is__m512<_registerType>)
+    {
+        alignas(alignmentBytes<__m512>) const F32 values[] = {static_cast<F32>(args)...};
+        return _mm512_load_ps(values);
+    }
+    else
+    {
+        alignas(alignmentBytes<__m512d>) const F64 values[] = {static_cast<F64>(args)...};
+        return _mm512_load_pd(values);
+    }
+#endif // __AVX512F__
 }
 
 
@@ -138,9 +232,15 @@ inline _registerType _mm_add(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_add_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_add_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_add_ps(lhs, rhs);
+    else
+        return _mm512_add_pd(lhs, rhs);
+#endif // __AVX512F__
 }
 
 
@@ -160,9 +260,15 @@ inline _registerType _mm_sub(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_sub_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_sub_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_sub_ps(lhs, rhs);
+    else
+        return _mm512_sub_pd(lhs, rhs);
+#endif // __AVX512F__
 }
 
 
@@ -182,9 +288,15 @@ inline _registerType _mm_mul(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_mul_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_mul_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_mul_ps(lhs, rhs);
+    else
+        return _mm512_mul_pd(lhs, rhs);
+#endif // __AVX512F__
 }
 
 
@@ -204,9 +316,15 @@ _registerType _mm_div(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_div_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_div_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_div_ps(lhs, rhs);
+    else
+        return _mm512_div_pd(lhs, rhs);
+#endif // __AVX512F__
 }
 
 
@@ -229,9 +347,15 @@ inline _registerType _mm_fmadd(_registerType lhsM, _registerType rhsM, _register
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_fmadd_ps(lhsM, rhsM, add);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_fmadd_pd(lhsM, rhsM, add);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_fmadd_ps(lhsM, rhsM, add);
+    else
+        return _mm512_fmadd_pd(lhsM, rhsM, add);
+#endif // __AVX512F__
 #endif // __FMA__
 }
 
@@ -255,9 +379,15 @@ inline _registerType _mm_fnmadd(_registerType lhsM, _registerType rhsM, _registe
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_fnmadd_ps(lhsM, rhsM, add);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_fnmadd_pd(lhsM, rhsM, add);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_fnmadd_ps(lhsM, rhsM, add);
+    else
+        return _mm512_fnmadd_pd(lhsM, rhsM, add);
+#endif // __AVX512F__
 #endif // __FMA__
 }
 
@@ -281,9 +411,15 @@ inline _registerType _mm_fmsub(_registerType lhsM, _registerType rhsM, _register
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_fmsub_ps(lhsM, rhsM, sub);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_fmsub_pd(lhsM, rhsM, sub);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_fmsub_ps(lhsM, rhsM, sub);
+    else
+        return _mm512_fmsub_pd(lhsM, rhsM, sub);
+#endif // __AVX512F__
 #endif // __FMA__
 }
 
@@ -307,9 +443,15 @@ inline _registerType _mm_fnmsub(_registerType lhsM, _registerType rhsM, _registe
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_fnmsub_ps(lhsM, rhsM, sub);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_fnmsub_pd(lhsM, rhsM, sub);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_fnmsub_ps(lhsM, rhsM, sub);
+    else
+        return _mm512_fnmsub_pd(lhsM, rhsM, sub);
+#endif // __AVX512F__
 #endif // __FMA__
 }
 
@@ -352,9 +494,15 @@ _registerType _mm_sqrt(_registerType reg)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_sqrt_ps(reg);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_sqrt_pd(reg);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_sqrt_ps(reg);
+    else
+        return _mm512_sqrt_pd(reg);
+#endif // __AVX512F__
 }
 
 
@@ -374,9 +522,15 @@ _registerType _mm_rsqrt(_registerType reg)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_rsqrt_ps(reg);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_rsqrt_pd(reg);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_rsqrt14_ps(reg);
+    else
+        return _mm512_rsqrt14_pd(reg);
+#endif // __AVX512F__
 }
 
 
@@ -396,9 +550,15 @@ inline auto _mm_cmpeq(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OS);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OS);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_EQ_OS);
+    else
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_EQ_OS);
+#endif // __AVX512F__
 }
 
 
@@ -418,9 +578,15 @@ inline auto _mm_cmple(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OS);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OS);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LE_OS);
+    else
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LE_OS);
+#endif // __AVX512F__
 }
 
 
@@ -440,9 +606,15 @@ inline auto _mm_cmpgt(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OS);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OS);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_GT_OS);
+    else
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_GT_OS);
+#endif // __AVX512F__
 }
 
 
@@ -462,9 +634,15 @@ inline auto _mm_cmplt(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OS);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OS);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_cmp_ps_mask(lhs, rhs, _CMP_LT_OS);
+    else
+        return _mm512_cmp_pd_mask(lhs, rhs, _CMP_LT_OS);
+#endif // __AVX512F__
 }
 
 
@@ -484,9 +662,15 @@ inline _registerType _mm_max(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_max_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_max_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_max_ps(lhs, rhs);
+    else
+        return _mm512_max_pd(lhs, rhs);
+#endif // __AVX512F__
 }
 
 
@@ -506,9 +690,15 @@ inline _registerType _mm_min(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_min_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_min_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_min_ps(lhs, rhs);
+    else
+        return _mm512_min_pd(lhs, rhs);
+#endif // __AVX512F__
 }
 
 
@@ -528,9 +718,17 @@ inline _registerType _mm_and(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_and_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_and_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_castsi512_ps(
+                _mm512_and_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+    else
+        return _mm512_castsi512_pd(
+                _mm512_and_si512(_mm512_castpd_si512(lhs), _mm512_castpd_si512(rhs)));
+#endif // __AVX512F__
 }
 
 
@@ -550,9 +748,17 @@ inline _registerType _mm_andnot(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_andnot_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_andnot_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_castsi512_ps(
+                _mm512_andnot_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+    else
+        return _mm512_castsi512_pd(
+                _mm512_andnot_si512(_mm512_castpd_si512(lhs), _mm512_castpd_si512(rhs)));
+#endif // __AVX512F__
 }
 
 
@@ -572,9 +778,17 @@ inline _registerType _mm_or(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_or_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_or_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_castsi512_ps(
+                _mm512_or_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+    else
+        return _mm512_castsi512_pd(
+                _mm512_or_si512(_mm512_castpd_si512(lhs), _mm512_castpd_si512(rhs)));
+#endif // __AVX512F__
 }
 
 
@@ -594,9 +808,17 @@ inline _registerType _mm_xor(_registerType lhs, _registerType rhs)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_xor_ps(lhs, rhs);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_xor_pd(lhs, rhs);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_castsi512_ps(
+                _mm512_xor_si512(_mm512_castps_si512(lhs), _mm512_castps_si512(rhs)));
+    else
+        return _mm512_castsi512_pd(
+                _mm512_xor_si512(_mm512_castpd_si512(lhs), _mm512_castpd_si512(rhs)));
+#endif // __AVX512F__
 }
 
 
@@ -635,9 +857,15 @@ inline auto _mm_castFI(_registerType src)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_castps_si256(src);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_castpd_si256(src);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_castps_si512(src);
+    else
+        return _mm512_castpd_si512(src);
+#endif // __AVX512F__
 }
 
 
@@ -648,7 +876,7 @@ template <typename _registerType, typename _intRegisterType>
 inline _registerType _mm_castIF(_intRegisterType src)
 {
     using namespace GDL::simd;
-    static_assert(Is__m128i<_intRegisterType> || Is__m256i<_intRegisterType>,
+    static_assert(Is__m128i<_intRegisterType> || Is__m256i<_intRegisterType> || Is__m512i<_intRegisterType>,
                   "Function can only be used with compatible integer register types.");
 
     if constexpr (Is__m128<_registerType>)
@@ -658,9 +886,15 @@ inline _registerType _mm_castIF(_intRegisterType src)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_castsi256_ps(src);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_castsi256_pd(src);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_castsi512_ps(src);
+    else
+        return _mm512_castsi512_pd(src);
+#endif // __AVX512F__
 }
 
 
@@ -680,9 +914,15 @@ inline auto _mm_cvtsF(_registerType reg)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_cvtss_f32(reg);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_cvtsd_f64(reg);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_cvtss_f32(reg);
+    else
+        return _mm512_cvtsd_f64(reg);
+#endif // __AVX512F__
 }
 
 
@@ -702,20 +942,28 @@ inline auto _mm_blend(_registerType src0, _registerType src1)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_blend_ps(src0, src1, _blendMask);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_blend_pd(src0, src1, _blendMask);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_mask_blend_ps(_blendMask, src0, src1);
+    else
+        return _mm512_mask_blend_pd(_blendMask, src0, src1);
+#endif // __AVX512F__
 }
 
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _registerType>
-inline auto _mm_blendv(_registerType src0, _registerType src1, _registerType _blendMask)
+template <typename _registerType, typename _maskType>
+inline auto _mm_blendv(_registerType src0, _registerType src1, _maskType _blendMask)
 {
     using namespace GDL::simd;
     static_assert(IsRegisterType<_registerType>, "Function can only be used with compatible register types.");
+    static_assert(HasMaskRegister<_registerType> || std::is_same<_registerType, _maskType>::value,
+                  "The blend mask must be of the same type as the source registers.");
 
     if constexpr (Is__m128<_registerType>)
         return _mm_blendv_ps(src0, src1, _blendMask);
@@ -724,9 +972,15 @@ inline auto _mm_blendv(_registerType src0, _registerType src1, _registerType _bl
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_blendv_ps(src0, src1, _blendMask);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_blendv_pd(src0, src1, _blendMask);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_mask_blend_ps(_blendMask, src0, src1);
+    else
+        return _mm512_mask_blend_pd(_blendMask, src0, src1);
+#endif // __AVX512F__
 }
 
 
@@ -750,8 +1004,14 @@ inline _registerType _mm_broadcasts(_registerType src)
         return _mm_movedup_pd(src);
     else if constexpr (Is__m256<_registerType>)
         return _mm256_broadcastss_ps(_mm256_castps256_ps128(src));
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_broadcastsd_pd(_mm256_castpd256_pd128(src));
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_broadcastss_ps(_mm512_castps512_ps128(src));
+    else
+        return _mm512_broadcastsd_pd(_mm512_castpd512_pd128(src));
+#endif // __AVX512F__
 }
 
 #endif //__AVX2__
@@ -764,15 +1024,19 @@ template <typename _registerType>
 inline _registerType _mm_movehdup(_registerType src)
 {
     using namespace GDL::simd;
-    static_assert(Is__m128<_registerType> || Is__m256<_registerType>,
+    static_assert(Is__m128<_registerType> || Is__m256<_registerType> || Is__m512<_registerType>,
                   "Function can only be used with compatible register types.");
 
     if constexpr (Is__m128<_registerType>)
         return _mm_movehdup_ps(src);
 #ifdef __AVX2__
-    else
+    else if constexpr (Is__m256<_registerType>)
         return _mm256_movehdup_ps(src);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else
+        return _mm512_movehdup_ps(src);
+#endif // __AVX512F__
 }
 
 
@@ -792,9 +1056,15 @@ inline _registerType _mm_moveldup(_registerType src)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_moveldup_ps(src);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_movedup_pd(src);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_moveldup_ps(src);
+    else
+        return _mm512_movedup_pd(src);
+#endif // __AVX512F__
 }
 
 
@@ -805,16 +1075,21 @@ template <typename _registerType>
 inline _registerType _mm_movehl(_registerType src0, _registerType src1)
 {
     using namespace GDL::simd;
-    static_assert(Is__m128<_registerType> || Is__m256<_registerType>, "Only __m128 and __m256 registers supported.");
+    static_assert(Is__m128<_registerType> || Is__m256<_registerType> || Is__m512<_registerType>,
+                  "Only __m128, __m256 and __m512 registers supported.");
 
     if constexpr (Is__m128<_registerType>)
         return _mm_movehl_ps(src0, src1);
 #ifdef __AVX2__
-    else
+    else if constexpr (Is__m256<_registerType>)
         // See: https://stackoverflow.com/questions/58954801/avx-equivalent-for-mm-movelh-ps?noredirect=1#58955087
         // return _mm256_castpd_ps(_mm256_unpackhi_pd(_mm256_castps_pd(src1), _mm256_castps_pd(src0)));
         return _mm256_shuffle_ps(src1, src0, 0xee);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else
+        return _mm512_shuffle_ps(src1, src0, 0xee);
+#endif // __AVX512F__
 }
 
 
@@ -825,17 +1100,21 @@ template <typename _registerType>
 inline _registerType _mm_movelh(_registerType src0, _registerType src1)
 {
     using namespace GDL::simd;
-    static_assert(Is__m128<_registerType> || Is__m256<_registerType>, "Only __m128 and __m256 registers supported.");
+    static_assert(Is__m128<_registerType> || Is__m256<_registerType> || Is__m512<_registerType>,
+                  "Only __m128, __m256 and __m512 registers supported.");
 
     if constexpr (Is__m128<_registerType>)
         return _mm_movelh_ps(src0, src1);
 #ifdef __AVX2__
-    else
+    else if constexpr (Is__m256<_registerType>)
         // See: https://stackoverflow.com/questions/58954801/avx-equivalent-for-mm-movelh-ps?noredirect=1#58955087
         // return _mm256_castpd_ps(_mm256_unpacklo_pd(_mm256_castps_pd(src0), _mm256_castps_pd(src1)));
         return _mm256_shuffle_ps(src0, src1, 0x44);
-
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else
+        return _mm512_shuffle_ps(src0, src1, 0x44);
+#endif // __AVX512F__
 }
 
 
@@ -860,9 +1139,15 @@ inline auto _mm_permute(_registerType reg)
         return _mm_permute_pd(reg, _permuteMask);
     else if constexpr (Is__m256<_registerType>)
         return _mm256_permute_ps(reg, _permuteMask);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_permute_pd(reg, _permuteMask);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_permute_ps(reg, _permuteMask);
+    else
+        return _mm512_permute_pd(reg, _permuteMask);
+#endif // __AVX512F__
 }
 
 
@@ -913,9 +1198,15 @@ inline auto _mm_shuffle(_registerType src0, _registerType src1)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_shuffle_ps(src0, src1, _shuffleMask);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_shuffle_pd(src0, src1, _shuffleMask);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_shuffle_ps(src0, src1, _shuffleMask);
+    else
+        return _mm512_shuffle_pd(src0, src1, _shuffleMask);
+#endif // __AVX512F__
 }
 
 
@@ -935,9 +1226,15 @@ inline auto _mm_unpackhi(_registerType src0, _registerType src1)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_unpackhi_ps(src0, src1);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_unpackhi_pd(src0, src1);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_unpackhi_ps(src0, src1);
+    else
+        return _mm512_unpackhi_pd(src0, src1);
+#endif // __AVX512F__
 }
 
 
@@ -957,9 +1254,15 @@ inline auto _mm_unpacklo(_registerType src0, _registerType src1)
 #ifdef __AVX2__
     else if constexpr (Is__m256<_registerType>)
         return _mm256_unpacklo_ps(src0, src1);
-    else
+    else if constexpr (Is__m256d<_registerType>)
         return _mm256_unpacklo_pd(src0, src1);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_unpacklo_ps(src0, src1);
+    else
+        return _mm512_unpacklo_pd(src0, src1);
+#endif // __AVX512F__
 }
 
 
@@ -33,16 +33,16 @@ inline _registerType Negate(_registerType source)
 {
     constexpr U32 numRegVals = numRegisterValues<_registerType>;
 
-    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8,
-                  "Only registers with 2, 4 or 8 values are supported.");
+    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8 || numRegVals == 16,
+                  "Only registers with 2, 4, 8 or 16 values are supported.");
 
-    if constexpr (numRegVals == 2)
+    if constexpr (HasMaskRegister<_registerType>)
+        return _mm_xor(source, _mm_set1<_registerType>(-0.));
+    else if constexpr (numRegVals == 2)
         return Negate<1, 1>(source);
-
-    if constexpr (numRegVals == 4)
+    else if constexpr (numRegVals == 4)
         return Negate<1, 1, 1, 1>(source);
-
-    if constexpr (numRegVals == 8)
+    else if constexpr (numRegVals == 8)
         return Negate<1, 1, 1, 1, 1, 1, 1, 1>(source);
 }
 
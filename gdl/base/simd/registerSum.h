@@ -76,6 +76,26 @@ template <U32 _regIdxFirst = 0, typename _registerType, std::size_t _size>
 
 
 
+#ifdef __AVX512F__
+
+//! @brief Calculate the sum of multiple registers. The results are stored in a single register in the same order as the
+//! registers occur in the array. In consequence, the array size must be equal to the number of values per register.
+//! @param data: Array of 8 registers
+//! @return Register containing the sums of the array registers.
+[[nodiscard]] inline __m512d RegisterMultiSum(const std::array<__m512d, 8>& data) noexcept;
+
+
+
+//! @brief Calculate the sum of multiple registers. The results are stored in a single register in the same order as the
+//! registers occur in the array. In consequence, the array size must be equal to the number of values per register.
+//! @param data: Array of 16 registers
+//! @return Register containing the sums of the array registers.
+[[nodiscard]] inline __m512 RegisterMultiSum(const std::array<__m512, 16>& data) noexcept;
+
+#endif // __AVX512F__
+
+
+
 //! @brief Calculates the sum of all register values and returns a new register with all values set to the sum.
 //! @param source: Source register
 //! @return Register with all values equal to the sum of the source register's values.
@@ -108,6 +128,24 @@ template <U32 _regIdxFirst = 0, typename _registerType, std::size_t _size>
 
 
 
+#ifdef __AVX512F__
+
+//! @brief Calculates the sum of all register values and returns a new register with all values set to the sum.
+//! @param source: Source register
+//! @return Register with all values equal to the sum of the source register's values.
+[[nodiscard]] inline __m512 RegisterSum(__m512 source) noexcept;
+
+
+
+//! @brief Calculates the sum of all register values and returns a new register with all values set to the sum.
+//! @param source: Source register
+//! @return Register with all values equal to the sum of the source register's values.
+[[nodiscard]] inline __m512d RegisterSum(__m512d source) noexcept;
+
+#endif // __AVX512F__
+
+
+
 } // namespace GDL::simd
 
 #include "gdl/base/simd/registerSum.inl"
@@ -133,6 +133,65 @@ template <U32 _regIdxFirst, typename _registerType, std::size_t _size>
 
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifdef __AVX512F__
+
+[[nodiscard]] inline __m512d RegisterMultiSum(const std::array<__m512d, 8>& data) noexcept
+{
+    // Each step halves the number of registers. Values whose index has the corresponding bit set are taken from the
+    // second register of a pair and added to their neighbour at the same distance.
+    auto step = [](__m512d lhs, __m512d rhs, __mmask8 mask, auto permute) {
+        return _mm_add(_mm_blendv(lhs, rhs, mask), permute(_mm_blendv(rhs, lhs, mask)));
+    };
+    auto permute1 = [](__m512d reg) { return _mm_permute<0x55>(reg); };
+    auto permute2 = [](__m512d reg) { return _mm512_shuffle_f64x2(reg, reg, 0xB1); };
+    auto permute4 = [](__m512d reg) { return _mm512_shuffle_f64x2(reg, reg, 0x4E); };
+
+    __m512d tmp_0_0 = step(data[0], data[1], 0xAA, permute1);
+    __m512d tmp_0_1 = step(data[2], data[3], 0xAA, permute1);
+    __m512d tmp_0_2 = step(data[4], data[5], 0xAA, permute1);
+    __m512d tmp_0_3 = step(data[6], data[7], 0xAA, permute1);
+
+    __m512d tmp_1_0 = step(tmp_0_0, tmp_0_1, 0xCC, permute2);
+    __m512d tmp_1_1 = step(tmp_0_2, tmp_0_3, 0xCC, permute2);
+
+    return step(tmp_1_0, tmp_1_1, 0xF0, permute4);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline __m512 RegisterMultiSum(const std::array<__m512, 16>& data) noexcept
+{
+    // See __m512d version
+    auto step = [](__m512 lhs, __m512 rhs, __mmask16 mask, auto permute) {
+        return _mm_add(_mm_blendv(lhs, rhs, mask), permute(_mm_blendv(rhs, lhs, mask)));
+    };
+    auto permute1 = [](__m512 reg) { return _mm_permute<0xB1>(reg); };
+    auto permute2 = [](__m512 reg) { return _mm_permute<0x4E>(reg); };
+    auto permute4 = [](__m512 reg) { return _mm512_shuffle_f32x4(reg, reg, 0xB1); };
+    auto permute8 = [](__m512 reg) { return _mm512_shuffle_f32x4(reg, reg, 0x4E); };
+
+    std::array<__m512, 8> tmp_0;
+    for (U32 i = 0; i < 8; ++i)
+        tmp_0[i] = step(data[2 * i], data[2 * i + 1], 0xAAAA, permute1);
+
+    std::array<__m512, 4> tmp_1;
+    for (U32 i = 0; i < 4; ++i)
+        tmp_1[i] = step(tmp_0[2 * i], tmp_0[2 * i + 1], 0xCCCC, permute2);
+
+    __m512 tmp_2_0 = step(tmp_1[0], tmp_1[1], 0xF0F0, permute4);
+    __m512 tmp_2_1 = step(tmp_1[2], tmp_1[3], 0xF0F0, permute4);
+
+    return step(tmp_2_0, tmp_2_1, 0xFF00, permute8);
+}
+
+#endif // __AVX512F__
+
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 [[nodiscard]] inline __m128 RegisterSum(__m128 source) noexcept
@@ -177,4 +236,31 @@ template <U32 _regIdxFirst, typename _registerType, std::size_t _size>
 
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifdef __AVX512F__
+
+[[nodiscard]] inline __m512 RegisterSum(__m512 source) noexcept
+{
+    __m512 sum = _mm_add(source, _mm_permute<0xB1>(source));
+    sum = _mm_add(sum, _mm_permute<0x4E>(sum));
+    sum = _mm_add(sum, _mm512_shuffle_f32x4(sum, sum, 0x4E));
+    return _mm_add(sum, _mm512_shuffle_f32x4(sum, sum, 0xB1));
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+[[nodiscard]] inline __m512d RegisterSum(__m512d source) noexcept
+{
+    __m512d sum = _mm_add(source, _mm_permute<0x55>(source));
+    sum = _mm_add(sum, _mm512_shuffle_f64x2(sum, sum, 0x4E));
+    return _mm_add(sum, _mm512_shuffle_f64x2(sum, sum, 0xB1));
+}
+
+#endif // __AVX512F__
+
+
+
 } // namespace GDL::simd
@@ -165,6 +165,28 @@ inline void Exchange(__m256d& reg0, __m256d& reg1);
 
 #endif // __AVX2__
 
+#ifdef __AVX512F__
+
+//! @brief Exchanges 2 values between 2 registers
+//! @tparam _idx0: Index of the first registers value that should be exchanged
+//! @tparam _idx1: Index of the second registers value that should be exchanged
+//! @param reg0: First register
+//! @param reg1: Second register
+//! @remark: Use the swap function to swap 2 values that are in the same register.
+template <U32 _idx0, U32 _idx1>
+inline void Exchange(__m512& reg0, __m512& reg1);
+
+//! @brief Exchanges 2 values between 2 registers
+//! @tparam _idx0: Index of the first registers value that should be exchanged
+//! @tparam _idx1: Index of the second registers value that should be exchanged
+//! @param reg0: First register
+//! @param reg1: Second register
+//! @remark: Use the swap function to swap 2 values that are in the same register.
+template <U32 _idx0, U32 _idx1>
+inline void Exchange(__m512d& reg0, __m512d& reg1);
+
+#endif // __AVX512F__
+
 //! @brief Inserts a single value from a register into another register and returns the result. Optionally, specific
 //! values of the result can be set to zero.
 //! @tparam _idxSrc: Index of the value that should be copied inside of the source register
@@ -418,6 +440,28 @@ inline __m256d Swap(__m256d source);
 
 #endif // __AVX2__
 
+#ifdef __AVX512F__
+
+//! @brief Creates a new register where 2 values are swapped
+//! @tparam _idx0: Index of the first value that should be swapped
+//! @tparam _idx1: Index of the second value that should be swapped
+//! @param source: Source register
+//! @return New register with swapped values
+//! @remark: Use the exchange function to swap 2 values that are not in the same register.
+template <U32 _idx0, U32 _idx1>
+inline __m512 Swap(__m512 source);
+
+//! @brief Creates a new register where 2 values are swapped
+//! @tparam _idx0: Index of the first value that should be swapped
+//! @tparam _idx1: Index of the second value that should be swapped
+//! @param source: Source register
+//! @return New register with swapped values
+//! @remark: Use the exchange function to swap 2 values that are not in the same register.
+template <U32 _idx0, U32 _idx1>
+inline __m512d Swap(__m512d source);
+
+#endif // __AVX512F__
+
 
 
 //! @brief Swap the lanes of a register with 2 lanes.
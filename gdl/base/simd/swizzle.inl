@@ -78,17 +78,19 @@ inline _registerType BlendIndex(_registerType source0, _registerType source1)
     constexpr U32 numRegVals = numRegisterValues<_registerType>;
 
     static_assert(_index < numRegVals, "Index must be lower than the number of register values.");
-    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8,
-                  "Only registers with 2, 4 or 8 values are supported.");
+    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8 || numRegVals == 16,
+                  "Only registers with 2, 4, 8 or 16 values are supported.");
 
-    if constexpr (numRegVals == 2)
+    if constexpr (HasMaskRegister<_registerType>)
+        return _mm_blend<(1 << _index)>(source0, source1);
+    else if constexpr (numRegVals == 2)
     {
         constexpr U32 b0 = (_index == 0) ? 1 : 0;
         constexpr U32 b1 = (_index == 1) ? 1 : 0;
 
         return Blend<b0, b1>(source0, source1);
     }
-    if constexpr (numRegVals == 4)
+    else if constexpr (numRegVals == 4)
     {
         constexpr U32 b0 = (_index == 0) ? 1 : 0;
         constexpr U32 b1 = (_index == 1) ? 1 : 0;
@@ -97,7 +99,7 @@ inline _registerType BlendIndex(_registerType source0, _registerType source1)
 
         return Blend<b0, b1, b2, b3>(source0, source1);
     }
-    if constexpr (numRegVals == 8)
+    else if constexpr (numRegVals == 8)
     {
         constexpr U32 b0 = (_index == 0) ? 1 : 0;
         constexpr U32 b1 = (_index == 1) ? 1 : 0;
@@ -122,11 +124,13 @@ inline _registerType BlendAboveIndex(_registerType source0, [[maybe_unused]] _re
     constexpr U32 numRegVals = numRegisterValues<_registerType>;
 
     static_assert(_index < numRegVals, "Index must be lower than the number of register values.");
-    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8,
-                  "Only registers with 2, 4 or 8 values are supported.");
+    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8 || numRegVals == 16,
+                  "Only registers with 2, 4, 8 or 16 values are supported.");
 
     if constexpr (_index == 0)
         return source0;
+    else if constexpr (HasMaskRegister<_registerType>)
+        return _mm_blend<(1 << _index) - 1>(source0, source1);
     else if constexpr (numRegVals == 2)
     {
         constexpr U32 b0 = (_index > 0) ? 1 : 0;
@@ -170,10 +174,12 @@ inline _registerType BlendInRange([[maybe_unused]] _registerType source0, _regis
     static_assert(_idxFirst < numRegVals && _idxLast < numRegVals,
                   "Indices must be lower than the number of register values.");
     static_assert(_idxFirst <= _idxLast, "First index must be lower or equal to the second index");
-    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8,
-                  "Only registers with 2, 4 or 8 values are supported.");
+    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8 || numRegVals == 16,
+                  "Only registers with 2, 4, 8 or 16 values are supported.");
     if constexpr (_idxFirst == 0 && _idxLast == numRegVals - 1)
         return source1;
+    else if constexpr (HasMaskRegister<_registerType>)
+        return _mm_blend<((2 << _idxLast) - 1) & ~((1 << _idxFirst) - 1)>(source0, source1);
     else if constexpr (numRegVals == 2)
     {
         constexpr U32 b0 = (_idxFirst <= 0 && _idxLast >= 0) ? 1 : 0;
@@ -215,13 +221,15 @@ inline _registerType BlendBelowIndex(_registerType source0, [[maybe_unused]] _re
     constexpr U32 numRegVals = numRegisterValues<_registerType>;
 
     static_assert(_index < numRegVals, "Index must be lower than the number of register values.");
-    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8,
-                  "Only registers with 2, 4 or 8 values are supported.");
+    static_assert(numRegVals == 2 || numRegVals == 4 || numRegVals == 8 || numRegVals == 16,
+                  "Only registers with 2, 4, 8 or 16 values are supported.");
 
     constexpr U32 b0 = 0;
 
     if constexpr (_index >= numRegVals)
         return source0;
+    else if constexpr (HasMaskRegister<_registerType>)
+        return _mm_blend<((1 << numRegVals) - 1) & ~((2 << _index) - 1)>(source0, source1);
     else if constexpr (numRegVals == 2)
     {
         constexpr U32 b1 = (_index < 1) ? 1 : 0;
@@ -345,6 +353,12 @@ inline _registerType BroadcastAcrossLanes(_registerType reg)
 #ifdef __AVX2__
     if constexpr (_index == 0)
         return _mm_broadcasts(reg);
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return _mm512_permutexvar_ps(_mm512_set1_epi32(_index), reg);
+    else if constexpr (Is__m512d<_registerType>)
+        return _mm512_permutexvar_pd(_mm512_set1_epi64(_index), reg);
+#endif // __AVX512F__
     else if constexpr (numLanes<_registerType> == 1)
         return Broadcast<_index>(reg);
     else
@@ -567,6 +581,38 @@ inline void Exchange(__m256d& reg0, __m256d& reg1)
 
 
 
+#ifdef __AVX512F__
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <U32 _idx0, U32 _idx1>
+inline void Exchange(__m512& reg0, __m512& reg1)
+{
+    static_assert(_idx0 < 16 && _idx1 < 16, "Indices must be in the range [0, 15]");
+
+    __m512 tmp = reg0;
+    reg0 = BlendIndex<_idx0>(reg0, BroadcastAcrossLanes<_idx1>(reg1));
+    reg1 = BlendIndex<_idx1>(reg1, BroadcastAcrossLanes<_idx0>(tmp));
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <U32 _idx0, U32 _idx1>
+inline void Exchange(__m512d& reg0, __m512d& reg1)
+{
+    static_assert(_idx0 < 8 && _idx1 < 8, "Indices must be in the range [0, 7]");
+
+    __m512d tmp = reg0;
+    reg0 = BlendIndex<_idx0>(reg0, BroadcastAcrossLanes<_idx1>(reg1));
+    reg1 = BlendIndex<_idx1>(reg1, BroadcastAcrossLanes<_idx0>(tmp));
+}
+
+#endif // __AVX512F__
+
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <U32 _idxSrc, U32 _idxDst, bool _setZeroIdx0, bool _setZeroIdx1, bool _setZeroIdx2, bool _setZeroIdx3>
@@ -1003,13 +1049,50 @@ inline __m256d Swap(__m256d source)
 
 
 
+#ifdef __AVX512F__
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <U32 _idx0, U32 _idx1>
+inline __m512 Swap(__m512 source)
+{
+    static_assert(_idx0 != _idx1, "Indices must differ");
+    static_assert(_idx0 < 16 && _idx1 < 16, "Indices must be in the range [0, 15]");
+
+    // Only the two swapped values are written by the masked permutation. All other values are taken from the source.
+    const __m512i indices = _mm512_mask_set1_epi32(_mm512_set1_epi32(_idx0), 1 << _idx0, _idx1);
+    return _mm512_mask_permutexvar_ps(source, (1 << _idx0) | (1 << _idx1), indices, source);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <U32 _idx0, U32 _idx1>
+inline __m512d Swap(__m512d source)
+{
+    static_assert(_idx0 != _idx1, "Indices must differ");
+    static_assert(_idx0 < 8 && _idx1 < 8, "Indices must be in the range [0, 7]");
+
+    const __m512i indices = _mm512_mask_set1_epi64(_mm512_set1_epi64(_idx0), 1 << _idx0, _idx1);
+    return _mm512_mask_permutexvar_pd(source, (1 << _idx0) | (1 << _idx1), indices, source);
+}
+
+#endif // __AVX512F__
+
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <typename _registerType>
 [[nodiscard]] inline _registerType SwapLanes(_registerType in) noexcept
 {
     static_assert(numLanes<_registerType> == 2, "Only registers with 2 lanes supported.");
+#ifdef __AVX2__
     return Permute2F128<1, 0>(in);
+#else
+    return in;
+#endif // __AVX2__
 }
 
 
@@ -6,6 +6,8 @@
 #include "gdl/base/simd/_transpose/transpose_m128d.h"
 #include "gdl/base/simd/_transpose/transpose_m256.h"
 #include "gdl/base/simd/_transpose/transpose_m256d.h"
+#include "gdl/base/simd/_transpose/transpose_m512.h"
+#include "gdl/base/simd/_transpose/transpose_m512d.h"
 
 #include "gdl/base/simd/swizzle.h"
 #include "gdl/base/simd/intrinsics.h"
@@ -67,6 +69,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
         else if constexpr (_cols == 4)
             Transpose1x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataO[idxO[0]]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose1x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
@@ -83,6 +86,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
             Transpose1x8<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
                     matDataI[idxI[5]], matDataI[idxI[6]], matDataI[idxI[7]], matDataO[idxO[0]]);
+#endif // __AVX2__
     }
     else if constexpr (_rows == 2)
     {
@@ -99,6 +103,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
             Transpose2x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataO[idxO[0]],
                     matDataO[idxO[1]]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose2x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
@@ -115,6 +120,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
             Transpose2x8<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
                     matDataI[idxI[5]], matDataI[idxI[6]], matDataI[idxI[7]], matDataO[idxO[0]], matDataO[idxO[1]]);
+#endif // __AVX2__
     }
     else if constexpr (_rows == 3)
     {
@@ -132,6 +138,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
             Transpose3x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataO[idxO[0]],
                     matDataO[idxO[1]], matDataO[idxO[2]]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose3x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
@@ -149,6 +156,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
                     matDataI[idxI[5]], matDataI[idxI[6]], matDataI[idxI[7]], matDataO[idxO[0]], matDataO[idxO[1]],
                     matDataO[idxO[2]]);
+#endif // __AVX2__
     }
     else if constexpr (_rows == 4)
     {
@@ -167,6 +175,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
             Transpose4x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataO[idxO[0]],
                     matDataO[idxO[1]], matDataO[idxO[2]], matDataO[idxO[3]]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose4x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
@@ -185,7 +194,9 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
                     matDataI[idxI[0]], matDataI[idxI[1]], matDataI[idxI[2]], matDataI[idxI[3]], matDataI[idxI[4]],
                     matDataI[idxI[5]], matDataI[idxI[6]], matDataI[idxI[7]], matDataO[idxO[0]], matDataO[idxO[1]],
                     matDataO[idxO[2]], matDataO[idxO[3]]);
+#endif // __AVX2__
     }
+#ifdef __AVX2__
     else if constexpr (_rows == 5)
     {
         if constexpr (_cols == 1)
@@ -347,6 +358,7 @@ inline void Transpose(const std::array<_registerType, _arrSizeIn>& matDataI,
                     matDataO[idxO[2]], matDataO[idxO[3]], matDataO[idxO[4]], matDataO[idxO[5]], matDataO[idxO[6]],
                     matDataO[idxO[7]]);
     }
+#endif // __AVX2__
 }
 
 
@@ -37,6 +37,12 @@ constexpr auto GetDataType()
     else if constexpr (Is__m256d<_registerType>)
         return F64{0};
 #endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (Is__m512<_registerType>)
+        return F32{0};
+    else if constexpr (Is__m512d<_registerType>)
+        return F64{0};
+#endif // __AVX512F__
     else if constexpr (_returnTypeIfNoTARegister)
         return _registerType();
     else
@@ -61,13 +67,21 @@ auto GetFittingRegister()
     if constexpr (std::is_same<_type, F64>::value && _registerSize == 256)
         return __m256d();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    if constexpr (std::is_same<_type, F32>::value && _registerSize == 512)
+        return __m512();
+    if constexpr (std::is_same<_type, F64>::value && _registerSize == 512)
+        return __m512d();
+#endif // __AVX512F__
 }
 
 
 
 constexpr U32 MaxRegisterSize()
 {
-#ifdef __AVX2__
+#if defined(__AVX512F__)
+    return 512;
+#elif defined(__AVX2__)
     return 256;
 #else
     return 128;
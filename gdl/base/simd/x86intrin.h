@@ -7,4 +7,14 @@
 #pragma GCC diagnostic ignored "-Wignored-attributes"
 #endif
 
+// GCC 12 reports the self initialized placeholder of _mm512_undefined_ps and similar intrinsics as uninitialized in
+// optimized builds (GCC bug 105593). The warnings are only disabled for the intrinsic headers.
+#if defined __GNUC__ && !defined __clang__ && __GNUC__ < 13
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #include <x86intrin.h>
+#pragma GCC diagnostic pop
+#else
+#include <x86intrin.h>
+#endif
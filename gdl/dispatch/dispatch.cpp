@@ -0,0 +1,61 @@
+#include "gdl/dispatch/dispatch.h"
+
+#include "gdl/base/exception.h"
+
+#include <atomic>
+#include <cstdlib>
+
+
+namespace GDL::Dispatch
+{
+
+//! @brief Selects the highest supported instruction set or the one that is set by the environment variable
+//! GDL_INSTRUCTION_SET
+//! @return Instruction set
+static simd::InstructionSet SelectInstructionSet()
+{
+    const char* environmentValue = std::getenv("GDL_INSTRUCTION_SET");
+    if (environmentValue == nullptr)
+        return simd::GetSupportedInstructionSet();
+
+    const simd::InstructionSet instructionSet = simd::GetInstructionSet(environmentValue);
+    EXCEPTION(!simd::IsSupported(instructionSet),
+              "The instruction set selected by GDL_INSTRUCTION_SET is not supported by the CPU.");
+    return instructionSet;
+}
+
+
+
+//! @brief Gets the storage of the active instruction set. It is initialized on first use, so that kernels can also be
+//! called during the initialization of static objects.
+//! @return Active instruction set
+static std::atomic<simd::InstructionSet>& ActiveInstructionSet()
+{
+    static std::atomic<simd::InstructionSet> activeInstructionSet{SelectInstructionSet()};
+    return activeInstructionSet;
+}
+
+
+
+simd::InstructionSet GetInstructionSet()
+{
+    return ActiveInstructionSet().load(std::memory_order_relaxed);
+}
+
+
+
+void SetInstructionSet(simd::InstructionSet instructionSet)
+{
+    EXCEPTION(!simd::IsSupported(instructionSet),
+              "The instruction set " + simd::GetName(instructionSet) + " is not supported by the CPU.");
+    ActiveInstructionSet().store(instructionSet, std::memory_order_relaxed);
+}
+
+
+
+void ResetInstructionSet()
+{
+    ActiveInstructionSet().store(SelectInstructionSet(), std::memory_order_relaxed);
+}
+
+} // namespace GDL::Dispatch
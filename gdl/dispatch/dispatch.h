@@ -0,0 +1,25 @@
+#pragma once
+
+#include "gdl/base/simd/instructionSet.h"
+
+
+
+namespace GDL::Dispatch
+{
+
+//! @brief Gets the instruction set whose kernels are used by the dispatched functions. It is selected on first use and
+//! is the highest instruction set that is supported by the CPU. The environment variable GDL_INSTRUCTION_SET can be
+//! set to the name of an instruction set (see simd::GetName) to select a lower one.
+//! @return Active instruction set
+[[nodiscard]] simd::InstructionSet GetInstructionSet();
+
+//! @brief Forces the dispatched functions to use the kernels of the passed instruction set. Throws if the instruction
+//! set is not supported by the CPU.
+//! @param instructionSet: Instruction set
+//! @remark This function is meant for testing and benchmarking. It is not synchronized with running kernels.
+void SetInstructionSet(simd::InstructionSet instructionSet);
+
+//! @brief Selects the instruction set as it is done on first use
+void ResetInstructionSet();
+
+} // namespace GDL::Dispatch
@@ -0,0 +1,34 @@
+// No include guard: This file is included once for every instruction set by kernelVariants.h.
+// GDL_DISPATCH_DECLARATION_NAMESPACE must be set to the name of the instruction set before it is included.
+
+namespace GDL::Dispatch::GDL_DISPATCH_DECLARATION_NAMESPACE
+{
+
+template <typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size * _size> Multiply(const std::array<_type, _size * _size>& lhs,
+                                                        const std::array<_type, _size * _size>& rhs);
+
+template <typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size * _size> Transpose(const std::array<_type, _size * _size>& matrix);
+
+template <Solver::Pivot _pivot, typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size> Gauss(const std::array<_type, _size * _size>& A,
+                                             const std::array<_type, _size>& r);
+
+template <Solver::Pivot _pivot, typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size> LU(const std::array<_type, _size * _size>& A,
+                                          const std::array<_type, _size>& r);
+
+void Orientation(const std::array<F32, 2>& a, const std::array<F32, 2>& b, const std::array<F32, 2>* points,
+                 U32 numPoints, F32* results);
+
+void Orientation(const std::array<F32, 3>& a, const std::array<F32, 3>& b, const std::array<F32, 3>& c,
+                 const std::array<F32, 3>* points, U32 numPoints, F32* results);
+
+void PointInsideCircle(const std::array<std::array<F32, 2>, 3>& circle, const std::array<F32, 2>* points,
+                       U32 numPoints, F32* results);
+
+void PointInsideSphere(const std::array<std::array<F32, 3>, 4>& sphere, const std::array<F32, 3>* points,
+                       U32 numPoints, F32* results);
+
+} // namespace GDL::Dispatch::GDL_DISPATCH_DECLARATION_NAMESPACE
@@ -0,0 +1,304 @@
+#pragma once
+
+// Definitions of the kernels of a single instruction set. This file is included by kernelsSSE4_2.cpp,
+// kernelsAVX2.cpp and kernelsAVX512.cpp, which are compiled with the flags of the corresponding instruction set.
+// GDL_DISPATCH_VARIANT must be set to the name of the instruction set before it is included.
+// All inline functions and template instances that are used by the kernels are compiled with the same flags. The build
+// system turns them into local symbols of the kernel object (see CMakeLists.txt of gdl/dispatch), so that the linker
+// can't merge them with the versions of other translation units.
+
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/intrinsics.h"
+#include "gdl/base/simd/utility.h"
+#include "gdl/dispatch/internal/kernelSizes.h"
+#include "gdl/dispatch/internal/kernelVariants.h"
+#include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/vec2fSSE.h"
+#include "gdl/math/simd/vec3fSSE.h"
+#include "gdl/math/simd/vecSIMD.h"
+#include "gdl/math/solver/gauss.h"
+#include "gdl/math/solver/lu.h"
+#include "gdl/physics/collision/functions/orientation.h"
+
+#include <algorithm>
+#include <array>
+
+#ifndef GDL_DISPATCH_VARIANT
+#error "GDL_DISPATCH_VARIANT must be set to the name of the instruction set"
+#endif
+
+
+
+// Kernel definitions -------------------------------------------------------------------------------------------------
+
+namespace GDL::Dispatch::GDL_DISPATCH_VARIANT
+{
+
+template <typename _type, U32 _size>
+std::array<_type, _size * _size> Multiply(const std::array<_type, _size * _size>& lhs,
+                                          const std::array<_type, _size * _size>& rhs)
+{
+    using Matrix = GDL::MatSIMD<_type, _size, _size>;
+    return (Matrix(lhs) * Matrix(rhs)).Data();
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type, U32 _size>
+std::array<_type, _size * _size> Transpose(const std::array<_type, _size * _size>& matrix)
+{
+    return GDL::MatSIMD<_type, _size, _size>(matrix).Transpose().Data();
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Solver::Pivot _pivot, typename _type, U32 _size>
+std::array<_type, _size> Gauss(const std::array<_type, _size * _size>& A, const std::array<_type, _size>& r)
+{
+    return GDL::Solver::Gauss<_pivot>(GDL::MatSIMD<_type, _size, _size>(A), GDL::VecSIMD<_type, _size, true>(r))
+            .Data();
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Solver::Pivot _pivot, typename _type, U32 _size>
+std::array<_type, _size> LU(const std::array<_type, _size * _size>& A, const std::array<_type, _size>& r)
+{
+    return GDL::Solver::LU<_pivot>(GDL::MatSIMD<_type, _size, _size>(A), GDL::VecSIMD<_type, _size, true>(r))
+            .Data();
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! @brief Loads the points in groups of one register width into registers with one coordinate per register (structure
+//! of arrays), passes them to a function that calculates the results of all points of the group and stores them. The
+//! coordinates of the missing points of the last group are set to zero and their results are discarded.
+//! @tparam _numDimensions: Number of point coordinates
+//! @tparam _function: Function type
+//! @param points: Points
+//! @param numPoints: Number of points
+//! @param results: Array that stores the result for each point
+//! @param function: Function that gets an array with a register for each coordinate and returns a register with the
+//! results
+template <UST _numDimensions, typename _function>
+inline void ForEachPointGroup(const std::array<F32, _numDimensions>* points, U32 numPoints, F32* results,
+                              _function function)
+{
+    using RegisterType = decltype(simd::GetFittingRegister<F32, simd::MaxRegisterSize()>());
+    constexpr U32 numGroupPoints = simd::numRegisterValues<RegisterType>;
+
+    auto processGroup = [&function](const std::array<F32, _numDimensions>* groupPoints, F32* groupResults) {
+        std::array<std::array<F32, numGroupPoints>, _numDimensions> values;
+        for (U32 j = 0; j < numGroupPoints; ++j)
+            for (UST k = 0; k < _numDimensions; ++k)
+                values[k][j] = groupPoints[j][k];
+
+        std::array<RegisterType, _numDimensions> coordinates;
+        for (UST k = 0; k < _numDimensions; ++k)
+            coordinates[k] = _mmx_loadu_p<RegisterType>(values[k].data());
+
+        _mm_storeu(groupResults, function(coordinates));
+    };
+
+    const U32 numFullGroupPoints = numPoints - numPoints % numGroupPoints;
+    for (U32 i = 0; i < numFullGroupPoints; i += numGroupPoints)
+        processGroup(&points[i], &results[i]);
+
+    const U32 numRemainingPoints = numPoints - numFullGroupPoints;
+    if (numRemainingPoints > 0)
+    {
+        std::array<std::array<F32, _numDimensions>, numGroupPoints> remainingPoints{};
+        std::array<F32, numGroupPoints> remainingResults;
+        std::copy_n(&points[numFullGroupPoints], numRemainingPoints, remainingPoints.begin());
+        processGroup(remainingPoints.data(), remainingResults.data());
+        std::copy_n(remainingResults.begin(), numRemainingPoints, &results[numFullGroupPoints]);
+    }
+}
+
+
+
+//! @brief Broadcasts each coordinate of a point into a separate register
+//! @tparam _numDimensions: Number of point coordinates
+//! @param point: Point
+//! @return Array with a register for each coordinate
+template <UST _numDimensions>
+inline auto BroadcastPoint(const std::array<F32, _numDimensions>& point)
+{
+    using RegisterType = decltype(simd::GetFittingRegister<F32, simd::MaxRegisterSize()>());
+
+    std::array<RegisterType, _numDimensions> coordinates;
+    for (UST k = 0; k < _numDimensions; ++k)
+        coordinates[k] = _mm_set1<RegisterType>(point[k]);
+    return coordinates;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void Orientation(const std::array<F32, 2>& a, const std::array<F32, 2>& b, const std::array<F32, 2>* points,
+                 U32 numPoints, F32* results)
+{
+    using namespace GDL::simd;
+
+    const auto regA = BroadcastPoint(a);
+    const auto regB = BroadcastPoint(b);
+
+    ForEachPointGroup(points, numPoints, results, [&](const auto& p) {
+        const auto ax = _mm_sub(regA[0], p[0]);
+        const auto ay = _mm_sub(regA[1], p[1]);
+        const auto bx = _mm_sub(regB[0], p[0]);
+        const auto by = _mm_sub(regB[1], p[1]);
+
+        return _mm_fmsub(ax, by, _mm_mul(ay, bx));
+    });
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void Orientation(const std::array<F32, 3>& a, const std::array<F32, 3>& b, const std::array<F32, 3>& c,
+                 const std::array<F32, 3>* points, U32 numPoints, F32* results)
+{
+    using namespace GDL::simd;
+
+    const auto regA = BroadcastPoint(a);
+    const auto regB = BroadcastPoint(b);
+    const auto regC = BroadcastPoint(c);
+
+    ForEachPointGroup(points, numPoints, results, [&](const auto& p) {
+        const auto ax = _mm_sub(regA[0], p[0]);
+        const auto ay = _mm_sub(regA[1], p[1]);
+        const auto az = _mm_sub(regA[2], p[2]);
+        const auto bx = _mm_sub(regB[0], p[0]);
+        const auto by = _mm_sub(regB[1], p[1]);
+        const auto bz = _mm_sub(regB[2], p[2]);
+        const auto cx = _mm_sub(regC[0], p[0]);
+        const auto cy = _mm_sub(regC[1], p[1]);
+        const auto cz = _mm_sub(regC[2], p[2]);
+
+        // a * (b x c)
+        const auto crossX = _mm_fmsub(by, cz, _mm_mul(bz, cy));
+        const auto crossY = _mm_fmsub(bz, cx, _mm_mul(bx, cz));
+        const auto crossZ = _mm_fmsub(bx, cy, _mm_mul(by, cx));
+
+        return _mm_fmadd(ax, crossX, _mm_fmadd(ay, crossY, _mm_mul(az, crossZ)));
+    });
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void PointInsideCircle(const std::array<std::array<F32, 2>, 3>& circle, const std::array<F32, 2>* points,
+                       U32 numPoints, F32* results)
+{
+    using namespace GDL::simd;
+
+    DEV_EXCEPTION(GDL::Orientation(GDL::Vec2fSSE<true>(circle[0]), GDL::Vec2fSSE<true>(circle[1]),
+                                   GDL::Vec2fSSE<true>(circle[2])) <= 0,
+                  "The passed points c0, c1 and c2 must be in counter clockwise ordering if viewed as triangle");
+
+    const std::array<decltype(BroadcastPoint(circle[0])), 3> regC = {
+            {BroadcastPoint(circle[0]), BroadcastPoint(circle[1]), BroadcastPoint(circle[2])}};
+
+    // Determinant of the 3x3 matrix whose columns are (x, y, x^2 + y^2) of the circle points relative to the point
+    ForEachPointGroup(points, numPoints, results, [&](const auto& p) {
+        using RegisterType = std::decay_t<decltype(p[0])>;
+
+        std::array<RegisterType, 3> x;
+        std::array<RegisterType, 3> y;
+        std::array<RegisterType, 3> r;
+        for (U32 i = 0; i < 3; ++i)
+        {
+            x[i] = _mm_sub(regC[i][0], p[0]);
+            y[i] = _mm_sub(regC[i][1], p[1]);
+            r[i] = _mm_fmadd(x[i], x[i], _mm_mul(y[i], y[i]));
+        }
+
+        const auto minor0 = _mm_fmsub(y[1], r[2], _mm_mul(y[2], r[1]));
+        const auto minor1 = _mm_fmsub(y[2], r[0], _mm_mul(y[0], r[2]));
+        const auto minor2 = _mm_fmsub(y[0], r[1], _mm_mul(y[1], r[0]));
+
+        return _mm_fmadd(x[0], minor0, _mm_fmadd(x[1], minor1, _mm_mul(x[2], minor2)));
+    });
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void PointInsideSphere(const std::array<std::array<F32, 3>, 4>& sphere, const std::array<F32, 3>* points,
+                       U32 numPoints, F32* results)
+{
+    using namespace GDL::simd;
+
+    DEV_EXCEPTION(GDL::Orientation(GDL::Vec3fSSE<true>(sphere[0]), GDL::Vec3fSSE<true>(sphere[1]),
+                                   GDL::Vec3fSSE<true>(sphere[2]), GDL::Vec3fSSE<true>(sphere[3])) <= 0,
+                  "Invalid order of the passed points c0, c1, c2 and c3.");
+
+    const std::array<decltype(BroadcastPoint(sphere[0])), 4> regC = {{BroadcastPoint(sphere[0]),
+                                                                      BroadcastPoint(sphere[1]),
+                                                                      BroadcastPoint(sphere[2]),
+                                                                      BroadcastPoint(sphere[3])}};
+
+    // Determinant of the 4x4 matrix whose columns are (x, y, z, x^2 + y^2 + z^2) of the sphere points relative to the
+    // point. It is calculated with the products of the 2x2 minors of the first two and the last two rows.
+    ForEachPointGroup(points, numPoints, results, [&](const auto& p) {
+        using RegisterType = std::decay_t<decltype(p[0])>;
+
+        std::array<RegisterType, 4> x;
+        std::array<RegisterType, 4> y;
+        std::array<RegisterType, 4> z;
+        std::array<RegisterType, 4> r;
+        for (U32 i = 0; i < 4; ++i)
+        {
+            x[i] = _mm_sub(regC[i][0], p[0]);
+            y[i] = _mm_sub(regC[i][1], p[1]);
+            z[i] = _mm_sub(regC[i][2], p[2]);
+            r[i] = _mm_fmadd(x[i], x[i], _mm_fmadd(y[i], y[i], _mm_mul(z[i], z[i])));
+        }
+
+        auto minorXY = [&](U32 i, U32 j) { return _mm_fmsub(x[i], y[j], _mm_mul(x[j], y[i])); };
+        auto minorZR = [&](U32 i, U32 j) { return _mm_fmsub(z[i], r[j], _mm_mul(z[j], r[i])); };
+
+        auto determinant = _mm_mul(minorXY(0, 1), minorZR(2, 3));
+        determinant = _mm_fnmadd(minorXY(0, 2), minorZR(1, 3), determinant);
+        determinant = _mm_fmadd(minorXY(0, 3), minorZR(1, 2), determinant);
+        determinant = _mm_fmadd(minorXY(1, 2), minorZR(0, 3), determinant);
+        determinant = _mm_fnmadd(minorXY(1, 3), minorZR(0, 2), determinant);
+        return _mm_fmadd(minorXY(2, 3), minorZR(0, 1), determinant);
+    });
+}
+
+
+
+// Explicit instantiations --------------------------------------------------------------------------------------------
+
+#define GDL_DISPATCH_INSTANTIATE_KERNELS(_type, _size)                                                                 \
+    template std::array<_type, _size * _size> Multiply<_type, _size>(const std::array<_type, _size * _size>&,          \
+                                                                     const std::array<_type, _size * _size>&);         \
+    template std::array<_type, _size * _size> Transpose<_type, _size>(const std::array<_type, _size * _size>&);        \
+    template std::array<_type, _size> Gauss<Solver::Pivot::NONE, _type, _size>(                                        \
+            const std::array<_type, _size * _size>&, const std::array<_type, _size>&);                                 \
+    template std::array<_type, _size> Gauss<Solver::Pivot::PARTIAL, _type, _size>(                                     \
+            const std::array<_type, _size * _size>&, const std::array<_type, _size>&);                                 \
+    template std::array<_type, _size> LU<Solver::Pivot::NONE, _type, _size>(const std::array<_type, _size * _size>&,   \
+                                                                            const std::array<_type, _size>&);          \
+    template std::array<_type, _size> LU<Solver::Pivot::PARTIAL, _type, _size>(                                        \
+            const std::array<_type, _size * _size>&, const std::array<_type, _size>&);
+
+GDL_DISPATCH_FOR_EACH_KERNEL_SIZE(GDL_DISPATCH_INSTANTIATE_KERNELS)
+
+#undef GDL_DISPATCH_INSTANTIATE_KERNELS
+
+} // namespace GDL::Dispatch::GDL_DISPATCH_VARIANT
@@ -0,0 +1,7 @@
+#pragma once
+
+//! @brief Calls the passed macro with every data type and system size for which the dispatched kernels are compiled.
+//! Kernels for other sizes can be added here.
+#define GDL_DISPATCH_FOR_EACH_KERNEL_SIZE(_macro)                                                                      \
+    _macro(F32, 4) _macro(F32, 8) _macro(F32, 16) _macro(F32, 32) _macro(F32, 64) _macro(F64, 4) _macro(F64, 8)        \
+            _macro(F64, 16) _macro(F64, 32) _macro(F64, 64)
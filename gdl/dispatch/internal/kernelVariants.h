@@ -0,0 +1,23 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/math/solver/pivotEnum.h"
+
+#include <array>
+
+
+
+// Declarations of the kernels of each instruction set. The kernels are defined in kernelDefinitions.inl, which is
+// compiled once for every instruction set (kernelsSSE4_2.cpp, kernelsAVX2.cpp and kernelsAVX512.cpp).
+
+#define GDL_DISPATCH_DECLARATION_NAMESPACE SSE4_2
+#include "gdl/dispatch/internal/kernelDeclarations.h"
+#undef GDL_DISPATCH_DECLARATION_NAMESPACE
+
+#define GDL_DISPATCH_DECLARATION_NAMESPACE AVX2
+#include "gdl/dispatch/internal/kernelDeclarations.h"
+#undef GDL_DISPATCH_DECLARATION_NAMESPACE
+
+#define GDL_DISPATCH_DECLARATION_NAMESPACE AVX512
+#include "gdl/dispatch/internal/kernelDeclarations.h"
+#undef GDL_DISPATCH_DECLARATION_NAMESPACE
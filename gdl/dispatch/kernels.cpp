@@ -0,0 +1,69 @@
+#include "gdl/dispatch/kernels.h"
+
+
+namespace GDL::Dispatch
+{
+
+void Orientation(const std::array<F32, 2>& a, const std::array<F32, 2>& b, const std::array<F32, 2>* points,
+                 U32 numPoints, F32* results)
+{
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::Orientation(a, b, points, numPoints, results);
+    case simd::InstructionSet::AVX2:
+        return AVX2::Orientation(a, b, points, numPoints, results);
+    default:
+        return SSE4_2::Orientation(a, b, points, numPoints, results);
+    }
+}
+
+
+
+void Orientation(const std::array<F32, 3>& a, const std::array<F32, 3>& b, const std::array<F32, 3>& c,
+                 const std::array<F32, 3>* points, U32 numPoints, F32* results)
+{
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::Orientation(a, b, c, points, numPoints, results);
+    case simd::InstructionSet::AVX2:
+        return AVX2::Orientation(a, b, c, points, numPoints, results);
+    default:
+        return SSE4_2::Orientation(a, b, c, points, numPoints, results);
+    }
+}
+
+
+
+void PointInsideCircle(const std::array<std::array<F32, 2>, 3>& circle, const std::array<F32, 2>* points,
+                       U32 numPoints, F32* results)
+{
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::PointInsideCircle(circle, points, numPoints, results);
+    case simd::InstructionSet::AVX2:
+        return AVX2::PointInsideCircle(circle, points, numPoints, results);
+    default:
+        return SSE4_2::PointInsideCircle(circle, points, numPoints, results);
+    }
+}
+
+
+
+void PointInsideSphere(const std::array<std::array<F32, 3>, 4>& sphere, const std::array<F32, 3>* points,
+                       U32 numPoints, F32* results)
+{
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::PointInsideSphere(sphere, points, numPoints, results);
+    case simd::InstructionSet::AVX2:
+        return AVX2::PointInsideSphere(sphere, points, numPoints, results);
+    default:
+        return SSE4_2::PointInsideSphere(sphere, points, numPoints, results);
+    }
+}
+
+} // namespace GDL::Dispatch
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/dispatch/dispatch.h"
+#include "gdl/math/solver/pivotEnum.h"
+
+#include <array>
+
+
+//! @brief Kernels that are compiled for multiple instruction sets and select the fastest version that is supported by
+//! the CPU at runtime (see GetInstructionSet). In contrast to the regular SIMD classes, whose register types are fixed
+//! by the compiler flags, binaries that use these functions run on all CPUs that support SSE4.2.
+//! @remark Matrices are passed as arrays in column major ordering. The fixed size kernels are only compiled for the
+//! sizes that are listed in internal/kernelSizes.h.
+namespace GDL::Dispatch
+{
+
+//! @brief Matrix - matrix multiplication
+//! @tparam _type: Data type
+//! @tparam _size: Number of rows and columns
+//! @param lhs: Lhs matrix
+//! @param rhs: Rhs matrix
+//! @return Result of the multiplication
+template <typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size * _size> Multiply(const std::array<_type, _size * _size>& lhs,
+                                                        const std::array<_type, _size * _size>& rhs);
+
+//! @brief Transposes a matrix
+//! @tparam _type: Data type
+//! @tparam _size: Number of rows and columns
+//! @param matrix: Matrix
+//! @return Transposed matrix
+template <typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size * _size> Transpose(const std::array<_type, _size * _size>& matrix);
+
+//! @brief Solves the linear system A * x = r using gaussian elimination
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @tparam _type: Data type
+//! @tparam _size: Size of the system
+//! @param A: Matrix
+//! @param r: Vector
+//! @return Result vector x
+template <Solver::Pivot _pivot = Solver::Pivot::PARTIAL, typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size> Gauss(const std::array<_type, _size * _size>& A,
+                                             const std::array<_type, _size>& r);
+
+//! @brief Solves the linear system A * x = r using LU decomposition
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @tparam _type: Data type
+//! @tparam _size: Size of the system
+//! @param A: Matrix
+//! @param r: Vector
+//! @return Result vector x
+template <Solver::Pivot _pivot = Solver::Pivot::PARTIAL, typename _type, U32 _size>
+[[nodiscard]] std::array<_type, _size> LU(const std::array<_type, _size * _size>& A,
+                                          const std::array<_type, _size>& r);
+
+//! @brief Checks the orientation of multiple 2d points in relation to a line described by 2 points a and b. See the
+//! corresponding GDL::Orientation function for the meaning of the results.
+//! @param a: First point of the line
+//! @param b: Second point of the line
+//! @param points: Points that should be compared to the line
+//! @param numPoints: Number of points
+//! @param results: Array that stores the result for each point
+void Orientation(const std::array<F32, 2>& a, const std::array<F32, 2>& b, const std::array<F32, 2>* points,
+                 U32 numPoints, F32* results);
+
+//! @brief Checks the orientation of multiple 3d points in relation to a plane described by 3 points a, b and c. See
+//! the corresponding GDL::Orientation function for the meaning of the results.
+//! @param a: First point of the plane
+//! @param b: Second point of the plane
+//! @param c: Third point of the plane
+//! @param points: Points that should be compared to the plane
+//! @param numPoints: Number of points
+//! @param results: Array that stores the result for each point
+void Orientation(const std::array<F32, 3>& a, const std::array<F32, 3>& b, const std::array<F32, 3>& c,
+                 const std::array<F32, 3>* points, U32 numPoints, F32* results);
+
+//! @brief Checks if multiple points lie inside of a circle. See GDL::PointInsideCircle for the meaning of the
+//! results.
+//! @param circle: Three counter clockwise ordered points that describe the circle
+//! @param points: Points that should be checked
+//! @param numPoints: Number of points
+//! @param results: Array that stores the result for each point
+void PointInsideCircle(const std::array<std::array<F32, 2>, 3>& circle, const std::array<F32, 2>* points,
+                       U32 numPoints, F32* results);
+
+//! @brief Checks if multiple points lie inside of a sphere. See GDL::PointInsideSphere for the meaning of the
+//! results.
+//! @param sphere: Four points that describe the sphere. They must have a positive orientation.
+//! @param points: Points that should be checked
+//! @param numPoints: Number of points
+//! @param results: Array that stores the result for each point
+void PointInsideSphere(const std::array<std::array<F32, 3>, 4>& sphere, const std::array<F32, 3>* points,
+                       U32 numPoints, F32* results);
+
+} // namespace GDL::Dispatch
+
+
+#include "gdl/dispatch/kernels.inl"
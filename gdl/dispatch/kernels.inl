@@ -0,0 +1,109 @@
+#pragma once
+
+#include "gdl/dispatch/kernels.h"
+
+#include "gdl/dispatch/internal/kernelSizes.h"
+#include "gdl/dispatch/internal/kernelVariants.h"
+
+#include <type_traits>
+
+namespace GDL::Dispatch
+{
+
+//! @brief Returns if the dispatched kernels are compiled for the passed data type and size
+//! @tparam _type: Data type
+//! @tparam _size: Size
+//! @return TRUE / FALSE
+template <typename _type, U32 _size>
+[[nodiscard]] constexpr bool IsKernelSize()
+{
+#define GDL_DISPATCH_IS_KERNEL_SIZE(_kernelType, _kernelSize)                                                          \
+    if (std::is_same_v<_type, _kernelType> && _size == _kernelSize)                                                    \
+        return true;
+    GDL_DISPATCH_FOR_EACH_KERNEL_SIZE(GDL_DISPATCH_IS_KERNEL_SIZE)
+#undef GDL_DISPATCH_IS_KERNEL_SIZE
+    return false;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type, U32 _size>
+std::array<_type, _size * _size> Multiply(const std::array<_type, _size * _size>& lhs,
+                                          const std::array<_type, _size * _size>& rhs)
+{
+    static_assert(IsKernelSize<_type, _size>(), "No kernel compiled for this size. See internal/kernelSizes.h.");
+
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::Multiply<_type, _size>(lhs, rhs);
+    case simd::InstructionSet::AVX2:
+        return AVX2::Multiply<_type, _size>(lhs, rhs);
+    default:
+        return SSE4_2::Multiply<_type, _size>(lhs, rhs);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type, U32 _size>
+std::array<_type, _size * _size> Transpose(const std::array<_type, _size * _size>& matrix)
+{
+    static_assert(IsKernelSize<_type, _size>(), "No kernel compiled for this size. See internal/kernelSizes.h.");
+
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::Transpose<_type, _size>(matrix);
+    case simd::InstructionSet::AVX2:
+        return AVX2::Transpose<_type, _size>(matrix);
+    default:
+        return SSE4_2::Transpose<_type, _size>(matrix);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Solver::Pivot _pivot, typename _type, U32 _size>
+std::array<_type, _size> Gauss(const std::array<_type, _size * _size>& A, const std::array<_type, _size>& r)
+{
+    static_assert(IsKernelSize<_type, _size>(), "No kernel compiled for this size. See internal/kernelSizes.h.");
+
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::Gauss<_pivot, _type, _size>(A, r);
+    case simd::InstructionSet::AVX2:
+        return AVX2::Gauss<_pivot, _type, _size>(A, r);
+    default:
+        return SSE4_2::Gauss<_pivot, _type, _size>(A, r);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Solver::Pivot _pivot, typename _type, U32 _size>
+std::array<_type, _size> LU(const std::array<_type, _size * _size>& A, const std::array<_type, _size>& r)
+{
+    static_assert(IsKernelSize<_type, _size>(), "No kernel compiled for this size. See internal/kernelSizes.h.");
+
+    switch (GetInstructionSet())
+    {
+    case simd::InstructionSet::AVX512:
+        return AVX512::LU<_pivot, _type, _size>(A, r);
+    case simd::InstructionSet::AVX2:
+        return AVX2::LU<_pivot, _type, _size>(A, r);
+    default:
+        return SSE4_2::LU<_pivot, _type, _size>(A, r);
+    }
+}
+
+} // namespace GDL::Dispatch
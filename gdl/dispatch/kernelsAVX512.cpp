@@ -0,0 +1,4 @@
+// Kernels for the AVX512 instruction set. The compiler flags are set in the CMakeLists.txt of this directory.
+
+#define GDL_DISPATCH_VARIANT AVX512
+#include "gdl/dispatch/internal/kernelDefinitions.inl"
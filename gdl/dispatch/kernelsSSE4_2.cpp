@@ -0,0 +1,4 @@
+// Kernels for the SSE4_2 instruction set. The compiler flags are set in the CMakeLists.txt of this directory.
+
+#define GDL_DISPATCH_VARIANT SSE4_2
+#include "gdl/dispatch/internal/kernelDefinitions.inl"
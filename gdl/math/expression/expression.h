@@ -0,0 +1,467 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/math/expression/internal/containerTraits.h"
+
+#include <type_traits>
+
+
+namespace GDL
+{
+namespace Expression
+{
+
+
+
+//! @brief Base class of all expression template nodes. It is only used to identify expressions.
+struct ExpressionTag
+{
+};
+
+
+
+template <typename _type>
+constexpr bool IsExpression = std::is_base_of<ExpressionTag, _type>::value;
+
+template <typename _type>
+constexpr bool IsContainer = ContainerTraits<_type>::isContainer;
+
+template <typename _type>
+constexpr bool IsOperand = IsExpression<_type> || IsContainer<_type>;
+
+template <typename _lhs, typename _rhs>
+constexpr bool AreBinaryOperands = IsOperand<_lhs> && IsOperand<_rhs> && (IsExpression<_lhs> || IsExpression<_rhs>);
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! @brief Collection of the basic operations on a single container element. An element is either a register or a single
+//! value.
+//! @tparam _elementType: Element type
+template <typename _elementType>
+struct ElementOperations
+{
+    static constexpr bool isRegister = !std::is_floating_point<_elementType>::value;
+
+    //! @brief Returns lhs + rhs
+    [[nodiscard]] static inline _elementType Add(_elementType lhs, _elementType rhs);
+
+    //! @brief Returns an element with all values set to the passed value
+    template <typename _type>
+    [[nodiscard]] static inline _elementType Broadcast(_type value);
+
+    //! @brief Returns lhs * rhs + add
+    [[nodiscard]] static inline _elementType FMAdd(_elementType lhs, _elementType rhs, _elementType add);
+
+    //! @brief Returns lhs * rhs
+    [[nodiscard]] static inline _elementType Mul(_elementType lhs, _elementType rhs);
+
+    //! @brief Returns lhs - rhs
+    [[nodiscard]] static inline _elementType Sub(_elementType lhs, _elementType rhs);
+
+    //! @brief Returns an element with all values set to zero
+    [[nodiscard]] static inline _elementType Zero();
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! @brief Expression that references the data of a container. The container must outlive the expression.
+//!
+//! All expression nodes provide the same interface:
+//! - Get: Returns a single element of the result. Only available if isElementWise is TRUE.
+//! - IsAliasSafe: Returns if the expression can be written directly to the passed destination.
+//! - References: Returns if any container of the expression uses the passed data.
+//! - AssignTo / AddTo / SubtractTo: Write, add or subtract the result to the destination elements.
+//! @tparam _container: Container type
+template <typename _container>
+class Leaf : public ExpressionTag
+{
+public:
+    using ContainerType = _container;
+    using ElementType = typename ContainerTraits<_container>::ElementType;
+    using ValueType = typename ContainerTraits<_container>::ValueType;
+    static constexpr bool isElementWise = true;
+
+private:
+    static constexpr U32 numElements = ContainerTraits<_container>::numElements;
+
+    const ElementType* mData;
+
+public:
+    //! @brief Constructor
+    //! @param container: Referenced container
+    explicit Leaf(const _container& container);
+
+    //! @brief Gets an element of the result
+    //! @param index: Index of the element
+    //! @return Element
+    [[nodiscard]] inline ElementType Get(U32 index) const;
+
+    //! @brief Gets a pointer to the referenced data
+    //! @return Pointer to the referenced data
+    [[nodiscard]] inline const ElementType* Data() const;
+
+    //! @brief Returns if the expression can be written directly to the passed destination
+    //! @param destination: Destination data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool IsAliasSafe(const void* destination) const;
+
+    //! @brief Returns if any container of the expression uses the passed data
+    //! @param data: Data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool References(const void* data) const;
+
+    //! @brief Writes the result to the destination
+    //! @param destination: Destination data
+    inline void AssignTo(ElementType* destination) const;
+
+    //! @brief Adds the result to the destination
+    //! @param destination: Destination data
+    inline void AddTo(ElementType* destination) const;
+
+    //! @brief Subtracts the result from the destination
+    //! @param destination: Destination data
+    inline void SubtractTo(ElementType* destination) const;
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! @brief Element-wise addition or subtraction of two expressions. If one of the operands is not element-wise, the lhs
+//! is written to the destination first and the rhs is accumulated afterwards. This maps A * x + b onto FMA operations.
+//! @tparam _lhs: Lhs expression
+//! @tparam _rhs: Rhs expression
+//! @tparam _subtract: If TRUE, the rhs is subtracted
+template <typename _lhs, typename _rhs, bool _subtract>
+class Addition : public ExpressionTag
+{
+public:
+    using ContainerType = typename _lhs::ContainerType;
+    using ElementType = typename ContainerTraits<ContainerType>::ElementType;
+    using ValueType = typename ContainerTraits<ContainerType>::ValueType;
+    static constexpr bool isElementWise = _lhs::isElementWise && _rhs::isElementWise;
+
+    static_assert(std::is_same<ContainerType, typename _rhs::ContainerType>::value,
+                  "Element-wise operations require operands of the same type and size.");
+
+private:
+    static constexpr U32 numElements = ContainerTraits<ContainerType>::numElements;
+
+    _lhs mLhs;
+    _rhs mRhs;
+
+public:
+    //! @brief Constructor
+    //! @param lhs: Lhs expression
+    //! @param rhs: Rhs expression
+    Addition(const _lhs& lhs, const _rhs& rhs);
+
+    //! @brief Gets an element of the result
+    //! @param index: Index of the element
+    //! @return Element
+    [[nodiscard]] inline ElementType Get(U32 index) const;
+
+    //! @brief Returns if the expression can be written directly to the passed destination
+    //! @param destination: Destination data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool IsAliasSafe(const void* destination) const;
+
+    //! @brief Returns if any container of the expression uses the passed data
+    //! @param data: Data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool References(const void* data) const;
+
+    //! @brief Writes the result to the destination
+    //! @param destination: Destination data
+    inline void AssignTo(ElementType* destination) const;
+
+    //! @brief Adds the result to the destination
+    //! @param destination: Destination data
+    inline void AddTo(ElementType* destination) const;
+
+    //! @brief Subtracts the result from the destination
+    //! @param destination: Destination data
+    inline void SubtractTo(ElementType* destination) const;
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! @brief Multiplication of an expression with a scalar
+//! @tparam _expression: Scaled expression
+template <typename _expression>
+class Scaling : public ExpressionTag
+{
+public:
+    using ContainerType = typename _expression::ContainerType;
+    using ElementType = typename ContainerTraits<ContainerType>::ElementType;
+    using ValueType = typename ContainerTraits<ContainerType>::ValueType;
+    static constexpr bool isElementWise = _expression::isElementWise;
+
+private:
+    static constexpr U32 numElements = ContainerTraits<ContainerType>::numElements;
+
+    _expression mExpression;
+    ValueType mFactor;
+
+public:
+    //! @brief Constructor
+    //! @param expression: Scaled expression
+    //! @param factor: Scaling factor
+    Scaling(const _expression& expression, ValueType factor);
+
+    //! @brief Gets an element of the result
+    //! @param index: Index of the element
+    //! @return Element
+    [[nodiscard]] inline ElementType Get(U32 index) const;
+
+    //! @brief Returns if the expression can be written directly to the passed destination
+    //! @param destination: Destination data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool IsAliasSafe(const void* destination) const;
+
+    //! @brief Returns if any container of the expression uses the passed data
+    //! @param data: Data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool References(const void* data) const;
+
+    //! @brief Writes the result to the destination
+    //! @param destination: Destination data
+    inline void AssignTo(ElementType* destination) const;
+
+    //! @brief Adds the result to the destination
+    //! @param destination: Destination data
+    inline void AddTo(ElementType* destination) const;
+
+    //! @brief Subtracts the result from the destination
+    //! @param destination: Destination data
+    inline void SubtractTo(ElementType* destination) const;
+
+private:
+    //! @brief Adds or subtracts the result to the destination
+    //! @tparam _subtract: If TRUE, the result is subtracted
+    //! @param destination: Destination data
+    template <bool _subtract>
+    inline void Accumulate(ElementType* destination) const;
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! @brief Matrix-matrix or matrix-vector product. The result is accumulated column by column with FMA operations, so
+//! that adding it to another expression needs no additional pass over the memory. Operands that are not leaves are
+//! evaluated into a temporary first.
+//! @tparam _lhs: Lhs expression (matrix)
+//! @tparam _rhs: Rhs expression (matrix or vector)
+template <typename _lhs, typename _rhs>
+class Product : public ExpressionTag
+{
+    using LhsTraits = ContainerTraits<typename _lhs::ContainerType>;
+    using RhsTraits = ContainerTraits<typename _rhs::ContainerType>;
+
+    static_assert(LhsTraits::isMatrix, "Lhs operand of a product must be a matrix.");
+    static_assert(RhsTraits::isMatrix || RhsTraits::cols == 1,
+                  "Rhs operand of a product must be a matrix or column vector.");
+
+public:
+    using ContainerType = typename RhsTraits::template ProductType<LhsTraits::rows>;
+    using ElementType = typename LhsTraits::ElementType;
+    using ValueType = typename LhsTraits::ValueType;
+    static constexpr bool isElementWise = false;
+
+    static_assert(LhsTraits::cols == RhsTraits::rows, "Lhs cols != Rhs rows");
+    static_assert(std::is_same<ElementType, typename RhsTraits::ElementType>::value,
+                  "Product operands must have the same data type.");
+
+private:
+    static constexpr U32 numElements = ContainerTraits<ContainerType>::numElements;
+
+    _lhs mLhs;
+    _rhs mRhs;
+    ValueType mFactor;
+
+public:
+    //! @brief Constructor
+    //! @param lhs: Lhs expression
+    //! @param rhs: Rhs expression
+    //! @param factor: Factor that is multiplied with the product
+    Product(const _lhs& lhs, const _rhs& rhs, ValueType factor = 1);
+
+    //! @brief Returns a copy of the product that is multiplied with the passed factor
+    //! @param factor: Factor
+    //! @return Scaled product
+    [[nodiscard]] inline Product Scale(ValueType factor) const;
+
+    //! @brief Returns if the expression can be written directly to the passed destination
+    //! @param destination: Destination data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool IsAliasSafe(const void* destination) const;
+
+    //! @brief Returns if any container of the expression uses the passed data
+    //! @param data: Data
+    //! @return TRUE / FALSE
+    [[nodiscard]] inline bool References(const void* data) const;
+
+    //! @brief Writes the result to the destination
+    //! @param destination: Destination data
+    inline void AssignTo(ElementType* destination) const;
+
+    //! @brief Adds the result to the destination
+    //! @param destination: Destination data
+    inline void AddTo(ElementType* destination) const;
+
+    //! @brief Subtracts the result from the destination
+    //! @param destination: Destination data
+    inline void SubtractTo(ElementType* destination) const;
+
+private:
+    //! @brief Adds or subtracts the product to the destination
+    //! @tparam _subtract: If TRUE, the product is subtracted
+    //! @param destination: Destination data
+    template <bool _subtract>
+    inline void Accumulate(ElementType* destination) const;
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+constexpr bool IsLeaf = false;
+
+template <typename _container>
+constexpr bool IsLeaf<Leaf<_container>> = true;
+
+template <typename _type>
+constexpr bool IsProduct = false;
+
+template <typename _lhs, typename _rhs>
+constexpr bool IsProduct<Product<_lhs, _rhs>> = true;
+
+
+
+//! @brief Provides the data of an expression operand. Leaves are referenced directly, all other expressions are
+//! evaluated into a temporary container.
+//! @tparam _expression: Expression type
+//! @tparam _isLeaf: TRUE if the expression is a leaf
+template <typename _expression, bool _isLeaf = IsLeaf<_expression>>
+class OperandData
+{
+    using ElementType = typename _expression::ElementType;
+
+    const ElementType* mData;
+
+public:
+    //! @brief Constructor
+    //! @param expression: Leaf expression
+    explicit OperandData(const _expression& expression);
+
+    //! @brief Gets a pointer to the operand data
+    //! @return Pointer to the operand data
+    [[nodiscard]] inline const ElementType* Data() const;
+};
+
+
+
+template <typename _expression>
+class OperandData<_expression, false>
+{
+    using ContainerType = typename _expression::ContainerType;
+    using ElementType = typename _expression::ElementType;
+
+    ContainerType mContainer;
+
+public:
+    //! @brief Constructor
+    //! @param expression: Expression that is evaluated
+    explicit OperandData(const _expression& expression);
+
+    //! @brief Gets a pointer to the operand data
+    //! @return Pointer to the operand data
+    [[nodiscard]] inline const ElementType* Data() const;
+};
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+using OperandType = std::conditional_t<IsExpression<_type>, _type, Leaf<_type>>;
+
+//! @brief Converts a container into a leaf expression. Expressions are returned unchanged.
+//! @tparam _type: Container or expression type
+//! @param operand: Container or expression
+//! @return Expression
+template <typename _type>
+[[nodiscard]] inline OperandType<_type> AsOperand(const _type& operand);
+
+//! @brief Evaluates an expression and writes the result to the destination. If the expression can't be written directly
+//! to the destination because the destination is also used as a product operand, the expression is evaluated into a
+//! temporary that is copied afterwards.
+//! @tparam _expression: Expression type
+//! @param expression: Expression
+//! @param destination: Pointer to the first element of the destination container
+template <typename _expression>
+inline void Assign(const _expression& expression, typename _expression::ElementType* destination);
+
+
+
+// Operators ----------------------------------------------------------------------------------------------------------
+
+//! @brief Lazy element-wise addition. At least one of the operands must be an expression.
+template <typename _lhs, typename _rhs, typename = std::enable_if_t<AreBinaryOperands<_lhs, _rhs>>>
+[[nodiscard]] inline Addition<OperandType<_lhs>, OperandType<_rhs>, false> operator+(const _lhs& lhs,
+                                                                                     const _rhs& rhs);
+
+//! @brief Lazy element-wise subtraction. At least one of the operands must be an expression.
+template <typename _lhs, typename _rhs, typename = std::enable_if_t<AreBinaryOperands<_lhs, _rhs>>>
+[[nodiscard]] inline Addition<OperandType<_lhs>, OperandType<_rhs>, true> operator-(const _lhs& lhs,
+                                                                                    const _rhs& rhs);
+
+//! @brief Lazy matrix-matrix or matrix-vector product. At least one of the operands must be an expression.
+template <typename _lhs, typename _rhs, typename = std::enable_if_t<AreBinaryOperands<_lhs, _rhs>>>
+[[nodiscard]] inline Product<OperandType<_lhs>, OperandType<_rhs>> operator*(const _lhs& lhs, const _rhs& rhs);
+
+//! @brief Lazy multiplication of an expression with a scalar
+template <typename _expression, typename _scalar,
+          typename = std::enable_if_t<IsExpression<_expression> && std::is_arithmetic<_scalar>::value>>
+[[nodiscard]] inline auto operator*(const _expression& expression, _scalar factor);
+
+//! @brief Lazy multiplication of an expression with a scalar
+template <typename _scalar, typename _expression,
+          typename = std::enable_if_t<IsExpression<_expression> && std::is_arithmetic<_scalar>::value>>
+[[nodiscard]] inline auto operator*(_scalar factor, const _expression& expression);
+
+
+
+} // namespace Expression
+
+
+
+//! @brief Wraps a matrix or vector into an expression, so that all following arithmetic operations are evaluated
+//! lazily. The whole expression is evaluated once it is assigned to a matrix or vector. Supported are MatSerial,
+//! MatSIMD, VecSerial and VecSIMD. Row vectors only support element-wise operations. MatX and VecX are not supported
+//! because the expression sizes are resolved at compile time.
+//! @remark Expressions store pointers to the data of their container operands and never copy them. An expression must
+//! therefore be evaluated before any of its operands is destroyed. Assigning it to a container within the same full
+//! expression is always safe, even if temporaries are involved: `Mat r = Lazy(a) + b * 2;`. Storing it in a
+//! variable is only safe as long as all operands outlive the variable: `auto e = Lazy(a) + b;` dangles if `a` or `b`
+//! is a temporary or goes out of scope before `e` is evaluated.
+//! @tparam _container: Container type
+//! @param container: Matrix or vector
+//! @return Leaf expression
+template <typename _container>
+[[nodiscard]] inline Expression::Leaf<_container> Lazy(const _container& container);
+
+
+
+} // namespace GDL
+
+
+#include "gdl/math/expression/expression.inl"
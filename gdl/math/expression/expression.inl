@@ -0,0 +1,652 @@
+#pragma once
+
+#include "gdl/math/expression/expression.h"
+
+#include "gdl/base/simd/intrinsics.h"
+#include "gdl/math/gemm/gemm.h"
+
+#include <algorithm>
+#include <array>
+
+
+namespace GDL
+{
+namespace Expression
+{
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _elementType>
+inline _elementType ElementOperations<_elementType>::Add(_elementType lhs, _elementType rhs)
+{
+    if constexpr (isRegister)
+        return _mm_add(lhs, rhs);
+    else
+        return lhs + rhs;
+}
+
+
+
+template <typename _elementType>
+template <typename _type>
+inline _elementType ElementOperations<_elementType>::Broadcast(_type value)
+{
+    if constexpr (isRegister)
+        return _mm_set1<_elementType>(value);
+    else
+        return static_cast<_elementType>(value);
+}
+
+
+
+template <typename _elementType>
+inline _elementType ElementOperations<_elementType>::FMAdd(_elementType lhs, _elementType rhs, _elementType add)
+{
+    if constexpr (isRegister)
+        return _mm_fmadd(lhs, rhs, add);
+    else
+        return lhs * rhs + add;
+}
+
+
+
+template <typename _elementType>
+inline _elementType ElementOperations<_elementType>::Mul(_elementType lhs, _elementType rhs)
+{
+    if constexpr (isRegister)
+        return _mm_mul(lhs, rhs);
+    else
+        return lhs * rhs;
+}
+
+
+
+template <typename _elementType>
+inline _elementType ElementOperations<_elementType>::Sub(_elementType lhs, _elementType rhs)
+{
+    if constexpr (isRegister)
+        return _mm_sub(lhs, rhs);
+    else
+        return lhs - rhs;
+}
+
+
+
+template <typename _elementType>
+inline _elementType ElementOperations<_elementType>::Zero()
+{
+    if constexpr (isRegister)
+        return _mm_setzero<_elementType>();
+    else
+        return 0;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _container>
+Leaf<_container>::Leaf(const _container& container)
+    : mData{ContainerTraits<_container>::GetData(container)}
+{
+}
+
+
+
+template <typename _container>
+inline typename Leaf<_container>::ElementType Leaf<_container>::Get(U32 index) const
+{
+    return mData[index];
+}
+
+
+
+template <typename _container>
+inline const typename Leaf<_container>::ElementType* Leaf<_container>::Data() const
+{
+    return mData;
+}
+
+
+
+template <typename _container>
+inline bool Leaf<_container>::IsAliasSafe(const void*) const
+{
+    return true;
+}
+
+
+
+template <typename _container>
+inline bool Leaf<_container>::References(const void* data) const
+{
+    return mData == data;
+}
+
+
+
+template <typename _container>
+inline void Leaf<_container>::AssignTo(ElementType* destination) const
+{
+    if (destination != mData)
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = mData[i];
+}
+
+
+
+template <typename _container>
+inline void Leaf<_container>::AddTo(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    for (U32 i = 0; i < numElements; ++i)
+        destination[i] = Op::Add(destination[i], mData[i]);
+}
+
+
+
+template <typename _container>
+inline void Leaf<_container>::SubtractTo(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    for (U32 i = 0; i < numElements; ++i)
+        destination[i] = Op::Sub(destination[i], mData[i]);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _lhs, typename _rhs, bool _subtract>
+Addition<_lhs, _rhs, _subtract>::Addition(const _lhs& lhs, const _rhs& rhs)
+    : mLhs{lhs}
+    , mRhs{rhs}
+{
+}
+
+
+
+template <typename _lhs, typename _rhs, bool _subtract>
+inline typename Addition<_lhs, _rhs, _subtract>::ElementType Addition<_lhs, _rhs, _subtract>::Get(U32 index) const
+{
+    static_assert(isElementWise, "Expression is not element-wise.");
+
+    using Op = ElementOperations<ElementType>;
+
+    if constexpr (_subtract)
+        return Op::Sub(mLhs.Get(index), mRhs.Get(index));
+    else
+        return Op::Add(mLhs.Get(index), mRhs.Get(index));
+}
+
+
+
+template <typename _lhs, typename _rhs, bool _subtract>
+inline bool Addition<_lhs, _rhs, _subtract>::IsAliasSafe(const void* destination) const
+{
+    // Element-wise expressions only read the element that is written afterwards. Otherwise, the lhs result is written
+    // to the destination before the rhs reads its operands.
+    if constexpr (isElementWise)
+        return true;
+    else
+        return mLhs.IsAliasSafe(destination) && !mRhs.References(destination);
+}
+
+
+
+template <typename _lhs, typename _rhs, bool _subtract>
+inline bool Addition<_lhs, _rhs, _subtract>::References(const void* data) const
+{
+    return mLhs.References(data) || mRhs.References(data);
+}
+
+
+
+template <typename _lhs, typename _rhs, bool _subtract>
+inline void Addition<_lhs, _rhs, _subtract>::AssignTo(ElementType* destination) const
+{
+    if constexpr (isElementWise)
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = Get(i);
+    else
+    {
+        mLhs.AssignTo(destination);
+        if constexpr (_subtract)
+            mRhs.SubtractTo(destination);
+        else
+            mRhs.AddTo(destination);
+    }
+}
+
+
+
+template <typename _lhs, typename _rhs, bool _subtract>
+inline void Addition<_lhs, _rhs, _subtract>::AddTo(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    if constexpr (isElementWise)
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = Op::Add(destination[i], Get(i));
+    else
+    {
+        mLhs.AddTo(destination);
+        if constexpr (_subtract)
+            mRhs.SubtractTo(destination);
+        else
+            mRhs.AddTo(destination);
+    }
+}
+
+
+
+template <typename _lhs, typename _rhs, bool _subtract>
+inline void Addition<_lhs, _rhs, _subtract>::SubtractTo(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    if constexpr (isElementWise)
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = Op::Sub(destination[i], Get(i));
+    else
+    {
+        mLhs.SubtractTo(destination);
+        if constexpr (_subtract)
+            mRhs.AddTo(destination);
+        else
+            mRhs.SubtractTo(destination);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _expression>
+Scaling<_expression>::Scaling(const _expression& expression, ValueType factor)
+    : mExpression{expression}
+    , mFactor{factor}
+{
+}
+
+
+
+template <typename _expression>
+inline typename Scaling<_expression>::ElementType Scaling<_expression>::Get(U32 index) const
+{
+    static_assert(isElementWise, "Expression is not element-wise.");
+
+    using Op = ElementOperations<ElementType>;
+
+    return Op::Mul(Op::Broadcast(mFactor), mExpression.Get(index));
+}
+
+
+
+template <typename _expression>
+inline bool Scaling<_expression>::IsAliasSafe(const void* destination) const
+{
+    return mExpression.IsAliasSafe(destination);
+}
+
+
+
+template <typename _expression>
+inline bool Scaling<_expression>::References(const void* data) const
+{
+    return mExpression.References(data);
+}
+
+
+
+template <typename _expression>
+inline void Scaling<_expression>::AssignTo(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    if constexpr (isElementWise)
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = Get(i);
+    else
+    {
+        mExpression.AssignTo(destination);
+
+        const ElementType factor = Op::Broadcast(mFactor);
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = Op::Mul(factor, destination[i]);
+    }
+}
+
+
+
+template <typename _expression>
+inline void Scaling<_expression>::AddTo(ElementType* destination) const
+{
+    Accumulate<false>(destination);
+}
+
+
+
+template <typename _expression>
+inline void Scaling<_expression>::SubtractTo(ElementType* destination) const
+{
+    Accumulate<true>(destination);
+}
+
+
+
+template <typename _expression>
+template <bool _subtract>
+inline void Scaling<_expression>::Accumulate(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    const ElementType factor = Op::Broadcast((_subtract) ? -mFactor : mFactor);
+
+    if constexpr (isElementWise)
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = Op::FMAdd(factor, mExpression.Get(i), destination[i]);
+    else
+    {
+        const OperandData<_expression> expression(mExpression);
+        const ElementType* data = expression.Data();
+
+        for (U32 i = 0; i < numElements; ++i)
+            destination[i] = Op::FMAdd(factor, data[i], destination[i]);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _lhs, typename _rhs>
+Product<_lhs, _rhs>::Product(const _lhs& lhs, const _rhs& rhs, ValueType factor)
+    : mLhs{lhs}
+    , mRhs{rhs}
+    , mFactor{factor}
+{
+}
+
+
+
+template <typename _lhs, typename _rhs>
+inline Product<_lhs, _rhs> Product<_lhs, _rhs>::Scale(ValueType factor) const
+{
+    return Product(mLhs, mRhs, mFactor * factor);
+}
+
+
+
+template <typename _lhs, typename _rhs>
+inline bool Product<_lhs, _rhs>::IsAliasSafe(const void* destination) const
+{
+    return !References(destination);
+}
+
+
+
+template <typename _lhs, typename _rhs>
+inline bool Product<_lhs, _rhs>::References(const void* data) const
+{
+    return mLhs.References(data) || mRhs.References(data);
+}
+
+
+
+template <typename _lhs, typename _rhs>
+inline void Product<_lhs, _rhs>::AssignTo(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    for (U32 i = 0; i < numElements; ++i)
+        destination[i] = Op::Zero();
+
+    Accumulate<false>(destination);
+}
+
+
+
+template <typename _lhs, typename _rhs>
+inline void Product<_lhs, _rhs>::AddTo(ElementType* destination) const
+{
+    Accumulate<false>(destination);
+}
+
+
+
+template <typename _lhs, typename _rhs>
+inline void Product<_lhs, _rhs>::SubtractTo(ElementType* destination) const
+{
+    Accumulate<true>(destination);
+}
+
+
+
+template <typename _lhs, typename _rhs>
+template <bool _subtract>
+inline void Product<_lhs, _rhs>::Accumulate(ElementType* destination) const
+{
+    using Op = ElementOperations<ElementType>;
+
+    constexpr U32 numRows = LhsTraits::numElementsPerCol;
+    constexpr U32 numInner = LhsTraits::cols;
+    constexpr U32 numCols = RhsTraits::cols;
+    constexpr U32 ldLhs = LhsTraits::numValuesPerCol;
+    constexpr U32 ldRhs = RhsTraits::numValuesPerCol;
+    constexpr U32 blockSize = 4;
+    constexpr U32 minNumRowsColumnWise = 17;
+
+    const OperandData<_lhs> lhs(mLhs);
+    const OperandData<_rhs> rhs(mRhs);
+    const ElementType* lhsData = lhs.Data();
+    const ValueType* rhsValues = reinterpret_cast<const ValueType*>(rhs.Data());
+    const ValueType factor = (_subtract) ? -mFactor : mFactor;
+
+    if constexpr (IsGEMMBeneficial<ValueType>(ldLhs, numCols, numInner))
+        if (factor == 1)
+        {
+            GEMM<ValueType>(ldLhs, numCols, numInner, reinterpret_cast<const ValueType*>(lhsData), ldLhs, rhsValues,
+                            ldRhs, reinterpret_cast<ValueType*>(destination), ldLhs);
+            return;
+        }
+
+
+    // Long columns of single values: The scaled lhs columns are added to a local copy of the result column. The
+    // compiler vectorizes this loop and doesn't need to store the result after each lhs column because the copy can't
+    // alias the operands. Short columns are completely unrolled by the compiler which results in poor vector code.
+    // They use the blocked version below.
+    if constexpr (!Op::isRegister && numRows >= minNumRowsColumnWise)
+    {
+        for (U32 i = 0; i < numCols; ++i)
+        {
+            const ValueType* rhsCol = &rhsValues[i * ldRhs];
+            ElementType* resultCol = &destination[i * numRows];
+
+            std::array<ElementType, numRows> acc;
+            std::copy(resultCol, resultCol + numRows, acc.begin());
+            for (U32 j = 0; j < numInner; ++j)
+            {
+                const ElementType rhsValue = factor * rhsCol[j];
+                const ElementType* lhsCol = &lhsData[j * numRows];
+                for (U32 k = 0; k < numRows; ++k)
+                    acc[k] = Op::FMAdd(lhsCol[k], rhsValue, acc[k]);
+            }
+            std::copy(acc.begin(), acc.end(), resultCol);
+        }
+        return;
+    }
+
+
+    // Blocks of result elements are accumulated in local variables, so that they are only loaded and stored once
+    for (U32 i = 0; i < numCols; ++i)
+    {
+        const ValueType* rhsCol = &rhsValues[i * ldRhs];
+        ElementType* resultCol = &destination[i * numRows];
+
+        U32 k = 0;
+        for (; k + blockSize <= numRows; k += blockSize)
+        {
+            ElementType acc0 = resultCol[k];
+            ElementType acc1 = resultCol[k + 1];
+            ElementType acc2 = resultCol[k + 2];
+            ElementType acc3 = resultCol[k + 3];
+            for (U32 j = 0; j < numInner; ++j)
+            {
+                const ElementType rhsValue = Op::Broadcast(factor * rhsCol[j]);
+                const ElementType* lhsCol = &lhsData[j * numRows + k];
+                acc0 = Op::FMAdd(lhsCol[0], rhsValue, acc0);
+                acc1 = Op::FMAdd(lhsCol[1], rhsValue, acc1);
+                acc2 = Op::FMAdd(lhsCol[2], rhsValue, acc2);
+                acc3 = Op::FMAdd(lhsCol[3], rhsValue, acc3);
+            }
+            resultCol[k] = acc0;
+            resultCol[k + 1] = acc1;
+            resultCol[k + 2] = acc2;
+            resultCol[k + 3] = acc3;
+        }
+
+        for (; k < numRows; ++k)
+        {
+            ElementType acc = resultCol[k];
+            for (U32 j = 0; j < numInner; ++j)
+                acc = Op::FMAdd(lhsData[j * numRows + k], Op::Broadcast(factor * rhsCol[j]), acc);
+            resultCol[k] = acc;
+        }
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _expression, bool _isLeaf>
+OperandData<_expression, _isLeaf>::OperandData(const _expression& expression)
+    : mData{expression.Data()}
+{
+}
+
+
+
+template <typename _expression, bool _isLeaf>
+inline const typename OperandData<_expression, _isLeaf>::ElementType* OperandData<_expression, _isLeaf>::Data() const
+{
+    return mData;
+}
+
+
+
+template <typename _expression>
+OperandData<_expression, false>::OperandData(const _expression& expression)
+    : mContainer(expression)
+{
+}
+
+
+
+template <typename _expression>
+inline const typename OperandData<_expression, false>::ElementType* OperandData<_expression, false>::Data() const
+{
+    return ContainerTraits<ContainerType>::GetData(mContainer);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+inline OperandType<_type> AsOperand(const _type& operand)
+{
+    if constexpr (IsExpression<_type>)
+        return operand;
+    else
+        return Leaf<_type>(operand);
+}
+
+
+
+template <typename _expression>
+inline void Assign(const _expression& expression, typename _expression::ElementType* destination)
+{
+    using ContainerType = typename _expression::ContainerType;
+
+    if (expression.IsAliasSafe(destination))
+        expression.AssignTo(destination);
+    else
+    {
+        const ContainerType result(expression);
+        Leaf<ContainerType>(result).AssignTo(destination);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _lhs, typename _rhs, typename>
+inline Addition<OperandType<_lhs>, OperandType<_rhs>, false> operator+(const _lhs& lhs, const _rhs& rhs)
+{
+    return Addition<OperandType<_lhs>, OperandType<_rhs>, false>(AsOperand(lhs), AsOperand(rhs));
+}
+
+
+
+template <typename _lhs, typename _rhs, typename>
+inline Addition<OperandType<_lhs>, OperandType<_rhs>, true> operator-(const _lhs& lhs, const _rhs& rhs)
+{
+    return Addition<OperandType<_lhs>, OperandType<_rhs>, true>(AsOperand(lhs), AsOperand(rhs));
+}
+
+
+
+template <typename _lhs, typename _rhs, typename>
+inline Product<OperandType<_lhs>, OperandType<_rhs>> operator*(const _lhs& lhs, const _rhs& rhs)
+{
+    return Product<OperandType<_lhs>, OperandType<_rhs>>(AsOperand(lhs), AsOperand(rhs));
+}
+
+
+
+template <typename _expression, typename _scalar, typename>
+inline auto operator*(const _expression& expression, _scalar factor)
+{
+    using ValueType = typename _expression::ValueType;
+
+    // Scaled products are handled by the product itself, so that they are still mapped onto FMA operations
+    if constexpr (IsProduct<_expression>)
+        return expression.Scale(static_cast<ValueType>(factor));
+    else
+        return Scaling<_expression>(expression, static_cast<ValueType>(factor));
+}
+
+
+
+template <typename _scalar, typename _expression, typename>
+inline auto operator*(_scalar factor, const _expression& expression)
+{
+    return expression * factor;
+}
+
+
+
+} // namespace Expression
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _container>
+inline Expression::Leaf<_container> Lazy(const _container& container)
+{
+    static_assert(Expression::IsContainer<_container>, "Only matrices and vectors with static size can be used in expressions.");
+
+    return Expression::Leaf<_container>(container);
+}
+
+
+
+} // namespace GDL
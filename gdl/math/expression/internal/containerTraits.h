@@ -0,0 +1,221 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+
+namespace GDL
+{
+
+template <typename _type, U32, U32>
+class MatSerial;
+template <typename _type, U32, U32>
+class MatSIMD;
+template <typename _type, U32, bool>
+class VecSerial;
+template <typename _type, U32, bool>
+class VecSIMD;
+
+namespace Expression
+{
+
+
+
+//! @brief Provides the memory layout information of a container that is needed to evaluate expressions. The data of
+//! all supported containers is stored in column major order as a contiguous array of elements. An element is either a
+//! register or a single value. Each column might be padded to a multiple of the register size.
+//! @tparam _container: Container type
+template <typename _container>
+struct ContainerTraits
+{
+    static constexpr bool isContainer = false;
+};
+
+
+
+//! @brief Container traits of MatSIMD
+//! @tparam _type: Data type
+//! @tparam _rows: Number of rows
+//! @tparam _cols: Number of columns
+template <typename _type, U32 _rows, U32 _cols>
+struct ContainerTraits<MatSIMD<_type, _rows, _cols>>
+{
+    using ContainerType = MatSIMD<_type, _rows, _cols>;
+    using ElementType = typename ContainerType::RegisterType;
+    using ValueType = _type;
+
+    template <U32 _rowsResult>
+    using ProductType = MatSIMD<_type, _rowsResult, _cols>;
+
+    static constexpr bool isContainer = true;
+    static constexpr bool isMatrix = true;
+    static constexpr U32 rows = _rows;
+    static constexpr U32 cols = _cols;
+    static constexpr U32 numElementsPerCol = ContainerType::mNumRegistersPerCol;
+    static constexpr U32 numValuesPerCol = numElementsPerCol * ContainerType::mNumRegisterEntries;
+    static constexpr U32 numElements = numElementsPerCol * _cols;
+
+    //! @brief Gets a pointer to the first element of the container
+    //! @param container: Container
+    //! @return Pointer to the first element
+    [[nodiscard]] static inline const ElementType* GetData(const ContainerType& container)
+    {
+        return container.DataSSE().data();
+    }
+};
+
+
+
+//! @brief Container traits of VecSIMD column vectors
+//! @tparam _type: Data type
+//! @tparam _size: Number of rows
+template <typename _type, U32 _size>
+struct ContainerTraits<VecSIMD<_type, _size, true>>
+{
+    using ContainerType = VecSIMD<_type, _size, true>;
+    using ElementType = typename ContainerType::RegisterType;
+    using ValueType = _type;
+
+    template <U32 _rowsResult>
+    using ProductType = VecSIMD<_type, _rowsResult, true>;
+
+    static constexpr bool isContainer = true;
+    static constexpr bool isMatrix = false;
+    static constexpr U32 rows = _size;
+    static constexpr U32 cols = 1;
+    static constexpr U32 numElementsPerCol = ContainerType::mNumRegisters;
+    static constexpr U32 numValuesPerCol = numElementsPerCol * ContainerType::mNumRegisterEntries;
+    static constexpr U32 numElements = numElementsPerCol;
+
+    //! @brief Gets a pointer to the first element of the container
+    //! @param container: Container
+    //! @return Pointer to the first element
+    [[nodiscard]] static inline const ElementType* GetData(const ContainerType& container)
+    {
+        return container.DataSSE().data();
+    }
+};
+
+
+
+//! @brief Container traits of VecSIMD row vectors. Row vectors only support element-wise operations.
+//! @tparam _type: Data type
+//! @tparam _size: Number of columns
+template <typename _type, U32 _size>
+struct ContainerTraits<VecSIMD<_type, _size, false>>
+{
+    using ContainerType = VecSIMD<_type, _size, false>;
+    using ElementType = typename ContainerType::RegisterType;
+    using ValueType = _type;
+
+    static constexpr bool isContainer = true;
+    static constexpr bool isMatrix = false;
+    static constexpr U32 rows = 1;
+    static constexpr U32 cols = _size;
+    static constexpr U32 numElements = ContainerType::mNumRegisters;
+
+    //! @brief Gets a pointer to the first element of the container
+    //! @param container: Container
+    //! @return Pointer to the first element
+    [[nodiscard]] static inline const ElementType* GetData(const ContainerType& container)
+    {
+        return container.DataSSE().data();
+    }
+};
+
+
+
+//! @brief Container traits of MatSerial
+//! @tparam _type: Data type
+//! @tparam _rows: Number of rows
+//! @tparam _cols: Number of columns
+template <typename _type, U32 _rows, U32 _cols>
+struct ContainerTraits<MatSerial<_type, _rows, _cols>>
+{
+    using ContainerType = MatSerial<_type, _rows, _cols>;
+    using ElementType = _type;
+    using ValueType = _type;
+
+    template <U32 _rowsResult>
+    using ProductType = MatSerial<_type, _rowsResult, _cols>;
+
+    static constexpr bool isContainer = true;
+    static constexpr bool isMatrix = true;
+    static constexpr U32 rows = _rows;
+    static constexpr U32 cols = _cols;
+    static constexpr U32 numElementsPerCol = _rows;
+    static constexpr U32 numValuesPerCol = _rows;
+    static constexpr U32 numElements = _rows * _cols;
+
+    //! @brief Gets a pointer to the first element of the container
+    //! @param container: Container
+    //! @return Pointer to the first element
+    //! @remark MatSerial::Data() returns a copy. Therefore, the internal array is accessed directly.
+    [[nodiscard]] static inline const ElementType* GetData(const ContainerType& container)
+    {
+        return container.mData.data();
+    }
+};
+
+
+
+//! @brief Container traits of VecSerial column vectors
+//! @tparam _type: Data type
+//! @tparam _size: Number of rows
+template <typename _type, U32 _size>
+struct ContainerTraits<VecSerial<_type, _size, true>>
+{
+    using ContainerType = VecSerial<_type, _size, true>;
+    using ElementType = _type;
+    using ValueType = _type;
+
+    template <U32 _rowsResult>
+    using ProductType = VecSerial<_type, _rowsResult, true>;
+
+    static constexpr bool isContainer = true;
+    static constexpr bool isMatrix = false;
+    static constexpr U32 rows = _size;
+    static constexpr U32 cols = 1;
+    static constexpr U32 numElementsPerCol = _size;
+    static constexpr U32 numValuesPerCol = _size;
+    static constexpr U32 numElements = _size;
+
+    //! @brief Gets a pointer to the first element of the container
+    //! @param container: Container
+    //! @return Pointer to the first element
+    [[nodiscard]] static inline const ElementType* GetData(const ContainerType& container)
+    {
+        return container.Data().data();
+    }
+};
+
+
+
+//! @brief Container traits of VecSerial row vectors. Row vectors only support element-wise operations.
+//! @tparam _type: Data type
+//! @tparam _size: Number of columns
+template <typename _type, U32 _size>
+struct ContainerTraits<VecSerial<_type, _size, false>>
+{
+    using ContainerType = VecSerial<_type, _size, false>;
+    using ElementType = _type;
+    using ValueType = _type;
+
+    static constexpr bool isContainer = true;
+    static constexpr bool isMatrix = false;
+    static constexpr U32 rows = 1;
+    static constexpr U32 cols = _size;
+    static constexpr U32 numElements = _size;
+
+    //! @brief Gets a pointer to the first element of the container
+    //! @param container: Container
+    //! @return Pointer to the first element
+    [[nodiscard]] static inline const ElementType* GetData(const ContainerType& container)
+    {
+        return container.Data().data();
+    }
+};
+
+
+
+} // namespace Expression
+} // namespace GDL
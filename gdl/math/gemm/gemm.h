@@ -0,0 +1,56 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+
+namespace GDL
+{
+
+
+//! @brief Calculates C += A * B for column major matrices using a cache blocked and register tiled kernel. The largest
+//! available register type is used.
+//! @tparam _type: Data type of the matrices
+//! @param m: Number of rows of A and C
+//! @param n: Number of columns of B and C
+//! @param k: Number of columns of A and rows of B
+//! @param A: Pointer to the first value of A
+//! @param lda: Distance between two columns of A
+//! @param B: Pointer to the first value of B
+//! @param ldb: Distance between two columns of B
+//! @param C: Pointer to the first value of C
+//! @param ldc: Distance between two columns of C
+//! @remark C must not overlap with A or B
+template <typename _type>
+inline void GEMM(U32 m, U32 n, U32 k, const _type* A, U32 lda, const _type* B, U32 ldb, _type* C, U32 ldc);
+
+//! @brief Calculates C += A * B for column major matrices without cache blocking and packing. This is faster than
+//! GEMM for small matrices that fit into the L1 cache. The largest available register type is used.
+//! @tparam _type: Data type of the matrices
+//! @param m: Number of rows of A and C. Must be a multiple of the number of register values.
+//! @param n: Number of columns of B and C
+//! @param k: Number of columns of A and rows of B
+//! @param A: Pointer to the first value of A. Must be aligned to the register size.
+//! @param lda: Distance between two columns of A. Must be a multiple of the number of register values.
+//! @param B: Pointer to the first value of B
+//! @param ldb: Distance between two columns of B
+//! @param C: Pointer to the first value of C. Must be aligned to the register size.
+//! @param ldc: Distance between two columns of C. Must be a multiple of the number of register values.
+//! @remark C must not overlap with A or B
+template <typename _type>
+inline void GEMMUnblocked(U32 m, U32 n, U32 k, const _type* A, U32 lda, const _type* B, U32 ldb, _type* C, U32 ldc);
+
+//! @brief Returns if a multiplication of the passed size is large enough to be faster with GEMM than with a simple
+//! unblocked multiplication. Packing the matrices only pays off if they don't fit into the L1 cache anymore.
+//! @tparam _type: Data type of the matrices
+//! @param m: Number of rows of A and C
+//! @param n: Number of columns of B and C
+//! @param k: Number of columns of A and rows of B
+//! @return TRUE / FALSE
+template <typename _type>
+[[nodiscard]] constexpr bool IsGEMMBeneficial(U32 m, U32 n, U32 k);
+
+
+} // namespace GDL
+
+
+#include "gdl/math/gemm/gemm.inl"
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "gdl/math/gemm/gemm.h"
+
+#include "gdl/base/simd/utility.h"
+#include "gdl/math/gemm/internal/gemmKernel.h"
+
+#include <type_traits>
+
+
+namespace GDL
+{
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+inline void GEMM(U32 m, U32 n, U32 k, const _type* A, U32 lda, const _type* B, U32 ldb, _type* C, U32 ldc)
+{
+    static_assert(std::is_floating_point<_type>::value, "GEMM can only be used with floating point types");
+
+    using RegisterType = decltype(simd::GetFittingRegister<_type, simd::MaxRegisterSize()>());
+    GEMMKernel<RegisterType>::Multiply(m, n, k, A, lda, B, ldb, C, ldc);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+inline void GEMMUnblocked(U32 m, U32 n, U32 k, const _type* A, U32 lda, const _type* B, U32 ldb, _type* C, U32 ldc)
+{
+    static_assert(std::is_floating_point<_type>::value, "GEMM can only be used with floating point types");
+
+    using RegisterType = decltype(simd::GetFittingRegister<_type, simd::MaxRegisterSize()>());
+    GEMMKernel<RegisterType>::MultiplyUnblocked(m, n, k, A, lda, B, ldb, C, ldc);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+constexpr bool IsGEMMBeneficial(U32 m, U32 n, U32 k)
+{
+    // Measured crossover point with AVX2 and AVX-512 registers. Smaller matrices fit into the L1 cache and the packing
+    // overhead outweighs the faster micro-kernel.
+    constexpr U64 minNumOperations = 96 * 96 * 96;
+
+    return std::is_floating_point<_type>::value && static_cast<U64>(m) * n * k >= minNumOperations;
+}
+
+
+
+} // namespace GDL
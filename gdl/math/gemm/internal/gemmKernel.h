@@ -0,0 +1,151 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/utility.h"
+
+#include <memory>
+
+
+namespace GDL
+{
+
+
+//! @brief Cache blocked general matrix-matrix multiplication C += A * B for column major matrices. The matrices are
+//! split into blocks that fit into the L1 and L2 caches. Each block of A and each panel of B is copied (packed) into a
+//! contiguous buffer in the order in which the micro-kernel reads it. The micro-kernel keeps a MR x NR tile of C in
+//! registers and updates it with one fused multiply-add per register and column of the tile.
+//! @tparam _registerType: Register type
+template <typename _registerType>
+class GEMMKernel
+{
+    using ValueType = decltype(simd::GetDataType<_registerType>());
+
+    static constexpr U32 alignment = simd::alignmentBytes<_registerType>;
+    static constexpr U32 numRegisterValues = simd::numRegisterValues<_registerType>;
+
+#ifdef __AVX512F__
+    static constexpr U32 numArchitectureRegisters = 32;
+#else
+    static constexpr U32 numArchitectureRegisters = 16;
+#endif // __AVX512F__
+
+    static constexpr U32 l1CacheBytes = 32 * 1024;
+    static constexpr U32 l2CacheBytes = 256 * 1024;
+
+public:
+    //! @brief Number of registers that hold a single column of a micro tile
+    static constexpr U32 numRegistersMR = 2;
+
+    //! @brief Number of rows of a micro tile
+    static constexpr U32 MR = numRegistersMR * numRegisterValues;
+
+    //! @brief Number of columns of a micro tile. The tile, the registers of the current column of A and a broadcasted
+    //! value of B must fit into the architectures registers.
+    static constexpr U32 NR = (numArchitectureRegisters == 32) ? 12 : 6;
+
+    static_assert((NR + 1) * numRegistersMR + 1 <= numArchitectureRegisters, "Micro tile doesn't fit into registers.");
+
+    //! @brief Depth of the packed blocks. A packed micro panel of A uses half of the L1 cache.
+    static constexpr U32 KC = l1CacheBytes / 2 / (MR * static_cast<U32>(sizeof(ValueType)));
+
+    //! @brief Number of rows of a packed block of A, which uses half of the L2 cache
+    static constexpr U32 MC = l2CacheBytes / 2 / (KC * static_cast<U32>(sizeof(ValueType))) / MR * MR;
+
+    //! @brief Number of columns of a packed panel of B
+    static constexpr U32 NC = 4096 / NR * NR;
+
+private:
+    //! @brief Register aligned buffer for the packed matrices. Each thread keeps its own buffers, which are reused by all
+    //! of its multiplications and only grow if a larger block needs to be packed.
+    class PackingBuffer
+    {
+        std::unique_ptr<_registerType[]> mRegisters = nullptr;
+        U32 mNumRegisters = 0;
+
+    public:
+        //! @brief Ensures that the buffer can store the passed number of values. The previous content is not preserved
+        //! if the buffer grows.
+        //! @param numValues: Number of values
+        //! @return Pointer to the first value of the buffer
+        [[nodiscard]] inline ValueType* Reserve(U32 numValues);
+    };
+
+    GEMMKernel() = delete;
+
+public:
+    //! @brief Calculates C += A * B
+    //! @param m: Number of rows of A and C
+    //! @param n: Number of columns of B and C
+    //! @param k: Number of columns of A and rows of B
+    //! @param A: Pointer to the first value of A
+    //! @param lda: Distance between two columns of A
+    //! @param B: Pointer to the first value of B
+    //! @param ldb: Distance between two columns of B
+    //! @param C: Pointer to the first value of C
+    //! @param ldc: Distance between two columns of C
+    static void Multiply(U32 m, U32 n, U32 k, const ValueType* A, U32 lda, const ValueType* B, U32 ldb, ValueType* C,
+                         U32 ldc);
+
+    //! @brief Calculates C += A * B without packing the matrices. Blocks of result registers are accumulated while
+    //! looping over the columns of A.
+    //! @param m: Number of rows of A and C. Must be a multiple of the number of register values.
+    //! @param n: Number of columns of B and C
+    //! @param k: Number of columns of A and rows of B
+    //! @param A: Pointer to the first value of A. Must be aligned to the register size.
+    //! @param lda: Distance between two columns of A. Must be a multiple of the number of register values.
+    //! @param B: Pointer to the first value of B
+    //! @param ldb: Distance between two columns of B
+    //! @param C: Pointer to the first value of C. Must be aligned to the register size.
+    //! @param ldc: Distance between two columns of C. Must be a multiple of the number of register values.
+    static inline void MultiplyUnblocked(U32 m, U32 n, U32 k, const ValueType* A, U32 lda, const ValueType* B, U32 ldb,
+                                         ValueType* C, U32 ldc);
+
+private:
+    //! @brief Calculates the product of a packed block of A and a packed panel of B and adds it to C
+    //! @param mc: Number of rows of the block of A
+    //! @param nc: Number of columns of the panel of B
+    //! @param kc: Number of columns of the block of A and rows of the panel of B
+    //! @param packedA: Packed block of A
+    //! @param packedB: Packed panel of B
+    //! @param C: Pointer to the first value of the updated block of C
+    //! @param ldc: Distance between two columns of C
+    static inline void MacroKernel(U32 mc, U32 nc, U32 kc, const ValueType* packedA, const ValueType* packedB,
+                                   ValueType* C, U32 ldc);
+
+    //! @brief Calculates the product of a packed micro panel of A and a packed micro panel of B and adds it to C
+    //! @param kc: Number of columns of the micro panel of A and rows of the micro panel of B
+    //! @param packedA: Packed micro panel of A with MR rows
+    //! @param packedB: Packed micro panel of B with NR columns
+    //! @param C: Pointer to the first value of the updated tile of C
+    //! @param ldc: Distance between two columns of C
+    //! @param mr: Number of rows of the tile that are inside of C
+    //! @param nr: Number of columns of the tile that are inside of C
+    //! @remark The function is never inlined. If the matrix sizes are compile-time constants, GCC otherwise unrolls and
+    //! specializes the surrounding loops into code that runs up to twice as slow.
+    [[gnu::noinline]] static void MicroKernel(U32 kc, const ValueType* packedA, const ValueType* packedB,
+                                              ValueType* C, U32 ldc, U32 mr, U32 nr);
+
+    //! @brief Copies a block of A into a buffer that stores consecutive micro panels of MR rows. Inside of a micro
+    //! panel, the values are stored column by column. Rows beyond the end of the block are set to zero.
+    //! @param mc: Number of rows of the block
+    //! @param kc: Number of columns of the block
+    //! @param A: Pointer to the first value of the block
+    //! @param lda: Distance between two columns of A
+    //! @param packedA: Buffer that stores the packed block
+    static inline void PackA(U32 mc, U32 kc, const ValueType* A, U32 lda, ValueType* packedA);
+
+    //! @brief Copies a panel of B into a buffer that stores consecutive micro panels of NR columns. Inside of a micro
+    //! panel, the values are stored row by row. Columns beyond the end of the panel are set to zero.
+    //! @param kc: Number of rows of the panel
+    //! @param nc: Number of columns of the panel
+    //! @param B: Pointer to the first value of the panel
+    //! @param ldb: Distance between two columns of B
+    //! @param packedB: Buffer that stores the packed panel
+    static inline void PackB(U32 kc, U32 nc, const ValueType* B, U32 ldb, ValueType* packedB);
+};
+
+
+} // namespace GDL
+
+
+#include "gdl/math/gemm/internal/gemmKernel.inl"
@@ -0,0 +1,240 @@
+#pragma once
+
+#include "gdl/math/gemm/internal/gemmKernel.h"
+
+#include "gdl/base/simd/intrinsics.h"
+
+#include <algorithm>
+#include <array>
+
+
+namespace GDL
+{
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+void GEMMKernel<_registerType>::Multiply(U32 m, U32 n, U32 k, const ValueType* A, U32 lda, const ValueType* B,
+                                         U32 ldb, ValueType* C, U32 ldc)
+{
+    if (m == 0 || n == 0 || k == 0)
+        return;
+
+    const U32 maxKC = std::min(KC, k);
+    const U32 maxMC = std::min(MC, (m + MR - 1) / MR * MR);
+    const U32 maxNC = std::min(NC, (n + NR - 1) / NR * NR);
+
+    thread_local PackingBuffer bufferA;
+    thread_local PackingBuffer bufferB;
+    ValueType* packedA = bufferA.Reserve(maxMC * maxKC);
+    ValueType* packedB = bufferB.Reserve(maxKC * maxNC);
+
+    for (U32 jc = 0; jc < n; jc += NC)
+    {
+        const U32 nc = std::min(NC, n - jc);
+        for (U32 pc = 0; pc < k; pc += KC)
+        {
+            const U32 kc = std::min(KC, k - pc);
+            PackB(kc, nc, B + pc + static_cast<size_t>(jc) * ldb, ldb, packedB);
+            for (U32 ic = 0; ic < m; ic += MC)
+            {
+                const U32 mc = std::min(MC, m - ic);
+                PackA(mc, kc, A + ic + static_cast<size_t>(pc) * lda, lda, packedA);
+                MacroKernel(mc, nc, kc, packedA, packedB, C + ic + static_cast<size_t>(jc) * ldc, ldc);
+            }
+        }
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+inline void GEMMKernel<_registerType>::MultiplyUnblocked(U32 m, U32 n, U32 k, const ValueType* A, U32 lda,
+                                                         const ValueType* B, U32 ldb, ValueType* C, U32 ldc)
+{
+    // Blocks of 4 result registers are accumulated in local variables. Since the register types may alias any other
+    // type, the compiler would otherwise load and store the result registers for every multiplication.
+    constexpr U32 blockSize = 4;
+
+    const U32 numRegistersM = m / numRegisterValues;
+    const U32 ldaRegisters = lda / numRegisterValues;
+    const _registerType* registersA = reinterpret_cast<const _registerType*>(A);
+
+    for (U32 i = 0; i < n; ++i)
+    {
+        const ValueType* colB = B + static_cast<size_t>(i) * ldb;
+        _registerType* colC = reinterpret_cast<_registerType*>(C + static_cast<size_t>(i) * ldc);
+
+        U32 r = 0;
+        for (; r + blockSize <= numRegistersM; r += blockSize)
+        {
+            _registerType acc0 = colC[r];
+            _registerType acc1 = colC[r + 1];
+            _registerType acc2 = colC[r + 2];
+            _registerType acc3 = colC[r + 3];
+            for (U32 j = 0; j < k; ++j)
+            {
+                const _registerType valueB = _mm_set1<_registerType>(colB[j]);
+                const _registerType* colA = registersA + static_cast<size_t>(j) * ldaRegisters + r;
+                acc0 = _mm_fmadd(colA[0], valueB, acc0);
+                acc1 = _mm_fmadd(colA[1], valueB, acc1);
+                acc2 = _mm_fmadd(colA[2], valueB, acc2);
+                acc3 = _mm_fmadd(colA[3], valueB, acc3);
+            }
+            colC[r] = acc0;
+            colC[r + 1] = acc1;
+            colC[r + 2] = acc2;
+            colC[r + 3] = acc3;
+        }
+
+        for (; r < numRegistersM; ++r)
+        {
+            _registerType acc = colC[r];
+            for (U32 j = 0; j < k; ++j)
+                acc = _mm_fmadd(registersA[static_cast<size_t>(j) * ldaRegisters + r], _mm_set1<_registerType>(colB[j]),
+                                acc);
+            colC[r] = acc;
+        }
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+inline typename GEMMKernel<_registerType>::ValueType*
+GEMMKernel<_registerType>::PackingBuffer::Reserve(U32 numValues)
+{
+    const U32 numRegisters = (numValues + numRegisterValues - 1) / numRegisterValues;
+    if (numRegisters > mNumRegisters)
+    {
+        mRegisters.reset(new _registerType[numRegisters]);
+        mNumRegisters = numRegisters;
+    }
+    return reinterpret_cast<ValueType*>(mRegisters.get());
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+inline void GEMMKernel<_registerType>::MacroKernel(U32 mc, U32 nc, U32 kc, const ValueType* packedA,
+                                                   const ValueType* packedB, ValueType* C, U32 ldc)
+{
+    for (U32 jr = 0; jr < nc; jr += NR)
+    {
+        const U32 nr = std::min(NR, nc - jr);
+        for (U32 ir = 0; ir < mc; ir += MR)
+        {
+            const U32 mr = std::min(MR, mc - ir);
+            MicroKernel(kc, packedA + static_cast<size_t>(ir) * kc, packedB + static_cast<size_t>(jr) * kc,
+                        C + ir + static_cast<size_t>(jr) * ldc, ldc, mr, nr);
+        }
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+void GEMMKernel<_registerType>::MicroKernel(U32 kc, const ValueType* packedA, const ValueType* packedB, ValueType* C,
+                                            U32 ldc, U32 mr, U32 nr)
+{
+    std::array<_registerType, numRegistersMR * NR> tile;
+    for (U32 i = 0; i < tile.size(); ++i)
+        tile[i] = _mm_setzero<_registerType>();
+
+    for (U32 p = 0; p < kc; ++p)
+    {
+        std::array<_registerType, numRegistersMR> colA;
+        for (U32 i = 0; i < numRegistersMR; ++i)
+            colA[i] = _mmx_load_p<_registerType>(packedA + i * numRegisterValues);
+
+        for (U32 j = 0; j < NR; ++j)
+        {
+            const _registerType valueB = _mm_set1<_registerType>(packedB[j]);
+            for (U32 i = 0; i < numRegistersMR; ++i)
+                tile[j * numRegistersMR + i] = _mm_fmadd(colA[i], valueB, tile[j * numRegistersMR + i]);
+        }
+
+        packedA += MR;
+        packedB += NR;
+    }
+
+
+    if (mr == MR && nr == NR)
+    {
+        for (U32 j = 0; j < NR; ++j)
+            for (U32 i = 0; i < numRegistersMR; ++i)
+            {
+                ValueType* colC = C + static_cast<size_t>(j) * ldc + i * numRegisterValues;
+                _mm_storeu(colC, _mm_add(_mmx_loadu_p<_registerType>(colC), tile[j * numRegistersMR + i]));
+            }
+    }
+    else
+    {
+        alignas(alignment) std::array<ValueType, MR * NR> tileValues;
+        for (U32 i = 0; i < tile.size(); ++i)
+            _mm_store(tileValues.data() + i * numRegisterValues, tile[i]);
+
+        for (U32 j = 0; j < nr; ++j)
+            for (U32 i = 0; i < mr; ++i)
+                C[i + static_cast<size_t>(j) * ldc] += tileValues[i + j * MR];
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+inline void GEMMKernel<_registerType>::PackA(U32 mc, U32 kc, const ValueType* A, U32 lda, ValueType* packedA)
+{
+    for (U32 ir = 0; ir < mc; ir += MR)
+    {
+        const U32 mr = std::min(MR, mc - ir);
+        for (U32 p = 0; p < kc; ++p)
+        {
+            const ValueType* colA = A + ir + static_cast<size_t>(p) * lda;
+            for (U32 i = 0; i < mr; ++i)
+                packedA[i] = colA[i];
+            for (U32 i = mr; i < MR; ++i)
+                packedA[i] = 0;
+            packedA += MR;
+        }
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+inline void GEMMKernel<_registerType>::PackB(U32 kc, U32 nc, const ValueType* B, U32 ldb, ValueType* packedB)
+{
+    for (U32 jr = 0; jr < nc; jr += NR)
+    {
+        const U32 nr = std::min(NR, nc - jr);
+        for (U32 j = 0; j < nr; ++j)
+        {
+            const ValueType* colB = B + static_cast<size_t>(jr + j) * ldb;
+            for (U32 p = 0; p < kc; ++p)
+                packedB[p * NR + j] = colB[p];
+        }
+        for (U32 j = nr; j < NR; ++j)
+            for (U32 p = 0; p < kc; ++p)
+                packedB[p * NR + j] = 0;
+        packedB += static_cast<size_t>(kc) * NR;
+    }
+}
+
+
+
+} // namespace GDL
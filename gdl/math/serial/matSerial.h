@@ -1,6 +1,7 @@
 #pragma once
 
 #include "gdl/base/fundamentalTypes.h"
+#include "gdl/math/expression/expression.h"
 
 #include <array>
 
@@ -18,6 +19,9 @@ class MatSerial
     template <typename _type2, U32 _rows2, U32 _cols2>
     friend class MatSerial;
 
+    template <typename _container>
+    friend struct Expression::ContainerTraits;
+
     std::array<_type, _rows * _cols> mData;
 
 public:
@@ -34,6 +38,12 @@ public:
     //! @param data: Array with values (column major)
     explicit MatSerial(const std::array<_type, _rows * _cols>& data);
 
+    //! @brief Constructor that evaluates an expression
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    MatSerial(const _expression& expression);
+
     //! @brief Direct access operator
     //! @param row: Row of the accessed value
     //! @param col: Column of the accessed value
@@ -54,6 +64,13 @@ public:
     //! in the future. A global minimal base for linear algebra comparison might be introduced.
     [[nodiscard]] inline bool operator!=(const MatSerial& rhs) const;
 
+    //! @brief Evaluates an expression and assigns the result
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    //! @return Reference to this object
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    inline MatSerial& operator=(const _expression& expression);
+
     //! @brief Matrix - matrix addition assignment
     //! @param rhs: Rhs matrix
     //! @return Result of the addition
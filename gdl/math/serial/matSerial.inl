@@ -2,6 +2,9 @@
 
 #include "gdl/math/serial/matSerial.h"
 
+#include "gdl/base/approx.h"
+#include "gdl/math/gemm/gemm.h"
+
 #include <algorithm>
 #include <cassert>
 #include <cstring>
@@ -40,6 +43,15 @@ MatSerial<_type, _rows, _cols>::MatSerial(const std::array<_type, _rows * _cols>
 
 
 
+template <typename _type, U32 _rows, U32 _cols>
+template <typename _expression, typename>
+MatSerial<_type, _rows, _cols>::MatSerial(const _expression& expression)
+{
+    *this = expression;
+}
+
+
+
 template <typename _type, U32 _rows, U32 _cols>
 _type MatSerial<_type, _rows, _cols>::operator()(const U32 row, const U32 col) const
 {
@@ -67,6 +79,19 @@ bool MatSerial<_type, _rows, _cols>::operator!=(const MatSerial& rhs) const
 
 
 
+template <typename _type, U32 _rows, U32 _cols>
+template <typename _expression, typename>
+inline MatSerial<_type, _rows, _cols>& MatSerial<_type, _rows, _cols>::operator=(const _expression& expression)
+{
+    static_assert(std::is_same<typename _expression::ContainerType, MatSerial>::value,
+                  "Expression result type doesn't match the assigned type.");
+
+    Expression::Assign(expression, mData.data());
+    return *this;
+}
+
+
+
 template <typename _type, U32 _rows, U32 _cols>
 MatSerial<_type, _rows, _cols>& MatSerial<_type, _rows, _cols>::operator+=(const MatSerial<_type, _rows, _cols>& rhs)
 {
@@ -109,13 +134,18 @@ operator*(const MatSerial<_type, _rowsRhs, _colsRhs>& rhs) const
 
     MatSerial<_type, _rows, _colsRhs> result;
     result.SetZero();
-    // loop over RHS cols
-    for (U32 i = 0; i < _colsRhs; ++i)
-        // loop over RHS row
-        for (U32 j = 0; j < _rowsRhs; ++j)
-            // loop over LHS rows
-            for (U32 k = 0; k < _rows; ++k)
-                result.mData[k + i * _rows] += mData[k + j * _rows] * rhs.mData[j + i * _rowsRhs];
+
+    if constexpr (IsGEMMBeneficial<_type>(_rows, _colsRhs, _cols))
+        GEMM<_type>(_rows, _colsRhs, _cols, mData.data(), _rows, rhs.mData.data(), _rowsRhs, result.mData.data(),
+                    _rows);
+    else
+        // loop over RHS cols
+        for (U32 i = 0; i < _colsRhs; ++i)
+            // loop over RHS row
+            for (U32 j = 0; j < _rowsRhs; ++j)
+                // loop over LHS rows
+                for (U32 k = 0; k < _rows; ++k)
+                    result.mData[k + i * _rows] += mData[k + j * _rows] * rhs.mData[j + i * _rowsRhs];
     return result;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "gdl/base/fundamentalTypes.h"
+#include "gdl/math/expression/expression.h"
 
 #include <array>
 
@@ -37,6 +38,19 @@ public:
     //! @param data: Array with values
     explicit VecSerial(const std::array<_type, _size>& data);
 
+    //! @brief Constructor that evaluates an expression
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    VecSerial(const _expression& expression);
+
+    //! @brief Evaluates an expression and assigns the result
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    //! @return Reference to this object
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    inline VecSerial& operator=(const _expression& expression);
+
     //! @brief Direct access operator
     //! @param index: Index of the accessed value
     //! @return Accessed value
@@ -44,6 +44,28 @@ template <typename _type, U32 _size, bool _isCol>
 
 
 
+template <typename _type, U32 _size, bool _isCol>
+template <typename _expression, typename>
+VecSerial<_type, _size, _isCol>::VecSerial(const _expression& expression)
+{
+    *this = expression;
+}
+
+
+
+template <typename _type, U32 _size, bool _isCol>
+template <typename _expression, typename>
+inline VecSerial<_type, _size, _isCol>& VecSerial<_type, _size, _isCol>::operator=(const _expression& expression)
+{
+    static_assert(std::is_same<typename _expression::ContainerType, VecSerial>::value,
+                  "Expression result type doesn't match the assigned type.");
+
+    Expression::Assign(expression, mData.data());
+    return *this;
+}
+
+
+
 template <typename _type, U32 _size, bool _isCol>
 const std::array<_type, _size>& VecSerial<_type, _size, _isCol>::Data() const
 {
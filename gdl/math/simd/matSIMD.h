@@ -3,6 +3,7 @@
 #include "gdl/base/fundamentalTypes.h"
 #include "gdl/base/simd/utility.h"
 #include "gdl/base/simd/intrinsics.h"
+#include "gdl/math/expression/expression.h"
 
 #include <array>
 #include <type_traits>
@@ -12,7 +13,9 @@ namespace GDL
 {
 
 
-//! @brief Matrix of arbitrary size with SIMD support
+//! @brief Matrix of arbitrary size with SIMD support. The columns are stored in registers. If the number of rows is not
+//! a multiple of the number of register values, the unused values of the last register of each column are always zero.
+//! All arithmetic and solver kernels rely on this zero padding.
 //! @tparam _type: Data type of the matrix
 //! @tparam _rows: Number of rows
 //! @tparam _cols: Number of columns
@@ -54,6 +57,12 @@ public:
     //! @param data: Array with values (column major)
     explicit MatSIMD(const DataArray& data);
 
+    //! @brief Constructor that evaluates an expression
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    MatSIMD(const _expression& expression);
+
 private:
     //! @brief Private helper ctor to initialize a MatSIMD without initializing the memory to zero or any other value.
     //! @remark Find a better solution than using bool as parameter to distinguish from default ctor
@@ -80,6 +89,13 @@ public:
     //! in the future. A global minimal base for linear algebra comparison might be introduced.
     [[nodiscard]] inline bool operator!=(const MatSIMD& rhs) const;
 
+    //! @brief Evaluates an expression and assigns the result
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    //! @return Reference to this object
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    inline MatSIMD& operator=(const _expression& expression);
+
     //! @brief Matrix - matrix addition assignment
     //! @param rhs: Rhs matrix
     //! @return Result of the addition
@@ -139,30 +155,6 @@ private:
     template <bool _hasSparseRows, bool _hasSparseCols, U32 _count = 0, typename... _args>
     inline void TransposeSparseBlocks(MatSIMD<_type, _cols, _rows>& result, U32 indexBlock, _args&... args) const;
 
-    //! @brief Processes the inner two loops of matrix-matrix multiplication.
-    //! @tparam _rowsRhs: Rhs matrix number of rows
-    //! @tparam _colsRhs: Rhs matrix number of columns
-    //! @tparam _numMultipliedRegisters Number of registers that are multiplied and added to the result
-    //! @param result: Reference to the result matrix
-    //! @param rhs: Rhs matrix
-    //! @param j: Current outer loop value
-    template <U32 _rowsRhs, U32 _colsRhs, U32 _numMultipliedRegisters = mNumRegisterEntries>
-    inline void MultiplicationInnerLoops(MatSIMD<_type, _rows, _colsRhs>& result,
-                                         const MatSIMD<_type, _rowsRhs, _colsRhs>& rhs, U32 j) const;
-
-    //! @brief This function helps with the generalization of matrix-matrix multiplication. It calculates some in
-    //! between values that depend on the number of values in the used register and adds them to the current solution.
-    //! @tparam _numOperations: Number of recursive function calls.
-    //! @tparam _count: Internal counter to keep track of the number of recursive function calls.
-    //! @param rhsValues: Rhs register that is needed for the current multiplication step
-    //! @param currentValue: Current value in the result register
-    //! @param currentBlockIndex: Index of the currently used register of the lhs matrix.
-    //! @return Updated solution register
-    template <U32 _numOperations = mNumRegisterEntries, U32 _count = 0>
-    inline RegisterType MultiplyAddRegisters(const RegisterType rhsValues, const RegisterType currentValue,
-                                             const U32 currentBlockIndex) const;
-
-
     //! @brief Checks if the matrix was constructed as expected
     bool IsInternalDataValid() const;
 };
@@ -8,6 +8,7 @@
 #include "gdl/base/simd/directAccess.h"
 #include "gdl/base/simd/swizzle.h"
 #include "gdl/base/simd/transpose.h"
+#include "gdl/math/gemm/gemm.h"
 
 #include <algorithm>
 #include <cassert>
@@ -69,6 +70,16 @@ MatSIMD<_type, _rows, _cols>::MatSIMD(const DataArray& data)
 
 
 
+template <typename _type, U32 _rows, U32 _cols>
+template <typename _expression, typename>
+MatSIMD<_type, _rows, _cols>::MatSIMD(const _expression& expression)
+    : MatSIMD(true)
+{
+    *this = expression;
+}
+
+
+
 template <typename _type, U32 _rows, U32 _cols>
 MatSIMD<_type, _rows, _cols>::MatSIMD(bool)
 {
@@ -76,6 +87,19 @@ MatSIMD<_type, _rows, _cols>::MatSIMD(bool)
 
 
 
+template <typename _type, U32 _rows, U32 _cols>
+template <typename _expression, typename>
+inline MatSIMD<_type, _rows, _cols>& MatSIMD<_type, _rows, _cols>::operator=(const _expression& expression)
+{
+    static_assert(std::is_same<typename _expression::ContainerType, MatSIMD>::value,
+                  "Expression result type doesn't match the assigned type.");
+
+    Expression::Assign(expression, mData.data());
+    return *this;
+}
+
+
+
 template <typename _type, U32 _rows, U32 _cols>
 _type MatSIMD<_type, _rows, _cols>::operator()(const U32 row, const U32 col) const
 {
@@ -192,6 +216,43 @@ void MatSIMD<_type, _rows, _cols>::TransposeFullBlocks(MatSIMD<_type, _cols, _ro
                                    result.mData[firstRegisterIndexRes + 7 * result.mNumRegistersPerCol]);
             }
 #endif //__AVX2__
+#ifdef __AVX512F__
+            else if constexpr (mNumRegisterEntries == 16)
+            {
+                simd::Transpose16x16(mData[firstRegisterIndexSrc + 0 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 1 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 2 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 3 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 4 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 5 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 6 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 7 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 8 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 9 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 10 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 11 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 12 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 13 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 14 * mNumRegistersPerCol],
+                                     mData[firstRegisterIndexSrc + 15 * mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 0 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 1 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 2 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 3 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 4 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 5 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 6 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 7 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 8 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 9 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 10 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 11 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 12 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 13 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 14 * result.mNumRegistersPerCol],
+                                     result.mData[firstRegisterIndexRes + 15 * result.mNumRegistersPerCol]);
+            }
+#endif //__AVX512F__
             else
                 EXCEPTION(true, "Not implemented for given register size");
         }
@@ -242,9 +303,13 @@ void MatSIMD<_type, _rows, _cols>::TransposeSparseBlocks(MatSIMD<_type, _cols, _
     else if constexpr (mNumRegisterEntries == 4)
         simd::Transpose4x4(args...);
 #ifdef __AVX2__
-    else
+    else if constexpr (mNumRegisterEntries == 8)
         simd::Transpose8x8(args...);
 #endif //__AVX2__
+#ifdef __AVX512F__
+    else
+        simd::Transpose16x16(args...);
+#endif //__AVX512F__
 }
 
 
@@ -308,9 +373,7 @@ const std::array<_type, _rows * _cols> MatSIMD<_type, _rows, _cols>::Data() cons
     else
     {
         for (U32 i = 0; i < _cols; ++i)
-        {
             std::memcpy(&data[i * _rows], &mData[i * mNumRegistersPerCol], sizeof(_type) * _rows);
-        }
     }
     return data;
 }
@@ -349,64 +412,23 @@ operator*(const MatSIMD<_type, _rowsRhs, _colsRhs>& rhs) const
 
     MatSIMD<_type, _rows, _colsRhs> result;
 
+    // The zero filled padding rows are included, so that all registers and micro tiles are fully used
+    constexpr U32 ldLhs = mNumRegistersPerCol * mNumRegisterEntries;
+    constexpr U32 ldRhs = MatSIMD<_type, _rowsRhs, _colsRhs>::mNumRegistersPerCol * mNumRegisterEntries;
+    const _type* lhsValues = reinterpret_cast<const _type*>(mData.data());
+    const _type* rhsValues = reinterpret_cast<const _type*>(rhs.mData.data());
+    _type* resultValues = reinterpret_cast<_type*>(result.mData.data());
 
-    // loop over RHS rows (column registers)
-    for (U32 j = 0; j < _rowsRhs / mNumRegisterEntries; ++j)
-        MultiplicationInnerLoops<_rowsRhs, _colsRhs, mNumRegisterEntries>(result, rhs, j);
-
-    constexpr U32 remainder = _rowsRhs % mNumRegisterEntries;
-    if constexpr (remainder > 0)
-        MultiplicationInnerLoops<_rowsRhs, _colsRhs, remainder>(result, rhs, _rowsRhs / mNumRegisterEntries);
+    if constexpr (IsGEMMBeneficial<_type>(_rows, _colsRhs, _cols))
+        GEMM<_type>(ldLhs, _colsRhs, _cols, lhsValues, ldLhs, rhsValues, ldRhs, resultValues, ldLhs);
+    else
+        GEMMUnblocked<_type>(ldLhs, _colsRhs, _cols, lhsValues, ldLhs, rhsValues, ldRhs, resultValues, ldLhs);
 
     return result;
 }
 
 
 
-template <typename _type, U32 _rows, U32 _cols>
-template <U32 _rowsRhs, U32 _colsRhs, U32 _numMultipliedRegisters>
-inline void MatSIMD<_type, _rows, _cols>::MultiplicationInnerLoops(MatSIMD<_type, _rows, _colsRhs>& result,
-                                                                   const MatSIMD<_type, _rowsRhs, _colsRhs>& rhs,
-                                                                   U32 j) const
-{
-    constexpr U32 registersPerColRhs = simd::CalcMinNumArrayRegisters<RegisterType>(_rowsRhs);
-
-    for (U32 i = 0; i < _colsRhs; ++i)
-    {
-        const U32 indexRegisterRhs = i * registersPerColRhs + j;
-        // loop over LHS rows (column registers)
-        for (U32 k = 0; k < mNumRegistersPerCol; ++k)
-        {
-            const U32 indexRegisterResult = i * mNumRegistersPerCol + k;
-            const U32 indexFirstRegisterLhsBlock = j * mNumRegisterEntries * mNumRegistersPerCol + k;
-            result.mData[indexRegisterResult] = MultiplyAddRegisters<_numMultipliedRegisters>(
-                    rhs.mData[indexRegisterRhs], result.mData[indexRegisterResult], indexFirstRegisterLhsBlock);
-        }
-    }
-}
-
-
-
-template <typename _type, U32 _rows, U32 _cols>
-template <U32 _numOperations, U32 _count>
-typename MatSIMD<_type, _rows, _cols>::RegisterType
-MatSIMD<_type, _rows, _cols>::MultiplyAddRegisters(const RegisterType rhsValues, const RegisterType currentValue,
-                                                   const U32 currentBlockIndex) const
-{
-    static_assert(_numOperations <= mNumRegisterEntries && _numOperations > 0, "Invalid number of operations.");
-
-
-    if constexpr (_count + 1 == _numOperations)
-        return _mm_fmadd(mData[currentBlockIndex + _count * mNumRegistersPerCol],
-                         simd::BroadcastAcrossLanes<_count>(rhsValues), currentValue);
-    else
-        return _mm_fmadd(mData[currentBlockIndex + _count * mNumRegistersPerCol],
-                         simd::BroadcastAcrossLanes<_count>(rhsValues),
-                         MultiplyAddRegisters<_numOperations, _count + 1>(rhsValues, currentValue, currentBlockIndex));
-}
-
-
-
 template <typename _type, U32 _rows, U32 _cols>
 std::ostream& operator<<(std::ostream& os, const MatSIMD<_type, _rows, _cols>& mat)
 {
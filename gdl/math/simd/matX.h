@@ -0,0 +1,160 @@
+#pragma once
+
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/intrinsics.h"
+#include "gdl/base/simd/utility.h"
+
+#include <initializer_list>
+#include <iostream>
+#include <type_traits>
+
+
+namespace GDL
+{
+
+template <typename _type, U32 _rows, U32 _cols>
+class MatSIMD;
+template <typename _type>
+class VecX;
+
+
+//! @brief Matrix with SIMD support whose size is only known at runtime. The data is stored column major in registers
+//! of the same type as used by MatSIMD. Each column is padded with zeros to a multiple of the register size.
+//! @tparam _type: Data type of the matrix
+template <typename _type>
+class MatX
+{
+    static_assert(std::is_floating_point<_type>::value, "Matrix can only be created with floating point types");
+
+public:
+    using RegisterType = decltype(simd::GetFittingRegister<_type, simd::MaxRegisterSize()>());
+    constexpr static U32 mAlignment = simd::alignmentBytes<RegisterType>;
+    constexpr static U32 mNumRegisterEntries = simd::numRegisterValues<RegisterType>;
+
+private:
+    using DataArray = Vector<RegisterType>;
+
+    U32 mRows;
+    U32 mCols;
+    U32 mNumRegistersPerCol;
+    DataArray mData;
+
+public:
+    MatX() = delete;
+    MatX(const MatX&) = default;
+    MatX(MatX&&) noexcept = default;
+    MatX& operator=(const MatX&) = default;
+    MatX& operator=(MatX&&) noexcept = default;
+    ~MatX() = default;
+
+    //! @brief Creates a matrix with all values set to zero
+    //! @param rows: Number of rows
+    //! @param cols: Number of columns
+    MatX(U32 rows, U32 cols);
+
+    //! @brief Constructor to set the whole matrix
+    //! @param rows: Number of rows
+    //! @param cols: Number of columns
+    //! @param values: Values (column major)
+    MatX(U32 rows, U32 cols, std::initializer_list<_type> values);
+
+    //! @brief Constructor to set the whole matrix
+    //! @param rows: Number of rows
+    //! @param cols: Number of columns
+    //! @param values: Pointer to rows * cols values (column major)
+    MatX(U32 rows, U32 cols, const _type* values);
+
+    //! @brief Constructor to set the whole matrix
+    //! @param rows: Number of rows
+    //! @param cols: Number of columns
+    //! @param data: Register data array with the same layout as the internal one
+    MatX(U32 rows, U32 cols, DataArray data);
+
+    //! @brief Creates a copy of a matrix with static size
+    //! @tparam _rows: Number of rows
+    //! @tparam _cols: Number of columns
+    //! @param matrix: Matrix
+    template <U32 _rows, U32 _cols>
+    explicit MatX(const MatSIMD<_type, _rows, _cols>& matrix);
+
+    //! @brief Direct access operator
+    //! @param row: Row of the accessed value
+    //! @param col: Column of the accessed value
+    //! @return Accessed value
+    [[nodiscard]] inline _type operator()(const U32 row, const U32 col) const;
+
+    //! @brief Compares if two matrices are equal
+    //! @param rhs: Matrix that should be compared
+    //! @return TRUE/FALSE
+    [[nodiscard]] bool operator==(const MatX& rhs) const;
+
+    //! @brief Compares if two matrices are NOT equal
+    //! @param rhs: Matrix that should be compared
+    //! @return TRUE/FALSE
+    [[nodiscard]] bool operator!=(const MatX& rhs) const;
+
+    //! @brief Matrix - matrix addition assignment
+    //! @param rhs: Rhs matrix
+    //! @return Result of the addition
+    MatX& operator+=(const MatX& rhs);
+
+    //! @brief Matrix - matrix addition
+    //! @param rhs: Rhs matrix
+    //! @return Result of the addition
+    [[nodiscard]] MatX operator+(const MatX& rhs) const;
+
+    //! @brief Matrix - matrix multiplication
+    //! @param rhs: Rhs matrix
+    //! @return Result of the multiplication
+    [[nodiscard]] MatX operator*(const MatX& rhs) const;
+
+    //! @brief Matrix - vector multiplication
+    //! @param rhs: Rhs vector
+    //! @return Result of the multiplication
+    [[nodiscard]] VecX<_type> operator*(const VecX<_type>& rhs) const;
+
+    //! @brief Gets the number of rows
+    //! @return Number of rows
+    [[nodiscard]] inline U32 Rows() const;
+
+    //! @brief Gets the number of columns
+    //! @return Number of columns
+    [[nodiscard]] inline U32 Cols() const;
+
+    //! @brief Gets the number of registers per column
+    //! @return Number of registers per column
+    [[nodiscard]] inline U32 NumRegistersPerCol() const;
+
+    //! @brief Sets all matrix entries to zero
+    void SetZero();
+
+    //! @brief Gets the data in column major ordering
+    //! @return Data
+    [[nodiscard]] Vector<_type> Data() const;
+
+    //! @brief Gets the underlying array of registers
+    //! @return Data array
+    [[nodiscard]] inline const DataArray& DataSSE() const;
+
+private:
+    //! @brief Checks if the matrix was constructed as expected
+    bool IsInternalDataValid() const;
+};
+
+
+
+//! @brief Offstream operator
+//! @tparam _type: Data type of the matrix
+//! @param os: Reference to offstream object
+//! @param mat: Matrix
+//! @return Reference to offstream object
+template <typename _type>
+std::ostream& operator<<(std::ostream& os, const MatX<_type>& mat);
+
+
+} // namespace GDL
+
+
+
+#include "gdl/math/simd/matX.inl"
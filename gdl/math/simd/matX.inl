@@ -0,0 +1,272 @@
+#pragma once
+
+#include "gdl/math/simd/matX.h"
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/math/gemm/gemm.h"
+#include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/vecX.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace GDL
+{
+
+
+
+template <typename _type>
+MatX<_type>::MatX(U32 rows, U32 cols)
+    : mRows{rows}
+    , mCols{cols}
+    , mNumRegistersPerCol{simd::CalcMinNumArrayRegisters<RegisterType>(rows)}
+    , mData(cols * mNumRegistersPerCol, _mm_setzero<RegisterType>())
+{
+    DEV_EXCEPTION(!IsInternalDataValid(), "Internal data is not valid. Alignment or size is not as expected.");
+}
+
+
+
+template <typename _type>
+MatX<_type>::MatX(U32 rows, U32 cols, std::initializer_list<_type> values)
+    : MatX(rows, cols)
+{
+    EXCEPTION(values.size() != static_cast<size_t>(rows) * cols, "Number of values must be equal to rows * columns");
+    for (U32 i = 0; i < mCols; ++i)
+        std::memcpy(&mData[i * mNumRegistersPerCol], values.begin() + i * mRows, sizeof(_type) * mRows);
+}
+
+
+
+template <typename _type>
+MatX<_type>::MatX(U32 rows, U32 cols, const _type* values)
+    : MatX(rows, cols)
+{
+    for (U32 i = 0; i < mCols; ++i)
+        std::memcpy(&mData[i * mNumRegistersPerCol], &values[i * mRows], sizeof(_type) * mRows);
+}
+
+
+
+template <typename _type>
+MatX<_type>::MatX(U32 rows, U32 cols, DataArray data)
+    : mRows{rows}
+    , mCols{cols}
+    , mNumRegistersPerCol{simd::CalcMinNumArrayRegisters<RegisterType>(rows)}
+    , mData{std::move(data)}
+{
+    DEV_EXCEPTION(!IsInternalDataValid(), "Internal data is not valid. Alignment or size is not as expected.");
+}
+
+
+
+template <typename _type>
+template <U32 _rows, U32 _cols>
+MatX<_type>::MatX(const MatSIMD<_type, _rows, _cols>& matrix)
+    : mRows{_rows}
+    , mCols{_cols}
+    , mNumRegistersPerCol{MatSIMD<_type, _rows, _cols>::mNumRegistersPerCol}
+    , mData(matrix.DataSSE().begin(), matrix.DataSSE().end())
+{
+    DEV_EXCEPTION(!IsInternalDataValid(), "Internal data is not valid. Alignment or size is not as expected.");
+}
+
+
+
+template <typename _type>
+_type MatX<_type>::operator()(const U32 row, const U32 col) const
+{
+    assert(row < mRows && col < mCols);
+    return simd::GetValue(mData[row / mNumRegisterEntries + col * mNumRegistersPerCol], row % mNumRegisterEntries);
+}
+
+
+
+template <typename _type>
+bool MatX<_type>::operator==(const MatX& rhs) const
+{
+    if (mRows != rhs.mRows || mCols != rhs.mCols)
+        return false;
+
+    // Only the used values of the last register of each column are compared, since the padding might differ
+    const U32 numFullRegistersPerCol = mRows / mNumRegisterEntries;
+    const U32 numNonFullRegValues = mRows % mNumRegisterEntries;
+
+    bool result = true;
+    for (U32 i = 0; i < mCols; ++i)
+    {
+        const U32 colStartIdx = i * mNumRegistersPerCol;
+        for (U32 j = 0; j < numFullRegistersPerCol; ++j)
+            result = result && mData[colStartIdx + j] == Approx(rhs.mData[colStartIdx + j]);
+
+        for (U32 j = 0; j < numNonFullRegValues; ++j)
+        {
+            const U32 index = colStartIdx + numFullRegistersPerCol;
+            result = result && simd::GetValue(mData[index], j) == Approx(simd::GetValue(rhs.mData[index], j));
+        }
+    }
+
+    return result;
+}
+
+
+
+template <typename _type>
+bool MatX<_type>::operator!=(const MatX& rhs) const
+{
+    return !operator==(rhs);
+}
+
+
+
+template <typename _type>
+MatX<_type>& MatX<_type>::operator+=(const MatX& rhs)
+{
+    DEV_EXCEPTION(mRows != rhs.mRows || mCols != rhs.mCols, "Matrix sizes don't match.");
+
+    for (U32 i = 0; i < mData.size(); ++i)
+        mData[i] = _mm_add(rhs.mData[i], mData[i]);
+    return *this;
+}
+
+
+
+template <typename _type>
+MatX<_type> MatX<_type>::operator+(const MatX& rhs) const
+{
+    DEV_EXCEPTION(mRows != rhs.mRows || mCols != rhs.mCols, "Matrix sizes don't match.");
+
+    DataArray data(mData.size());
+    for (U32 i = 0; i < mData.size(); ++i)
+        data[i] = _mm_add(rhs.mData[i], mData[i]);
+    return MatX(mRows, mCols, std::move(data));
+}
+
+
+
+template <typename _type>
+MatX<_type> MatX<_type>::operator*(const MatX& rhs) const
+{
+    DEV_EXCEPTION(mCols != rhs.mRows, "Lhs cols != Rhs rows");
+
+    MatX result(mRows, rhs.mCols);
+
+    // The zero filled padding rows are included, so that all registers and micro tiles are fully used
+    const U32 ldLhs = mNumRegistersPerCol * mNumRegisterEntries;
+    const U32 ldRhs = rhs.mNumRegistersPerCol * mNumRegisterEntries;
+    const _type* lhsValues = reinterpret_cast<const _type*>(mData.data());
+    const _type* rhsValues = reinterpret_cast<const _type*>(rhs.mData.data());
+    _type* resultValues = reinterpret_cast<_type*>(result.mData.data());
+
+    if (IsGEMMBeneficial<_type>(mRows, rhs.mCols, mCols))
+        GEMM<_type>(ldLhs, rhs.mCols, mCols, lhsValues, ldLhs, rhsValues, ldRhs, resultValues, ldLhs);
+    else
+        GEMMUnblocked<_type>(ldLhs, rhs.mCols, mCols, lhsValues, ldLhs, rhsValues, ldRhs, resultValues, ldLhs);
+
+    return result;
+}
+
+
+
+template <typename _type>
+VecX<_type> MatX<_type>::operator*(const VecX<_type>& rhs) const
+{
+    DEV_EXCEPTION(mCols != rhs.Size(), "Matrix cols != vector size");
+
+    Vector<RegisterType> data(mNumRegistersPerCol, _mm_setzero<RegisterType>());
+    const _type* rhsValues = reinterpret_cast<const _type*>(rhs.DataSSE().data());
+    RegisterType* result = data.data();
+
+    for (U32 j = 0; j < mCols; ++j)
+    {
+        const RegisterType rhsValue = _mm_set1<RegisterType>(rhsValues[j]);
+        const RegisterType* lhsCol = &mData[j * mNumRegistersPerCol];
+        for (U32 k = 0; k < mNumRegistersPerCol; ++k)
+            result[k] = _mm_fmadd(lhsCol[k], rhsValue, result[k]);
+    }
+
+    return VecX<_type>(mRows, std::move(data));
+}
+
+
+
+template <typename _type>
+U32 MatX<_type>::Rows() const
+{
+    return mRows;
+}
+
+
+
+template <typename _type>
+U32 MatX<_type>::Cols() const
+{
+    return mCols;
+}
+
+
+
+template <typename _type>
+U32 MatX<_type>::NumRegistersPerCol() const
+{
+    return mNumRegistersPerCol;
+}
+
+
+
+template <typename _type>
+void MatX<_type>::SetZero()
+{
+    std::fill(mData.begin(), mData.end(), _mm_setzero<RegisterType>());
+}
+
+
+
+template <typename _type>
+Vector<_type> MatX<_type>::Data() const
+{
+    Vector<_type> data(static_cast<size_t>(mRows) * mCols);
+    for (U32 i = 0; i < mCols; ++i)
+        std::memcpy(&data[i * mRows], &mData[i * mNumRegistersPerCol], sizeof(_type) * mRows);
+    return data;
+}
+
+
+
+template <typename _type>
+const typename MatX<_type>::DataArray& MatX<_type>::DataSSE() const
+{
+    return mData;
+}
+
+
+
+template <typename _type>
+bool MatX<_type>::IsInternalDataValid() const
+{
+    return mData.size() == static_cast<size_t>(mCols) * mNumRegistersPerCol &&
+           (mData.empty() || IsAligned(mData.data(), mAlignment));
+}
+
+
+
+template <typename _type>
+std::ostream& operator<<(std::ostream& os, const MatX<_type>& mat)
+{
+    for (U32 i = 0; i < mat.Rows(); ++i)
+    {
+        os << "| ";
+        for (U32 j = 0; j < mat.Cols(); ++j)
+            os << mat(i, j) << " ";
+        os << "|" << std::endl;
+    }
+    return os;
+}
+
+
+
+} // namespace GDL
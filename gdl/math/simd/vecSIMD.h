@@ -2,6 +2,7 @@
 
 #include "gdl/base/fundamentalTypes.h"
 #include "gdl/base/simd/utility.h"
+#include "gdl/math/expression/expression.h"
 
 #include <array>
 #include <iostream>
@@ -9,7 +10,9 @@
 namespace GDL
 {
 
-//! @brief Vector class with arbitrary number of elements
+//! @brief Vector class with arbitrary number of elements. If the size is not a multiple of the number of register
+//! values, the unused values of the last register are always zero. All arithmetic and solver kernels rely on this zero
+//! padding.
 //! @tparam _type: Data type of the vector
 //! @tparam _size: Number of rows
 //! @tparam _isCol: If true, the vector is treated as column vector, otherwise as row vector
@@ -56,6 +59,19 @@ public:
     //! @brief Array with values
     explicit VecSIMD(const DataArray& data);
 
+    //! @brief Constructor that evaluates an expression
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    VecSIMD(const _expression& expression);
+
+    //! @brief Evaluates an expression and assigns the result
+    //! @tparam _expression: Expression type
+    //! @param expression: Expression that is evaluated
+    //! @return Reference to this object
+    template <typename _expression, typename = std::enable_if_t<Expression::IsExpression<_expression>>>
+    inline VecSIMD& operator=(const _expression& expression);
+
     //! @brief Direct access operator
     //! @param index: Index of the accessed value
     //! @return Accessed value
@@ -33,6 +33,10 @@ VecSIMD<_type, _size, _isCol>::VecSIMD(const std::array<_type, _size>& data)
 {
     DEV_EXCEPTION(!IsInternalDataValid(), "Internal data is not valid. Alignment or size is not as expected.");
 
+    // Set last register to zero
+    if constexpr (_size % mNumRegisterEntries != 0)
+        std::memset(&mData[mNumRegisters - 1], 0, sizeof(RegisterType));
+
     std::memcpy(&mData, &data, sizeof(data));
 }
 
@@ -47,6 +51,28 @@ VecSIMD<_type, _size, _isCol>::VecSIMD(const DataArray& data)
 
 
 
+template <typename _type, U32 _size, bool _isCol>
+template <typename _expression, typename>
+VecSIMD<_type, _size, _isCol>::VecSIMD(const _expression& expression)
+{
+    *this = expression;
+}
+
+
+
+template <typename _type, U32 _size, bool _isCol>
+template <typename _expression, typename>
+inline VecSIMD<_type, _size, _isCol>& VecSIMD<_type, _size, _isCol>::operator=(const _expression& expression)
+{
+    static_assert(std::is_same<typename _expression::ContainerType, VecSIMD>::value,
+                  "Expression result type doesn't match the assigned type.");
+
+    Expression::Assign(expression, mData.data());
+    return *this;
+}
+
+
+
 template <typename _type, U32 _size, bool _isCol>
 inline _type VecSIMD<_type, _size, _isCol>::operator[](const U32 index) const
 {
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/intrinsics.h"
+#include "gdl/base/simd/utility.h"
+
+#include <initializer_list>
+#include <iostream>
+#include <type_traits>
+
+namespace GDL
+{
+
+template <typename _type, U32 _size, bool _isCol>
+class VecSIMD;
+
+
+//! @brief Column vector with SIMD support whose size is only known at runtime. The data is stored in registers of the
+//! same type as used by VecSIMD and padded with zeros to a multiple of the register size.
+//! @tparam _type: Data type of the vector
+template <typename _type>
+class VecX
+{
+    static_assert(std::is_floating_point<_type>::value, "Vector can only be created with floating point types");
+
+public:
+    using RegisterType = decltype(simd::GetFittingRegister<_type, simd::MaxRegisterSize()>());
+    constexpr static U32 mAlignment = simd::alignmentBytes<RegisterType>;
+    constexpr static U32 mNumRegisterEntries = simd::numRegisterValues<RegisterType>;
+
+private:
+    using DataArray = Vector<RegisterType>;
+
+    U32 mSize;
+    DataArray mData;
+
+public:
+    VecX() = delete;
+    VecX(const VecX&) = default;
+    VecX(VecX&&) noexcept = default;
+    VecX& operator=(const VecX&) = default;
+    VecX& operator=(VecX&&) noexcept = default;
+    ~VecX() = default;
+
+    //! @brief Creates a vector with all values set to zero
+    //! @param size: Number of values
+    explicit VecX(U32 size);
+
+    //! @brief Constructor to set the whole vector
+    //! @param values: Values
+    VecX(std::initializer_list<_type> values);
+
+    //! @brief Constructor to set the whole vector
+    //! @param size: Number of values
+    //! @param values: Pointer to the values
+    VecX(U32 size, const _type* values);
+
+    //! @brief Constructor to set the whole vector
+    //! @param size: Number of values
+    //! @param data: Register data array with the same layout as the internal one
+    VecX(U32 size, DataArray data);
+
+    //! @brief Creates a copy of a vector with static size
+    //! @tparam _size: Number of values
+    //! @param vector: Vector
+    template <U32 _size>
+    explicit VecX(const VecSIMD<_type, _size, true>& vector);
+
+    //! @brief Direct access operator
+    //! @param index: Index of the accessed value
+    //! @return Accessed value
+    [[nodiscard]] inline _type operator[](const U32 index) const;
+
+    //! @brief Compares if two vectors are equal
+    //! @param rhs: Vector that should be compared
+    //! @return TRUE/FALSE
+    [[nodiscard]] bool operator==(const VecX& rhs) const;
+
+    //! @brief Compares if two vectors are NOT equal
+    //! @param rhs: Vector that should be compared
+    //! @return TRUE/FALSE
+    [[nodiscard]] bool operator!=(const VecX& rhs) const;
+
+    //! @brief Gets the number of values
+    //! @return Number of values
+    [[nodiscard]] inline U32 Size() const;
+
+    //! @brief Gets the data array
+    //! @return Data
+    [[nodiscard]] Vector<_type> Data() const;
+
+    //! @brief Gets the underlying array of registers
+    //! @return Data array
+    [[nodiscard]] inline const DataArray& DataSSE() const;
+
+private:
+    //! @brief Checks if the vector was constructed as expected
+    bool IsInternalDataValid() const;
+};
+
+
+
+//! @brief Offstream operator
+//! @tparam _type: Data type of the vector
+//! @param os: Reference to offstream object
+//! @param vec: Vector
+//! @return Reference to offstream object
+template <typename _type>
+std::ostream& operator<<(std::ostream& os, const VecX<_type>& vec);
+
+
+} // namespace GDL
+
+
+#include "gdl/math/simd/vecX.inl"
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "gdl/math/simd/vecX.h"
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/math/simd/vecSIMD.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace GDL
+{
+
+
+
+template <typename _type>
+VecX<_type>::VecX(U32 size)
+    : mSize{size}
+    , mData(simd::CalcMinNumArrayRegisters<RegisterType>(size), _mm_setzero<RegisterType>())
+{
+    DEV_EXCEPTION(!IsInternalDataValid(), "Internal data is not valid. Alignment or size is not as expected.");
+}
+
+
+
+template <typename _type>
+VecX<_type>::VecX(std::initializer_list<_type> values)
+    : VecX(static_cast<U32>(values.size()), values.begin())
+{
+}
+
+
+
+template <typename _type>
+VecX<_type>::VecX(U32 size, const _type* values)
+    : VecX(size)
+{
+    if (mSize > 0)
+        std::memcpy(mData.data(), values, sizeof(_type) * mSize);
+}
+
+
+
+template <typename _type>
+VecX<_type>::VecX(U32 size, DataArray data)
+    : mSize{size}
+    , mData{std::move(data)}
+{
+    DEV_EXCEPTION(!IsInternalDataValid(), "Internal data is not valid. Alignment or size is not as expected.");
+}
+
+
+
+template <typename _type>
+template <U32 _size>
+VecX<_type>::VecX(const VecSIMD<_type, _size, true>& vector)
+    : mSize{_size}
+    , mData(vector.DataSSE().begin(), vector.DataSSE().end())
+{
+    DEV_EXCEPTION(!IsInternalDataValid(), "Internal data is not valid. Alignment or size is not as expected.");
+}
+
+
+
+template <typename _type>
+_type VecX<_type>::operator[](const U32 index) const
+{
+    assert(index < mSize);
+    return simd::GetValue(mData[index / mNumRegisterEntries], index % mNumRegisterEntries);
+}
+
+
+
+template <typename _type>
+bool VecX<_type>::operator==(const VecX& rhs) const
+{
+    if (mSize != rhs.mSize)
+        return false;
+
+    const U32 numFullRegisters = mSize / mNumRegisterEntries;
+
+    bool result = true;
+    for (U32 i = 0; i < numFullRegisters; ++i)
+        result = result && mData[i] == Approx(rhs.mData[i]);
+    for (U32 i = numFullRegisters * mNumRegisterEntries; i < mSize; ++i)
+        result = result && operator[](i) == Approx(rhs[i]);
+
+    return result;
+}
+
+
+
+template <typename _type>
+bool VecX<_type>::operator!=(const VecX& rhs) const
+{
+    return !operator==(rhs);
+}
+
+
+
+template <typename _type>
+U32 VecX<_type>::Size() const
+{
+    return mSize;
+}
+
+
+
+template <typename _type>
+Vector<_type> VecX<_type>::Data() const
+{
+    Vector<_type> data(mSize);
+    if (mSize > 0)
+        std::memcpy(data.data(), mData.data(), sizeof(_type) * mSize);
+    return data;
+}
+
+
+
+template <typename _type>
+const typename VecX<_type>::DataArray& VecX<_type>::DataSSE() const
+{
+    return mData;
+}
+
+
+
+template <typename _type>
+bool VecX<_type>::IsInternalDataValid() const
+{
+    return mData.size() == simd::CalcMinNumArrayRegisters<RegisterType>(mSize) &&
+           (mData.empty() || IsAligned(mData.data(), mAlignment));
+}
+
+
+
+template <typename _type>
+std::ostream& operator<<(std::ostream& os, const VecX<_type>& vec)
+{
+    os << "| ";
+    for (U32 i = 0; i < vec.Size(); ++i)
+        os << vec[i] << " ";
+    os << "|" << std::endl;
+    return os;
+}
+
+
+
+} // namespace GDL
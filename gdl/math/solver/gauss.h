@@ -18,6 +18,10 @@ template <typename _type, U32, bool>
 class VecSerial;
 template <typename _type, U32, bool>
 class VecSIMD;
+template <typename _type>
+class MatX;
+template <typename _type>
+class VecX;
 
 namespace Solver
 {
@@ -46,6 +50,16 @@ template <Pivot _pivot = Pivot::PARTIAL, typename _type, U32 _size>
 [[nodiscard]] VecSIMD<_type, _size, true> Gauss(const MatSIMD<_type, _size, _size>& A,
                                                 const VecSIMD<_type, _size, true>& b);
 
+//! @brief Solves the linear system A * x = b by using a vectorized Gauss-Jordan algorithm. The size of the system is
+//! only known at runtime.
+//! @tparam _type: Data type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @param A: Matrix
+//! @param b: Vector
+//! @return Result vector x
+template <Pivot _pivot = Pivot::PARTIAL, typename _type>
+[[nodiscard]] VecX<_type> Gauss(const MatX<_type>& A, const VecX<_type>& b);
+
 
 
 // Support classes ----------------------------------------------------------------------------------------------------
@@ -85,7 +99,8 @@ private:
 
 
 
-//! @brief SSE based Gauss-Jordan solver class for dense static systems
+//! @brief SSE based Gauss-Jordan solver class for dense static systems. The register level steps are shared with the
+//! solver for systems whose size is only known at runtime (see GaussDenseSIMDX).
 //! @tparam _registerType: SSE register type
 //! @tparam _size: Size of the linear system
 //! @tparam _pivot: Enum to select the pivoting strategy
@@ -110,33 +125,6 @@ public:
     //! @param b: Vector
     //! @return Result vector x
     [[nodiscard]] inline static VectorType Solve(const MatrixType& A, const VectorType& b);
-
-private:
-    //! @brief Performs the elimination step of the current iteration
-    //! @tparam _regValueIdx: Each column is composed of registers that contain multiple row values of that column. This
-    //! parameter specifies the position of the value inside of the corresponding register that belongs to the current
-    //! iterations active row.
-    //! @param iteration: Number of the current iteration
-    //! @param regRowIdx: This parameter specifies the position of the register that holds the value of the current
-    //! iterations active row inside of each column of registers.
-    //! @param matData: Matrix data array (column major ordering)
-    //! @param vecData: Vector data array
-    template <U32 _regValueIdx>
-    inline static void EliminationStepRegister(U32 iteration, U32 regRowIdx, MatrixDataArray& matData,
-                                               VectorDataArray& vecData);
-
-    //! @brief This function uses template recursion to perform a gauss step (pivoting and elimination) for each value
-    //! inside of a register.
-    //! @tparam _regValueIdx: Each column is composed of registers that contain multiple row values of that column. This
-    //! parameter specifies the position of the value inside of the corresponding register that belongs to the current
-    //! iterations active row.
-    //! @tparam _maxRecursionDepth: Specifies the maximal recursion depth.
-    //! @param regRowIdx: This parameter specifies the position of the register that holds the value of the current
-    //! iterations active row inside of each column of registers.
-    //! @param matData: Matrix data array (column major ordering)
-    //! @param vecData: Vector data array
-    template <U32 _regValueIdx = 0, U32 _maxRecursionDepth = numRegisterValues>
-    inline static void GaussStepsRegister(U32 regRowIdx, MatrixDataArray& matData, VectorDataArray& vecData);
 };
 
 
@@ -2,13 +2,16 @@
 
 #include "gdl/math/solver/gauss.h"
 
+#include "gdl/base/exception.h"
 #include "gdl/base/simd/swizzle.h"
 #include "gdl/math/serial/matSerial.h"
 #include "gdl/math/serial/vecSerial.h"
 #include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/matX.h"
 #include "gdl/math/simd/vecSIMD.h"
+#include "gdl/math/simd/vecX.h"
+#include "gdl/math/solver/internal/gaussDenseSIMDX.h"
 #include "gdl/math/solver/internal/pivotDenseSerial.h"
-#include "gdl/math/solver/internal/pivotDenseSIMD.inl"
 
 #include <cmath>
 
@@ -38,6 +41,21 @@ VecSIMD<_type, _size, true> Gauss(const MatSIMD<_type, _size, _size>& A, const V
 
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Pivot _pivot, typename _type>
+VecX<_type> Gauss(const MatX<_type>& A, const VecX<_type>& b)
+{
+    using RegisterType = typename MatX<_type>::RegisterType;
+
+    EXCEPTION(A.Rows() != A.Cols(), "Gauss-Jordan algorithm requires a square matrix.");
+    EXCEPTION(A.Rows() != b.Size(), "Size of the matrix and the vector don't match.");
+
+    return VecX<_type>(b.Size(), GaussDenseSIMDX<RegisterType, _pivot>::Solve(A.Rows(), A.DataSSE(), b.DataSSE()));
+}
+
+
+
 // --------------------------------------------------------------------------------------------------------------------
 
 template <typename _type, U32 _size, Pivot _pivot>
@@ -119,93 +137,14 @@ template <typename _registerType, U32 _size, Pivot _pivot>
 inline typename GaussDenseSSE<_registerType, _size, _pivot>::VectorType
 GaussDenseSSE<_registerType, _size, _pivot>::Solve(const MatrixType& A, const VectorType& b)
 {
-    using namespace GDL::simd;
-
     alignas(alignment) MatrixDataArray matData = A.DataSSE();
     alignas(alignment) VectorDataArray vecData = b.DataSSE();
 
-    constexpr U32 numRowsFullRegisters = _size / numRegisterValues;
-    constexpr U32 numNonFullRegValues = _size % numRegisterValues;
-
-    // Perform Gauss steps for all registers that do not contain unused values
-    for (U32 i = 0; i < numRowsFullRegisters; ++i)
-        GaussStepsRegister(i, matData, vecData);
-
-    // Perform Gauss steps for remaining rows that are stored in registers with unused values
-    if constexpr (numNonFullRegValues != 0)
-        GaussStepsRegister<0, numNonFullRegValues>(numColRegisters - 1, matData, vecData);
-
+    GaussDenseSIMDX<_registerType, _pivot, _size>::SolveInPlace(_size, matData.data(), vecData.data(), nullptr);
 
     return VectorType(vecData);
 }
 
 
 
-// --------------------------------------------------------------------------------------------------------------------
-
-template <typename _registerType, U32 _size, Pivot _pivot>
-template <U32 _regValueIdx>
-inline void GaussDenseSSE<_registerType, _size, _pivot>::EliminationStepRegister(U32 iteration, U32 regRowIdx,
-                                                                                 MatrixDataArray& matData,
-                                                                                 VectorDataArray& vecData)
-{
-    using namespace GDL::simd;
-
-    const U32 colStartIdx = iteration * numColRegisters;
-    const U32 actRowRegIdx = colStartIdx + regRowIdx;
-
-    DEV_EXCEPTION(GetValue<_regValueIdx>(matData[actRowRegIdx]) == ApproxZero<ValueType>(1, 100),
-                  "Singular matrix - system not solveable");
-
-
-    // Calculate row multipliers
-    alignas(alignment) std::array<_registerType, numColRegisters> rowMult;
-    const _registerType zero = _mm_setzero<_registerType>();
-    const _registerType one = _mm_set1<_registerType>(1);
-    const _registerType div = _mm_div(one, BroadcastAcrossLanes<_regValueIdx>(matData[actRowRegIdx]));
-
-    matData[actRowRegIdx] = _mm_sub(matData[actRowRegIdx], BlendIndex<_regValueIdx>(zero, one));
-    for (U32 i = 0; i < numColRegisters; ++i)
-        rowMult[i] = _mm_mul(div, matData[colStartIdx + i]);
-
-
-    // Perform elimination for all relevant columns
-    for (U32 i = colStartIdx + numColRegisters; i < _size * numColRegisters; i += numColRegisters)
-    {
-        _registerType pivValue = BroadcastAcrossLanes<_regValueIdx>(matData[regRowIdx + i]);
-        for (U32 j = 0; j < numColRegisters; ++j)
-            matData[i + j] = _mm_fnmadd(rowMult[j], pivValue, matData[i + j]);
-    }
-
-    _registerType pivValue = BroadcastAcrossLanes<_regValueIdx>(vecData[regRowIdx]);
-    for (U32 i = 0; i < numColRegisters; ++i)
-        vecData[i] = _mm_fnmadd(rowMult[i], pivValue, vecData[i]);
-}
-
-
-
-// --------------------------------------------------------------------------------------------------------------------
-
-template <typename _registerType, U32 _size, Pivot _pivot>
-template <U32 _regValueIdx, U32 _maxRecursionDepth>
-inline void GaussDenseSSE<_registerType, _size, _pivot>::GaussStepsRegister(U32 regRowIdx, MatrixDataArray& matData,
-                                                                            VectorDataArray& vecData)
-{
-
-    static_assert(_maxRecursionDepth <= numRegisterValues,
-                  "_maxRecursionDepth must be equal or smaller than the number of register values.");
-
-    const U32 iteration = regRowIdx * numRegisterValues + _regValueIdx;
-
-    if constexpr (_pivot != Pivot::NONE)
-        PivotDenseSSE<_registerType, _size>::template PivotingStepRegister<_regValueIdx, _pivot>(iteration, regRowIdx,
-                                                                                                 matData, vecData);
-    EliminationStepRegister<_regValueIdx>(iteration, regRowIdx, matData, vecData);
-
-    if constexpr (_regValueIdx + 1 < _maxRecursionDepth)
-        GaussStepsRegister<_regValueIdx + 1, _maxRecursionDepth>(regRowIdx, matData, vecData);
-}
-
-
-
 } // namespace GDL::Solver
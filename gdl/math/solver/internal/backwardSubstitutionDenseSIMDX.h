@@ -0,0 +1,65 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/utility.h"
+
+
+namespace GDL::Solver
+{
+
+
+
+//! @brief Backward substitution solver class for dense systems. All loop boundaries depend on the passed system size,
+//! so that it can be used for systems whose size is only known at runtime. The solver of statically sized systems uses
+//! the same functions (see BackwardSubstitutionDenseSIMD).
+//! @tparam _registerType: Register type
+//! @tparam _isUnit: If TRUE, the solver is optimized for unit triangular matrices.
+//! @tparam _size: Size of the linear system if it is known at compile time, 0 otherwise
+template <typename _registerType, bool _isUnit = false, U32 _size = 0>
+class BackwardSubstitutionDenseSIMDX
+{
+    static constexpr U32 numRegisterValues = simd::numRegisterValues<_registerType>;
+
+
+    using ValueType = decltype(simd::GetDataType<_registerType>());
+
+    BackwardSubstitutionDenseSIMDX() = delete;
+
+public:
+    //! @brief Solves the linear system A * x = r with A being an upper triangular matrix. The result is written into
+    //! the passed vector data
+    //! @param size: Size of the linear system
+    //! @param matrixData: Matrix data (column major ordering)
+    //! @param rhsData: Data of the right-hand side vector. The passed data is overwritten with the result.
+    inline static void SolveInPlace(U32 size, const _registerType* matrixData, _registerType* rhsData);
+
+private:
+    //! @brief Performs a single backward substitution step
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
+    //! @param regRowIdx: Row index of the register that contains the current active row
+    //! @param size: Size of the linear system
+    //! @param matrixData: Matrix data (column major ordering)
+    //! @param rhsData: Data of the right-hand side vector
+    template <U32 _regValueIdx>
+    static inline void SubstitutionStep(U32 regRowIdx, U32 size, const _registerType* matrixData,
+                                        _registerType* rhsData);
+
+    //! @brief Performs the backward substitution steps of all rows of a register using template recursion
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register. If the
+    //! system size is known at compile time, the recursion must start with the last row that belongs to the system.
+    //! @param regRowIdx: Row index of the register that contains the current active row
+    //! @param lastRegValueIdx: Register value index of the last row that belongs to the system
+    //! @param size: Size of the linear system
+    //! @param matrixData: Matrix data (column major ordering)
+    //! @param rhsData: Data of the right-hand side vector
+    template <U32 _regValueIdx = numRegisterValues - 1>
+    static inline void SubstitutionSteps(U32 regRowIdx, U32 lastRegValueIdx, U32 size,
+                                         const _registerType* matrixData, _registerType* rhsData);
+};
+
+
+
+} // namespace GDL::Solver
+
+
+#include "gdl/math/solver/internal/backwardSubstitutionDenseSIMDX.inl"
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "gdl/math/solver/internal/backwardSubstitutionDenseSIMDX.h"
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/base/simd/swizzle.h"
+#include "gdl/math/solver/internal/systemSize.h"
+
+
+namespace GDL::Solver
+{
+
+
+
+template <typename _registerType, bool _isUnit, U32 _size>
+inline void BackwardSubstitutionDenseSIMDX<_registerType, _isUnit, _size>::SolveInPlace(U32 size,
+                                                                                        const _registerType* matrixData,
+                                                                                        _registerType* rhsData)
+{
+    const U32 numRegistersPerCol = simd::CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 numFullRegisterIterations = SystemSize<_size>(size) / numRegisterValues;
+    const U32 numNonFullRegIterations = SystemSize<_size>(size) % numRegisterValues;
+
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numStaticNonFullRegIterations = _size % numRegisterValues;
+        if constexpr (numStaticNonFullRegIterations != 0)
+            SubstitutionSteps<numStaticNonFullRegIterations - 1>(numRegistersPerCol - 1,
+                                                                 numStaticNonFullRegIterations - 1, size, matrixData,
+                                                                 rhsData);
+    }
+    else if (numNonFullRegIterations != 0)
+        SubstitutionSteps(numRegistersPerCol - 1, numNonFullRegIterations - 1, size, matrixData, rhsData);
+
+    for (U32 i = numFullRegisterIterations; 0 < i--;)
+        SubstitutionSteps(i, numRegisterValues - 1, size, matrixData, rhsData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+
+template <typename _registerType, bool _isUnit, U32 _size>
+template <U32 _regValueIdx>
+inline void BackwardSubstitutionDenseSIMDX<_registerType, _isUnit, _size>::SubstitutionStep(
+        U32 regRowIdx, U32 size, const _registerType* matrixData, _registerType* rhsData)
+{
+    using namespace GDL::simd;
+
+    const U32 numRegistersPerCol = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 iteration = regRowIdx * numRegisterValues + _regValueIdx;
+    const _registerType* col = matrixData + iteration * numRegistersPerCol;
+
+
+    DEV_EXCEPTION(GetValue<_regValueIdx>(col[regRowIdx]) == ApproxZero<ValueType>(1, 100),
+                  "Can't solve system - Singular matrix.");
+
+
+    if constexpr (not _isUnit)
+        rhsData[regRowIdx] =
+                BlendIndex<_regValueIdx>(rhsData[regRowIdx], _mm_div(rhsData[regRowIdx], col[regRowIdx]));
+
+    _registerType mult = BroadcastAcrossLanes<_regValueIdx>(rhsData[regRowIdx]);
+
+    if constexpr (_regValueIdx > 0)
+        rhsData[regRowIdx] = BlendAboveIndex<_regValueIdx>(rhsData[regRowIdx],
+                                                           _mm_fnmadd(col[regRowIdx], mult, rhsData[regRowIdx]));
+
+    for (U32 i = regRowIdx; 0 < i--;)
+        rhsData[i] = _mm_fnmadd(col[i], mult, rhsData[i]);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+
+template <typename _registerType, bool _isUnit, U32 _size>
+template <U32 _regValueIdx>
+inline void BackwardSubstitutionDenseSIMDX<_registerType, _isUnit, _size>::SubstitutionSteps(
+        U32 regRowIdx, U32 lastRegValueIdx, U32 size, const _registerType* matrixData, _registerType* rhsData)
+{
+    static_assert(_regValueIdx < numRegisterValues, "_regValueIdx must be smaller than the number of register values");
+
+    if (_size != 0 || _regValueIdx <= lastRegValueIdx)
+        SubstitutionStep<_regValueIdx>(regRowIdx, size, matrixData, rhsData);
+
+    if constexpr (_regValueIdx > 0)
+        SubstitutionSteps<_regValueIdx - 1>(regRowIdx, lastRegValueIdx, size, matrixData, rhsData);
+}
+
+
+} // namespace GDL::Solver
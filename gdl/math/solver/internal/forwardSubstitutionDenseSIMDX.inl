@@ -0,0 +1,96 @@
+#pragma once
+
+#include "gdl/math/solver/internal/forwardSubstitutionDenseSIMDX.h"
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/base/simd/swizzle.h"
+#include "gdl/math/solver/internal/systemSize.h"
+
+
+namespace GDL::Solver
+{
+
+
+
+template <typename _registerType, bool _isUnit, U32 _size>
+inline void ForwardSubstitutionDenseSIMDX<_registerType, _isUnit, _size>::SolveInPlace(U32 size,
+                                                                                       const _registerType* matrixData,
+                                                                                       _registerType* rhsData)
+{
+    DEV_EXCEPTION(size == 0, "Can't solve an empty system.");
+
+    const U32 numRegistersPerCol = simd::CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 numIterations = SystemSize<_size>(size) - 1;
+    const U32 numFullRegisterIterations = numIterations / numRegisterValues;
+    const U32 numNonFullRegIterations = numIterations % numRegisterValues;
+
+    for (U32 i = 0; i < numFullRegisterIterations; ++i)
+        SubstitutionSteps(i, numRegisterValues, size, matrixData, rhsData);
+
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numStaticNonFullRegIterations = (_size - 1) % numRegisterValues;
+        if constexpr (numStaticNonFullRegIterations != 0)
+            SubstitutionSteps<0, numStaticNonFullRegIterations>(numRegistersPerCol - 1, numStaticNonFullRegIterations,
+                                                                size, matrixData, rhsData);
+    }
+    else if (numNonFullRegIterations != 0)
+        SubstitutionSteps(numRegistersPerCol - 1, numNonFullRegIterations, size, matrixData, rhsData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+
+template <typename _registerType, bool _isUnit, U32 _size>
+template <U32 _regValueIdx>
+inline void ForwardSubstitutionDenseSIMDX<_registerType, _isUnit, _size>::SubstitutionStep(
+        U32 regRowIdx, U32 size, const _registerType* matrixData, _registerType* rhsData)
+{
+    using namespace GDL::simd;
+
+    const U32 numRegistersPerCol = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 iteration = regRowIdx * numRegisterValues + _regValueIdx;
+    const _registerType* col = matrixData + iteration * numRegistersPerCol;
+
+
+    DEV_EXCEPTION(GetValue<_regValueIdx>(col[regRowIdx]) == ApproxZero<ValueType>(1, 100),
+                  "Can't solve system - Singular matrix.");
+
+
+    if constexpr (not _isUnit)
+        rhsData[regRowIdx] =
+                BlendIndex<_regValueIdx>(rhsData[regRowIdx], _mm_div(rhsData[regRowIdx], col[regRowIdx]));
+
+    _registerType mult = BroadcastAcrossLanes<_regValueIdx>(rhsData[regRowIdx]);
+
+    if constexpr (_regValueIdx < numRegisterValues - 1)
+        rhsData[regRowIdx] = BlendBelowIndex<_regValueIdx>(rhsData[regRowIdx],
+                                                           _mm_fnmadd(col[regRowIdx], mult, rhsData[regRowIdx]));
+
+    for (U32 i = regRowIdx + 1; i < numRegistersPerCol; ++i)
+        rhsData[i] = _mm_fnmadd(col[i], mult, rhsData[i]);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+
+template <typename _registerType, bool _isUnit, U32 _size>
+template <U32 _regValueIdx, U32 _maxRecursionDepth>
+inline void ForwardSubstitutionDenseSIMDX<_registerType, _isUnit, _size>::SubstitutionSteps(
+        U32 regRowIdx, U32 numSteps, U32 size, const _registerType* matrixData, _registerType* rhsData)
+{
+    SubstitutionStep<_regValueIdx>(regRowIdx, size, matrixData, rhsData);
+
+    if constexpr (_regValueIdx + 1 < _maxRecursionDepth)
+        if (_size != 0 || _regValueIdx + 1 < numSteps)
+            SubstitutionSteps<_regValueIdx + 1, _maxRecursionDepth>(regRowIdx, numSteps, size, matrixData, rhsData);
+}
+
+
+} // namespace GDL::Solver
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/utility.h"
+#include "gdl/math/solver/internal/pivotDenseSIMDX.h"
+#include "gdl/math/solver/pivotEnum.h"
+
+
+namespace GDL::Solver
+{
+
+
+//! @brief Gauss-Jordan solver class for dense systems. All loop boundaries depend on the passed system size, so that it
+//! can be used for systems whose size is only known at runtime. The solver of statically sized systems uses the same
+//! functions (see GaussDenseSSE).
+//! @tparam _registerType: Register type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @tparam _size: Size of the linear system if it is known at compile time, 0 otherwise
+template <typename _registerType, Pivot _pivot, U32 _size = 0>
+class GaussDenseSIMDX
+{
+    template <typename, U32, Pivot>
+    friend class GaussDenseSSE;
+
+
+    static constexpr U32 alignment = simd::alignmentBytes<_registerType>;
+    static constexpr U32 numRegisterValues = simd::numRegisterValues<_registerType>;
+
+
+    using DataArray = Vector<_registerType>;
+    using ValueType = decltype(simd::GetDataType<_registerType>());
+
+    GaussDenseSIMDX() = delete;
+
+public:
+    //! @brief Solves the linear system A * x = b by using a Gauss-Jordan algorithm.
+    //! @param size: Size of the linear system
+    //! @param matData: Matrix data array (column major ordering)
+    //! @param vecData: Vector data array
+    //! @return Data of the result vector x
+    [[nodiscard]] inline static DataArray Solve(U32 size, DataArray matData, DataArray vecData);
+
+private:
+    //! @brief Solves the linear system A * x = b by using a Gauss-Jordan algorithm. The result is written into the
+    //! passed vector data
+    //! @param size: Size of the linear system
+    //! @param matData: Matrix data (column major ordering). The data is modified during the solution process.
+    //! @param vecData: Vector data. The passed data is overwritten with the result.
+    //! @param rowMult: Buffer for the row multipliers. Its size must be equal to the number of registers per column.
+    //! It is unused if the system size is known at compile time.
+    inline static void SolveInPlace(U32 size, _registerType* matData, _registerType* vecData, _registerType* rowMult);
+
+    //! @brief Performs the elimination step of the current iteration
+    //! @tparam _regValueIdx: Position of the current iterations active row inside of its corresponding register
+    //! @param iteration: Number of the current iteration
+    //! @param regRowIdx: Row index of the register that holds the value of the current iterations active row
+    //! @param size: Size of the linear system
+    //! @param matData: Matrix data (column major ordering)
+    //! @param vecData: Vector data
+    //! @param rowMult: Buffer for the row multipliers. Its size must be equal to the number of registers per column.
+    //! It is unused if the system size is known at compile time.
+    template <U32 _regValueIdx>
+    inline static void EliminationStepRegister(U32 iteration, U32 regRowIdx, U32 size, _registerType* matData,
+                                               _registerType* vecData, _registerType* rowMult);
+
+    //! @brief This function uses template recursion to perform a gauss step (pivoting and elimination) for each value
+    //! inside of a register.
+    //! @tparam _regValueIdx: Position of the current iterations active row inside of its corresponding register
+    //! @tparam _maxRecursionDepth: Maximum number of template recursions. If the system size is known at compile time,
+    //! it must be equal to the number of steps. The steps are then unrolled without any runtime checks.
+    //! @param regRowIdx: Row index of the register that holds the value of the current iterations active row
+    //! @param numSteps: Number of steps that should be performed
+    //! @param size: Size of the linear system
+    //! @param matData: Matrix data (column major ordering)
+    //! @param vecData: Vector data
+    //! @param rowMult: Buffer for the row multipliers. Its size must be equal to the number of registers per column.
+    //! It is unused if the system size is known at compile time.
+    template <U32 _regValueIdx = 0, U32 _maxRecursionDepth = numRegisterValues>
+    inline static void GaussStepsRegister(U32 regRowIdx, U32 numSteps, U32 size, _registerType* matData,
+                                          _registerType* vecData, _registerType* rowMult);
+};
+
+
+
+} // namespace GDL::Solver
+
+
+#include "gdl/math/solver/internal/gaussDenseSIMDX.inl"
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "gdl/math/solver/internal/gaussDenseSIMDX.h"
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/base/simd/swizzle.h"
+#include "gdl/math/solver/internal/systemSize.h"
+
+#include <array>
+
+
+
+namespace GDL::Solver
+{
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline typename GaussDenseSIMDX<_registerType, _pivot, _size>::DataArray
+GaussDenseSIMDX<_registerType, _pivot, _size>::Solve(U32 size, DataArray matData, DataArray vecData)
+{
+    const U32 numColRegisters = simd::CalcMinNumArrayRegisters<_registerType>(size);
+
+    DEV_EXCEPTION(matData.size() != static_cast<size_t>(size) * numColRegisters || vecData.size() != numColRegisters,
+                  "Size of the matrix or vector data doesn't match the system size.");
+
+    DataArray rowMult(numColRegisters);
+    SolveInPlace(size, matData.data(), vecData.data(), rowMult.data());
+
+    return vecData;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline void GaussDenseSIMDX<_registerType, _pivot, _size>::SolveInPlace(U32 size, _registerType* matData,
+                                                                        _registerType* vecData, _registerType* rowMult)
+{
+    const U32 numRowsFullRegisters = SystemSize<_size>(size) / numRegisterValues;
+    const U32 numNonFullRegValues = SystemSize<_size>(size) % numRegisterValues;
+
+    // Perform Gauss steps for all registers that do not contain unused values
+    for (U32 i = 0; i < numRowsFullRegisters; ++i)
+        GaussStepsRegister(i, numRegisterValues, size, matData, vecData, rowMult);
+
+    // Perform Gauss steps for remaining rows that are stored in registers with unused values
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numStaticNonFullRegValues = _size % numRegisterValues;
+        if constexpr (numStaticNonFullRegValues != 0)
+            GaussStepsRegister<0, numStaticNonFullRegValues>(numRowsFullRegisters, numStaticNonFullRegValues, size,
+                                                             matData, vecData, rowMult);
+    }
+    else if (numNonFullRegValues != 0)
+        GaussStepsRegister(numRowsFullRegisters, numNonFullRegValues, size, matData, vecData, rowMult);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx>
+inline void GaussDenseSIMDX<_registerType, _pivot, _size>::EliminationStepRegister(U32 iteration, U32 regRowIdx,
+                                                                                   U32 size, _registerType* matData,
+                                                                                   _registerType* vecData,
+                                                                                   _registerType* rowMult)
+{
+    using namespace GDL::simd;
+
+    const U32 numColRegisters = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 colStartIdx = iteration * numColRegisters;
+    const U32 actRowRegIdx = colStartIdx + regRowIdx;
+    const _registerType* matEnd = matData + SystemSize<_size>(size) * numColRegisters;
+
+    DEV_EXCEPTION(GetValue<_regValueIdx>(matData[actRowRegIdx]) == ApproxZero<ValueType>(1, 100),
+                  "Singular matrix - system not solveable");
+
+
+    // Static systems store the row multipliers in a local array. Otherwise, the compiler can't rule out that the buffer
+    // aliases the matrix data and has to reload the multipliers for each column.
+    alignas(alignment) std::array<_registerType, CalcMinNumArrayRegisters<_registerType>(_size)> staticRowMult;
+    if constexpr (_size != 0)
+        rowMult = staticRowMult.data();
+
+
+    // Calculate row multipliers
+    const _registerType zero = _mm_setzero<_registerType>();
+    const _registerType one = _mm_set1<_registerType>(1);
+    const _registerType div = _mm_div(one, BroadcastAcrossLanes<_regValueIdx>(matData[actRowRegIdx]));
+
+    matData[actRowRegIdx] = _mm_sub(matData[actRowRegIdx], BlendIndex<_regValueIdx>(zero, one));
+    for (U32 i = 0; i < numColRegisters; ++i)
+        rowMult[i] = _mm_mul(div, matData[colStartIdx + i]);
+
+
+    // Perform elimination for all relevant columns
+    for (_registerType* col = matData + colStartIdx + numColRegisters; col < matEnd; col += numColRegisters)
+    {
+        _registerType pivValue = BroadcastAcrossLanes<_regValueIdx>(col[regRowIdx]);
+        for (U32 j = 0; j < numColRegisters; ++j)
+            col[j] = _mm_fnmadd(rowMult[j], pivValue, col[j]);
+    }
+
+    _registerType pivValue = BroadcastAcrossLanes<_regValueIdx>(vecData[regRowIdx]);
+    for (U32 i = 0; i < numColRegisters; ++i)
+        vecData[i] = _mm_fnmadd(rowMult[i], pivValue, vecData[i]);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx, U32 _maxRecursionDepth>
+inline void GaussDenseSIMDX<_registerType, _pivot, _size>::GaussStepsRegister(U32 regRowIdx, U32 numSteps, U32 size,
+                                                                              _registerType* matData,
+                                                                              _registerType* vecData,
+                                                                              _registerType* rowMult)
+{
+    const U32 iteration = regRowIdx * numRegisterValues + _regValueIdx;
+
+    if constexpr (_pivot != Pivot::NONE)
+        PivotDenseSIMDX<_registerType, _size>::template PivotingStepRegister<_regValueIdx, _pivot>(
+                iteration, regRowIdx, size, matData, vecData);
+    EliminationStepRegister<_regValueIdx>(iteration, regRowIdx, size, matData, vecData, rowMult);
+
+    if constexpr (_regValueIdx + 1 < _maxRecursionDepth)
+        if (_size != 0 || _regValueIdx + 1 < numSteps)
+            GaussStepsRegister<_regValueIdx + 1, _maxRecursionDepth>(regRowIdx, numSteps, size, matData, vecData,
+                                                                     rowMult);
+}
+
+
+
+} // namespace GDL::Solver
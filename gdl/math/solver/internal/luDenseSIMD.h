@@ -12,7 +12,8 @@ namespace GDL::Solver
 {
 
 
-//! @brief LU solver class for dense static systems
+//! @brief LU solver class for dense static systems. The factorization and substitution steps are shared with the
+//! solver for systems whose size is only known at runtime (see LUDenseSIMDX).
 //! @tparam _registerType: Register type
 //! @tparam _size: Size of the linear system
 //! @tparam _pivot: Enum to select the pivoting strategy
@@ -20,13 +21,11 @@ template <typename _registerType, U32 _size, Pivot _pivot>
 class LUDenseSIMD
 {
     static constexpr U32 alignment = simd::alignmentBytes<_registerType>;
-    static constexpr U32 numRegisterValues = simd::numRegisterValues<_registerType>;
     static constexpr U32 numRegistersPerCol = simd::CalcMinNumArrayRegisters<_registerType>(_size);
 
 
     using MatrixDataArray = std::array<_registerType, numRegistersPerCol * _size>;
     using VectorDataArray = std::array<_registerType, numRegistersPerCol>;
-    using ValueType = decltype(simd::GetDataType<_registerType>());
 
     LUDenseSIMD() = delete;
 
@@ -60,23 +59,6 @@ public:
     //! @return Result vector x
     [[nodiscard]] inline static VectorDataArray Solve(const Factorization& factorization,
                                                       const VectorDataArray& rhsData);
-
-private:
-    //! @brief Performs a single factorization step
-    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
-    //! @param iteration: Iteration number of the factorization procedure
-    //! @param regRowIdx: Row index of the register that contains the current active row
-    //! @param lu: Data of the LU decomposition
-    template <U32 _regValueIdx>
-    static inline void FactorizationStep(U32 iteration, U32 regRowIdx, MatrixDataArray& lu);
-
-    //! @brief Performs multiple factorization steps using template recursion
-    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
-    //! @tparam _maxRecursionDepth: Maximum number of template recursions
-    //! @param regRowIdx: Row index of the register that contains the current active row
-    //! @param factorization: Matrix factorization
-    template <U32 _regValueIdx = 0, U32 _maxRecursionDepth = numRegisterValues>
-    static inline void FactorizationSteps(U32 regRowIdx, Factorization& factorization);
 };
 
 
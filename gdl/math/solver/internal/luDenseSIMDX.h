@@ -0,0 +1,119 @@
+#pragma once
+
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/utility.h"
+#include "gdl/math/solver/internal/pivotDenseSIMDX.h"
+#include "gdl/math/solver/pivotEnum.h"
+
+
+namespace GDL::Solver
+{
+
+
+//! @brief LU solver class for dense systems. All loop boundaries depend on the passed system size, so that it can be
+//! used for systems whose size is only known at runtime. The solver of statically sized systems uses the same functions
+//! (see LUDenseSIMD).
+//! @tparam _registerType: Register type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @tparam _size: Size of the linear system if it is known at compile time, 0 otherwise
+template <typename _registerType, Pivot _pivot, U32 _size = 0>
+class LUDenseSIMDX
+{
+    template <typename, U32, Pivot>
+    friend class LUDenseSIMD;
+
+
+    static constexpr U32 alignment = simd::alignmentBytes<_registerType>;
+    static constexpr U32 numRegisterValues = simd::numRegisterValues<_registerType>;
+
+
+    using DataArray = Vector<_registerType>;
+    using ValueType = decltype(simd::GetDataType<_registerType>());
+    using VectorPermutationData = typename PivotDenseSIMDX<_registerType, _size>::VectorPermutationData;
+
+    LUDenseSIMDX() = delete;
+
+public:
+    //! @brief Class that stores the LU factorization and the permutations
+    class Factorization
+    {
+        friend class LUDenseSIMDX;
+
+        using PermutationDataArray = typename PivotDenseSIMDX<_registerType, _size>::VectorPermutationDataArray;
+
+        U32 mSize;
+        U32 mNumRegistersPerCol;
+        DataArray mLU;
+        PermutationDataArray mPermutationData;
+
+
+        //! @brief ctor
+        //! @param size: Size of the linear system
+        //! @param matrixData: Data of the matrix that should be factorized
+        Factorization(U32 size, const DataArray& matrixData);
+    };
+
+
+
+    //! @brief Calculates the LU factorization and returns it
+    //! @param size: Size of the linear system
+    //! @param matrixData: Data of the matrix that should be factorized
+    //! @return LU factorization
+    [[nodiscard]] static inline Factorization Factorize(U32 size, const DataArray& matrixData);
+
+    //! @brief Solves the linear system A * x = r
+    //! @param factorization: Matrix factorization
+    //! @param rhsData: Data of the right-hand side vector
+    //! @return Result vector x
+    [[nodiscard]] inline static DataArray Solve(const Factorization& factorization, const DataArray& rhsData);
+
+private:
+    //! @brief Calculates the LU factorization of the passed matrix data in place
+    //! @tparam _typePermData: Type of the permutation data. It must provide an AddPermutation function.
+    //! @param size: Size of the linear system
+    //! @param lu: Matrix data (column major ordering). The data is overwritten with the factorization.
+    //! @param permutationData: Permutation data
+    template <typename _typePermData>
+    static inline void FactorizeInPlace(U32 size, _registerType* lu, _typePermData& permutationData);
+
+    //! @brief Performs a single factorization step
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
+    //! @param iteration: Iteration number of the factorization procedure
+    //! @param regRowIdx: Row index of the register that contains the current active row
+    //! @param size: Size of the linear system
+    //! @param lu: Data of the LU decomposition
+    template <U32 _regValueIdx>
+    static inline void FactorizationStep(U32 iteration, U32 regRowIdx, U32 size, _registerType* lu);
+
+    //! @brief Performs multiple factorization steps using template recursion
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
+    //! @tparam _maxRecursionDepth: Maximum number of template recursions. If the system size is known at compile time,
+    //! it must be equal to the number of steps. The steps are then unrolled without any runtime checks.
+    //! @tparam _typePermData: Type of the permutation data. It must provide an AddPermutation function.
+    //! @param regRowIdx: Row index of the register that contains the current active row
+    //! @param numSteps: Number of steps that should be performed
+    //! @param size: Size of the linear system
+    //! @param lu: Data of the LU decomposition
+    //! @param permutationData: Permutation data
+    template <U32 _regValueIdx = 0, U32 _maxRecursionDepth = numRegisterValues, typename _typePermData>
+    static inline void FactorizationSteps(U32 regRowIdx, U32 numSteps, U32 size, _registerType* lu,
+                                          _typePermData& permutationData);
+
+    //! @brief Solves the linear system A * x = r using the passed factorization data. The result is written into the
+    //! passed vector data
+    //! @param size: Size of the linear system
+    //! @param lu: Data of the LU decomposition
+    //! @param permutations: Pointer to the first permutation
+    //! @param numPermutations: Number of permutations
+    //! @param rhsData: Data of the right-hand side vector. The passed data is overwritten with the result.
+    static inline void SolveInPlace(U32 size, const _registerType* lu, const VectorPermutationData* permutations,
+                                    U32 numPermutations, _registerType* rhsData);
+};
+
+
+
+} // namespace GDL::Solver
+
+
+#include "gdl/math/solver/internal/luDenseSIMDX.inl"
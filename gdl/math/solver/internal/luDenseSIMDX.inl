@@ -0,0 +1,185 @@
+#pragma once
+
+#include "gdl/math/solver/internal/luDenseSIMDX.h"
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/base/simd/swizzle.h"
+#include "gdl/math/solver/internal/backwardSubstitutionDenseSIMDX.h"
+#include "gdl/math/solver/internal/forwardSubstitutionDenseSIMDX.h"
+#include "gdl/math/solver/internal/systemSize.h"
+
+
+
+namespace GDL::Solver
+{
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline LUDenseSIMDX<_registerType, _pivot, _size>::Factorization::Factorization(U32 size,
+                                                                               const DataArray& matrixData)
+    : mSize{size}
+    , mNumRegistersPerCol{simd::CalcMinNumArrayRegisters<_registerType>(size)}
+    , mLU{matrixData}
+{
+    DEV_EXCEPTION(mLU.size() != static_cast<size_t>(mSize) * mNumRegistersPerCol,
+                  "Size of the matrix data doesn't match the system size.");
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+[[nodiscard]] inline typename LUDenseSIMDX<_registerType, _pivot, _size>::Factorization
+LUDenseSIMDX<_registerType, _pivot, _size>::Factorize(U32 size, const DataArray& matrixData)
+{
+    DEV_EXCEPTION(size == 0, "Can't factorize an empty system.");
+
+    Factorization factorization(size, matrixData);
+    FactorizeInPlace(size, factorization.mLU.data(), factorization.mPermutationData);
+
+    return factorization;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline typename LUDenseSIMDX<_registerType, _pivot, _size>::DataArray
+LUDenseSIMDX<_registerType, _pivot, _size>::Solve(const Factorization& factorization, const DataArray& rhsData)
+{
+    DEV_EXCEPTION(rhsData.size() != factorization.mNumRegistersPerCol,
+                  "Size of the vector data doesn't match the system size.");
+
+    const auto& permutations = factorization.mPermutationData.mPermutations;
+
+    DataArray vectorData = rhsData;
+    SolveInPlace(factorization.mSize, factorization.mLU.data(), permutations.data(),
+                 static_cast<U32>(permutations.size()), vectorData.data());
+
+    return vectorData;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <typename _typePermData>
+inline void LUDenseSIMDX<_registerType, _pivot, _size>::FactorizeInPlace(U32 size, _registerType* lu,
+                                                                         _typePermData& permutationData)
+{
+    const U32 systemSize = SystemSize<_size>(size);
+    [[maybe_unused]] const U32 numRegistersPerCol = simd::CalcMinNumArrayRegisters<_registerType>(systemSize);
+    const U32 numFullRegistersPerCol = (systemSize - 1) / numRegisterValues;
+    const U32 numNonFullRegValues = (systemSize - 1) % numRegisterValues;
+
+    for (U32 i = 0; i < numFullRegistersPerCol; ++i)
+        FactorizationSteps(i, numRegisterValues, size, lu, permutationData);
+
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numStaticNonFullRegValues = (_size - 1) % numRegisterValues;
+        if constexpr (numStaticNonFullRegValues != 0)
+            FactorizationSteps<0, numStaticNonFullRegValues>(numFullRegistersPerCol, numStaticNonFullRegValues, size,
+                                                             lu, permutationData);
+    }
+    else if (numNonFullRegValues != 0)
+        FactorizationSteps(numFullRegistersPerCol, numNonFullRegValues, size, lu, permutationData);
+
+
+    DEV_EXCEPTION(simd::GetValue(lu[systemSize * numRegistersPerCol - 1], (systemSize - 1) % numRegisterValues) ==
+                          ApproxZero<ValueType>(1, 100),
+                  "Can't solve system - Singular matrix or inappropriate pivoting strategy.");
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx>
+inline void LUDenseSIMDX<_registerType, _pivot, _size>::FactorizationStep(U32 iteration, U32 regRowIdx, U32 size,
+                                                                          _registerType* lu)
+{
+    using namespace GDL::simd;
+
+    const U32 numRegistersPerCol = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 colStartIdx = iteration * numRegistersPerCol;
+    const U32 actRowRegIdx = colStartIdx + regRowIdx;
+    const _registerType* luEnd = lu + SystemSize<_size>(size) * numRegistersPerCol;
+
+    DEV_EXCEPTION(GetValue<_regValueIdx>(lu[actRowRegIdx]) == ApproxZero<ValueType>(1, 100),
+                  "Can't solve system - Singular matrix or inappropriate pivoting strategy.");
+
+
+    const _registerType one = _mm_set1<_registerType>(1);
+    const _registerType div = _mm_div(one, BroadcastAcrossLanes<_regValueIdx>(lu[actRowRegIdx]));
+
+
+
+    lu[actRowRegIdx] = BlendBelowIndex<_regValueIdx>(lu[actRowRegIdx], _mm_mul(div, lu[actRowRegIdx]));
+    for (U32 i = regRowIdx + 1; i < numRegistersPerCol; ++i)
+        lu[colStartIdx + i] = _mm_mul(div, lu[colStartIdx + i]);
+
+    const _registerType* actCol = lu + actRowRegIdx;
+    const U32 numActColRegisters = numRegistersPerCol - regRowIdx;
+
+    for (_registerType* col = lu + actRowRegIdx + numRegistersPerCol; col < luEnd; col += numRegistersPerCol)
+    {
+        _registerType pivValue = BroadcastAcrossLanes<_regValueIdx>(col[0]);
+        col[0] = BlendBelowIndex<_regValueIdx>(col[0], _mm_fnmadd(actCol[0], pivValue, col[0]));
+        for (U32 j = 1; j < numActColRegisters; ++j)
+            col[j] = _mm_fnmadd(actCol[j], pivValue, col[j]);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx, U32 _maxRecursionDepth, typename _typePermData>
+inline void LUDenseSIMDX<_registerType, _pivot, _size>::FactorizationSteps(U32 regRowIdx, U32 numSteps, U32 size,
+                                                                           _registerType* lu,
+                                                                           _typePermData& permutationData)
+{
+    const U32 iteration = regRowIdx * numRegisterValues + _regValueIdx;
+
+    if constexpr (_pivot != Pivot::NONE)
+        PivotDenseSIMDX<_registerType, _size>::template PivotingStepRegister<_regValueIdx, _pivot>(
+                iteration, regRowIdx, size, lu, permutationData);
+
+    FactorizationStep<_regValueIdx>(iteration, regRowIdx, size, lu);
+
+    if constexpr (_regValueIdx + 1 < _maxRecursionDepth)
+        if (_size != 0 || _regValueIdx + 1 < numSteps)
+            FactorizationSteps<_regValueIdx + 1, _maxRecursionDepth>(regRowIdx, numSteps, size, lu, permutationData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline void
+LUDenseSIMDX<_registerType, _pivot, _size>::SolveInPlace(U32 size, const _registerType* lu,
+                                                         [[maybe_unused]] const VectorPermutationData* permutations,
+                                                         [[maybe_unused]] U32 numPermutations, _registerType* rhsData)
+{
+    if constexpr (_pivot != Pivot::NONE)
+        PivotDenseSIMDX<_registerType, _size>::PermuteVector(rhsData, permutations, numPermutations);
+
+    ForwardSubstitutionDenseSIMDX<_registerType, true, _size>::SolveInPlace(size, lu, rhsData);
+    BackwardSubstitutionDenseSIMDX<_registerType, false, _size>::SolveInPlace(size, lu, rhsData);
+}
+
+
+
+} // namespace GDL::Solver
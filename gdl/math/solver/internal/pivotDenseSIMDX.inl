@@ -0,0 +1,260 @@
+#pragma once
+
+#include "gdl/math/solver/internal/pivotDenseSIMDX.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/abs.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/base/simd/swizzle.h"
+#include "gdl/math/solver/internal/systemSize.h"
+
+#include <array>
+#include <type_traits>
+
+
+namespace GDL::Solver
+{
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+inline PivotDenseSIMDX<_registerType, _size>::VectorPermutationData::VectorPermutationData(U32 idx0, U32 idx1,
+                                                                                          PermutationFuncPtr funcPtr)
+    : mRegIdx0{idx0}
+    , mRegIdx1{idx1}
+    , mFuncPtr{funcPtr}
+{
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+inline void PivotDenseSIMDX<_registerType, _size>::VectorPermutationDataArray::AddPermutation(U32 idx0, U32 idx1,
+                                                                                             PermutationFuncPtr funcPtr)
+{
+    mPermutations.emplace_back(idx0, idx1, funcPtr);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+template <U32 _regElmIdxPiv>
+inline U32 PivotDenseSIMDX<_registerType, _size>::FindMaxAbsValueCol(U32 iteration, U32 regRowIdxPiv, U32 size,
+                                                                     _registerType* matData)
+{
+    using namespace GDL::simd;
+
+    const U32 numColRegisters = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 numNonFullRegValues = SystemSize<_size>(size) % numRegisterValues;
+
+    const U32 colStartIdx = iteration * numColRegisters;
+    const _registerType zero = _mm_setzero<_registerType>();
+
+    // Set unused values of last register to 0. For runtime sizes, the blend mask is created by comparing the lane
+    // indices with the number of used values.
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numNonFullRegValuesStatic = _size % numRegisterValues;
+        if constexpr (numNonFullRegValuesStatic != 0)
+        {
+            U32 nonFullRegIdx = colStartIdx + numColRegisters - 1;
+            matData[nonFullRegIdx] = BlendBelowIndex<numNonFullRegValuesStatic - 1>(matData[nonFullRegIdx], zero);
+        }
+    }
+    else if (numNonFullRegValues != 0)
+    {
+        alignas(alignment) std::array<ValueType, numRegisterValues> laneIndices;
+        for (U32 i = 0; i < numRegisterValues; ++i)
+            laneIndices[i] = static_cast<ValueType>(i);
+
+        const auto usedValues = _mm_cmplt(_mmx_load_p<_registerType>(laneIndices.data()),
+                                          _mm_set1<_registerType>(numNonFullRegValues));
+
+        U32 nonFullRegIdx = colStartIdx + numColRegisters - 1;
+        matData[nonFullRegIdx] = _mm_blendv(zero, matData[nonFullRegIdx], usedValues);
+    }
+
+
+    // Vectorized comparisons
+    _registerType cmpAbs = Abs(BlendAboveIndex<_regElmIdxPiv>(matData[colStartIdx + regRowIdxPiv], zero));
+    _registerType cmpIdx = _mm_set1<_registerType>(regRowIdxPiv);
+
+    for (U32 i = regRowIdxPiv + 1; i < numColRegisters; ++i)
+    {
+        _registerType cmpAbs2 = Abs(matData[colStartIdx + i]);
+        const auto cmpRes = _mm_cmplt(cmpAbs, cmpAbs2);
+        cmpAbs = _mm_blendv(cmpAbs, cmpAbs2, cmpRes);
+        cmpIdx = _mm_blendv(cmpIdx, _mm_set1<_registerType>(i), cmpRes);
+    }
+
+
+    // Find pivot in result register
+    alignas(alignment) std::array<ValueType, numRegisterValues> values;
+    _mm_store(values.data(), cmpAbs);
+    ValueType maxVal = values[0];
+    U32 maxValIdx = 0;
+
+    for (U32 i = 1; i < numRegisterValues; ++i)
+        if (maxVal < values[i])
+        {
+            maxVal = values[i];
+            maxValIdx = i;
+        }
+
+
+    return GetValue(cmpIdx, maxValIdx) * numRegisterValues + maxValIdx;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+template <U32 _regElmIdxPiv, typename _typeVecPerm>
+inline void PivotDenseSIMDX<_registerType, _size>::PartialPivotingStepRegister(U32 iteration, U32 regRowIdxPiv,
+                                                                               U32 size, _registerType* matData,
+                                                                               _typeVecPerm& vecPermData)
+{
+    U32 rowIdxSwp = FindMaxAbsValueCol<_regElmIdxPiv>(iteration, regRowIdxPiv, size, matData);
+
+    DEV_EXCEPTION(rowIdxSwp >= size, "Internal error. Pivot index bigger than matrix size.");
+
+    if (rowIdxSwp != iteration)
+        SwapRowPivot<_regElmIdxPiv>(rowIdxSwp, iteration, regRowIdxPiv, size, matData, vecPermData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+template <U32 _regElmIdx0, U32 _regElmIdx1, bool _sameReg>
+inline void PivotDenseSIMDX<_registerType, _size>::PermutationFunction(_registerType& reg0,
+                                                                       [[maybe_unused]] _registerType& reg1)
+{
+    using namespace GDL::simd;
+
+    if constexpr (_sameReg)
+        reg0 = Swap<_regElmIdx0, _regElmIdx1>(reg0);
+    else
+        Exchange<_regElmIdx0, _regElmIdx1>(reg0, reg1);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+inline void PivotDenseSIMDX<_registerType, _size>::PermuteVector(_registerType* vectorData,
+                                                                 const VectorPermutationData* permutations,
+                                                                 U32 numPermutations)
+{
+    for (U32 i = 0; i < numPermutations; ++i)
+        permutations[i].mFuncPtr(vectorData[permutations[i].mRegIdx0], vectorData[permutations[i].mRegIdx1]);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+template <U32 _regElmIdxPiv, Pivot _pivot, typename _typeVecPerm>
+inline void PivotDenseSIMDX<_registerType, _size>::PivotingStepRegister(U32 iteration, U32 regRowIdxPiv, U32 size,
+                                                                        _registerType* matData,
+                                                                        _typeVecPerm& vecPermData)
+{
+    static_assert(_pivot != Pivot::NONE, "Unneccessary function call");
+
+    static_assert(_pivot == Pivot::PARTIAL, "Unsupported pivoting strategy");
+
+    if constexpr (_pivot == Pivot::PARTIAL)
+        PartialPivotingStepRegister<_regElmIdxPiv>(iteration, regRowIdxPiv, size, matData, vecPermData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+template <U32 _regElmIdxPiv, U32 _regElmIdxSwp, typename _typeVecPerm>
+void PivotDenseSIMDX<_registerType, _size>::SwapRowPivotLoop(U32 iteration, U32 regRowIdxPiv, U32 regRowIdxSwp,
+                                                             U32 size, _registerType* matData,
+                                                             _typeVecPerm& vecPermData)
+{
+    using namespace GDL::simd;
+
+    constexpr bool dataIsVectorData = std::is_same<_typeVecPerm, _registerType*>::value;
+
+    const U32 numColRegisters = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const _registerType* matEnd = matData + SystemSize<_size>(size) * numColRegisters;
+
+    // Factorizations that store permutation data also swap the rows of the already processed columns. Otherwise, these
+    // rows only contain zeros and the swap can start at the current column.
+    U32 loopStartIdx = regRowIdxPiv;
+    if constexpr (dataIsVectorData)
+        loopStartIdx += iteration * numColRegisters;
+
+    if (regRowIdxPiv == regRowIdxSwp)
+    {
+        if constexpr (_regElmIdxPiv < _regElmIdxSwp)
+        {
+            for (_registerType* reg = matData + loopStartIdx; reg < matEnd; reg += numColRegisters)
+                *reg = Swap<_regElmIdxPiv, _regElmIdxSwp>(*reg);
+
+            if constexpr (dataIsVectorData)
+                vecPermData[regRowIdxPiv] = Swap<_regElmIdxPiv, _regElmIdxSwp>(vecPermData[regRowIdxPiv]);
+            else
+                vecPermData.AddPermutation(regRowIdxPiv, regRowIdxPiv,
+                                           &PermutationFunction<_regElmIdxPiv, _regElmIdxSwp, true>);
+        }
+        else
+            THROW("Internal index error - Probably singular matrix."); // LCOV_EXCL_LINE
+    }
+    else
+    {
+        DEV_EXCEPTION(regRowIdxSwp <= regRowIdxPiv,
+                      "Internal error. Pivot register has equal or lower index than current register");
+
+        U32 regDiff = regRowIdxSwp - regRowIdxPiv;
+
+        for (_registerType* reg = matData + loopStartIdx; reg < matEnd; reg += numColRegisters)
+            Exchange<_regElmIdxPiv, _regElmIdxSwp>(reg[0], reg[regDiff]);
+
+        if constexpr (dataIsVectorData)
+            Exchange<_regElmIdxPiv, _regElmIdxSwp>(vecPermData[regRowIdxPiv], vecPermData[regRowIdxSwp]);
+        else
+            vecPermData.AddPermutation(regRowIdxPiv, regRowIdxSwp,
+                                       &PermutationFunction<_regElmIdxPiv, _regElmIdxSwp, false>);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, U32 _size>
+template <U32 _regElmIdxPiv, U32 _regElmIdxSwp, typename _typeVecPerm>
+inline void PivotDenseSIMDX<_registerType, _size>::SwapRowPivot(U32 rowIdxSwp, U32 iteration, U32 regRowIdxPiv,
+                                                                U32 size, _registerType* matData,
+                                                                _typeVecPerm& vecPermData)
+{
+    // Static systems that are smaller than a register never swap with the rows of the unused register elements
+    constexpr U32 numCandidates = (_size != 0 && _size < numRegisterValues) ? _size : numRegisterValues;
+
+    static_assert(_regElmIdxSwp < numCandidates, "Register element index out of range.");
+
+    if (rowIdxSwp % numRegisterValues == _regElmIdxSwp)
+        SwapRowPivotLoop<_regElmIdxPiv, _regElmIdxSwp>(iteration, regRowIdxPiv, rowIdxSwp / numRegisterValues, size,
+                                                       matData, vecPermData);
+    else if constexpr (_regElmIdxSwp + 1 < numCandidates)
+        SwapRowPivot<_regElmIdxPiv, _regElmIdxSwp + 1>(rowIdxSwp, iteration, regRowIdxPiv, size, matData,
+                                                       vecPermData);
+}
+
+
+
+} // namespace GDL::Solver
@@ -12,15 +12,18 @@ namespace GDL::Solver
 {
 
 
-//! @brief QR solver class for dense static systems
+//! @brief QR solver class for dense static systems. The factorization steps are shared with the solver for systems
+//! whose size is only known at runtime (see QRDenseSIMDX).
 //! @tparam _registerType: Register type
-//! @tparam _size: Size of the linear system
+//! @tparam _rows: Number of rows
+//! @tparam _cols: Number of columns
 //! @tparam _pivot: Enum to select the pivoting strategy
 template <typename _registerType, U32 _rows, U32 _cols, Pivot _pivot>
 class QRDenseSIMD
 {
+    static_assert(_rows == _cols, "Only square systems are supported.");
+
     static constexpr U32 alignment = simd::alignmentBytes<_registerType>;
-    static constexpr U32 numRegisterValues = simd::numRegisterValues<_registerType>;
     static constexpr U32 numRegistersPerCol = simd::CalcMinNumArrayRegisters<_registerType>(_rows);
 
 
@@ -38,62 +41,14 @@ public:
 
         using PermutationDataArray = typename PivotDenseSSE<_registerType, _rows>::VectorPermutationDataArray;
 
-
-        //! @brief Helper struct that is used inside of a union
-        struct RData
-        {
-            VectorDataArray Offset;
-            MatrixDataArray R;
-        };
-
-        //! @brief Helper struct that is used inside of a union
-        struct VData
-        {
-            MatrixDataArray V;
-            VectorDataArray Offset;
-        };
-
-        using VRDataArray = std::array<_registerType, numRegistersPerCol*(_cols + 1)>;
-
-        //! Union that stores the data of Q and R as compact as possible
-        union alignas(alignment) VRData
-        {
-            VData mVData;
-            RData mRData;
-            VRDataArray mVR;
-
-            //! @brief ctor
-            //! @param dataQ: Data that should initialize Q
-            VRData(const MatrixDataArray& dataQ);
-        };
-
-
-        VRData mVR;
+        alignas(alignment) MatrixDataArray mQR;
+        std::array<ValueType, _rows - 1> mReflectionPivValues;
         PermutationDataArray mPermutationData;
 
+
         //! @brief ctor
         //! @param matrixData: Data of the matrix that should be factorized
         Factorization(const MatrixDataArray& matrixData);
-
-        //! @brief Returns a reference to V
-        //! @return Reference to V
-        MatrixDataArray& GetV();
-
-        //! @brief Returns a reference to V
-        //! @return Reference to V
-        const MatrixDataArray& GetV() const;
-
-        //! @brief Returns a reference to R
-        //! @return Reference to R
-        MatrixDataArray& GetR();
-
-        //! @brief Returns a reference to R
-        //! @return Reference to R
-        const MatrixDataArray& GetR() const;
-
-        //! @brief Returns a reference to the internal data array
-        //! @return Reference to the internal data array
-        VRDataArray& GetVR();
     };
 
 
@@ -109,35 +64,6 @@ public:
     //! @return Result vector x
     [[nodiscard]] inline static VectorDataArray Solve(const Factorization& factorization,
                                                       const VectorDataArray& rhsData);
-
-private:
-    template <U32 _regValueIdx>
-    static inline _registerType CalculateSquareSum(U32 regRowIdx, U32 colStartIdx, MatrixDataArray& R);
-
-    //! @brief Performs a single factorization step
-    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
-    //! @param iteration: Iteration number of the factorization procedure
-    //! @param regRowIdx: Row index of the register that contains the current active row
-    //! @param V: Matrix that stores the Householder reflections.
-    //! @param R: Matrix R
-    template <U32 _regValueIdx>
-    static inline void FactorizationStep(U32 iteration, U32 regRowIdx, MatrixDataArray& V, MatrixDataArray& R);
-
-    template <UST _start, UST _end>
-    static inline void BroadcastValues(_registerType values, std::array<_registerType, numRegisterValues>& broadcasted);
-
-    template <UST _start, UST _end>
-    static inline void SetZeroAboveMainDiagonal(std::array<_registerType, numRegisterValues>& V);
-
-    //! @brief Performs multiple factorization steps using template recursion
-    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
-    //! @tparam _maxRecursionDepth: Maximum number of template recursions
-    //! @param regRowIdx: Row index of the register that contains the current active row
-    //! @param factorization: Matrix factorization
-    template <U32 _regValueIdx = 0, U32 _maxRecursionDepth = numRegisterValues>
-    static inline void FactorizationSteps(U32 regRowIdx, MatrixDataArray& V, MatrixDataArray& R);
-
-    static inline void MultiplyWithTransposedQ(const MatrixDataArray& V, VectorDataArray& vectorData);
 };
 
 
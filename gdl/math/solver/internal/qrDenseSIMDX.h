@@ -0,0 +1,181 @@
+#pragma once
+
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/utility.h"
+#include "gdl/math/solver/internal/pivotDenseSIMDX.h"
+#include "gdl/math/solver/pivotEnum.h"
+
+
+namespace GDL::Solver
+{
+
+
+//! @brief QR solver class for dense systems. The normalized Householder vectors are stored below the main diagonal of
+//! R, like the lower triangular matrix of a LU factorization. Their values on the main diagonal are stored separately.
+//! All loop boundaries depend on the passed system size, so that it can be used for systems whose size is only known at
+//! runtime. The solver of statically sized systems uses the same functions (see QRDenseSIMD).
+//! @tparam _registerType: Register type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @tparam _size: Size of the linear system if it is known at compile time, 0 otherwise
+template <typename _registerType, Pivot _pivot, U32 _size = 0>
+class QRDenseSIMDX
+{
+    template <typename, U32, U32, Pivot>
+    friend class QRDenseSIMD;
+
+
+    static constexpr U32 alignment = simd::alignmentBytes<_registerType>;
+    static constexpr U32 numRegisterValues = simd::numRegisterValues<_registerType>;
+
+
+    using DataArray = Vector<_registerType>;
+    using ValueType = decltype(simd::GetDataType<_registerType>());
+    using VectorPermutationData = typename PivotDenseSIMDX<_registerType, _size>::VectorPermutationData;
+
+    QRDenseSIMDX() = delete;
+
+public:
+    //! @brief Class that stores the QR factorization and the permutations
+    class Factorization
+    {
+        friend class QRDenseSIMDX;
+
+        using PermutationDataArray = typename PivotDenseSIMDX<_registerType, _size>::VectorPermutationDataArray;
+
+        U32 mSize;
+        U32 mNumRegistersPerCol;
+        DataArray mQR;
+        Vector<ValueType> mReflectionPivValues;
+        PermutationDataArray mPermutationData;
+
+
+        //! @brief ctor
+        //! @param size: Size of the linear system
+        //! @param matrixData: Data of the matrix that should be factorized
+        Factorization(U32 size, const DataArray& matrixData);
+    };
+
+
+
+    //! @brief Calculates the QR factorization and returns it
+    //! @param size: Size of the linear system
+    //! @param matrixData: Data of the matrix that should be factorized
+    //! @return QR factorization
+    [[nodiscard]] static inline Factorization Factorize(U32 size, const DataArray& matrixData);
+
+    //! @brief Solves the linear system A * x = r
+    //! @param factorization: Matrix factorization
+    //! @param rhsData: Data of the right-hand side vector
+    //! @return Result vector x
+    [[nodiscard]] inline static DataArray Solve(const Factorization& factorization, const DataArray& rhsData);
+
+private:
+    //! @brief Applies a Householder reflection H = I - 2 * w * w^T to a column
+    //! @param reflection: Register of w that contains the current active row. Values above the active row must be 0.
+    //! @param w: Pointer to the register of the factorization that contains the current active row. The following
+    //! registers store the remaining values of w.
+    //! @param numRegisters: Number of registers from the current active row to the end of the column
+    //! @param col: Pointer to the register of the column that contains the current active row
+    static inline void ApplyReflection(_registerType reflection, const _registerType* w, U32 numRegisters,
+                                       _registerType* col);
+
+    //! @brief Calculates the QR factorization of the passed matrix data in place
+    //! @tparam _typePermData: Type of the permutation data. It must provide an AddPermutation function.
+    //! @param size: Size of the linear system
+    //! @param qr: Matrix data (column major ordering). The data is overwritten with the factorization.
+    //! @param reflectionPivValues: Values of the Householder vectors on the main diagonal. Its size must be at least
+    //! the system size minus 1.
+    //! @param permutationData: Permutation data
+    template <typename _typePermData>
+    static inline void FactorizeInPlace(U32 size, _registerType* qr, ValueType* reflectionPivValues,
+                                        _typePermData& permutationData);
+
+    //! @brief Performs a single factorization step
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
+    //! @param iteration: Iteration number of the factorization procedure
+    //! @param regRowIdx: Row index of the register that contains the current active row
+    //! @param size: Size of the linear system
+    //! @param qr: Data of the QR decomposition
+    //! @param reflectionPivValues: Values of the Householder vectors on the main diagonal
+    template <U32 _regValueIdx>
+    static inline void FactorizationStep(U32 iteration, U32 regRowIdx, U32 size, _registerType* qr,
+                                         ValueType* reflectionPivValues);
+
+    //! @brief Performs multiple factorization steps using template recursion
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
+    //! @tparam _maxRecursionDepth: Maximum number of template recursions. If the system size is known at compile time,
+    //! it must be equal to the number of steps. The steps are then unrolled without any runtime checks.
+    //! @tparam _typePermData: Type of the permutation data. It must provide an AddPermutation function.
+    //! @param regRowIdx: Row index of the register that contains the current active row
+    //! @param numSteps: Number of steps that should be performed
+    //! @param size: Size of the linear system
+    //! @param qr: Data of the QR decomposition
+    //! @param reflectionPivValues: Values of the Householder vectors on the main diagonal
+    //! @param permutationData: Permutation data
+    template <U32 _regValueIdx = 0, U32 _maxRecursionDepth = numRegisterValues, typename _typePermData>
+    static inline void FactorizationSteps(U32 regRowIdx, U32 numSteps, U32 size, _registerType* qr,
+                                          ValueType* reflectionPivValues, _typePermData& permutationData);
+
+    //! @brief Returns the value of the factorization in the last row and column
+    //! @param size: Size of the linear system
+    //! @param qr: Data of the QR decomposition
+    //! @return Value of the factorization in the last row and column
+    static inline ValueType GetLastPivotValue(U32 size, const _registerType* qr);
+
+    //! @brief Returns the register of a Householder vector that contains the current active row. The value of the
+    //! active row is set to the passed value and all values above are set to 0.
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
+    //! @param reg: Register of the factorization that contains the current active row
+    //! @param pivValue: Value of the Householder vector in the active row
+    //! @return Register of the Householder vector
+    template <U32 _regValueIdx>
+    static inline _registerType GetReflectionRegister(_registerType reg, ValueType pivValue);
+
+    //! @brief Multiplies the vector with the transpose of Q
+    //! @param size: Size of the linear system
+    //! @param qr: Data of the QR decomposition
+    //! @param reflectionPivValues: Values of the Householder vectors on the main diagonal
+    //! @param rhsData: Vector data. The passed data is overwritten with the result.
+    static inline void MultiplyWithTransposedQ(U32 size, const _registerType* qr, const ValueType* reflectionPivValues,
+                                               _registerType* rhsData);
+
+    //! @brief Applies multiple Householder reflections to a vector using template recursion
+    //! @tparam _regValueIdx: Specifies the current active rows position inside of its corresponding register
+    //! @tparam _maxRecursionDepth: Maximum number of template recursions. If the system size is known at compile time,
+    //! it must be equal to the number of steps. The steps are then unrolled without any runtime checks.
+    //! @param regRowIdx: Row index of the register that contains the current active row
+    //! @param numSteps: Number of steps that should be performed
+    //! @param size: Size of the linear system
+    //! @param qr: Data of the QR decomposition
+    //! @param reflectionPivValues: Values of the Householder vectors on the main diagonal
+    //! @param rhsData: Vector data. The passed data is overwritten with the result.
+    template <U32 _regValueIdx = 0, U32 _maxRecursionDepth = numRegisterValues>
+    static inline void MultiplyWithTransposedQSteps(U32 regRowIdx, U32 numSteps, U32 size, const _registerType* qr,
+                                                    const ValueType* reflectionPivValues, _registerType* rhsData);
+
+    //! @brief Solves the linear system A * x = r using the passed factorization data. The result is written into the
+    //! passed vector data
+    //! @param size: Size of the linear system
+    //! @param qr: Data of the QR decomposition
+    //! @param reflectionPivValues: Values of the Householder vectors on the main diagonal
+    //! @param permutations: Pointer to the first permutation
+    //! @param numPermutations: Number of permutations
+    //! @param rhsData: Data of the right-hand side vector. The passed data is overwritten with the result.
+    static inline void SolveInPlace(U32 size, const _registerType* qr, const ValueType* reflectionPivValues,
+                                    const VectorPermutationData* permutations, U32 numPermutations,
+                                    _registerType* rhsData);
+
+    //! @brief Sets the unused values of the last register of each column to zero. The reflections are calculated from
+    //! all values of a column.
+    //! @param size: Size of the linear system
+    //! @param qr: Matrix data (column major ordering)
+    static inline void ZeroUnusedValues(U32 size, _registerType* qr);
+};
+
+
+
+} // namespace GDL::Solver
+
+
+#include "gdl/math/solver/internal/qrDenseSIMDX.inl"
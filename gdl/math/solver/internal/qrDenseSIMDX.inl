@@ -0,0 +1,347 @@
+#pragma once
+
+#include "gdl/math/solver/internal/qrDenseSIMDX.h"
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/base/simd/registerSum.h"
+#include "gdl/base/simd/swizzle.h"
+#include "gdl/math/solver/internal/backwardSubstitutionDenseSIMDX.h"
+#include "gdl/math/solver/internal/systemSize.h"
+
+#include <array>
+#include <cmath>
+
+
+
+namespace GDL::Solver
+{
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline QRDenseSIMDX<_registerType, _pivot, _size>::Factorization::Factorization(U32 size,
+                                                                               const DataArray& matrixData)
+    : mSize{size}
+    , mNumRegistersPerCol{simd::CalcMinNumArrayRegisters<_registerType>(size)}
+    , mQR{matrixData}
+    , mReflectionPivValues(size - 1)
+{
+    DEV_EXCEPTION(mQR.size() != static_cast<size_t>(mSize) * mNumRegistersPerCol,
+                  "Size of the matrix data doesn't match the system size.");
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+[[nodiscard]] inline typename QRDenseSIMDX<_registerType, _pivot, _size>::Factorization
+QRDenseSIMDX<_registerType, _pivot, _size>::Factorize(U32 size, const DataArray& matrixData)
+{
+    DEV_EXCEPTION(size == 0, "Can't factorize an empty system.");
+
+    Factorization factorization(size, matrixData);
+    FactorizeInPlace(size, factorization.mQR.data(), factorization.mReflectionPivValues.data(),
+                     factorization.mPermutationData);
+
+    return factorization;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline typename QRDenseSIMDX<_registerType, _pivot, _size>::DataArray
+QRDenseSIMDX<_registerType, _pivot, _size>::Solve(const Factorization& factorization, const DataArray& rhsData)
+{
+    DEV_EXCEPTION(rhsData.size() != factorization.mNumRegistersPerCol,
+                  "Size of the vector data doesn't match the system size.");
+
+    const auto& permutations = factorization.mPermutationData.mPermutations;
+
+    DataArray vectorData = rhsData;
+    SolveInPlace(factorization.mSize, factorization.mQR.data(), factorization.mReflectionPivValues.data(),
+                 permutations.data(), static_cast<U32>(permutations.size()), vectorData.data());
+
+    return vectorData;
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::ApplyReflection(_registerType reflection,
+                                                                        const _registerType* w, U32 numRegisters,
+                                                                        _registerType* col)
+{
+    using namespace GDL::simd;
+
+    _registerType dot = _mm_mul(reflection, col[0]);
+    for (U32 i = 1; i < numRegisters; ++i)
+        dot = _mm_fmadd(w[i], col[i], dot);
+
+    const _registerType dotSum = RegisterSum(dot);
+    const _registerType scaledDot = _mm_add(dotSum, dotSum);
+
+    col[0] = _mm_fnmadd(scaledDot, reflection, col[0]);
+    for (U32 i = 1; i < numRegisters; ++i)
+        col[i] = _mm_fnmadd(scaledDot, w[i], col[i]);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <typename _typePermData>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::FactorizeInPlace(U32 size, _registerType* qr,
+                                                                         ValueType* reflectionPivValues,
+                                                                         _typePermData& permutationData)
+{
+    const U32 systemSize = SystemSize<_size>(size);
+    const U32 numFullRegistersPerCol = (systemSize - 1) / numRegisterValues;
+    const U32 numNonFullRegValues = (systemSize - 1) % numRegisterValues;
+
+    ZeroUnusedValues(size, qr);
+
+    for (U32 i = 0; i < numFullRegistersPerCol; ++i)
+        FactorizationSteps(i, numRegisterValues, size, qr, reflectionPivValues, permutationData);
+
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numStaticNonFullRegValues = (_size - 1) % numRegisterValues;
+        if constexpr (numStaticNonFullRegValues != 0)
+            FactorizationSteps<0, numStaticNonFullRegValues>(numFullRegistersPerCol, numStaticNonFullRegValues, size,
+                                                             qr, reflectionPivValues, permutationData);
+    }
+    else if (numNonFullRegValues != 0)
+        FactorizationSteps(numFullRegistersPerCol, numNonFullRegValues, size, qr, reflectionPivValues,
+                           permutationData);
+
+
+    DEV_EXCEPTION(GetLastPivotValue(size, qr) == ApproxZero<ValueType>(1, 100),
+                  "Can't solve system - Singular matrix or inappropriate pivoting strategy.");
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::FactorizationStep(U32 iteration, U32 regRowIdx, U32 size,
+                                                                          _registerType* qr,
+                                                                          ValueType* reflectionPivValues)
+{
+    using namespace GDL::simd;
+
+    const U32 numRegistersPerCol = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    _registerType* actCol = qr + iteration * numRegistersPerCol + regRowIdx;
+    const U32 numActColRegisters = numRegistersPerCol - regRowIdx;
+    const _registerType* qrEnd = qr + SystemSize<_size>(size) * numRegistersPerCol;
+
+    const ValueType pivValue = GetValue<_regValueIdx>(actCol[0]);
+
+    DEV_EXCEPTION(pivValue == ApproxZero<ValueType>(1, 100),
+                  "Can't solve system - Singular matrix or inappropriate pivoting strategy.");
+
+
+    // Calculate the normalized reflection vector that maps the active part of the column to the main diagonal
+    const _registerType activeValues = BlendAboveIndex<_regValueIdx>(actCol[0], _mm_setzero<_registerType>());
+
+    _registerType squareSum = _mm_mul(activeValues, activeValues);
+    for (U32 i = 1; i < numActColRegisters; ++i)
+        squareSum = _mm_fmadd(actCol[i], actCol[i], squareSum);
+
+    // The squared norm of the reflection vector w = x + sign(x_piv) * |x| * e_piv is 2 * (|x|^2 + |x_piv| * |x|)
+    const ValueType colSignedNorm = std::copysign(std::sqrt(GetValue<0>(RegisterSum(squareSum))), pivValue);
+    const ValueType reflectionPivValue = pivValue + colSignedNorm;
+    const _registerType reflectionNorm =
+            _mm_set1<_registerType>(1 / std::sqrt(2 * colSignedNorm * reflectionPivValue));
+
+    actCol[0] = BlendIndex<_regValueIdx>(BlendBelowIndex<_regValueIdx>(actCol[0], _mm_mul(reflectionNorm, actCol[0])),
+                                         _mm_set1<_registerType>(-colSignedNorm));
+    for (U32 i = 1; i < numActColRegisters; ++i)
+        actCol[i] = _mm_mul(reflectionNorm, actCol[i]);
+
+    reflectionPivValues[iteration] = reflectionPivValue * GetValue<0>(reflectionNorm);
+
+
+    // Apply the reflection to the remaining columns
+    const _registerType reflection = GetReflectionRegister<_regValueIdx>(actCol[0], reflectionPivValues[iteration]);
+
+    for (_registerType* col = actCol + numRegistersPerCol; col < qrEnd; col += numRegistersPerCol)
+        ApplyReflection(reflection, actCol, numActColRegisters, col);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx, U32 _maxRecursionDepth, typename _typePermData>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::FactorizationSteps(U32 regRowIdx, U32 numSteps, U32 size,
+                                                                           _registerType* qr,
+                                                                           ValueType* reflectionPivValues,
+                                                                           _typePermData& permutationData)
+{
+    const U32 iteration = regRowIdx * numRegisterValues + _regValueIdx;
+
+    // The row swaps include the stored reflections of the previous iterations. This way, all permutations can be
+    // applied to the right-hand side vector before the reflections.
+    if constexpr (_pivot != Pivot::NONE)
+        PivotDenseSIMDX<_registerType, _size>::template PivotingStepRegister<_regValueIdx, _pivot>(
+                iteration, regRowIdx, size, qr, permutationData);
+
+    FactorizationStep<_regValueIdx>(iteration, regRowIdx, size, qr, reflectionPivValues);
+
+    if constexpr (_regValueIdx + 1 < _maxRecursionDepth)
+        if (_size != 0 || _regValueIdx + 1 < numSteps)
+            FactorizationSteps<_regValueIdx + 1, _maxRecursionDepth>(regRowIdx, numSteps, size, qr,
+                                                                     reflectionPivValues, permutationData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline typename QRDenseSIMDX<_registerType, _pivot, _size>::ValueType
+QRDenseSIMDX<_registerType, _pivot, _size>::GetLastPivotValue(U32 size, const _registerType* qr)
+{
+    const U32 numRegistersPerCol = simd::CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const _registerType lastRegister = qr[SystemSize<_size>(size) * numRegistersPerCol - 1];
+
+    if constexpr (_size != 0)
+        return simd::GetValue<(_size - 1) % numRegisterValues>(lastRegister);
+    else
+        return simd::GetValue(lastRegister, (size - 1) % numRegisterValues);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx>
+inline _registerType QRDenseSIMDX<_registerType, _pivot, _size>::GetReflectionRegister(_registerType reg,
+                                                                                      ValueType pivValue)
+{
+    using namespace GDL::simd;
+
+    return BlendIndex<_regValueIdx>(BlendBelowIndex<_regValueIdx>(_mm_setzero<_registerType>(), reg),
+                                    _mm_set1<_registerType>(pivValue));
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::MultiplyWithTransposedQ(U32 size, const _registerType* qr,
+                                                                                const ValueType* reflectionPivValues,
+                                                                                _registerType* rhsData)
+{
+    const U32 numFullRegistersPerCol = (SystemSize<_size>(size) - 1) / numRegisterValues;
+    const U32 numNonFullRegValues = (SystemSize<_size>(size) - 1) % numRegisterValues;
+
+    for (U32 i = 0; i < numFullRegistersPerCol; ++i)
+        MultiplyWithTransposedQSteps(i, numRegisterValues, size, qr, reflectionPivValues, rhsData);
+
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numStaticNonFullRegValues = (_size - 1) % numRegisterValues;
+        if constexpr (numStaticNonFullRegValues != 0)
+            MultiplyWithTransposedQSteps<0, numStaticNonFullRegValues>(
+                    numFullRegistersPerCol, numStaticNonFullRegValues, size, qr, reflectionPivValues, rhsData);
+    }
+    else if (numNonFullRegValues != 0)
+        MultiplyWithTransposedQSteps(numFullRegistersPerCol, numNonFullRegValues, size, qr, reflectionPivValues,
+                                     rhsData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+template <U32 _regValueIdx, U32 _maxRecursionDepth>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::MultiplyWithTransposedQSteps(
+        U32 regRowIdx, U32 numSteps, U32 size, const _registerType* qr, const ValueType* reflectionPivValues,
+        _registerType* rhsData)
+{
+    const U32 numRegistersPerCol = simd::CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 iteration = regRowIdx * numRegisterValues + _regValueIdx;
+    const _registerType* w = qr + iteration * numRegistersPerCol + regRowIdx;
+
+    ApplyReflection(GetReflectionRegister<_regValueIdx>(w[0], reflectionPivValues[iteration]), w,
+                    numRegistersPerCol - regRowIdx, rhsData + regRowIdx);
+
+    if constexpr (_regValueIdx + 1 < _maxRecursionDepth)
+        if (_size != 0 || _regValueIdx + 1 < numSteps)
+            MultiplyWithTransposedQSteps<_regValueIdx + 1, _maxRecursionDepth>(regRowIdx, numSteps, size, qr,
+                                                                               reflectionPivValues, rhsData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::SolveInPlace(
+        U32 size, const _registerType* qr, const ValueType* reflectionPivValues,
+        [[maybe_unused]] const VectorPermutationData* permutations, [[maybe_unused]] U32 numPermutations,
+        _registerType* rhsData)
+{
+    if constexpr (_pivot != Pivot::NONE)
+        PivotDenseSIMDX<_registerType, _size>::PermuteVector(rhsData, permutations, numPermutations);
+
+    MultiplyWithTransposedQ(size, qr, reflectionPivValues, rhsData);
+    BackwardSubstitutionDenseSIMDX<_registerType, false, _size>::SolveInPlace(size, qr, rhsData);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType, Pivot _pivot, U32 _size>
+inline void QRDenseSIMDX<_registerType, _pivot, _size>::ZeroUnusedValues(U32 size, _registerType* qr)
+{
+    using namespace GDL::simd;
+
+    const U32 numRegistersPerCol = CalcMinNumArrayRegisters<_registerType>(SystemSize<_size>(size));
+    const U32 numNonFullRegValues = SystemSize<_size>(size) % numRegisterValues;
+    const _registerType* qrEnd = qr + SystemSize<_size>(size) * numRegistersPerCol;
+    const _registerType zero = _mm_setzero<_registerType>();
+
+    // For runtime sizes, the blend mask is created by comparing the lane indices with the number of used values.
+    if constexpr (_size != 0)
+    {
+        constexpr U32 numNonFullRegValuesStatic = _size % numRegisterValues;
+        if constexpr (numNonFullRegValuesStatic != 0)
+            for (_registerType* reg = qr + numRegistersPerCol - 1; reg < qrEnd; reg += numRegistersPerCol)
+                *reg = BlendBelowIndex<numNonFullRegValuesStatic - 1>(*reg, zero);
+    }
+    else if (numNonFullRegValues != 0)
+    {
+        alignas(alignment) std::array<ValueType, numRegisterValues> laneIndices;
+        for (U32 i = 0; i < numRegisterValues; ++i)
+            laneIndices[i] = static_cast<ValueType>(i);
+
+        const auto usedValues = _mm_cmplt(_mmx_load_p<_registerType>(laneIndices.data()),
+                                          _mm_set1<_registerType>(numNonFullRegValues));
+
+        for (_registerType* reg = qr + numRegistersPerCol - 1; reg < qrEnd; reg += numRegistersPerCol)
+            *reg = _mm_blendv(zero, *reg, usedValues);
+    }
+}
+
+
+
+} // namespace GDL::Solver
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+
+namespace GDL::Solver
+{
+
+
+//! @brief Returns the size of a linear system. The solver steps that are shared between statically and dynamically
+//! sized systems take the size as function parameter. If the size is known at compile time, the passed value is
+//! replaced by the template parameter. This way, the compiler can still specialize all loops of the static solvers,
+//! even if it decides to not inline the shared functions.
+//! @tparam _size: Size of the system if it is known at compile time, 0 otherwise
+//! @param size: Size of the system
+//! @return Size of the system
+template <U32 _size>
+[[nodiscard]] constexpr U32 SystemSize(U32 size);
+
+
+} // namespace GDL::Solver
+
+
+#include "gdl/math/solver/internal/systemSize.inl"
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "gdl/math/solver/internal/systemSize.h"
+
+
+namespace GDL::Solver
+{
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <U32 _size>
+constexpr U32 SystemSize([[maybe_unused]] U32 size)
+{
+    if constexpr (_size != 0)
+        return _size;
+    else
+        return size;
+}
+
+
+
+} // namespace GDL::Solver
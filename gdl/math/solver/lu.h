@@ -5,6 +5,7 @@
 #include "gdl/math/solver/pivotEnum.h"
 #include "gdl/math/solver/internal/luDenseSerial.h"
 #include "gdl/math/solver/internal/luDenseSIMD.h"
+#include "gdl/math/solver/internal/luDenseSIMDX.h"
 
 #include <array>
 
@@ -20,6 +21,10 @@ template <typename _type, U32, bool>
 class VecSerial;
 template <typename _type, U32, bool>
 class VecSIMD;
+template <typename _type>
+class MatX;
+template <typename _type>
+class VecX;
 
 namespace Solver
 {
@@ -34,6 +39,9 @@ template <Pivot _pivot, typename _type, U32 _size>
 using LUFactorizationSIMD =
         typename LUDenseSIMD<typename VecSIMD<_type, _size, true>::RegisterType, _size, _pivot>::Factorization;
 
+template <Pivot _pivot, typename _type>
+using LUFactorizationSIMDX = typename LUDenseSIMDX<typename VecX<_type>::RegisterType, _pivot>::Factorization;
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -105,6 +113,34 @@ template <Pivot _pivot = Pivot::PARTIAL, typename _type, U32 _size>
 
 
 
+//! @brief Solves the linear system A * x = r using LU decomposition. The size of the system is only known at runtime.
+//! @tparam _type: Data type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @param A: Matrix
+//! @param r: Vector
+//! @return Result vector x
+template <Pivot _pivot = Pivot::PARTIAL, typename _type>
+[[nodiscard]] VecX<_type> LU(const MatX<_type>& A, const VecX<_type>& r);
+
+//! @brief Solves the linear system A * x = r using LU decomposition. The size of the system is only known at runtime.
+//! @tparam _type: Data type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @param factorization: Factorization of A
+//! @param r: Vector
+//! @return Result vector x
+template <Pivot _pivot = Pivot::PARTIAL, typename _type>
+[[nodiscard]] VecX<_type> LU(const LUFactorizationSIMDX<_pivot, _type>& factorization, const VecX<_type>& r);
+
+//! @brief Calculates the LU decomposition of a matrix whose size is only known at runtime.
+//! @tparam _type: Data type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @param A: Matrix
+//! @return LU decomposition
+template <Pivot _pivot = Pivot::PARTIAL, typename _type>
+[[nodiscard]] LUFactorizationSIMDX<_pivot, _type> LUFactorization(const MatX<_type>& A);
+
+
+
 } // namespace Solver
 
 } // namespace GDL
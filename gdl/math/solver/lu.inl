@@ -4,8 +4,11 @@
 
 #include "gdl/math/serial/matSerial.h"
 #include "gdl/math/serial/vecSerial.h"
+#include "gdl/base/exception.h"
 #include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/matX.h"
 #include "gdl/math/simd/vecSIMD.h"
+#include "gdl/math/simd/vecX.h"
 
 
 //#include <cmath>
@@ -87,4 +90,45 @@ LUFactorizationSIMD<_pivot, _type, _size> LUFactorization(const MatSIMD<_type, _
     return LUSolver::Factorize(A.DataSSE());
 }
 
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Pivot _pivot, typename _type>
+VecX<_type> LU(const MatX<_type>& A, const VecX<_type>& r)
+{
+    EXCEPTION(A.Rows() != r.Size(), "Size of the matrix and the vector don't match.");
+
+    auto factorization = LUFactorization<_pivot, _type>(A);
+    return LU<_pivot, _type>(factorization, r);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Pivot _pivot, typename _type>
+[[nodiscard]] VecX<_type> LU(const LUFactorizationSIMDX<_pivot, _type>& factorization, const VecX<_type>& r)
+{
+    using RegisterType = typename VecX<_type>::RegisterType;
+    using LUSolver = LUDenseSIMDX<RegisterType, _pivot>;
+
+    return VecX<_type>(r.Size(), LUSolver::Solve(factorization, r.DataSSE()));
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Pivot _pivot, typename _type>
+LUFactorizationSIMDX<_pivot, _type> LUFactorization(const MatX<_type>& A)
+{
+    using RegisterType = typename MatX<_type>::RegisterType;
+    using LUSolver = LUDenseSIMDX<RegisterType, _pivot>;
+
+    EXCEPTION(A.Rows() != A.Cols(), "LU decomposition requires a square matrix.");
+
+    return LUSolver::Factorize(A.Rows(), A.DataSSE());
+}
+
 } // namespace GDL::Solver
@@ -5,6 +5,7 @@
 #include "gdl/math/solver/pivotEnum.h"
 #include "gdl/math/solver/internal/qrDenseSerial.h"
 #include "gdl/math/solver/internal/qrDenseSIMD.h"
+#include "gdl/math/solver/internal/qrDenseSIMDX.h"
 
 
 #include <array>
@@ -21,6 +22,10 @@ template <typename _type, U32, bool>
 class VecSerial;
 template <typename _type, U32, bool>
 class VecSIMD;
+template <typename _type>
+class MatX;
+template <typename _type>
+class VecX;
 
 namespace Solver
 {
@@ -35,6 +40,9 @@ template <Pivot _pivot, typename _type, U32 _rows, U32 _cols>
 using QRFactorizationSIMD =
         typename QRDenseSIMD<typename VecSIMD<_type, _rows, true>::RegisterType, _rows, _cols, _pivot>::Factorization;
 
+template <Pivot _pivot, typename _type>
+using QRFactorizationSIMDX = typename QRDenseSIMDX<typename VecX<_type>::RegisterType, _pivot>::Factorization;
+
 
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -113,6 +121,34 @@ template <Pivot _pivot = Pivot::PARTIAL, typename _type, U32 _rows, U32 _cols>
 
 
 
+//! @brief Solves the linear system A * x = r using QR decomposition. The size of the system is only known at runtime.
+//! @tparam _type: Data type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @param A: Matrix
+//! @param r: Vector
+//! @return Result vector x
+template <Pivot _pivot = Pivot::PARTIAL, typename _type>
+[[nodiscard]] VecX<_type> QR(const MatX<_type>& A, const VecX<_type>& r);
+
+//! @brief Solves the linear system A * x = r using QR decomposition. The size of the system is only known at runtime.
+//! @tparam _type: Data type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @param factorization: Factorization of A
+//! @param r: Vector
+//! @return Result vector x
+template <Pivot _pivot = Pivot::PARTIAL, typename _type>
+[[nodiscard]] VecX<_type> QR(const QRFactorizationSIMDX<_pivot, _type>& factorization, const VecX<_type>& r);
+
+//! @brief Calculates the QR decomposition of a matrix whose size is only known at runtime.
+//! @tparam _type: Data type
+//! @tparam _pivot: Enum to select the pivoting strategy
+//! @param A: Matrix
+//! @return QR decomposition
+template <Pivot _pivot = Pivot::PARTIAL, typename _type>
+[[nodiscard]] QRFactorizationSIMDX<_pivot, _type> QRFactorization(const MatX<_type>& A);
+
+
+
 } // namespace Solver
 
 } // namespace GDL
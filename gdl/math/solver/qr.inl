@@ -2,10 +2,13 @@
 
 #include "gdl/math/solver/qr.h"
 
+#include "gdl/base/exception.h"
 #include "gdl/math/serial/matSerial.h"
 #include "gdl/math/serial/vecSerial.h"
 #include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/matX.h"
 #include "gdl/math/simd/vecSIMD.h"
+#include "gdl/math/simd/vecX.h"
 
 
 //#include <cmath>
@@ -89,4 +92,45 @@ QRFactorizationSIMD<_pivot, _type, _rows, _cols> QRFactorization(const MatSIMD<_
 
 
 
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Pivot _pivot, typename _type>
+VecX<_type> QR(const MatX<_type>& A, const VecX<_type>& r)
+{
+    EXCEPTION(A.Rows() != r.Size(), "Size of the matrix and the vector don't match.");
+
+    auto factorization = QRFactorization<_pivot, _type>(A);
+    return QR<_pivot, _type>(factorization, r);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Pivot _pivot, typename _type>
+[[nodiscard]] VecX<_type> QR(const QRFactorizationSIMDX<_pivot, _type>& factorization, const VecX<_type>& r)
+{
+    using RegisterType = typename VecX<_type>::RegisterType;
+    using QRSolver = QRDenseSIMDX<RegisterType, _pivot>;
+
+    return VecX<_type>(r.Size(), QRSolver::Solve(factorization, r.DataSSE()));
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <Pivot _pivot, typename _type>
+QRFactorizationSIMDX<_pivot, _type> QRFactorization(const MatX<_type>& A)
+{
+    using RegisterType = typename MatX<_type>::RegisterType;
+    using QRSolver = QRDenseSIMDX<RegisterType, _pivot>;
+
+    EXCEPTION(A.Rows() != A.Cols(), "QR decomposition requires a square matrix.");
+
+    return QRSolver::Factorize(A.Rows(), A.DataSSE());
+}
+
+
+
 } // namespace GDL::Solver
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/container/deque.h"
+#include "gdl/resources/cpu/mpmcRingBuffer.h"
+#include "gdl/resources/cpu/spinlock.h"
+
+#include <atomic>
+#include <type_traits>
+
+
+namespace GDL
+{
+
+//! @brief Defines what happens if a task is submitted to a full bounded thread pool queue
+enum class OverflowPolicy
+{
+    BLOCK, //!< The submitting thread executes tasks of the same queue until there is free space
+    SPILL, //!< The task is stored in an unbounded, lock protected overflow list
+    INLINE //!< The task is executed immediately by the submitting thread
+};
+
+
+
+//! @brief Bounded, lock-free thread pool queue. It can be used as alternative to the ThreadPoolQueue by passing it as
+//! queue type to the thread pool.
+//! @tparam _type: Value type. Must be nothrow move constructible.
+//! @tparam _capacity: Capacity of the lock-free ring buffer. Must be a power of 2.
+//! @tparam _overflowPolicy: Defines what happens if the ring buffer is full. Only the SPILL policy is handled by the
+//! queue itself. The other policies are handled by the thread pool, since they need to execute tasks.
+//! @remark Values that were spilled into the overflow list are only fetched if the ring buffer is empty. Therefore,
+//! the FIFO order is not preserved while the ring buffer is full.
+template <typename _type, U64 _capacity = 1024, OverflowPolicy _overflowPolicy = OverflowPolicy::BLOCK>
+class BoundedThreadPoolQueue
+{
+    MPMCRingBuffer<_type> mRingBuffer;
+    mutable SpinLock mSpinLockOverflow;
+    std::atomic<U64> mNumOverflowValues;
+    Deque<_type> mOverflow;
+
+public:
+    static constexpr OverflowPolicy Overflow = _overflowPolicy;
+
+    BoundedThreadPoolQueue();
+    BoundedThreadPoolQueue(const BoundedThreadPoolQueue&) = delete;
+    BoundedThreadPoolQueue(BoundedThreadPoolQueue&&) = delete;
+    BoundedThreadPoolQueue& operator=(const BoundedThreadPoolQueue&) = delete;
+    BoundedThreadPoolQueue& operator=(BoundedThreadPoolQueue&&) = delete;
+    ~BoundedThreadPoolQueue() = default;
+
+    //! @brief Tries to push a new value into the queue
+    //! @param value: New value. It is only moved if the operation is successful.
+    //! @return TRUE if the operation was successful, FALSE if the queue is full. Always TRUE if the overflow policy is
+    //! SPILL.
+    bool TryPush(_type&& value);
+
+    //! @brief Tries to get the next value of the queue
+    //! @param out: reference to a variable that stores fetched value
+    //! @return TRUE if the operation was successful, FALSE if not
+    bool TryPop(_type& out);
+
+    //! @brief Gets the capacity of the ring buffer
+    //! @return Capacity of the ring buffer
+    U64 GetCapacity() const;
+
+    //! @brief Gets the number of values in the overflow list
+    //! @return Number of values in the overflow list
+    U64 GetNumOverflowValues() const;
+
+    //! @brief Returns if the queue is empty or not
+    //! @return TRUE if the queue is empty, FALSE if not
+    //! @remark The result is only exact if no other thread modifies the queue at the same time
+    bool IsEmpty() const;
+
+    //! @brief Gets the approximate size of the queue, including the overflow list
+    //! @return Size
+    //! @remark The result is only exact if no other thread modifies the queue at the same time
+    U64 GetSize() const;
+};
+
+
+
+//! @brief Type trait that checks if a type is a BoundedThreadPoolQueue
+//! @tparam _type: Type that should be checked
+template <typename _type>
+struct IsBoundedThreadPoolQueue : std::false_type
+{
+};
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+struct IsBoundedThreadPoolQueue<BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>> : std::true_type
+{
+};
+
+} // namespace GDL
+
+#include "gdl/resources/cpu/boundedThreadPoolQueue.inl"
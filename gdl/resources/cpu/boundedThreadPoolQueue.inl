@@ -0,0 +1,97 @@
+#pragma once
+
+#include "gdl/resources/cpu/boundedThreadPoolQueue.h"
+
+#include <mutex>
+#include <utility>
+
+
+namespace GDL
+{
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>::BoundedThreadPoolQueue()
+    : mRingBuffer{_capacity}
+    , mSpinLockOverflow{}
+    , mNumOverflowValues{0}
+    , mOverflow{}
+{
+}
+
+
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+bool BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>::TryPush(_type&& value)
+{
+    if (mRingBuffer.TryPush(std::move(value)))
+        return true;
+
+    if constexpr (_overflowPolicy == OverflowPolicy::SPILL)
+    {
+        std::lock_guard<SpinLock> lock(mSpinLockOverflow);
+        mOverflow.push_back(std::move(value));
+        mNumOverflowValues.fetch_add(1, std::memory_order_release);
+        return true;
+    }
+    else
+        return false;
+}
+
+
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+bool BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>::TryPop(_type& out)
+{
+    if (mRingBuffer.TryPop(out))
+        return true;
+
+    if constexpr (_overflowPolicy == OverflowPolicy::SPILL)
+    {
+        if (mNumOverflowValues.load(std::memory_order_acquire) == 0)
+            return false;
+
+        std::lock_guard<SpinLock> lock(mSpinLockOverflow);
+        if (mOverflow.empty())
+            return false;
+        out = std::move(mOverflow.front());
+        mOverflow.pop_front();
+        mNumOverflowValues.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    else
+        return false;
+}
+
+
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+U64 BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>::GetCapacity() const
+{
+    return mRingBuffer.GetCapacity();
+}
+
+
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+U64 BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>::GetNumOverflowValues() const
+{
+    return mNumOverflowValues.load(std::memory_order_relaxed);
+}
+
+
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+bool BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>::IsEmpty() const
+{
+    return GetSize() == 0;
+}
+
+
+
+template <typename _type, U64 _capacity, OverflowPolicy _overflowPolicy>
+U64 BoundedThreadPoolQueue<_type, _capacity, _overflowPolicy>::GetSize() const
+{
+    return mRingBuffer.GetSize() + GetNumOverflowValues();
+}
+
+} // namespace GDL
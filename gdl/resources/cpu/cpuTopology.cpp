@@ -0,0 +1,256 @@
+#include "gdl/resources/cpu/cpuTopology.h"
+
+#include "gdl/base/exception.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <thread>
+#include <utility>
+
+
+namespace GDL
+{
+
+//! @brief Reads the first line of a file
+//! @param path: Path of the file
+//! @param line: Reference to a string that stores the line
+//! @return TRUE if the file could be read, FALSE otherwise
+static bool ReadFirstLine(const std::filesystem::path& path, std::string& line)
+{
+    std::ifstream file(path);
+    return file.is_open() && std::getline(file, line) && !line.empty();
+}
+
+
+
+//! @brief Reads a single unsigned integer from a file
+//! @param path: Path of the file
+//! @param defaultValue: Value that is returned if the file could not be read or contains a negative number
+//! @return Value
+static U32 ReadValue(const std::filesystem::path& path, U32 defaultValue)
+{
+    std::string line;
+    if (!ReadFirstLine(path, line))
+        return defaultValue;
+    const I64 value = std::stoll(line);
+    return (value < 0) ? defaultValue : static_cast<U32>(value);
+}
+
+
+
+CpuTopology::CpuTopology(const std::string& sysfsPath)
+    : mCpus{}
+    , mNumCores{0}
+    , mNumNodes{0}
+    , mNumPackages{0}
+{
+    namespace fs = std::filesystem;
+    const fs::path cpuPath = fs::path(sysfsPath) / "cpu";
+    const fs::path nodePath = fs::path(sysfsPath) / "node";
+
+    std::string onlineCpus;
+    if (ReadFirstLine(cpuPath / "online", onlineCpus))
+        for (U32 cpu : ParseCpuList(onlineCpus))
+        {
+            const fs::path topologyPath = cpuPath / ("cpu" + std::to_string(cpu)) / "topology";
+            mCpus.push_back({cpu, ReadValue(topologyPath / "core_id", cpu),
+                             ReadValue(topologyPath / "physical_package_id", 0), 0});
+        }
+    else
+    {
+        const U32 numCpus = std::max(1u, std::thread::hardware_concurrency());
+        for (U32 cpu = 0; cpu < numCpus; ++cpu)
+            mCpus.push_back({cpu, cpu, 0, 0});
+    }
+
+    std::error_code errorCode;
+    if (fs::is_directory(nodePath, errorCode))
+        for (const auto& entry : fs::directory_iterator(nodePath, errorCode))
+        {
+            const std::string name = entry.path().filename().string();
+            std::string cpuList;
+            if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+                !std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; }) ||
+                !ReadFirstLine(entry.path() / "cpulist", cpuList))
+                continue;
+
+            const U32 nodeId = static_cast<U32>(std::stoul(name.substr(4)));
+            for (U32 cpu : ParseCpuList(cpuList))
+                for (auto& cpuInfo : mCpus)
+                    if (cpuInfo.mId == cpu)
+                        cpuInfo.mNodeId = nodeId;
+        }
+
+    CountComponents();
+}
+
+
+
+const Vector<CpuInfo>& CpuTopology::GetCpus() const
+{
+    return mCpus;
+}
+
+
+
+Vector<Vector<U32>> CpuTopology::GetCpuSets(CpuSetGranularity granularity, bool interleaveNodes) const
+{
+    // Sets of each node in order of their first logical CPU
+    Vector<Vector<Vector<U32>>> nodeSets(mNumNodes);
+    std::map<std::pair<U32, U32>, std::pair<U32, U32>> coreSetIndices;
+
+    for (const auto& cpu : mCpus)
+    {
+        auto& sets = nodeSets[cpu.mNodeId];
+        switch (granularity)
+        {
+        case CpuSetGranularity::CPU:
+            sets.push_back({cpu.mId});
+            break;
+        case CpuSetGranularity::CORE:
+        {
+            const auto core = std::make_pair(cpu.mPackageId, cpu.mCoreId);
+            auto it = coreSetIndices.find(core);
+            if (it == coreSetIndices.end())
+            {
+                coreSetIndices.emplace(core, std::make_pair(cpu.mNodeId, static_cast<U32>(sets.size())));
+                sets.push_back({cpu.mId});
+            }
+            else
+                nodeSets[it->second.first][it->second.second].push_back(cpu.mId);
+            break;
+        }
+        case CpuSetGranularity::NODE:
+            if (sets.empty())
+                sets.emplace_back();
+            sets[0].push_back(cpu.mId);
+            break;
+        }
+    }
+
+    Vector<Vector<U32>> cpuSets;
+    if (interleaveNodes)
+    {
+        U32 maxNumSets = 0;
+        for (const auto& sets : nodeSets)
+            maxNumSets = std::max(maxNumSets, static_cast<U32>(sets.size()));
+        for (U32 i = 0; i < maxNumSets; ++i)
+            for (auto& sets : nodeSets)
+                if (i < sets.size())
+                    cpuSets.push_back(std::move(sets[i]));
+    }
+    else
+        for (auto& sets : nodeSets)
+            for (auto& set : sets)
+                cpuSets.push_back(std::move(set));
+
+    return cpuSets;
+}
+
+
+
+Vector<U32> CpuTopology::GetCpusOfNode(U32 nodeId) const
+{
+    DEV_EXCEPTION(nodeId >= mNumNodes, "Invalid NUMA node id.");
+
+    Vector<U32> cpus;
+    for (const auto& cpu : mCpus)
+        if (cpu.mNodeId == nodeId)
+            cpus.push_back(cpu.mId);
+    return cpus;
+}
+
+
+
+U32 CpuTopology::GetNumCpus() const
+{
+    return static_cast<U32>(mCpus.size());
+}
+
+
+
+U32 CpuTopology::GetNumCores() const
+{
+    return mNumCores;
+}
+
+
+
+U32 CpuTopology::GetNumNodes() const
+{
+    return mNumNodes;
+}
+
+
+
+U32 CpuTopology::GetNumPackages() const
+{
+    return mNumPackages;
+}
+
+
+
+Vector<U32> CpuTopology::ParseCpuList(const std::string& cpuList)
+{
+    Vector<U32> cpus;
+    size_t position = 0;
+
+    while (position < cpuList.size())
+    {
+        size_t end = cpuList.find(',', position);
+        if (end == std::string::npos)
+            end = cpuList.size();
+
+        const std::string range = cpuList.substr(position, end - position);
+        const size_t dash = range.find('-');
+        try
+        {
+            const U32 first = static_cast<U32>(std::stoul(range.substr(0, dash)));
+            const U32 last = (dash == std::string::npos) ? first : static_cast<U32>(std::stoul(range.substr(dash + 1)));
+            EXCEPTION(last < first, "Invalid CPU list. Range end is smaller than its start.");
+            for (U32 cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+        }
+        catch (const std::logic_error&)
+        {
+            THROW("Invalid CPU list: " + cpuList);
+        }
+
+        position = end + 1;
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+
+
+void CpuTopology::CountComponents()
+{
+    // Nodes are renumbered consecutively, since node ids might have gaps
+    std::set<U32> nodeIds;
+    std::set<U32> packageIds;
+    std::set<std::pair<U32, U32>> coreIds;
+    for (const auto& cpu : mCpus)
+    {
+        nodeIds.insert(cpu.mNodeId);
+        packageIds.insert(cpu.mPackageId);
+        coreIds.insert(std::make_pair(cpu.mPackageId, cpu.mCoreId));
+    }
+
+    std::map<U32, U32> nodeIndices;
+    for (U32 nodeId : nodeIds)
+        nodeIndices.emplace(nodeId, static_cast<U32>(nodeIndices.size()));
+    for (auto& cpu : mCpus)
+        cpu.mNodeId = nodeIndices[cpu.mNodeId];
+
+    mNumCores = static_cast<U32>(coreIds.size());
+    mNumNodes = static_cast<U32>(nodeIds.size());
+    mNumPackages = static_cast<U32>(packageIds.size());
+}
+
+} // namespace GDL
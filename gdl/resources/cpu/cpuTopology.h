@@ -0,0 +1,96 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/container/vector.h"
+
+#include <string>
+
+
+namespace GDL
+{
+
+//! @brief Granularity of CPU sets that are created from a CPU topology
+enum class CpuSetGranularity
+{
+    CPU,  //!< One set per logical CPU
+    CORE, //!< One set per physical core containing all its hardware threads
+    NODE  //!< One set per NUMA node containing all its logical CPUs
+};
+
+
+
+//! @brief Topology information of a single logical CPU
+struct CpuInfo
+{
+    U32 mId;
+    U32 mCoreId;
+    U32 mPackageId;
+    U32 mNodeId;
+};
+
+
+
+//! @brief Describes the logical CPUs of the system, the physical cores and packages they belong to and their NUMA
+//! nodes. On Linux, the information is read from sysfs. If sysfs is not available, all logical CPUs reported by the
+//! standard library are treated as individual cores of a single NUMA node.
+class CpuTopology
+{
+    Vector<CpuInfo> mCpus;
+    U32 mNumCores;
+    U32 mNumNodes;
+    U32 mNumPackages;
+
+public:
+    //! @brief Reads the topology of the system
+    //! @param sysfsPath: Path to the sysfs system directory. Can be changed for testing purposes.
+    explicit CpuTopology(const std::string& sysfsPath = "/sys/devices/system");
+
+    CpuTopology(const CpuTopology&) = default;
+    CpuTopology(CpuTopology&&) = default;
+    CpuTopology& operator=(const CpuTopology&) = default;
+    CpuTopology& operator=(CpuTopology&&) = default;
+    ~CpuTopology() = default;
+
+    //! @brief Gets the information of all online logical CPUs ordered by their ids
+    //! @return Logical CPUs
+    const Vector<CpuInfo>& GetCpus() const;
+
+    //! @brief Gets sets of logical CPUs that can be used to pin threads
+    //! @param granularity: Defines which logical CPUs are grouped together
+    //! @param interleaveNodes: If TRUE, consecutive sets alternate between the NUMA nodes. Otherwise, all sets of a
+    //! node are listed before the ones of the next node.
+    //! @return CPU sets
+    Vector<Vector<U32>> GetCpuSets(CpuSetGranularity granularity, bool interleaveNodes = false) const;
+
+    //! @brief Gets the logical CPUs of a NUMA node
+    //! @param nodeId: Id of the NUMA node
+    //! @return Logical CPUs of the node
+    Vector<U32> GetCpusOfNode(U32 nodeId) const;
+
+    //! @brief Gets the number of logical CPUs
+    //! @return Number of logical CPUs
+    U32 GetNumCpus() const;
+
+    //! @brief Gets the number of physical cores
+    //! @return Number of physical cores
+    U32 GetNumCores() const;
+
+    //! @brief Gets the number of NUMA nodes
+    //! @return Number of NUMA nodes
+    U32 GetNumNodes() const;
+
+    //! @brief Gets the number of physical packages (sockets)
+    //! @return Number of physical packages
+    U32 GetNumPackages() const;
+
+    //! @brief Parses a Linux CPU list like "0-3,8,10-11"
+    //! @param cpuList: CPU list string
+    //! @return Logical CPU numbers
+    static Vector<U32> ParseCpuList(const std::string& cpuList);
+
+private:
+    //! @brief Counts the number of cores, nodes and packages and renumbers the nodes consecutively
+    void CountComponents();
+};
+
+} // namespace GDL
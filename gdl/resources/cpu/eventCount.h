@@ -0,0 +1,59 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+
+namespace GDL
+{
+
+//! @brief Event count that lets threads sleep until another thread signals that there might be new work. Waiting is a
+//! two step process to avoid lost wake-ups: A thread announces its intention to wait with PrepareWait, checks its
+//! wake-up condition again and either cancels or commits the wait. Notifications that are issued between both steps
+//! are not lost.
+//! @remark Notifying is cheap if no thread is waiting, since only an atomic counter needs to be checked. The mutex and
+//! the condition variable are only used if there are waiting threads.
+class EventCount
+{
+    std::atomic<U32> mEpoch;
+    std::atomic<U32> mNumWaiters;
+    std::mutex mMutex;
+    std::condition_variable mConditionVariable;
+
+public:
+    EventCount();
+    EventCount(const EventCount&) = delete;
+    EventCount(EventCount&&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+    EventCount& operator=(EventCount&&) = delete;
+    ~EventCount() = default;
+
+    //! @brief Cancels a prepared wait
+    void CancelWait();
+
+    //! @brief Gets the number of threads that are currently waiting or preparing to wait
+    //! @return Number of waiting threads
+    U32 GetNumWaiters() const;
+
+    //! @brief Wakes all waiting threads
+    void NotifyAll();
+
+    //! @brief Wakes a single waiting thread
+    void NotifyOne();
+
+    //! @brief Announces that the calling thread wants to wait. Afterwards, the wake-up condition must be checked again
+    //! before either Wait or CancelWait is called.
+    //! @return Key that must be passed to Wait
+    U32 PrepareWait();
+
+    //! @brief Blocks the calling thread until a notification was issued after the corresponding PrepareWait call
+    //! @param key: Key returned by PrepareWait
+    void Wait(U32 key);
+};
+
+} // namespace GDL
+
+#include "gdl/resources/cpu/eventCount.inl"
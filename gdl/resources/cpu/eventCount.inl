@@ -0,0 +1,83 @@
+#pragma once
+
+#include "gdl/resources/cpu/eventCount.h"
+
+
+namespace GDL
+{
+
+inline EventCount::EventCount()
+    : mEpoch{0}
+    , mNumWaiters{0}
+    , mMutex{}
+    , mConditionVariable{}
+{
+}
+
+
+
+inline void EventCount::CancelWait()
+{
+    mNumWaiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+
+
+inline U32 EventCount::GetNumWaiters() const
+{
+    return mNumWaiters.load(std::memory_order_relaxed);
+}
+
+
+
+inline void EventCount::NotifyAll()
+{
+    // Pairs with the fence in PrepareWait: Either the waiter sees the new state or we see the waiter
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mNumWaiters.load(std::memory_order_relaxed) == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEpoch.fetch_add(1, std::memory_order_relaxed);
+    }
+    mConditionVariable.notify_all();
+}
+
+
+
+inline void EventCount::NotifyOne()
+{
+    // Pairs with the fence in PrepareWait: Either the waiter sees the new state or we see the waiter
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mNumWaiters.load(std::memory_order_relaxed) == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEpoch.fetch_add(1, std::memory_order_relaxed);
+    }
+    mConditionVariable.notify_one();
+}
+
+
+
+inline U32 EventCount::PrepareWait()
+{
+    mNumWaiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return mEpoch.load(std::memory_order_relaxed);
+}
+
+
+
+inline void EventCount::Wait(U32 key)
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mConditionVariable.wait(lock, [this, key]() { return mEpoch.load(std::memory_order_relaxed) != key; });
+    }
+    mNumWaiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace GDL
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+
+namespace GDL
+{
+
+//! @brief Lock-free, bounded multi producer multi consumer FIFO queue. Every slot of the ring buffer has a sequence
+//! counter that tells producers and consumers if the slot is ready for them. Therefore, producers and consumers only
+//! compete for the enqueue or dequeue position respectively and never spin on a lock.
+//! @tparam _type: Type of the stored values. Must be nothrow move constructible.
+//! @remark Implementation follows Dmitry Vyukov's "Bounded MPMC queue". Slots are padded to a full cache line to
+//! avoid false sharing between neighbouring producers and consumers.
+template <typename _type>
+class MPMCRingBuffer
+{
+    static_assert(std::is_nothrow_move_constructible_v<_type>, "Type must be nothrow move constructible.");
+
+    static constexpr U32 CacheLineSize = 64;
+
+    //! @brief Storage for a single value and its sequence counter
+    struct alignas(CacheLineSize) Slot
+    {
+        std::atomic<U64> mSequence;
+        alignas(_type) std::byte mStorage[sizeof(_type)];
+    };
+
+    alignas(CacheLineSize) std::atomic<U64> mEnqueuePosition;
+    alignas(CacheLineSize) std::atomic<U64> mDequeuePosition;
+    alignas(CacheLineSize) const U64 mCapacity;
+    const U64 mMask;
+    std::unique_ptr<Slot[]> mSlots;
+
+public:
+    //! @brief Constructs the ring buffer with a fixed capacity
+    //! @param capacity: Maximum number of values that can be stored. Must be a power of 2 and larger than 1.
+    explicit MPMCRingBuffer(U64 capacity);
+
+    MPMCRingBuffer() = delete;
+    MPMCRingBuffer(const MPMCRingBuffer&) = delete;
+    MPMCRingBuffer(MPMCRingBuffer&&) = delete;
+    MPMCRingBuffer& operator=(const MPMCRingBuffer&) = delete;
+    MPMCRingBuffer& operator=(MPMCRingBuffer&&) = delete;
+    ~MPMCRingBuffer();
+
+    //! @brief Gets the capacity of the ring buffer
+    //! @return Capacity of the ring buffer
+    U64 GetCapacity() const;
+
+    //! @brief Gets the approximate number of values inside the ring buffer
+    //! @return Approximate number of values
+    //! @remark The result is only exact if no other thread modifies the ring buffer at the same time
+    U64 GetSize() const;
+
+    //! @brief Returns if the ring buffer is empty or not
+    //! @return TRUE if the ring buffer is empty, FALSE if not
+    //! @remark The result is only exact if no other thread modifies the ring buffer at the same time
+    bool IsEmpty() const;
+
+    //! @brief Tries to push a value into the ring buffer
+    //! @param value: Value that should be pushed. It is only moved if the operation is successful.
+    //! @return TRUE if the operation was successful, FALSE if the ring buffer is full
+    bool TryPush(_type&& value);
+
+    //! @brief Tries to get the oldest value of the ring buffer
+    //! @param out: Reference to a variable that stores the fetched value
+    //! @return TRUE if the operation was successful, FALSE if the ring buffer is empty
+    bool TryPop(_type& out);
+};
+
+} // namespace GDL
+
+#include "gdl/resources/cpu/mpmcRingBuffer.inl"
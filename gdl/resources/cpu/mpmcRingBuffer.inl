@@ -0,0 +1,129 @@
+#pragma once
+
+#include "gdl/resources/cpu/mpmcRingBuffer.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/isPowerOf2.h"
+
+#include <new>
+#include <utility>
+
+
+namespace GDL
+{
+
+template <typename _type>
+MPMCRingBuffer<_type>::MPMCRingBuffer(U64 capacity)
+    : mEnqueuePosition{0}
+    , mDequeuePosition{0}
+    , mCapacity{capacity}
+    , mMask{capacity - 1}
+    , mSlots{nullptr}
+{
+    EXCEPTION(capacity < 2 || !IsPowerOf2(capacity), "Capacity must be a power of 2 and larger than 1.");
+    mSlots.reset(new Slot[capacity]);
+    for (U64 i = 0; i < capacity; ++i)
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+}
+
+
+
+template <typename _type>
+MPMCRingBuffer<_type>::~MPMCRingBuffer()
+{
+    const U64 enqueuePosition = mEnqueuePosition.load(std::memory_order_relaxed);
+    for (U64 i = mDequeuePosition.load(std::memory_order_relaxed); i < enqueuePosition; ++i)
+        std::launder(reinterpret_cast<_type*>(mSlots[i & mMask].mStorage))->~_type();
+}
+
+
+
+template <typename _type>
+U64 MPMCRingBuffer<_type>::GetCapacity() const
+{
+    return mCapacity;
+}
+
+
+
+template <typename _type>
+U64 MPMCRingBuffer<_type>::GetSize() const
+{
+    const U64 dequeuePosition = mDequeuePosition.load(std::memory_order_relaxed);
+    const U64 enqueuePosition = mEnqueuePosition.load(std::memory_order_relaxed);
+    return (enqueuePosition > dequeuePosition) ? enqueuePosition - dequeuePosition : 0;
+}
+
+
+
+template <typename _type>
+bool MPMCRingBuffer<_type>::IsEmpty() const
+{
+    return GetSize() == 0;
+}
+
+
+
+template <typename _type>
+bool MPMCRingBuffer<_type>::TryPush(_type&& value)
+{
+    U64 position = mEnqueuePosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+
+    for (;;)
+    {
+        slot = &mSlots[position & mMask];
+        const U64 sequence = slot->mSequence.load(std::memory_order_acquire);
+        const I64 difference = static_cast<I64>(sequence - position);
+
+        if (difference == 0)
+        {
+            // Slot is free - try to claim it
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+            return false; // The slot still contains a value of the previous round - buffer is full
+        else
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+    }
+
+    new (slot->mStorage) _type(std::move(value));
+    slot->mSequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+
+
+template <typename _type>
+bool MPMCRingBuffer<_type>::TryPop(_type& out)
+{
+    U64 position = mDequeuePosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+
+    for (;;)
+    {
+        slot = &mSlots[position & mMask];
+        const U64 sequence = slot->mSequence.load(std::memory_order_acquire);
+        const I64 difference = static_cast<I64>(sequence - (position + 1));
+
+        if (difference == 0)
+        {
+            // Slot contains a value - try to claim it
+            if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+            return false; // The producer of this round has not finished yet - buffer is empty
+        else
+            position = mDequeuePosition.load(std::memory_order_relaxed);
+    }
+
+    _type* value = std::launder(reinterpret_cast<_type*>(slot->mStorage));
+    out = std::move(*value);
+    value->~_type();
+    slot->mSequence.store(position + mCapacity, std::memory_order_release);
+    return true;
+}
+
+} // namespace GDL
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/spinlock.h"
+#include "gdl/resources/cpu/threadPool.h"
+
+#include <atomic>
+#include <exception>
+
+
+namespace GDL
+{
+
+//! @brief Defines how the iteration range of a parallel loop is divided into chunks
+enum class Partitioner
+{
+    RECURSIVE, //!< Splits the range recursively in halves until the grain size is reached
+    STATIC,    //!< Splits the range into one contiguous chunk per thread
+    DYNAMIC,   //!< Threads fetch chunks of grain size from a shared counter
+    GUIDED     //!< Like DYNAMIC, but the chunk size decreases with the number of remaining iterations
+};
+
+
+
+//! @brief Shared state of a parallel loop. Splits the iteration range according to the selected partitioner, submits
+//! the chunks to the thread pool and keeps track of the unfinished tasks.
+//! @tparam _numQueues: Number of queues of the thread pool
+//! @tparam _workStealing: Work stealing mode of the thread pool
+//! @tparam _queue: Queue type of the thread pool
+//! @tparam _function: Type of the loop body. The signature should be void(U64 begin, U64 end)
+//! @remark This class is used by the ParallelFor and ParallelReduce functions. Use those instead.
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+class ParallelForContext
+{
+    ThreadPool<_numQueues, _workStealing, _queue>& mThreadPool;
+    _function& mFunction;
+    const U64 mBegin;
+    const U64 mEnd;
+    const U64 mGrainSize;
+    const U32 mNumWorkers;
+    const I32 mQueueNum;
+    alignas(64) std::atomic<U64> mNextIndex;
+    alignas(64) std::atomic<U32> mNumPendingTasks;
+    std::atomic_bool mCancelled;
+    SpinLock mExceptionLock;
+    std::exception_ptr mException;
+
+public:
+    //! @brief Constructor
+    //! @param threadPool: Thread pool that executes the chunks
+    //! @param function: Loop body
+    //! @param begin: First index of the range
+    //! @param end: One past the last index of the range
+    //! @param grainSize: Minimal number of iterations per chunk
+    //! @param queueNum: Array number of the thread pool queue that gets the chunks
+    ParallelForContext(ThreadPool<_numQueues, _workStealing, _queue>& threadPool, _function& function, U64 begin,
+                       U64 end, U64 grainSize, I32 queueNum);
+
+    ParallelForContext() = delete;
+    ParallelForContext(const ParallelForContext&) = delete;
+    ParallelForContext(ParallelForContext&&) = delete;
+    ParallelForContext& operator=(const ParallelForContext&) = delete;
+    ParallelForContext& operator=(ParallelForContext&&) = delete;
+    ~ParallelForContext() = default;
+
+    //! @brief Processes the range with the calling thread and the thread pool. Returns after all chunks are processed.
+    //! The first exception thrown by the loop body is rethrown.
+    //! @param partitioner: Partitioner that should be used
+    void Run(Partitioner partitioner);
+
+private:
+    //! @brief Executes the loop body for a single chunk. Exceptions are caught and stored.
+    //! @param begin: First index of the chunk
+    //! @param end: One past the last index of the chunk
+    void ExecuteChunk(U64 begin, U64 end);
+
+    //! @brief Fetches chunks from the shared counter until the range is processed
+    //! @param guided: If TRUE, the chunk size decreases with the number of remaining iterations
+    void ProcessSharedRange(bool guided);
+
+    //! @brief Splits the range recursively into halves. One half is submitted to the thread pool while the calling
+    //! thread continues with the other one.
+    //! @param begin: First index of the range
+    //! @param end: One past the last index of the range
+    void ProcessRecursive(U64 begin, U64 end);
+
+    //! @brief Submits a task to the thread pool which is tracked by the pending task counter
+    //! @tparam _taskFunction: Type of the task function
+    //! @param taskFunction: Task function
+    template <typename _taskFunction>
+    void SubmitTask(_taskFunction&& taskFunction);
+
+    //! @brief Executes pending tasks of the thread pool until all submitted tasks are finished
+    void WaitForTasks();
+};
+
+
+
+//! @brief Executes the passed function for all indices of the range [begin, end) in parallel. The calling thread
+//! participates and the function returns after all iterations are finished.
+//! @tparam _numQueues: Number of queues of the thread pool
+//! @tparam _workStealing: Work stealing mode of the thread pool
+//! @tparam _queue: Queue type of the thread pool
+//! @tparam _function: Type of the loop body
+//! @param threadPool: Thread pool that executes the iterations together with the calling thread
+//! @param begin: First index of the range
+//! @param end: One past the last index of the range
+//! @param grainSize: Minimal number of iterations that are processed as a single chunk
+//! @param function: Loop body. The signature should be either void(U64 index) or void(U64 begin, U64 end). The
+//! second one is called once per chunk.
+//! @param partitioner: Defines how the range is split into chunks
+//! @param queueNum: Array number of the thread pool queue that should be used
+//! @remark The first exception thrown by the loop body is rethrown after all running chunks are finished. Chunks that
+//! did not start yet are skipped.
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+void ParallelFor(ThreadPool<_numQueues, _workStealing, _queue>& threadPool, U64 begin, U64 end, U64 grainSize,
+                 _function&& function, Partitioner partitioner = Partitioner::RECURSIVE, I32 queueNum = 0);
+
+//! @brief Reduces the range [begin, end) in parallel. The calling thread participates and the function returns after
+//! all iterations are finished.
+//! @tparam _numQueues: Number of queues of the thread pool
+//! @tparam _workStealing: Work stealing mode of the thread pool
+//! @tparam _queue: Queue type of the thread pool
+//! @tparam _type: Result type
+//! @tparam _function: Type of the loop body
+//! @tparam _reduction: Type of the reduction function
+//! @param threadPool: Thread pool that executes the iterations together with the calling thread
+//! @param begin: First index of the range
+//! @param end: One past the last index of the range
+//! @param grainSize: Minimal number of iterations that are processed as a single chunk
+//! @param identity: Identity element of the reduction. Returned if the range is empty
+//! @param function: Loop body with the signature _type(U64 begin, U64 end). It returns the partial result of a chunk
+//! @param reduction: Function with the signature _type(const _type&, const _type&) that combines two partial results.
+//! It must be associative and commutative since the order of the partial results is not deterministic
+//! @param partitioner: Defines how the range is split into chunks
+//! @param queueNum: Array number of the thread pool queue that should be used
+//! @return Reduced result
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _type, typename _function, typename _reduction>
+_type ParallelReduce(ThreadPool<_numQueues, _workStealing, _queue>& threadPool, U64 begin, U64 end, U64 grainSize,
+                     const _type& identity, _function&& function, _reduction&& reduction,
+                     Partitioner partitioner = Partitioner::RECURSIVE, I32 queueNum = 0);
+
+} // namespace GDL
+
+#include "gdl/resources/cpu/parallelFor.inl"
@@ -0,0 +1,236 @@
+#pragma once
+
+#include "gdl/resources/cpu/parallelFor.h"
+
+#include "gdl/base/exception.h"
+
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+
+namespace GDL
+{
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+ParallelForContext<_numQueues, _workStealing, _queue, _function>::ParallelForContext(
+        ThreadPool<_numQueues, _workStealing, _queue>& threadPool, _function& function, U64 begin, U64 end,
+        U64 grainSize, I32 queueNum)
+    : mThreadPool{threadPool}
+    , mFunction{function}
+    , mBegin{begin}
+    , mEnd{end}
+    , mGrainSize{grainSize}
+    , mNumWorkers{threadPool.GetNumThreads() + 1}
+    , mQueueNum{queueNum}
+    , mNextIndex{begin}
+    , mNumPendingTasks{0}
+    , mCancelled{false}
+    , mExceptionLock{}
+    , mException{nullptr}
+{
+    assert(begin < end);
+    assert(grainSize > 0);
+    assert(queueNum < _numQueues && queueNum >= 0);
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+void ParallelForContext<_numQueues, _workStealing, _queue, _function>::Run(Partitioner partitioner)
+{
+    const U64 numIterations = mEnd - mBegin;
+    const U64 numChunks = std::min<U64>((numIterations - 1) / mGrainSize + 1, mNumWorkers);
+
+    switch (partitioner)
+    {
+    case Partitioner::RECURSIVE:
+        ProcessRecursive(mBegin, mEnd);
+        break;
+
+    case Partitioner::STATIC:
+    {
+        const U64 chunkSize = numIterations / numChunks;
+        const U64 remainder = numIterations % numChunks;
+        auto GetChunkBegin = [&](U64 chunk) { return mBegin + chunk * chunkSize + std::min(chunk, remainder); };
+
+        for (U64 i = 1; i < numChunks; ++i)
+            SubmitTask([this, chunkBegin = GetChunkBegin(i), chunkEnd = GetChunkBegin(i + 1)]() {
+                ExecuteChunk(chunkBegin, chunkEnd);
+            });
+        ExecuteChunk(mBegin, GetChunkBegin(1));
+        break;
+    }
+
+    case Partitioner::DYNAMIC:
+    case Partitioner::GUIDED:
+    {
+        const bool guided = partitioner == Partitioner::GUIDED;
+        for (U64 i = 1; i < numChunks; ++i)
+            SubmitTask([this, guided]() { ProcessSharedRange(guided); });
+        ProcessSharedRange(guided);
+        break;
+    }
+    }
+
+    WaitForTasks();
+
+    if (mException != nullptr)
+        std::rethrow_exception(mException);
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+void ParallelForContext<_numQueues, _workStealing, _queue, _function>::ExecuteChunk(U64 begin, U64 end)
+{
+    if (mCancelled.load(std::memory_order_relaxed))
+        return;
+
+    try
+    {
+        mFunction(begin, end);
+    }
+    catch (...)
+    {
+        std::lock_guard<SpinLock> lock(mExceptionLock);
+        if (mException == nullptr)
+            mException = std::current_exception();
+        mCancelled = true;
+    }
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+void ParallelForContext<_numQueues, _workStealing, _queue, _function>::ProcessSharedRange(bool guided)
+{
+    while (!mCancelled.load(std::memory_order_relaxed))
+    {
+        U64 chunkBegin = 0;
+        U64 chunkEnd = 0;
+
+        if (!guided)
+        {
+            chunkBegin = mNextIndex.fetch_add(mGrainSize, std::memory_order_relaxed);
+            if (chunkBegin >= mEnd)
+                return;
+            chunkEnd = std::min(chunkBegin + mGrainSize, mEnd);
+        }
+        else
+        {
+            chunkBegin = mNextIndex.load(std::memory_order_relaxed);
+            do
+            {
+                if (chunkBegin >= mEnd)
+                    return;
+                const U64 numRemaining = mEnd - chunkBegin;
+                const U64 chunkSize = std::max(mGrainSize, numRemaining / (2 * mNumWorkers));
+                chunkEnd = chunkBegin + std::min(chunkSize, numRemaining);
+            } while (!mNextIndex.compare_exchange_weak(chunkBegin, chunkEnd, std::memory_order_relaxed));
+        }
+
+        ExecuteChunk(chunkBegin, chunkEnd);
+    }
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+void ParallelForContext<_numQueues, _workStealing, _queue, _function>::ProcessRecursive(U64 begin, U64 end)
+{
+    while (end - begin > mGrainSize && !mCancelled.load(std::memory_order_relaxed))
+    {
+        const U64 middle = begin + (end - begin) / 2;
+        SubmitTask([this, middle, end]() { ProcessRecursive(middle, end); });
+        end = middle;
+    }
+    ExecuteChunk(begin, end);
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+template <typename _taskFunction>
+void ParallelForContext<_numQueues, _workStealing, _queue, _function>::SubmitTask(_taskFunction&& taskFunction)
+{
+    mNumPendingTasks.fetch_add(1, std::memory_order_relaxed);
+    mThreadPool.Submit(mQueueNum, [this, taskFunction = std::move(taskFunction)]() {
+        taskFunction();
+        // The context might be destroyed after the counter reaches zero - no member access afterwards
+        mNumPendingTasks.fetch_sub(1, std::memory_order_release);
+    });
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+void ParallelForContext<_numQueues, _workStealing, _queue, _function>::WaitForTasks()
+{
+    while (mNumPendingTasks.load(std::memory_order_acquire) > 0)
+        if (!mThreadPool.TryExecuteTask(mQueueNum))
+            std::this_thread::yield();
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _function>
+void ParallelFor(ThreadPool<_numQueues, _workStealing, _queue>& threadPool, U64 begin, U64 end, U64 grainSize,
+                 _function&& function, Partitioner partitioner, I32 queueNum)
+{
+    DEV_EXCEPTION(grainSize == 0, "The grain size must be larger than 0.");
+    DEV_EXCEPTION(begin > end, "Invalid range. The first index is larger than the last one.");
+    DEV_EXCEPTION(queueNum >= _numQueues || queueNum < 0, "Invalid queue number.");
+
+    if (begin == end)
+        return;
+
+    if constexpr (std::is_invocable_v<_function&, U64, U64>)
+    {
+        using FunctionType = std::remove_reference_t<_function>;
+        ParallelForContext<_numQueues, _workStealing, _queue, FunctionType> context(threadPool, function, begin, end,
+                                                                            grainSize, queueNum);
+        context.Run(partitioner);
+    }
+    else
+    {
+        static_assert(std::is_invocable_v<_function&, U64>,
+                      "The loop body signature should be void(U64 index) or void(U64 begin, U64 end).");
+
+        auto chunkFunction = [&function](U64 chunkBegin, U64 chunkEnd) {
+            for (U64 i = chunkBegin; i < chunkEnd; ++i)
+                function(i);
+        };
+        ParallelForContext<_numQueues, _workStealing, _queue, decltype(chunkFunction)> context(
+                threadPool, chunkFunction, begin, end, grainSize, queueNum);
+        context.Run(partitioner);
+    }
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue, typename _type, typename _function, typename _reduction>
+_type ParallelReduce(ThreadPool<_numQueues, _workStealing, _queue>& threadPool, U64 begin, U64 end, U64 grainSize,
+                     const _type& identity, _function&& function, _reduction&& reduction, Partitioner partitioner,
+                     I32 queueNum)
+{
+    static_assert(std::is_convertible_v<std::invoke_result_t<_function&, U64, U64>, _type>,
+                  "The loop body signature should be _type(U64 begin, U64 end).");
+
+    _type result = identity;
+    SpinLock resultLock;
+
+    ParallelFor(threadPool, begin, end, grainSize,
+                [&](U64 chunkBegin, U64 chunkEnd) {
+                    const _type partialResult = function(chunkBegin, chunkEnd);
+                    std::lock_guard<SpinLock> lock(resultLock);
+                    result = reduction(result, partialResult);
+                },
+                partitioner, queueNum);
+
+    return result;
+}
+
+} // namespace GDL
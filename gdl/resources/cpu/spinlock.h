@@ -1,40 +1,187 @@
 #pragma once
 
+#include "gdl/base/fundamentalTypes.h"
+
 #include <atomic>
 
 namespace GDL
 {
 
+//! @brief If TRUE, the default spinlocks count acquisitions, contended acquisitions and spin cycles. Enable it with the
+//! CMake option ENABLE_SPINLOCK_STATISTICS.
+#ifdef SPINLOCK_STATISTICS
+constexpr bool SpinLockStatisticsEnabled = true;
+#else
+constexpr bool SpinLockStatisticsEnabled = false;
+#endif
+
+
+
+//! @brief Contention statistics of a single spinlock instance
+struct SpinLockStatistics
+{
+    U64 mNumAcquisitions = 0;          //!< Total number of acquisitions
+    U64 mNumContendedAcquisitions = 0; //!< Number of acquisitions that found the lock already locked
+    U64 mNumSpinCycles = 0;            //!< Time stamp counter cycles spent waiting in contended acquisitions
+};
+
+
 
-//! @brief Spinlock for busy waiting
-//! @remark https://stackoverflow.com/questions/26583433/c11-implementation-of-spinlock-using-atomic
-class SpinLock
+//! @brief Exponential backoff for threads that wait for a lock. Each call to Pause executes twice as many pause
+//! instructions as the previous one until the maximum is reached. From there on, the thread also yields, so that a
+//! preempted lock owner can continue if there are more threads than CPUs.
+class SpinLockBackoff
 {
-    std::atomic_flag mLocked = ATOMIC_FLAG_INIT;
+    U32 mNumPauses;
 
 public:
-    SpinLock() = default;
-    SpinLock(const SpinLock&) = delete;
-    SpinLock(SpinLock&&) = delete;
-    SpinLock& operator=(const SpinLock&) = delete;
-    SpinLock& operator=(SpinLock&&) = delete;
-    ~SpinLock() = default;
+    //! @brief Maximal number of pause instructions per call
+    static constexpr U32 MaxNumPauses = 64;
 
+    SpinLockBackoff();
+    SpinLockBackoff(const SpinLockBackoff&) = delete;
+    SpinLockBackoff(SpinLockBackoff&&) = delete;
+    SpinLockBackoff& operator=(const SpinLockBackoff&) = delete;
+    SpinLockBackoff& operator=(SpinLockBackoff&&) = delete;
+    ~SpinLockBackoff() = default;
 
+    //! @brief Waits for a while and increases the waiting time of the next call
+    void Pause();
+};
 
-    //! @brief Locks the spinlock
-    void lock()
+
+
+//! @brief Stores the contention statistics of a spinlock. The specialization for disabled statistics is empty and
+//! does nothing.
+//! @tparam _enabled: If TRUE, statistics are collected
+template <bool _enabled>
+class SpinLockStatisticsCounter
+{
+    std::atomic<U64> mNumAcquisitions;
+    std::atomic<U64> mNumContendedAcquisitions;
+    std::atomic<U64> mNumSpinCycles;
+
+public:
+    SpinLockStatisticsCounter();
+    SpinLockStatisticsCounter(const SpinLockStatisticsCounter&) = delete;
+    SpinLockStatisticsCounter(SpinLockStatisticsCounter&&) = delete;
+    SpinLockStatisticsCounter& operator=(const SpinLockStatisticsCounter&) = delete;
+    SpinLockStatisticsCounter& operator=(SpinLockStatisticsCounter&&) = delete;
+    ~SpinLockStatisticsCounter() = default;
+
+    //! @brief Gets the statistics
+    //! @return Statistics
+    //! @remark The values might be slightly outdated if the lock is in use
+    SpinLockStatistics GetStatistics() const;
+
+    //! @brief Sets all statistics to zero
+    void ResetStatistics();
+
+protected:
+    //! @brief Records an acquisition
+    //! @param contended: TRUE if the lock was already locked
+    //! @param numSpinCycles: Number of cycles spent waiting
+    //! @remark Must only be called by the lock owner. This way no atomic read-modify-write operations are needed.
+    void RecordAcquisition(bool contended, U64 numSpinCycles);
+};
+
+
+
+template <>
+class SpinLockStatisticsCounter<false>
+{
+public:
+    SpinLockStatistics GetStatistics() const
     {
-        while (mLocked.test_and_set(std::memory_order_acquire))
-            ;
+        return SpinLockStatistics();
     }
 
+    void ResetStatistics()
+    {
+    }
 
-    //! @brief Unlocks the spinlock
-    void unlock()
+protected:
+    void RecordAcquisition(bool, U64)
     {
-        mLocked.clear(std::memory_order_release);
     }
 };
 
+
+
+//! @brief Test and test-and-set spinlock with exponential backoff. Waiting threads only read the lock state, so that
+//! the cache line is not bounced between the waiting threads.
+//! @tparam _statistics: If TRUE, contention statistics are collected
+template <bool _statistics>
+class TTASSpinLockTemplate : public SpinLockStatisticsCounter<_statistics>
+{
+    std::atomic_bool mLocked;
+
+public:
+    TTASSpinLockTemplate();
+    TTASSpinLockTemplate(const TTASSpinLockTemplate&) = delete;
+    TTASSpinLockTemplate(TTASSpinLockTemplate&&) = delete;
+    TTASSpinLockTemplate& operator=(const TTASSpinLockTemplate&) = delete;
+    TTASSpinLockTemplate& operator=(TTASSpinLockTemplate&&) = delete;
+    ~TTASSpinLockTemplate() = default;
+
+    //! @brief Locks the spinlock
+    void lock();
+
+    //! @brief Tries to lock the spinlock without waiting
+    //! @return TRUE if the lock was acquired, FALSE otherwise
+    bool try_lock();
+
+    //! @brief Unlocks the spinlock
+    void unlock();
+
+private:
+    //! @brief Waits until the lock can be acquired. Called if the first attempt failed.
+    void LockContended();
+};
+
+
+
+//! @brief Ticket spinlock with exponential backoff. Threads acquire the lock in the order they requested it, so no
+//! thread starves under high contention. In return, a preempted waiting thread blocks all threads behind it.
+//! @tparam _statistics: If TRUE, contention statistics are collected
+template <bool _statistics>
+class TicketSpinLockTemplate : public SpinLockStatisticsCounter<_statistics>
+{
+    std::atomic<U32> mNextTicket;
+    std::atomic<U32> mCurrentTicket;
+
+public:
+    TicketSpinLockTemplate();
+    TicketSpinLockTemplate(const TicketSpinLockTemplate&) = delete;
+    TicketSpinLockTemplate(TicketSpinLockTemplate&&) = delete;
+    TicketSpinLockTemplate& operator=(const TicketSpinLockTemplate&) = delete;
+    TicketSpinLockTemplate& operator=(TicketSpinLockTemplate&&) = delete;
+    ~TicketSpinLockTemplate() = default;
+
+    //! @brief Locks the spinlock
+    void lock();
+
+    //! @brief Tries to lock the spinlock without waiting
+    //! @return TRUE if the lock was acquired, FALSE otherwise
+    bool try_lock();
+
+    //! @brief Unlocks the spinlock
+    void unlock();
+
+private:
+    //! @brief Waits until the passed ticket is served. Called if the first check failed.
+    //! @param ticket: Ticket of the calling thread
+    void LockContended(U32 ticket);
+};
+
+
+
+using TTASSpinLock = TTASSpinLockTemplate<SpinLockStatisticsEnabled>;
+using TicketSpinLock = TicketSpinLockTemplate<SpinLockStatisticsEnabled>;
+
+//! @brief Default spinlock for short critical sections
+using SpinLock = TTASSpinLock;
+
 } // namespace GDL
+
+#include "gdl/resources/cpu/spinlock.inl"
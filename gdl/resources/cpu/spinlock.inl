@@ -0,0 +1,208 @@
+#pragma once
+
+#include "gdl/resources/cpu/spinlock.h"
+
+#include "gdl/base/simd/x86intrin.h"
+
+#include <thread>
+
+
+namespace GDL
+{
+
+// SpinLockBackoff ----------------------------------------------------------------------------------------------------
+
+inline SpinLockBackoff::SpinLockBackoff()
+    : mNumPauses{1}
+{
+}
+
+
+
+inline void SpinLockBackoff::Pause()
+{
+    for (U32 i = 0; i < mNumPauses; ++i)
+        _mm_pause();
+
+    if (mNumPauses < MaxNumPauses)
+        mNumPauses *= 2;
+    else
+        std::this_thread::yield();
+}
+
+
+
+// SpinLockStatisticsCounter ------------------------------------------------------------------------------------------
+
+template <bool _enabled>
+SpinLockStatisticsCounter<_enabled>::SpinLockStatisticsCounter()
+    : mNumAcquisitions{0}
+    , mNumContendedAcquisitions{0}
+    , mNumSpinCycles{0}
+{
+}
+
+
+
+template <bool _enabled>
+SpinLockStatistics SpinLockStatisticsCounter<_enabled>::GetStatistics() const
+{
+    SpinLockStatistics statistics;
+    statistics.mNumAcquisitions = mNumAcquisitions.load(std::memory_order_relaxed);
+    statistics.mNumContendedAcquisitions = mNumContendedAcquisitions.load(std::memory_order_relaxed);
+    statistics.mNumSpinCycles = mNumSpinCycles.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+
+
+template <bool _enabled>
+void SpinLockStatisticsCounter<_enabled>::ResetStatistics()
+{
+    mNumAcquisitions.store(0, std::memory_order_relaxed);
+    mNumContendedAcquisitions.store(0, std::memory_order_relaxed);
+    mNumSpinCycles.store(0, std::memory_order_relaxed);
+}
+
+
+
+template <bool _enabled>
+void SpinLockStatisticsCounter<_enabled>::RecordAcquisition(bool contended, U64 numSpinCycles)
+{
+    mNumAcquisitions.store(mNumAcquisitions.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (contended)
+    {
+        mNumContendedAcquisitions.store(mNumContendedAcquisitions.load(std::memory_order_relaxed) + 1,
+                                        std::memory_order_relaxed);
+        mNumSpinCycles.store(mNumSpinCycles.load(std::memory_order_relaxed) + numSpinCycles,
+                             std::memory_order_relaxed);
+    }
+}
+
+
+
+// TTASSpinLockTemplate -----------------------------------------------------------------------------------------------
+
+template <bool _statistics>
+TTASSpinLockTemplate<_statistics>::TTASSpinLockTemplate()
+    : mLocked{false}
+{
+}
+
+
+
+template <bool _statistics>
+void TTASSpinLockTemplate<_statistics>::lock()
+{
+    if (!mLocked.exchange(true, std::memory_order_acquire))
+        this->RecordAcquisition(false, 0);
+    else
+        LockContended();
+}
+
+
+
+template <bool _statistics>
+bool TTASSpinLockTemplate<_statistics>::try_lock()
+{
+    if (mLocked.load(std::memory_order_relaxed) || mLocked.exchange(true, std::memory_order_acquire))
+        return false;
+
+    this->RecordAcquisition(false, 0);
+    return true;
+}
+
+
+
+template <bool _statistics>
+void TTASSpinLockTemplate<_statistics>::unlock()
+{
+    mLocked.store(false, std::memory_order_release);
+}
+
+
+
+template <bool _statistics>
+void TTASSpinLockTemplate<_statistics>::LockContended()
+{
+    U64 startCycle = 0;
+    if constexpr (_statistics)
+        startCycle = __rdtsc();
+
+    SpinLockBackoff backoff;
+    do
+    {
+        while (mLocked.load(std::memory_order_relaxed))
+            backoff.Pause();
+    } while (mLocked.exchange(true, std::memory_order_acquire));
+
+    if constexpr (_statistics)
+        this->RecordAcquisition(true, __rdtsc() - startCycle);
+}
+
+
+
+// TicketSpinLockTemplate ---------------------------------------------------------------------------------------------
+
+template <bool _statistics>
+TicketSpinLockTemplate<_statistics>::TicketSpinLockTemplate()
+    : mNextTicket{0}
+    , mCurrentTicket{0}
+{
+}
+
+
+
+template <bool _statistics>
+void TicketSpinLockTemplate<_statistics>::lock()
+{
+    const U32 ticket = mNextTicket.fetch_add(1, std::memory_order_relaxed);
+    if (mCurrentTicket.load(std::memory_order_acquire) == ticket)
+        this->RecordAcquisition(false, 0);
+    else
+        LockContended(ticket);
+}
+
+
+
+template <bool _statistics>
+bool TicketSpinLockTemplate<_statistics>::try_lock()
+{
+    // The lock is free if no ticket was drawn after the current one. The acquire load synchronizes with the release
+    // store of the previous unlock, since the exchange only synchronizes with other threads drawing tickets.
+    U32 ticket = mCurrentTicket.load(std::memory_order_acquire);
+    if (!mNextTicket.compare_exchange_strong(ticket, ticket + 1, std::memory_order_relaxed,
+                                             std::memory_order_relaxed))
+        return false;
+
+    this->RecordAcquisition(false, 0);
+    return true;
+}
+
+
+
+template <bool _statistics>
+void TicketSpinLockTemplate<_statistics>::unlock()
+{
+    // Only the lock owner modifies the current ticket
+    mCurrentTicket.store(mCurrentTicket.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+
+
+template <bool _statistics>
+void TicketSpinLockTemplate<_statistics>::LockContended(U32 ticket)
+{
+    U64 startCycle = 0;
+    if constexpr (_statistics)
+        startCycle = __rdtsc();
+
+    SpinLockBackoff backoff;
+    while (mCurrentTicket.load(std::memory_order_acquire) != ticket)
+        backoff.Pause();
+
+    if constexpr (_statistics)
+        this->RecordAcquisition(true, __rdtsc() - startCycle);
+}
+
+} // namespace GDL
@@ -1,41 +1,96 @@
 #pragma once
 
-#include "gdl/resources/cpu/taskBase.h"
+#include "gdl/base/fundamentalTypes.h"
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#ifndef USE_STD_ALLOCATOR
+#include "gdl/resources/memory/poolAllocator.h"
+#endif
 
-#include <algorithm>
 
 namespace GDL
 {
+
 //! @brief This class stores a callable object that should be executed when the corresponding member function is called.
-//! Due to the template, any callable object (functors, std::functions) can be used.
-//! @tparam _function: Callable object type
-template <typename _function>
-class Task : public TaskBase
+//! Any callable object (functors, lambdas, std::functions) with the signature void() can be used.
+//! @remark Small callable objects are stored inside of the task object. Larger ones are stored in memory provided by
+//! the pool allocator. Therefore, tasks with small captures can be created and moved around without any memory
+//! allocation. There is also no virtual function call - the type specific functions are stored in a static table.
+class Task
 {
-    _function mFunction; //!< Stored callable object
-
 public:
-    Task() = delete;
-    Task(const Task& other) = delete;
-    Task(Task&& other) = default;
-    Task& operator=(const Task& other) = delete;
-    Task& operator=(Task&& other) = default;
-    ~Task() = default;
-
-    //! @brief Constructor which moves the provided callable object to the tasks internal variable
-    //! @param function: Callable object that should be executed by the task
-    Task(_function&& function)
-        : mFunction(std::move(function))
+    //! @brief Size of the internal buffer. Callable objects that don't exceed this size are stored inside of the task.
+    static constexpr U32 BufferSize = 48;
+
+private:
+    //! @brief Table of type specific functions
+    struct Operations
     {
-    }
+        void (*mExecute)(void* buffer);
+        void (*mMove)(void* source, void* destination) noexcept;
+        void (*mDestroy)(void* buffer) noexcept;
+    };
+
+#ifndef USE_STD_ALLOCATOR
+    template <typename _function>
+    using Allocator = PoolAllocator<_function>;
+#else
+    template <typename _function>
+    using Allocator = std::allocator<_function>;
+#endif
+
+    alignas(std::max_align_t) std::byte mBuffer[BufferSize];
+    const Operations* mOperations;
+
+public:
+    //! @brief Constructs an empty task
+    Task();
 
+    Task(const Task&) = delete;
+    Task(Task&& other) noexcept;
+    Task& operator=(const Task&) = delete;
+    Task& operator=(Task&& other) noexcept;
+    ~Task();
 
+    //! @brief Constructor which moves or copies the provided callable object into the task
+    //! @tparam _function: Callable object type
+    //! @param function: Callable object that should be executed by the task
+    template <typename _function, typename = std::enable_if_t<!std::is_same_v<std::decay_t<_function>, Task>>>
+    Task(_function&& function);
 
     //! @brief Executes the stored callable object.
-    virtual void execute() override
-    {
-        mFunction();
-    }
+    void Execute();
+
+    //! @brief Returns if the task stores a callable object
+    //! @return TRUE if the task is empty, FALSE otherwise
+    bool IsEmpty() const;
+
+    //! @brief Returns if a callable object of the passed type is stored inside of the task without memory allocation
+    //! @tparam _function: Callable object type
+    //! @return TRUE if the callable object is stored inside of the task, FALSE otherwise
+    template <typename _function>
+    static constexpr bool IsStoredInternally();
+
+private:
+    //! @brief Destroys the stored callable object and leaves an empty task
+    void Reset();
+
+    //! @brief Gets the function table for callable objects that are stored inside of the task
+    //! @tparam _function: Callable object type
+    //! @return Function table
+    template <typename _function>
+    static const Operations* GetInternalOperations();
+
+    //! @brief Gets the function table for callable objects that are stored in allocated memory
+    //! @tparam _function: Callable object type
+    //! @return Function table
+    template <typename _function>
+    static const Operations* GetExternalOperations();
 };
 
 } // namespace GDL
+
+#include "gdl/resources/cpu/task.inl"
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "gdl/resources/cpu/task.h"
+
+#include <cassert>
+#include <new>
+#include <utility>
+
+
+namespace GDL
+{
+
+inline Task::Task()
+    : mOperations{nullptr}
+{
+}
+
+
+
+inline Task::Task(Task&& other) noexcept
+    : mOperations{other.mOperations}
+{
+    if (mOperations != nullptr)
+        mOperations->mMove(other.mBuffer, mBuffer);
+    other.mOperations = nullptr;
+}
+
+
+
+inline Task& Task::operator=(Task&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        mOperations = other.mOperations;
+        if (mOperations != nullptr)
+            mOperations->mMove(other.mBuffer, mBuffer);
+        other.mOperations = nullptr;
+    }
+    return *this;
+}
+
+
+
+inline Task::~Task()
+{
+    Reset();
+}
+
+
+
+template <typename _function, typename>
+Task::Task(_function&& function)
+    : mOperations{nullptr}
+{
+    using FunctionType = std::decay_t<_function>;
+    static_assert(std::is_invocable_v<FunctionType&>, "Tasks can only store callable objects with signature void().");
+
+    if constexpr (IsStoredInternally<FunctionType>())
+    {
+        new (mBuffer) FunctionType(std::forward<_function>(function));
+        mOperations = GetInternalOperations<FunctionType>();
+    }
+    else
+    {
+        Allocator<FunctionType> allocator;
+        FunctionType* externalFunction = allocator.allocate(1);
+        try
+        {
+            new (externalFunction) FunctionType(std::forward<_function>(function));
+        }
+        catch (...)
+        {
+            allocator.deallocate(externalFunction, 1);
+            throw;
+        }
+        new (mBuffer) FunctionType*(externalFunction);
+        mOperations = GetExternalOperations<FunctionType>();
+    }
+}
+
+
+
+inline void Task::Execute()
+{
+    assert(mOperations != nullptr && "Task is empty.");
+    mOperations->mExecute(mBuffer);
+}
+
+
+
+inline bool Task::IsEmpty() const
+{
+    return mOperations == nullptr;
+}
+
+
+
+template <typename _function>
+constexpr bool Task::IsStoredInternally()
+{
+    return sizeof(_function) <= BufferSize && alignof(_function) <= alignof(std::max_align_t) &&
+           std::is_nothrow_move_constructible_v<_function>;
+}
+
+
+
+inline void Task::Reset()
+{
+    if (mOperations != nullptr)
+    {
+        mOperations->mDestroy(mBuffer);
+        mOperations = nullptr;
+    }
+}
+
+
+
+template <typename _function>
+const Task::Operations* Task::GetInternalOperations()
+{
+    static constexpr Operations operations = {
+            [](void* buffer) { (*std::launder(static_cast<_function*>(buffer)))(); },
+            [](void* source, void* destination) noexcept {
+                _function* sourceFunction = std::launder(static_cast<_function*>(source));
+                new (destination) _function(std::move(*sourceFunction));
+                sourceFunction->~_function();
+            },
+            [](void* buffer) noexcept { std::launder(static_cast<_function*>(buffer))->~_function(); }};
+    return &operations;
+}
+
+
+
+template <typename _function>
+const Task::Operations* Task::GetExternalOperations()
+{
+    static constexpr Operations operations = {
+            [](void* buffer) { (**std::launder(static_cast<_function**>(buffer)))(); },
+            [](void* source, void* destination) noexcept {
+                new (destination) _function*(*std::launder(static_cast<_function**>(source)));
+            },
+            [](void* buffer) noexcept {
+                _function* externalFunction = *std::launder(static_cast<_function**>(buffer));
+                externalFunction->~_function();
+                Allocator<_function>().deallocate(externalFunction, 1);
+            }};
+    return &operations;
+}
+
+} // namespace GDL
@@ -0,0 +1,262 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/sharedPtr.h"
+#include "gdl/base/uniquePtr.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/spinlock.h"
+#include "gdl/resources/cpu/task.h"
+
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <type_traits>
+
+
+namespace GDL
+{
+
+template <typename _type>
+class TaskFuture;
+
+template <typename _type>
+class TaskPromise;
+
+
+
+//! @brief Base class of the shared state of a task future and its promise. Stores the exception of a failed task and
+//! the continuations which are executed as soon as the state becomes ready.
+class TaskFutureStateBase
+{
+    mutable SpinLock mSpinLock;
+    std::atomic_bool mReady;
+    std::exception_ptr mException;
+    Vector<Task> mContinuations;
+
+public:
+    TaskFutureStateBase();
+    TaskFutureStateBase(const TaskFutureStateBase&) = delete;
+    TaskFutureStateBase(TaskFutureStateBase&&) = delete;
+    TaskFutureStateBase& operator=(const TaskFutureStateBase&) = delete;
+    TaskFutureStateBase& operator=(TaskFutureStateBase&&) = delete;
+    ~TaskFutureStateBase() = default;
+
+    //! @brief Adds a continuation that is executed by the thread which makes the state ready. If the state is already
+    //! ready, the continuation is executed immediately by the calling thread.
+    //! @tparam _function: Function type
+    //! @param function: Continuation. The signature should be void()
+    template <typename _function>
+    void AddContinuation(_function&& function);
+
+    //! @brief Returns if the state has an exception
+    //! @return TRUE if the state has an exception, FALSE if not
+    //! @remark Only valid if the state is ready
+    bool HasException() const;
+
+    //! @brief Returns if the state is ready
+    //! @return TRUE if the state is ready, FALSE if not
+    bool IsReady() const;
+
+    //! @brief Rethrows the stored exception. Does nothing if there is no stored exception.
+    void RethrowException() const;
+
+    //! @brief Stores an exception and makes the state ready
+    //! @param exception: Exception that should be stored
+    void SetException(std::exception_ptr exception);
+
+    //! @brief Waits passively until the state is ready
+    void Wait() const;
+
+protected:
+    //! @brief Makes the state ready and executes all continuations
+    void MakeReady();
+};
+
+
+
+//! @brief Shared state of a task future and its promise which stores the result value
+//! @tparam _type: Result type
+template <typename _type>
+class TaskFutureState : public TaskFutureStateBase
+{
+    std::optional<_type> mValue;
+
+public:
+    //! @brief Gets the stored value
+    //! @return Stored value
+    //! @remark Only valid if the state is ready and has no exception
+    const _type& GetValue() const;
+
+    //! @brief Stores the value and makes the state ready
+    //! @tparam _typeValue: Type of the passed value
+    //! @param value: Value that should be stored
+    template <typename _typeValue>
+    void SetValue(_typeValue&& value);
+};
+
+
+
+//! @brief Shared state of a task future and its promise for tasks without result value
+template <>
+class TaskFutureState<void> : public TaskFutureStateBase
+{
+public:
+    //! @brief Makes the state ready
+    void SetValue();
+};
+
+
+
+//! @brief Handle to the result of an asynchronously executed task. Copies of a future refer to the same result.
+//! @tparam _type: Result type
+//! @remark Use the corresponding functions of the thread pool to wait for a future. They help executing pending tasks
+//! instead of blocking the waiting thread.
+template <typename _type>
+class TaskFuture
+{
+    template <typename>
+    friend class TaskPromise;
+
+    SharedPtr<TaskFutureState<_type>> mState;
+
+public:
+    //! @brief Constructs an invalid future
+    TaskFuture() = default;
+    TaskFuture(const TaskFuture&) = default;
+    TaskFuture(TaskFuture&&) noexcept = default;
+    TaskFuture& operator=(const TaskFuture&) = default;
+    TaskFuture& operator=(TaskFuture&&) noexcept = default;
+    ~TaskFuture() = default;
+
+    //! @brief Waits passively until the result is ready and returns it. If the task has thrown an exception, it is
+    //! rethrown.
+    //! @return Result of the task. Nothing if the result type is void.
+    decltype(auto) Get() const;
+
+    //! @brief Returns if the task has thrown an exception
+    //! @return TRUE if the task has thrown an exception, FALSE if not
+    //! @remark Only valid if the future is ready
+    bool HasException() const;
+
+    //! @brief Returns if the result is ready
+    //! @return TRUE if the result is ready, FALSE if not
+    bool IsReady() const;
+
+    //! @brief Returns if the future refers to a shared state
+    //! @return TRUE if the future is valid, FALSE if not
+    bool IsValid() const;
+
+    //! @brief Adds a function which is executed as soon as the result is ready. It is executed by the thread that
+    //! finishes the task or immediately by the calling thread if the result is already ready.
+    //! @tparam _function: Function type
+    //! @param function: Function that should be executed. The signature should be void()
+    //! @remark The function should be short since it blocks the thread which finishes the task. Submit a continuation
+    //! to a thread pool for expensive work.
+    template <typename _function>
+    void OnReady(_function&& function) const;
+
+    //! @brief Waits passively until the result is ready
+    void Wait() const;
+
+private:
+    //! @brief Constructor
+    //! @param state: Shared state
+    explicit TaskFuture(SharedPtr<TaskFutureState<_type>> state);
+};
+
+
+
+//! @brief Class that sets the result of a task future
+//! @tparam _type: Result type
+//! @remark If a promise is destroyed before a result was set, the future gets an exception
+template <typename _type>
+class TaskPromise
+{
+    SharedPtr<TaskFutureState<_type>> mState;
+
+public:
+    TaskPromise();
+    TaskPromise(const TaskPromise&) = delete;
+    TaskPromise(TaskPromise&&) noexcept = default;
+    TaskPromise& operator=(const TaskPromise&) = delete;
+    TaskPromise& operator=(TaskPromise&&) noexcept = default;
+    ~TaskPromise();
+
+    //! @brief Executes the passed function and stores its result. Exceptions thrown by the function are caught and
+    //! stored.
+    //! @tparam _function: Function type
+    //! @param function: Function that should be executed. Its result type must be the promises result type.
+    template <typename _function>
+    void ExecuteAndSetResult(_function&& function);
+
+    //! @brief Gets a future that refers to the promises result
+    //! @return Future
+    TaskFuture<_type> GetFuture() const;
+
+    //! @brief Stores an exception and makes the future ready
+    //! @param exception: Exception that should be stored
+    void SetException(std::exception_ptr exception);
+
+    //! @brief Stores the result value and makes the future ready
+    //! @tparam _typeValue: Parameter pack of the value type. Must be empty if the result type is void.
+    //! @param value: Result value
+    template <typename... _typeValue>
+    void SetValue(_typeValue&&... value);
+};
+
+
+
+//! @brief Counts the unfinished dependencies of a task graph node and makes its future ready when the last dependency
+//! is finished (fan-in)
+class TaskFanInCounter
+{
+    SpinLock mSpinLock;
+    std::atomic<U32> mNumPendingDependencies;
+    std::exception_ptr mException;
+    TaskPromise<void> mPromise;
+
+public:
+    //! @brief Constructor
+    //! @param numDependencies: Number of dependencies. If it is 0, the future is ready immediately.
+    explicit TaskFanInCounter(U32 numDependencies);
+
+    TaskFanInCounter() = delete;
+    TaskFanInCounter(const TaskFanInCounter&) = delete;
+    TaskFanInCounter(TaskFanInCounter&&) = delete;
+    TaskFanInCounter& operator=(const TaskFanInCounter&) = delete;
+    TaskFanInCounter& operator=(TaskFanInCounter&&) = delete;
+    ~TaskFanInCounter() = default;
+
+    //! @brief Gets the future that becomes ready when all dependencies are finished
+    //! @return Future
+    TaskFuture<void> GetFuture() const;
+
+    //! @brief Notifies the counter that a dependency is ready. The first detected exception of a dependency is
+    //! forwarded to the counters future.
+    //! @tparam _type: Result type of the dependency
+    //! @param dependency: Future of the dependency. Must be ready.
+    template <typename _type>
+    void NotifyDependencyReady(const TaskFuture<_type>& dependency);
+};
+
+
+
+//! @brief Creates a future that becomes ready when all passed futures are ready (fan-in)
+//! @tparam _types: Result types of the passed futures
+//! @param futures: Futures that should be combined
+//! @return Future that becomes ready after all passed futures are ready. If one of the passed futures has an
+//! exception, the returned future stores the first detected exception.
+template <typename... _types>
+TaskFuture<void> WhenAll(const TaskFuture<_types>&... futures);
+
+//! @brief Creates a future that becomes ready when all futures of the passed vector are ready (fan-in)
+//! @tparam _type: Result type of the futures
+//! @param futures: Futures that should be combined
+//! @return Future that becomes ready after all passed futures are ready. If one of the passed futures has an
+//! exception, the returned future stores the first detected exception.
+template <typename _type>
+TaskFuture<void> WhenAll(const Vector<TaskFuture<_type>>& futures);
+
+} // namespace GDL
+
+#include "gdl/resources/cpu/taskFuture.inl"
@@ -0,0 +1,348 @@
+#pragma once
+
+#include "gdl/resources/cpu/taskFuture.h"
+
+#include "gdl/base/exception.h"
+
+#include <cassert>
+#include <mutex>
+#include <thread>
+
+
+namespace GDL
+{
+
+// TaskFutureStateBase ------------------------------------------------------------------------------------------------
+
+inline TaskFutureStateBase::TaskFutureStateBase()
+    : mSpinLock{}
+    , mReady{false}
+    , mException{nullptr}
+    , mContinuations{}
+{
+}
+
+
+
+template <typename _function>
+void TaskFutureStateBase::AddContinuation(_function&& function)
+{
+    {
+        std::lock_guard<SpinLock> lock(mSpinLock);
+        if (!mReady.load(std::memory_order_relaxed))
+        {
+            mContinuations.emplace_back(std::forward<_function>(function));
+            return;
+        }
+    }
+    function();
+}
+
+
+
+inline bool TaskFutureStateBase::HasException() const
+{
+    return mException != nullptr;
+}
+
+
+
+inline bool TaskFutureStateBase::IsReady() const
+{
+    return mReady.load(std::memory_order_acquire);
+}
+
+
+
+inline void TaskFutureStateBase::RethrowException() const
+{
+    if (mException != nullptr)
+        std::rethrow_exception(mException);
+}
+
+
+
+inline void TaskFutureStateBase::SetException(std::exception_ptr exception)
+{
+    DEV_EXCEPTION(IsReady(), "The result was already set.");
+    DEV_EXCEPTION(exception == nullptr, "Invalid exception pointer.");
+    mException = exception;
+    MakeReady();
+}
+
+
+
+inline void TaskFutureStateBase::Wait() const
+{
+    while (!IsReady())
+        std::this_thread::yield();
+}
+
+
+
+inline void TaskFutureStateBase::MakeReady()
+{
+    Vector<Task> continuations;
+    {
+        std::lock_guard<SpinLock> lock(mSpinLock);
+        mReady.store(true, std::memory_order_release);
+        continuations.swap(mContinuations);
+    }
+
+    for (auto& continuation : continuations)
+        continuation.Execute();
+}
+
+
+
+// TaskFutureState ----------------------------------------------------------------------------------------------------
+
+template <typename _type>
+const _type& TaskFutureState<_type>::GetValue() const
+{
+    assert(mValue.has_value());
+    return *mValue;
+}
+
+
+
+template <typename _type>
+template <typename _typeValue>
+void TaskFutureState<_type>::SetValue(_typeValue&& value)
+{
+    DEV_EXCEPTION(IsReady(), "The result was already set.");
+    mValue.emplace(std::forward<_typeValue>(value));
+    MakeReady();
+}
+
+
+
+inline void TaskFutureState<void>::SetValue()
+{
+    DEV_EXCEPTION(IsReady(), "The result was already set.");
+    MakeReady();
+}
+
+
+
+// TaskFuture ---------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+TaskFuture<_type>::TaskFuture(SharedPtr<TaskFutureState<_type>> state)
+    : mState{std::move(state)}
+{
+}
+
+
+
+template <typename _type>
+decltype(auto) TaskFuture<_type>::Get() const
+{
+    DEV_EXCEPTION(!IsValid(), "Future is not valid.");
+
+    mState->Wait();
+    mState->RethrowException();
+    if constexpr (!std::is_void_v<_type>)
+        return mState->GetValue();
+}
+
+
+
+template <typename _type>
+bool TaskFuture<_type>::HasException() const
+{
+    DEV_EXCEPTION(!IsValid(), "Future is not valid.");
+    DEV_EXCEPTION(!IsReady(), "Future is not ready.");
+    return mState->HasException();
+}
+
+
+
+template <typename _type>
+bool TaskFuture<_type>::IsReady() const
+{
+    DEV_EXCEPTION(!IsValid(), "Future is not valid.");
+    return mState->IsReady();
+}
+
+
+
+template <typename _type>
+bool TaskFuture<_type>::IsValid() const
+{
+    return mState != nullptr;
+}
+
+
+
+template <typename _type>
+template <typename _function>
+void TaskFuture<_type>::OnReady(_function&& function) const
+{
+    DEV_EXCEPTION(!IsValid(), "Future is not valid.");
+    mState->AddContinuation(std::forward<_function>(function));
+}
+
+
+
+template <typename _type>
+void TaskFuture<_type>::Wait() const
+{
+    DEV_EXCEPTION(!IsValid(), "Future is not valid.");
+    mState->Wait();
+}
+
+
+
+// TaskPromise --------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+TaskPromise<_type>::TaskPromise()
+    : mState{MakeShared<TaskFutureState<_type>>()}
+{
+}
+
+
+
+template <typename _type>
+TaskPromise<_type>::~TaskPromise()
+{
+    // Waiting threads would never finish otherwise
+    if (mState != nullptr && !mState->IsReady())
+        mState->SetException(std::make_exception_ptr(
+                Exception(__PRETTY_FUNCTION__, "Promise was destroyed before a result was set.")));
+}
+
+
+
+template <typename _type>
+template <typename _function>
+void TaskPromise<_type>::ExecuteAndSetResult(_function&& function)
+{
+    static_assert(std::is_same<_type, std::invoke_result_t<_function>>::value,
+                  "The functions result type does not match the promises result type.");
+
+    try
+    {
+        if constexpr (std::is_void_v<_type>)
+        {
+            function();
+            SetValue();
+        }
+        else
+            SetValue(function());
+    }
+    catch (...)
+    {
+        SetException(std::current_exception());
+    }
+}
+
+
+
+template <typename _type>
+TaskFuture<_type> TaskPromise<_type>::GetFuture() const
+{
+    DEV_EXCEPTION(mState == nullptr, "Promise has no state.");
+    return TaskFuture<_type>(mState);
+}
+
+
+
+template <typename _type>
+void TaskPromise<_type>::SetException(std::exception_ptr exception)
+{
+    DEV_EXCEPTION(mState == nullptr, "Promise has no state.");
+    mState->SetException(exception);
+}
+
+
+
+template <typename _type>
+template <typename... _typeValue>
+void TaskPromise<_type>::SetValue(_typeValue&&... value)
+{
+    DEV_EXCEPTION(mState == nullptr, "Promise has no state.");
+    mState->SetValue(std::forward<_typeValue>(value)...);
+}
+
+
+
+// TaskFanInCounter ---------------------------------------------------------------------------------------------------
+
+inline TaskFanInCounter::TaskFanInCounter(U32 numDependencies)
+    : mSpinLock{}
+    , mNumPendingDependencies{numDependencies}
+    , mException{nullptr}
+    , mPromise{}
+{
+    if (numDependencies == 0)
+        mPromise.SetValue();
+}
+
+
+
+inline TaskFuture<void> TaskFanInCounter::GetFuture() const
+{
+    return mPromise.GetFuture();
+}
+
+
+
+template <typename _type>
+void TaskFanInCounter::NotifyDependencyReady(const TaskFuture<_type>& dependency)
+{
+    if (dependency.HasException())
+    {
+        std::lock_guard<SpinLock> lock(mSpinLock);
+        if (mException == nullptr)
+            try
+            {
+                dependency.Get();
+            }
+            catch (...)
+            {
+                mException = std::current_exception();
+            }
+    }
+
+    assert(mNumPendingDependencies > 0);
+    if (mNumPendingDependencies.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    if (mException != nullptr)
+        mPromise.SetException(mException);
+    else
+        mPromise.SetValue();
+}
+
+
+
+// Free functions -----------------------------------------------------------------------------------------------------
+
+template <typename... _types>
+TaskFuture<void> WhenAll(const TaskFuture<_types>&... futures)
+{
+    auto counter = MakeShared<TaskFanInCounter>(static_cast<U32>(sizeof...(futures)));
+    TaskFuture<void> result = counter->GetFuture();
+
+    (futures.OnReady([counter, futures]() { counter->NotifyDependencyReady(futures); }), ...);
+
+    return result;
+}
+
+
+
+template <typename _type>
+TaskFuture<void> WhenAll(const Vector<TaskFuture<_type>>& futures)
+{
+    auto counter = MakeShared<TaskFanInCounter>(static_cast<U32>(futures.size()));
+    TaskFuture<void> result = counter->GetFuture();
+
+    for (const auto& future : futures)
+        future.OnReady([counter, future]() { counter->NotifyDependencyReady(future); });
+
+    return result;
+}
+
+} // namespace GDL
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/string.h"
+#include "gdl/base/container/vector.h"
+
+
+namespace GDL
+{
+
+//! @brief Maximal length of a thread name (without terminating null character). Longer names are truncated.
+constexpr U32 MaxThreadNameLength = 15;
+
+//! @brief Gets the logical CPU that currently executes the calling thread
+//! @return Logical CPU number or -1 if it can't be determined
+I32 GetCurrentCpu();
+
+//! @brief Gets the logical CPUs the calling thread is allowed to run on
+//! @return Logical CPU numbers in ascending order. Empty if affinities are not supported by the platform.
+Vector<U32> GetCurrentThreadAffinity();
+
+//! @brief Gets the name of the calling thread
+//! @return Name of the thread. Empty if thread names are not supported by the platform.
+String GetCurrentThreadName();
+
+//! @brief Pins the calling thread to the passed logical CPUs
+//! @param cpus: Logical CPU numbers. Must not be empty.
+//! @remark Does nothing on platforms that don't support thread affinities
+void SetCurrentThreadAffinity(const Vector<U32>& cpus);
+
+//! @brief Sets the name of the calling thread that is shown by debuggers and profilers
+//! @param name: Thread name. It is truncated to MaxThreadNameLength characters.
+//! @remark Does nothing on platforms that don't support thread names
+void SetCurrentThreadName(const String& name);
+
+} // namespace GDL
+
+#include "gdl/resources/cpu/threadAffinity.inl"
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "gdl/resources/cpu/threadAffinity.h"
+
+#include "gdl/base/exception.h"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace GDL
+{
+
+inline I32 GetCurrentCpu()
+{
+#ifdef __linux__
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+
+
+inline Vector<U32> GetCurrentThreadAffinity()
+{
+    Vector<U32> cpus;
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    EXCEPTION(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0,
+              "Could not get the affinity of the current thread.");
+    for (U32 i = 0; i < CPU_SETSIZE; ++i)
+        if (CPU_ISSET(i, &cpuSet))
+            cpus.push_back(i);
+#endif
+    return cpus;
+}
+
+
+
+inline String GetCurrentThreadName()
+{
+#ifdef __linux__
+    char name[MaxThreadNameLength + 1] = {};
+    EXCEPTION(pthread_getname_np(pthread_self(), name, sizeof(name)) != 0,
+              "Could not get the name of the current thread.");
+    return String(name);
+#else
+    return String();
+#endif
+}
+
+
+
+inline void SetCurrentThreadAffinity([[maybe_unused]] const Vector<U32>& cpus)
+{
+    EXCEPTION(cpus.empty(), "The thread must be allowed to run on at least one CPU.");
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (U32 cpu : cpus)
+    {
+        EXCEPTION(cpu >= CPU_SETSIZE, "CPU number exceeds the maximal supported number of CPUs.");
+        CPU_SET(cpu, &cpuSet);
+    }
+    EXCEPTION(pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0,
+              "Could not set the affinity of the current thread. Check if the CPUs are available.");
+#endif
+}
+
+
+
+inline void SetCurrentThreadName([[maybe_unused]] const String& name)
+{
+#ifdef __linux__
+    const String truncatedName = name.substr(0, MaxThreadNameLength);
+    EXCEPTION(pthread_setname_np(pthread_self(), truncatedName.c_str()) != 0,
+              "Could not set the name of the current thread.");
+#endif
+}
+
+} // namespace GDL
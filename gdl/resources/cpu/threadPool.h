@@ -4,45 +4,116 @@
 #include "gdl/base/fundamentalTypes.h"
 #include "gdl/base/string.h"
 #include "gdl/base/uniquePtr.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/boundedThreadPoolQueue.h"
+#include "gdl/resources/cpu/eventCount.h"
 #include "gdl/resources/cpu/task.h"
+#include "gdl/resources/cpu/taskFuture.h"
 #include "gdl/resources/cpu/threadPoolQueue.h"
 
 
 #include <array>
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <thread>
+#include <type_traits>
 
 
 namespace GDL
 {
 
-template <I32>
+template <I32, bool, typename>
 class ThreadPoolThread;
 
 //! @brief Class that manages multiple worker threads.
+//! @tparam _numQueues: Number of queues. Lower queue numbers usually represent higher priorities, but the order in
+//! which the queues are processed is defined by the threads main loop function.
+//! @tparam _workStealing: If TRUE, each worker thread owns a local lock-free deque for every queue. Tasks that are
+//! submitted from inside a worker thread are pushed to its local deque instead of the shared queue. Idle threads try
+//! the shared queue first and steal from the deques of randomly selected worker threads afterwards.
+//! @tparam _queue: Type of the shared queues. Either the growable, lock protected ThreadPoolQueue or a lock-free
+//! BoundedThreadPoolQueue. The overflow policy of a bounded queue defines how tasks are handled if it is full.
+//! @remark Idle worker threads of the default main loop spin for a short time, yield afterwards and finally go to
+//! sleep until a new task is submitted. The thresholds can be adjusted with SetIdleThresholds. Custom main loops can
+//! use the same strategy by calling WaitForTasks.
+//! @remark Worker threads can be pinned to sets of logical CPUs and named with SetThreadAffinities and SetThreadName.
+//! Use the CpuTopology class to create CPU sets that match the cores or NUMA nodes of the system.
 //! @remark Worker thread exceptions are caught and the messages are stored in an exception message buffer that can be
-//! checked. This pool does not use futures to avoid an additional source of deadlocks. If you need to wait for results,
-//! resubmit the function until the necessary value is ready.
-template <I32 _numQueues = 1>
+//! checked. Tasks that are submitted with a future store their exceptions in the future instead. Waiting for a future
+//! with the thread pools Wait function executes pending tasks instead of blocking the waiting thread.
+template <I32 _numQueues = 1, bool _workStealing = false, typename _queue = ThreadPoolQueue<Task>>
 class ThreadPool
 {
     static_assert(_numQueues > 0, "The threadpool needs at least 1 queue");
 
-    template <I32>
+    template <I32, bool, typename>
     friend class ThreadPoolThread;
 
-    using QueueArray = std::array<ThreadPoolQueue<UniquePtr<TaskBase>>, _numQueues>;
+    using QueueArray = std::array<_queue, _numQueues>;
+    using WorkerThread = ThreadPoolThread<_numQueues, _workStealing, _queue>;
 
+    //! @brief Determines the result type of a continuation function
+    //! @tparam _type: Result type of the dependency
+    //! @tparam _function: Type of the continuation function
+    template <typename _type, typename _function>
+    struct ContinuationResult
+    {
+        using Type = std::invoke_result_t<std::decay_t<_function>&, const _type&>;
+    };
 
-    mutable std::mutex mMutexThreads;
+    template <typename _function>
+    struct ContinuationResult<void, _function>
+    {
+        using Type = std::invoke_result_t<std::decay_t<_function>&>;
+    };
+
+    //! @brief RAII class that blocks all steal attempts during its lifetime and waits until all running steal attempts
+    //! are finished. Necessary to modify the worker threads in work stealing mode.
+    class StealingBlocker
+    {
+        ThreadPool& mThreadPool;
+
+    public:
+        //! @brief Ctor
+        //! @param threadPool: Thread pool whose steal attempts should be blocked
+        explicit StealingBlocker(ThreadPool& threadPool);
+
+        StealingBlocker() = delete;
+        StealingBlocker(const StealingBlocker&) = delete;
+        StealingBlocker(StealingBlocker&&) = delete;
+        StealingBlocker& operator=(const StealingBlocker&) = delete;
+        StealingBlocker& operator=(StealingBlocker&&) = delete;
+        ~StealingBlocker();
+    };
+
+
+    mutable std::shared_mutex mMutexThreads;
     mutable std::mutex mMutexExceptionLog;
+    std::atomic_bool mStealingBlocked;
+    mutable std::atomic<U32> mNumThieves;
+    std::atomic<U32> mNumIdleSpins;
+    std::atomic<U32> mNumIdleYields;
+    EventCount mEventCount;
     String mExceptionLog;
-    Deque<ThreadPoolThread<_numQueues>> mThreads;
+    String mThreadName;
+    Vector<Vector<U32>> mThreadCpuSets;
+    Deque<WorkerThread> mThreads;
     QueueArray mQueue;
 
 
 public:
-    ThreadPool() = default;
+    //! @brief Capacity of each local work stealing deque. If a local deque is full, tasks are submitted to the shared
+    //! queue.
+    static constexpr U32 LocalQueueCapacity = 1024;
+
+    //! @brief Default number of unsuccessful iterations that an idle thread spins before it starts yielding
+    static constexpr U32 DefaultNumIdleSpins = 1024;
+
+    //! @brief Default number of unsuccessful iterations that an idle thread yields before it goes to sleep
+    static constexpr U32 DefaultNumIdleYields = 64;
+
+    ThreadPool();
     ThreadPool(const ThreadPool&) = delete;
     ThreadPool(ThreadPool&&) = delete;
     ThreadPool& operator=(const ThreadPool&) = delete;
@@ -100,6 +171,7 @@ public:
     //! @brief Returns true if the thread pool has tasks in the specified queue
     //! @param queueNum: Array number of the queue
     //! @return true/false
+    //! @remark In work stealing mode, the local queues of all worker threads are included.
     bool HasTasks(const I32 queueNum) const;
 
     //! @brief Returns true if the thread pool has tasks
@@ -110,6 +182,7 @@ public:
     //! @brief Gets the number of tasks in the specified queue
     //! @param queueNum: Array number of the queue
     //! @return Number of tasks in the queue
+    //! @remark In work stealing mode, the local queues of all worker threads are included.
     U32 GetNumTasks(const I32 queueNum) const;
 
     //! @brief Gets the number of tasks in the queue
@@ -117,9 +190,43 @@ public:
     //! @remark This function can only be used by thread pools with a single queue.
     U64 GetNumTasks() const;
 
+    //! @brief Gets the number of iterations that idle threads spin before they start yielding
+    //! @return Number of spinning iterations
+    U32 GetNumIdleSpins() const;
+
+    //! @brief Gets the number of iterations that idle threads yield before they go to sleep
+    //! @return Number of yielding iterations
+    U32 GetNumIdleYields() const;
+
+    //! @brief Gets the number of threads that are currently sleeping in WaitForTasks
+    //! @return Number of sleeping threads
+    U32 GetNumSleepingThreads() const;
+
+    //! @brief Sets the thresholds of the idle strategy used by WaitForTasks
+    //! @param numSpins: Number of unsuccessful iterations that an idle thread spins before it starts yielding
+    //! @param numYields: Number of unsuccessful iterations that an idle thread yields before it goes to sleep
+    //! @remark Set the number of spins to the maximum value of U32 to get the old busy waiting behavior
+    void SetIdleThresholds(U32 numSpins, U32 numYields);
+
+    //! @brief Sets the logical CPUs that newly started worker threads are pinned to. The thread with index i is pinned
+    //! to the CPU set with index i modulo the number of CPU sets.
+    //! @param cpuSets: CPU sets of the worker threads. If empty, new worker threads are not pinned.
+    //! @remark The pinning is applied by each thread before its initialization function is called. Memory that is
+    //! first touched by the initialization function is therefore allocated on the NUMA node of the thread. Already
+    //! running threads are not affected.
+    void SetThreadAffinities(const Vector<Vector<U32>>& cpuSets);
+
+    //! @brief Sets the name of newly started worker threads. Each thread gets the passed name followed by its index.
+    //! @param name: Name of the worker threads. If empty, the thread names are not changed.
+    //! @remark Names are truncated to MaxThreadNameLength characters by the operating system. Already running threads
+    //! are not affected.
+    void SetThreadName(const String& name);
+
     //! @brief Tries to fetch and execute a task from a specific queue
     //! @param queueNum: Array number of the queue
     //! @return TRUE if task was executed, FALSe if not
+    //! @remark In work stealing mode, worker threads check their local queue first. Afterwards the shared queue is
+    //! checked. If both are empty, the function tries to steal a task from another worker thread.
     bool TryExecuteTask(const I32 queueNum);
 
     //! @brief Tries to fetch and execute a task from the queue
@@ -133,6 +240,7 @@ public:
     //! @param queueNum: Array number of the queue that should store the task
     //! @param function: Function that should be executed
     //! @param args: Function arguments
+    //! @remark In work stealing mode, tasks submitted by a worker thread are pushed to its local queue.
     template <typename _function, typename... _args>
     void Submit(const I32 queueNum, _function&& function, _args&&... args);
 
@@ -145,6 +253,72 @@ public:
     template <typename _function, typename... _args>
     void Submit(_function&& function, _args&&... args);
 
+    //! @brief Submits a task to a certain queue of the thread pool and returns a future of its result
+    //! @tparam _function: Function or functor type
+    //! @tparam _args: Parameter pack of the functions argument types
+    //! @param queueNum: Array number of the queue that should store the task
+    //! @param function: Function that should be executed
+    //! @param args: Function arguments
+    //! @return Future of the functions result. Exceptions thrown by the function are stored in the future.
+    template <typename _function, typename... _args>
+    TaskFuture<std::invoke_result_t<std::decay_t<_function>&, std::decay_t<_args>&...>>
+    SubmitWithFuture(const I32 queueNum, _function&& function, _args&&... args);
+
+    //! @brief Submits a task to the queue of the thread pool and returns a future of its result
+    //! @tparam _function: Function or functor type
+    //! @tparam _args: Parameter pack of the functions argument types
+    //! @param function: Function that should be executed
+    //! @param args: Function arguments
+    //! @return Future of the functions result. Exceptions thrown by the function are stored in the future.
+    //! @remark This function can only be used by thread pools with a single queue.
+    template <typename _function, typename... _args>
+    TaskFuture<std::invoke_result_t<std::decay_t<_function>&, std::decay_t<_args>&...>>
+    SubmitWithFuture(_function&& function, _args&&... args);
+
+    //! @brief Submits a task to a certain queue of the thread pool as soon as the passed dependency is ready. The
+    //! result of the dependency is passed to the function.
+    //! @tparam _type: Result type of the dependency
+    //! @tparam _function: Function or functor type. Its signature must be R(const _type&) or R() if _type is void.
+    //! @param queueNum: Array number of the queue that should store the task
+    //! @param dependency: Future the task depends on. Use WhenAll to create a dependency on multiple futures.
+    //! @param function: Function that should be executed
+    //! @return Future of the functions result. If the dependency has an exception, the function is not executed and
+    //! the exception is forwarded to the returned future.
+    //! @remark The thread pool must not be destroyed before the dependency is ready.
+    template <typename _type, typename _function>
+    TaskFuture<typename ContinuationResult<_type, _function>::Type>
+    SubmitContinuation(const I32 queueNum, const TaskFuture<_type>& dependency, _function&& function);
+
+    //! @brief Submits a task to the queue of the thread pool as soon as the passed dependency is ready. The result of
+    //! the dependency is passed to the function.
+    //! @tparam _type: Result type of the dependency
+    //! @tparam _function: Function or functor type. Its signature must be R(const _type&) or R() if _type is void.
+    //! @param dependency: Future the task depends on. Use WhenAll to create a dependency on multiple futures.
+    //! @param function: Function that should be executed
+    //! @return Future of the functions result. If the dependency has an exception, the function is not executed and
+    //! the exception is forwarded to the returned future.
+    //! @remark This function can only be used by thread pools with a single queue. The thread pool must not be
+    //! destroyed before the dependency is ready.
+    template <typename _type, typename _function>
+    TaskFuture<typename ContinuationResult<_type, _function>::Type>
+    SubmitContinuation(const TaskFuture<_type>& dependency, _function&& function);
+
+    //! @brief Should be called by the main loop of a worker thread if it didn't find any task. Depending on the number
+    //! of consecutive unsuccessful iterations, the thread spins, yields or sleeps until a new task is submitted.
+    //! @param numIdleIterations: Number of consecutive unsuccessful iterations. It is increased by this function and
+    //! reset after the thread woke up. The main loop should reset it to 0 after a task was executed.
+    //! @remark Sleeping threads are only woken by new tasks in the shared queues or by tasks that are pushed to local
+    //! work stealing queues. Tasks of other sources, like external events checked by a custom main loop, do not wake
+    //! them up.
+    void WaitForTasks(U32& numIdleIterations);
+
+    //! @brief Waits until the passed future is ready. Instead of blocking, the calling thread executes pending tasks of
+    //! the thread pool. Queues with lower numbers are processed first.
+    //! @tparam _type: Result type of the future
+    //! @param future: Future that should be waited for
+    template <typename _type>
+    void Wait(const TaskFuture<_type>& future);
+
     //! @brief Clears the exception log
     void ClearExceptionLog();
 
@@ -156,6 +330,52 @@ public:
     void PropagateExceptions() const;
 
 private:
+    //! @brief Returns if all shared queues are empty
+    //! @return TRUE if all shared queues are empty, FALSE otherwise
+    bool AreSharedQueuesEmpty() const;
+
+    //! @brief Returns if the local work stealing queues of all worker threads are empty
+    //! @return TRUE if all local queues are empty or work stealing is disabled, FALSE otherwise
+    bool AreLocalQueuesEmpty() const;
+
+    //! @brief Pushes a task into the specified shared queue. If a bounded queue is full, the task is handled as
+    //! defined by its overflow policy.
+    //! @param queueNum: Array number of the queue
+    //! @param task: Task that should be pushed
+    void PushTask(const I32 queueNum, Task&& task);
+
+    //! @brief Creates a task from the passed function and arguments. The arguments are only bound if there are any.
+    //! @tparam _function: Function type
+    //! @tparam _args: Parameter pack for variable number of parameters of different types
+    //! @param function: Function that should be executed by the task
+    //! @param args: Function arguments
+    //! @return Task
+    template <typename _function, typename... _args>
+    static Task MakeTask(_function&& function, _args&&... args);
+
+    //! @brief Gets the worker thread of this thread pool that is executed by the calling thread
+    //! @return Pointer to the worker thread or nullptr if the calling thread is not a worker of this thread pool
+    WorkerThread* GetCurrentWorkerThread() const;
+
+    //! @brief Gets the total number of tasks stored in the local queues of all worker threads
+    //! @param queueNum: Array number of the queue
+    //! @return Approximate number of tasks in the local queues
+    //! @remark While worker threads are started or closed, the local queues are not accessible and 0 is returned.
+    //! The local tasks of closed threads are moved to the shared queue.
+    U64 GetNumLocalTasks(const I32 queueNum) const;
+
+    //! @brief Gets a thread local pseudo random number which is used to select the victims of steal attempts
+    //! @return Pseudo random number
+    static U32 GetRandomNumber();
+
+    //! @brief Tries to steal a task from the local queue of a randomly selected worker thread. All other threads are
+    //! tried subsequently if the first attempt fails.
+    //! @param queueNum: Array number of the queue
+    //! @param task: Reference to a task that stores the stolen task
+    //! @return TRUE if a task was stolen, FALSE if not
+    //! @remark If the worker threads are currently modified, the function returns FALSE without blocking
+    bool TryStealTask(const I32 queueNum, Task& task);
+
     //! @brief Adds a new message to the exception log
     //! @tparam _args: Parameter pack for variable number of parameters of different types
     //! @param args: The new message is constructed from all the passed arguments.
@@ -3,7 +3,7 @@
 #include "gdl/resources/cpu/threadPool.h"
 
 #include "gdl/base/exception.h"
-
+#include "gdl/base/simd/x86intrin.h"
 
 #include <cassert>
 #include <functional>
@@ -12,16 +12,28 @@
 namespace GDL
 {
 
-template <I32 _numQueues>
-ThreadPool<_numQueues>::~ThreadPool()
+template <I32 _numQueues, bool _workStealing, typename _queue>
+ThreadPool<_numQueues, _workStealing, _queue>::ThreadPool()
+    : mStealingBlocked{false}
+    , mNumThieves{0}
+    , mNumIdleSpins{DefaultNumIdleSpins}
+    , mNumIdleYields{DefaultNumIdleYields}
+{
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+ThreadPool<_numQueues, _workStealing, _queue>::~ThreadPool()
 {
     CloseAllThreads();
 }
 
 
 
-template <I32 _numQueues>
-ThreadPool<_numQueues>::ThreadPool(U32 numThreads)
+template <I32 _numQueues, bool _workStealing, typename _queue>
+ThreadPool<_numQueues, _workStealing, _queue>::ThreadPool(U32 numThreads)
+    : ThreadPool()
 {
     static_assert(_numQueues == 1, "This thread pool has multiple queues. Can't start threads. There is no default "
                                    "main loop for this case. Use the default constructor and add threads with a "
@@ -31,8 +43,8 @@ ThreadPool<_numQueues>::ThreadPool(U32 numThreads)
 
 
 
-template <I32 _numQueues>
-void ThreadPool<_numQueues>::Deinitialize()
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::Deinitialize()
 {
     CloseAllThreads();
     PropagateExceptions();
@@ -40,40 +52,46 @@ void ThreadPool<_numQueues>::Deinitialize()
 
 
 
-template <I32 _numQueues>
-U32 ThreadPool<_numQueues>::GetNumThreads() const
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U32 ThreadPool<_numQueues, _workStealing, _queue>::GetNumThreads() const
 {
-    std::lock_guard<std::mutex> lock(mMutexThreads);
+    std::shared_lock<std::shared_mutex> lock(mMutexThreads);
     return mThreads.size();
 }
 
 
 
-template <I32 _numQueues>
-void ThreadPool<_numQueues>::StartThreads(U32 numThreads)
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::StartThreads(U32 numThreads)
 {
     static_assert(_numQueues == 1, "This thread pool has multiple queues. Can't start threads. There is no default "
                                    "main loop for this case. Use \"StartThreads(numThreads, function)\" and provide a "
                                    "main loop function.");
 
-    StartThreads(numThreads, [this] { TryExecuteTask(); });
+    StartThreads(numThreads, [this, numIdleIterations = U32{0}]() mutable {
+        if (TryExecuteTask())
+            numIdleIterations = 0;
+        else
+            WaitForTasks(numIdleIterations);
+    });
 }
 
 
 
-template <I32 _numQueues>
+template <I32 _numQueues, bool _workStealing, typename _queue>
 template <typename _function>
-void ThreadPool<_numQueues>::StartThreads(U32 numThreads, _function&& function)
+void ThreadPool<_numQueues, _workStealing, _queue>::StartThreads(U32 numThreads, _function&& function)
 {
     StartThreads(numThreads, function, []() {}, []() {});
 }
 
 
 
-template <I32 _numQueues>
+template <I32 _numQueues, bool _workStealing, typename _queue>
 template <typename _function, typename _initFunction, typename _deinitFunction>
-void ThreadPool<_numQueues>::StartThreads(U32 numThreads, _function&& function, _initFunction&& initFunction,
-                                          _deinitFunction&& deinitFunction)
+void ThreadPool<_numQueues, _workStealing, _queue>::StartThreads(U32 numThreads, _function&& function,
+                                                                 _initFunction&& initFunction,
+                                                                 _deinitFunction&& deinitFunction)
 {
     static_assert(std::is_same<void, std::invoke_result_t<decltype(function)>>::value,
                   "The threads main loop function should not return any value.");
@@ -82,17 +100,27 @@ void ThreadPool<_numQueues>::StartThreads(U32 numThreads, _function&& function,
     static_assert(std::is_same<void, std::invoke_result_t<decltype(initFunction)>>::value,
                   "The threads deinitialization function should not return any value.");
 
-    std::lock_guard<std::mutex> lock(mMutexThreads);
+    std::lock_guard<std::shared_mutex> lock(mMutexThreads);
+    StealingBlocker stealingBlocker(*this);
+
     for (U32 i = 0; i < numThreads; ++i)
-        mThreads.emplace_back(*this, std::move(function), std::move(initFunction), std::move(deinitFunction));
+    {
+        const U32 threadIndex = static_cast<U32>(mThreads.size());
+        Vector<U32> cpuSet =
+                (mThreadCpuSets.empty()) ? Vector<U32>() : mThreadCpuSets[threadIndex % mThreadCpuSets.size()];
+        String threadName = (mThreadName.empty()) ? String() : mThreadName + ToString(threadIndex);
+        mThreads.emplace_back(*this, std::move(cpuSet), std::move(threadName), std::move(function),
+                              std::move(initFunction), std::move(deinitFunction));
+    }
 }
 
 
 
-template <I32 _numQueues>
-void ThreadPool<_numQueues>::CloseThreads(I32 numThreadsToClose)
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::CloseThreads(I32 numThreadsToClose)
 {
-    std::lock_guard<std::mutex> lock(mMutexThreads);
+    std::lock_guard<std::shared_mutex> lock(mMutexThreads);
+    StealingBlocker stealingBlocker(*this);
 
     const I32 numRunningThreads = static_cast<I32>(mThreads.size());
 
@@ -103,6 +131,7 @@ void ThreadPool<_numQueues>::CloseThreads(I32 numThreadsToClose)
     // Notify threads to exit main loop
     for (I32 i = numRunningThreads; i > numRunningThreads - numThreadsToClose; --i)
         mThreads[i - 1].Close();
+    mEventCount.NotifyAll();
 
     // Pop threads from the back of the container
     for (I32 i = 0; i < numThreadsToClose; ++i)
@@ -111,58 +140,120 @@ void ThreadPool<_numQueues>::CloseThreads(I32 numThreadsToClose)
 
 
 
-template <I32 _numQueues>
-void ThreadPool<_numQueues>::CloseAllThreads()
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::CloseAllThreads()
 {
-    std::lock_guard<std::mutex> lock(mMutexThreads);
+    std::lock_guard<std::shared_mutex> lock(mMutexThreads);
+    StealingBlocker stealingBlocker(*this);
 
     for (auto& thread : mThreads)
         thread.Close();
+    mEventCount.NotifyAll();
     mThreads.clear();
 }
 
 
 
-template <I32 _numQueues>
-bool ThreadPool<_numQueues>::HasTasks() const
+template <I32 _numQueues, bool _workStealing, typename _queue>
+bool ThreadPool<_numQueues, _workStealing, _queue>::HasTasks() const
 {
     static_assert(_numQueues == 1, "This thread pool has multiple queues. Use the corresponding function overload to "
                                    "specify which one you want to use.");
-    return !mQueue[0].IsEmpty();
+    return HasTasks(0);
 }
 
 
 
-template <I32 _numQueues>
-bool ThreadPool<_numQueues>::HasTasks(const I32 queueNum) const
+template <I32 _numQueues, bool _workStealing, typename _queue>
+bool ThreadPool<_numQueues, _workStealing, _queue>::HasTasks(const I32 queueNum) const
 {
     assert(queueNum < _numQueues && queueNum >= 0);
+    if constexpr (_workStealing)
+        if (GetNumLocalTasks(queueNum) > 0)
+            return true;
     return !mQueue[queueNum].IsEmpty();
 }
 
 
 
-template <I32 _numQueues>
-U64 ThreadPool<_numQueues>::GetNumTasks() const
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U64 ThreadPool<_numQueues, _workStealing, _queue>::GetNumTasks() const
 {
     static_assert(_numQueues == 1, "This thread pool has multiple queues. Use the corresponding function overload to "
                                    "specify which one you want to use.");
-    return mQueue[0].GetSize();
+    return GetNumTasks(0);
 }
 
 
 
-template <I32 _numQueues>
-U32 ThreadPool<_numQueues>::GetNumTasks(const I32 queueNum) const
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U32 ThreadPool<_numQueues, _workStealing, _queue>::GetNumTasks(const I32 queueNum) const
 {
     assert(queueNum < _numQueues && queueNum >= 0);
-    return mQueue[queueNum].GetSize();
+    if constexpr (_workStealing)
+        return mQueue[queueNum].GetSize() + GetNumLocalTasks(queueNum);
+    else
+        return mQueue[queueNum].GetSize();
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U32 ThreadPool<_numQueues, _workStealing, _queue>::GetNumIdleSpins() const
+{
+    return mNumIdleSpins.load(std::memory_order_relaxed);
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U32 ThreadPool<_numQueues, _workStealing, _queue>::GetNumIdleYields() const
+{
+    return mNumIdleYields.load(std::memory_order_relaxed);
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U32 ThreadPool<_numQueues, _workStealing, _queue>::GetNumSleepingThreads() const
+{
+    return mEventCount.GetNumWaiters();
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::SetIdleThresholds(U32 numSpins, U32 numYields)
+{
+    mNumIdleSpins.store(numSpins, std::memory_order_relaxed);
+    mNumIdleYields.store(numYields, std::memory_order_relaxed);
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::SetThreadAffinities(const Vector<Vector<U32>>& cpuSets)
+{
+    for (const auto& cpuSet : cpuSets)
+        EXCEPTION(cpuSet.empty(), "CPU sets must contain at least one logical CPU.");
+
+    std::lock_guard<std::shared_mutex> lock(mMutexThreads);
+    mThreadCpuSets = cpuSets;
 }
 
 
 
-template <I32 _numQueues>
-bool ThreadPool<_numQueues>::TryExecuteTask()
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::SetThreadName(const String& name)
+{
+    std::lock_guard<std::shared_mutex> lock(mMutexThreads);
+    mThreadName = name;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+bool ThreadPool<_numQueues, _workStealing, _queue>::TryExecuteTask()
 {
     static_assert(_numQueues == 1, "This thread pool has multiple queues. Use the corresponding function overload to "
                                    "specify which one you want to use.");
@@ -171,43 +262,73 @@ bool ThreadPool<_numQueues>::TryExecuteTask()
 
 
 
-template <I32 _numQueues>
-bool ThreadPool<_numQueues>::TryExecuteTask(const I32 queueNum)
+template <I32 _numQueues, bool _workStealing, typename _queue>
+bool ThreadPool<_numQueues, _workStealing, _queue>::TryExecuteTask(const I32 queueNum)
 {
     assert(queueNum < _numQueues && queueNum >= 0);
-    UniquePtr<TaskBase> task{nullptr};
+
+    Task task;
+
+    if constexpr (_workStealing)
+    {
+        WorkerThread* thread = GetCurrentWorkerThread();
+        if (thread != nullptr && thread->TryPopLocal(queueNum, task))
+        {
+            task.Execute();
+            return true;
+        }
+    }
+
     if (mQueue[queueNum].TryPop(task))
     {
-        task->execute();
+        task.Execute();
         return true;
     }
+
+    if constexpr (_workStealing)
+    {
+        if (TryStealTask(queueNum, task))
+        {
+            task.Execute();
+            return true;
+        }
+    }
     return false;
 }
 
 
 
-template <I32 _numQueues>
+template <I32 _numQueues, bool _workStealing, typename _queue>
 template <typename _function, typename... _args>
-void ThreadPool<_numQueues>::Submit(const I32 queueNum, _function&& function, _args&&... args)
+void ThreadPool<_numQueues, _workStealing, _queue>::Submit(const I32 queueNum, _function&& function, _args&&... args)
 {
     using ResultType =
             std::invoke_result_t<decltype(std::bind(std::forward<_function>(function), std::forward<_args>(args)...))>;
-    using TaskType = Task<decltype(std::bind(std::forward<_function>(function), std::forward<_args>(args)...))>;
-
 
     static_assert(std::is_same<void, ResultType>::value, "Used submit() with non void function!");
     assert(queueNum < _numQueues && queueNum >= 0);
 
 
-    mQueue[queueNum].Push(
-            MakeUnique<TaskType>(std::bind(std::forward<_function>(function), std::forward<_args>(args)...)));
+    Task task = MakeTask(std::forward<_function>(function), std::forward<_args>(args)...);
+
+    if constexpr (_workStealing)
+    {
+        WorkerThread* thread = GetCurrentWorkerThread();
+        if (thread != nullptr && thread->TryPushLocal(queueNum, task))
+        {
+            mEventCount.NotifyOne();
+            return;
+        }
+    }
+
+    PushTask(queueNum, std::move(task));
 }
 
 
 
-template <I32 _numQueues>
+template <I32 _numQueues, bool _workStealing, typename _queue>
 template <typename _function, typename... _args>
-void ThreadPool<_numQueues>::Submit(_function&& function, _args&&... args)
+void ThreadPool<_numQueues, _workStealing, _queue>::Submit(_function&& function, _args&&... args)
 {
     static_assert(_numQueues == 1, "This thread pool has multiple queues. Use the corresponding function overload to "
                                    "specify which one you want to use.");
@@ -216,8 +337,147 @@ void ThreadPool<_numQueues>::Submit(_function&& function, _args&&... args)
 
 
 
-template <I32 _numQueues>
-void ThreadPool<_numQueues>::ClearExceptionLog()
+template <I32 _numQueues, bool _workStealing, typename _queue>
+template <typename _function, typename... _args>
+TaskFuture<std::invoke_result_t<std::decay_t<_function>&, std::decay_t<_args>&...>>
+ThreadPool<_numQueues, _workStealing, _queue>::SubmitWithFuture(const I32 queueNum, _function&& function,
+                                                                _args&&... args)
+{
+    using ResultType = std::invoke_result_t<std::decay_t<_function>&, std::decay_t<_args>&...>;
+
+    TaskPromise<ResultType> promise;
+    TaskFuture<ResultType> future = promise.GetFuture();
+
+    Submit(queueNum, [promise = std::move(promise),
+                      boundFunction = std::bind(std::forward<_function>(function),
+                                                std::forward<_args>(args)...)]() mutable {
+        promise.ExecuteAndSetResult(boundFunction);
+    });
+
+    return future;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+template <typename _function, typename... _args>
+TaskFuture<std::invoke_result_t<std::decay_t<_function>&, std::decay_t<_args>&...>>
+ThreadPool<_numQueues, _workStealing, _queue>::SubmitWithFuture(_function&& function, _args&&... args)
+{
+    static_assert(_numQueues == 1, "This thread pool has multiple queues. Use the corresponding function overload to "
+                                   "specify which one you want to use.");
+    return SubmitWithFuture(0, std::forward<_function>(function), std::forward<_args>(args)...);
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+template <typename _type, typename _function>
+TaskFuture<typename ThreadPool<_numQueues, _workStealing, _queue>::template ContinuationResult<_type, _function>::Type>
+ThreadPool<_numQueues, _workStealing, _queue>::SubmitContinuation(const I32 queueNum,
+                                                                  const TaskFuture<_type>& dependency,
+                                                                  _function&& function)
+{
+    using ResultType = typename ContinuationResult<_type, _function>::Type;
+
+    assert(queueNum < _numQueues && queueNum >= 0);
+    DEV_EXCEPTION(!dependency.IsValid(), "Dependency is not a valid future.");
+
+    TaskPromise<ResultType> promise;
+    TaskFuture<ResultType> future = promise.GetFuture();
+
+    // The task is submitted by the thread that finishes the dependency. In work stealing mode it usually ends up in
+    // the local queue of this thread.
+    dependency.OnReady([this, queueNum, dependency, promise = std::move(promise),
+                        function = std::decay_t<_function>(std::forward<_function>(function))]() mutable {
+        Submit(queueNum, [dependency = std::move(dependency), promise = std::move(promise),
+                          function = std::move(function)]() mutable {
+            promise.ExecuteAndSetResult([&]() -> ResultType {
+                if constexpr (std::is_void_v<_type>)
+                {
+                    dependency.Get();
+                    return function();
+                }
+                else
+                    return function(dependency.Get());
+            });
+        });
+    });
+
+    return future;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+template <typename _type, typename _function>
+TaskFuture<typename ThreadPool<_numQueues, _workStealing, _queue>::template ContinuationResult<_type, _function>::Type>
+ThreadPool<_numQueues, _workStealing, _queue>::SubmitContinuation(const TaskFuture<_type>& dependency,
+                                                                  _function&& function)
+{
+    static_assert(_numQueues == 1, "This thread pool has multiple queues. Use the corresponding function overload to "
+                                   "specify which one you want to use.");
+    return SubmitContinuation(0, dependency, std::forward<_function>(function));
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::WaitForTasks(U32& numIdleIterations)
+{
+    const U32 numSpins = mNumIdleSpins.load(std::memory_order_relaxed);
+    const U32 numYields = mNumIdleYields.load(std::memory_order_relaxed);
+
+    if (numIdleIterations < numSpins)
+    {
+        ++numIdleIterations;
+        _mm_pause();
+        return;
+    }
+
+    if (numIdleIterations - numSpins < numYields)
+    {
+        ++numIdleIterations;
+        std::this_thread::yield();
+        return;
+    }
+
+    // The wake-up conditions must be checked after the wait is prepared. Otherwise notifications might get lost.
+    const U32 key = mEventCount.PrepareWait();
+    WorkerThread* thread = GetCurrentWorkerThread();
+    if (!AreSharedQueuesEmpty() || !AreLocalQueuesEmpty() || (thread != nullptr && thread->mClose))
+    {
+        mEventCount.CancelWait();
+        return;
+    }
+
+    mEventCount.Wait(key);
+    numIdleIterations = 0;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+template <typename _type>
+void ThreadPool<_numQueues, _workStealing, _queue>::Wait(const TaskFuture<_type>& future)
+{
+    DEV_EXCEPTION(!future.IsValid(), "Future is not valid.");
+
+    while (!future.IsReady())
+    {
+        bool executedTask = false;
+        for (I32 i = 0; i < _numQueues && !executedTask; ++i)
+            executedTask = TryExecuteTask(i);
+
+        if (!executedTask)
+            std::this_thread::yield();
+    }
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::ClearExceptionLog()
 {
     std::lock_guard<std::mutex> lock(mMutexExceptionLog);
     mExceptionLog.clear();
@@ -225,8 +485,8 @@ void ThreadPool<_numQueues>::ClearExceptionLog()
 
 
 
-template <I32 _numQueues>
-U32 ThreadPool<_numQueues>::GetExceptionLogSize() const
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U32 ThreadPool<_numQueues, _workStealing, _queue>::GetExceptionLogSize() const
 {
     std::lock_guard<std::mutex> lock(mMutexExceptionLog);
     return mExceptionLog.size();
@@ -234,8 +494,8 @@ U32 ThreadPool<_numQueues>::GetExceptionLogSize() const
 
 
 
-template <I32 _numQueues>
-void ThreadPool<_numQueues>::PropagateExceptions() const
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::PropagateExceptions() const
 {
     std::lock_guard<std::mutex> lock(mMutexExceptionLog);
     EXCEPTION(!mExceptionLog.empty(), mExceptionLog.c_str());
@@ -243,9 +503,179 @@ void ThreadPool<_numQueues>::PropagateExceptions() const
 
 
 
-template <I32 _numQueues>
+template <I32 _numQueues, bool _workStealing, typename _queue>
+bool ThreadPool<_numQueues, _workStealing, _queue>::AreSharedQueuesEmpty() const
+{
+    for (const auto& queue : mQueue)
+        if (!queue.IsEmpty())
+            return false;
+    return true;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+bool ThreadPool<_numQueues, _workStealing, _queue>::AreLocalQueuesEmpty() const
+{
+    if constexpr (_workStealing)
+        for (I32 i = 0; i < _numQueues; ++i)
+            if (GetNumLocalTasks(i) > 0)
+                return false;
+    return true;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+void ThreadPool<_numQueues, _workStealing, _queue>::PushTask(const I32 queueNum, Task&& task)
+{
+    if constexpr (IsBoundedThreadPoolQueue<_queue>::value)
+    {
+        while (!mQueue[queueNum].TryPush(std::move(task)))
+        {
+            if constexpr (_queue::Overflow == OverflowPolicy::INLINE)
+            {
+                task.Execute();
+                return;
+            }
+            else if (!TryExecuteTask(queueNum))
+                std::this_thread::yield();
+        }
+    }
+    else
+        mQueue[queueNum].Push(std::move(task));
+
+    mEventCount.NotifyOne();
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+template <typename _function, typename... _args>
+Task ThreadPool<_numQueues, _workStealing, _queue>::MakeTask(_function&& function, _args&&... args)
+{
+    if constexpr (sizeof...(_args) == 0)
+        return Task(std::forward<_function>(function));
+    else
+        return Task(std::bind(std::forward<_function>(function), std::forward<_args>(args)...));
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+typename ThreadPool<_numQueues, _workStealing, _queue>::WorkerThread*
+ThreadPool<_numQueues, _workStealing, _queue>::GetCurrentWorkerThread() const
+{
+    WorkerThread* thread = WorkerThread::GetCurrentThread();
+    if (thread != nullptr && &thread->mThreadPool == this)
+        return thread;
+    return nullptr;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U64 ThreadPool<_numQueues, _workStealing, _queue>::GetNumLocalTasks(const I32 queueNum) const
+{
+    static_assert(_workStealing, "Local queues are only available in work stealing mode.");
+
+    // Never lock the thread mutex here. Tasks might call this function while the threads are closed and joined by a
+    // thread that holds the lock. The threads are protected in the same way as during steal attempts instead.
+    if (mStealingBlocked)
+        return 0;
+    ++mNumThieves;
+    if (mStealingBlocked)
+    {
+        --mNumThieves;
+        return 0;
+    }
+
+    U64 numTasks = 0;
+    for (const auto& thread : mThreads)
+        numTasks += thread.GetNumLocalTasks(queueNum);
+
+    --mNumThieves;
+    return numTasks;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+U32 ThreadPool<_numQueues, _workStealing, _queue>::GetRandomNumber()
+{
+    // xorshift32 - https://en.wikipedia.org/wiki/Xorshift
+    static thread_local U32 state =
+            static_cast<U32>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1;
+
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+bool ThreadPool<_numQueues, _workStealing, _queue>::TryStealTask(const I32 queueNum, Task& task)
+{
+    static_assert(_workStealing, "Stealing is only available in work stealing mode.");
+
+    // Never block here. Threads that are closed by another thread need to leave their main loop.
+    if (mStealingBlocked)
+        return false;
+    ++mNumThieves;
+    if (mStealingBlocked)
+    {
+        --mNumThieves;
+        return false;
+    }
+
+    bool success = false;
+    const U32 numThreads = static_cast<U32>(mThreads.size());
+    if (numThreads > 0)
+    {
+        const WorkerThread* currentThread = GetCurrentWorkerThread();
+        const U32 firstVictim = GetRandomNumber() % numThreads;
+
+        for (U32 i = 0; i < numThreads && !success; ++i)
+        {
+            WorkerThread& victim = mThreads[(firstVictim + i) % numThreads];
+            success = &victim != currentThread && victim.TryStealLocal(queueNum, task);
+        }
+    }
+
+    --mNumThieves;
+    return success;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+ThreadPool<_numQueues, _workStealing, _queue>::StealingBlocker::StealingBlocker(ThreadPool& threadPool)
+    : mThreadPool{threadPool}
+{
+    if constexpr (_workStealing)
+    {
+        mThreadPool.mStealingBlocked = true;
+        while (mThreadPool.mNumThieves > 0)
+            std::this_thread::yield();
+    }
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
+ThreadPool<_numQueues, _workStealing, _queue>::StealingBlocker::~StealingBlocker()
+{
+    if constexpr (_workStealing)
+        mThreadPool.mStealingBlocked = false;
+}
+
+
+
+template <I32 _numQueues, bool _workStealing, typename _queue>
 template <typename... _args>
-void ThreadPool<_numQueues>::AddMessageToExceptionLog(const _args&... args)
+void ThreadPool<_numQueues, _workStealing, _queue>::AddMessageToExceptionLog(const _args&... args)
 {
     std::lock_guard<std::mutex> lock(mMutexExceptionLog);
     AppendToString(mExceptionLog, args..., "\n\n");
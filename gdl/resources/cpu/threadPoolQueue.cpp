@@ -1,64 +1,131 @@
 #include "gdl/resources/cpu/threadPoolQueue.h"
 
-#include "gdl/base/uniquePtr.h"
-#include "gdl/resources/cpu/taskBase.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/isPowerOf2.h"
+#include "gdl/resources/cpu/task.h"
 
 #include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#ifndef USE_STD_ALLOCATOR
+#include "gdl/resources/memory/generalPurposeAllocator.h"
+#endif
 
 
 namespace GDL
 {
 
+#ifndef USE_STD_ALLOCATOR
+template <typename _type>
+using BufferAllocator = GeneralPurposeAllocator<_type>;
+#else
+template <typename _type>
+using BufferAllocator = std::allocator<_type>;
+#endif
+
+
 
 template <typename _type>
-ThreadPoolQueue<_type>::ThreadPoolQueue()
+ThreadPoolQueue<_type>::ThreadPoolQueue(U64 initialCapacity)
     : mSpinLock{}
+    , mBuffer{nullptr}
+    , mCapacity{initialCapacity}
+    , mFirst{0}
+    , mSize{0}
 {
+    static_assert(std::is_nothrow_move_constructible_v<_type>, "Type must be nothrow move constructible.");
+    EXCEPTION(initialCapacity == 0 || !IsPowerOf2(initialCapacity), "Capacity must be a power of 2.");
+    mBuffer = BufferAllocator<_type>().allocate(mCapacity);
 }
 
 template <typename _type>
 ThreadPoolQueue<_type>::~ThreadPoolQueue()
 {
+    for (U64 i = 0; i < mSize; ++i)
+        mBuffer[(mFirst + i) & (mCapacity - 1)].~_type();
+    BufferAllocator<_type>().deallocate(mBuffer, mCapacity);
 }
 
 
 
 template <typename _type>
-void ThreadPoolQueue<_type>::Push(_type value)
+void ThreadPoolQueue<_type>::Push(_type&& value)
 {
     std::lock_guard<SpinLock> lock(mSpinLock);
-    mQueue.push(std::move(value));
+    if (mSize == mCapacity)
+        Grow();
+    new (&mBuffer[(mFirst + mSize) & (mCapacity - 1)]) _type(std::move(value));
+    ++mSize;
 }
 
 template <typename _type>
 bool ThreadPoolQueue<_type>::TryPop(_type& out)
 {
     std::lock_guard<SpinLock> lock(mSpinLock);
-    if (mQueue.empty())
+    if (mSize == 0)
     {
         return false;
     }
-    out = std::move(mQueue.front());
-    mQueue.pop();
+    _type& first = mBuffer[mFirst];
+    out = std::move(first);
+    first.~_type();
+    mFirst = (mFirst + 1) & (mCapacity - 1);
+    --mSize;
     return true;
 }
 
 
 
+template <typename _type>
+U64 ThreadPoolQueue<_type>::GetCapacity() const
+{
+    std::lock_guard<SpinLock> lockGuard(mSpinLock);
+    return mCapacity;
+}
+
+template <typename _type>
+SpinLockStatistics ThreadPoolQueue<_type>::GetLockStatistics() const
+{
+    return mSpinLock.GetStatistics();
+}
+
 template <typename _type>
 bool ThreadPoolQueue<_type>::IsEmpty() const
 {
     std::lock_guard<SpinLock> lockGuard(mSpinLock);
-    return mQueue.empty();
+    return mSize == 0;
 }
 
 template <typename _type>
 U64 ThreadPoolQueue<_type>::GetSize() const
 {
     std::lock_guard<SpinLock> lockGuard(mSpinLock);
-    return mQueue.size();
+    return mSize;
 }
 
 
-template class ThreadPoolQueue<UniquePtr<TaskBase>>;
+
+template <typename _type>
+void ThreadPoolQueue<_type>::Grow()
+{
+    const U64 newCapacity = 2 * mCapacity;
+    _type* newBuffer = BufferAllocator<_type>().allocate(newCapacity);
+
+    for (U64 i = 0; i < mSize; ++i)
+    {
+        _type& value = mBuffer[(mFirst + i) & (mCapacity - 1)];
+        new (&newBuffer[i]) _type(std::move(value));
+        value.~_type();
+    }
+
+    BufferAllocator<_type>().deallocate(mBuffer, mCapacity);
+    mBuffer = newBuffer;
+    mCapacity = newCapacity;
+    mFirst = 0;
 }
+
+
+template class ThreadPoolQueue<Task>;
+} // namespace GDL
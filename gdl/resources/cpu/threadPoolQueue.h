@@ -1,21 +1,30 @@
 #pragma once
 
 #include "gdl/base/fundamentalTypes.h"
-#include "gdl/base/container/queue.h"
 #include "gdl/resources/cpu/spinlock.h"
 
 
 namespace GDL
 {
+
+//! @brief Thread safe FIFO queue of the thread pool. The values are stored in a ring buffer which grows if it is full.
+//! Therefore, push and pop operations do not allocate memory unless the capacity needs to be increased.
+//! @tparam _type: Value type. Must be nothrow move constructible.
 template <typename _type>
 class ThreadPoolQueue
 {
     mutable SpinLock mSpinLock; //!< Spinlock to protect internal data from data races
-    Queue<_type> mQueue; //!< Queue filled with tasks
+    _type* mBuffer; //!< Ring buffer filled with tasks
+    U64 mCapacity; //!< Capacity of the ring buffer. Always a power of 2
+    U64 mFirst; //!< Index of the first value
+    U64 mSize; //!< Number of stored values
 
 
 public:
-    ThreadPoolQueue();
+    //! @brief Constructor
+    //! @param initialCapacity: Initial capacity of the ring buffer. Must be a power of 2.
+    explicit ThreadPoolQueue(U64 initialCapacity = 64);
+
     ThreadPoolQueue(const ThreadPoolQueue& other) = delete;
     ThreadPoolQueue(ThreadPoolQueue&& other) = delete;
     ThreadPoolQueue& operator=(const ThreadPoolQueue& other) = delete;
@@ -24,9 +33,9 @@ public:
 
 
 
-    //! @brief Pushes a new value into the queue and informs a waiting thread
+    //! @brief Pushes a new value into the queue
     //! @param value New value
-    void Push(_type value);
+    void Push(_type&& value);
 
 
     //! @brief Tries to get the next value of the queue
@@ -35,6 +44,14 @@ public:
     bool TryPop(_type& out);
 
 
+    //! @brief Gets the capacity of the internal ring buffer
+    //! @return Capacity
+    U64 GetCapacity() const;
+
+    //! @brief Gets the contention statistics of the internal spinlock
+    //! @return Spinlock statistics. All values are zero if the statistics are disabled.
+    SpinLockStatistics GetLockStatistics() const;
+
     //! @brief Returns if the queue is empty or not
     //! @return TRUE if the queue is empty, FALSE if not
     bool IsEmpty() const;
@@ -42,5 +59,10 @@ public:
     //! @brief Gets the size of the queue
     //! @return Size
     U64 GetSize() const;
+
+private:
+    //! @brief Doubles the capacity of the ring buffer
+    //! @remark The caller must hold the lock
+    void Grow();
 };
-}
+} // namespace GDL
@@ -1,25 +1,53 @@
 #pragma once
 
 #include <gdl/base/fundamentalTypes.h>
+#include <gdl/base/string.h>
+#include <gdl/base/uniquePtr.h>
+#include <gdl/base/container/vector.h>
+#include <gdl/resources/cpu/task.h>
+#include <gdl/resources/cpu/workStealingDeque.h>
 
+#include <array>
 #include <atomic>
+#include <memory>
 #include <thread>
 
 namespace GDL
 {
 
-template <I32>
+template <I32, bool, typename>
 class ThreadPool;
 
 //! @brief Class for worker threads of the thread pool
 //! @tparam _numThreadPoolQueues: Number of queues used by the thread pool. Necessary since there is no common base
 //! class of all thread pools and this class needs to store a reference to the thread pool
-template <I32 _numThreadPoolQueues>
+//! @tparam _workStealing: If TRUE, the thread owns a local work stealing deque for each queue of the thread pool
+//! @tparam _queue: Type of the shared queues of the thread pool
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
 class ThreadPoolThread
 {
+    template <I32, bool, typename>
+    friend class ThreadPool;
+
+    //! @brief Storage of a task that is pushed to a local queue. The slots of the local queues must be atomic, so they
+    //! can only store pointers to the task slots. A slot is occupied until the task is popped or stolen.
+    struct alignas(64) TaskSlot
+    {
+        Task mTask;
+        std::atomic_bool mOccupied = false;
+    };
+
+    using LocalQueueArray = std::array<std::unique_ptr<WorkStealingDeque<TaskSlot*>>, _numThreadPoolQueues>;
+
+    inline static thread_local ThreadPoolThread* mCurrentThread = nullptr;
 
     std::atomic_bool mClose;
-    ThreadPool<_numThreadPoolQueues>& mThreadPool;
+    ThreadPool<_numThreadPoolQueues, _workStealing, _queue>& mThreadPool;
+    LocalQueueArray mLocalQueues;
+    std::unique_ptr<TaskSlot[]> mTaskSlots;
+    U32 mNextTaskSlot;
+    Vector<U32> mCpuSet;
+    String mName;
     std::thread mThread; // <--- Always last member (initialization problems may occur if not)
 
 public:
@@ -35,11 +63,14 @@ public:
     //! @tparam _initFunction: Type of the initialization function
     //! @tparam _deinitFunction: Type of the deinitialization function
     //! @param threadPool: The threads thread pool
+    //! @param cpuSet: Logical CPUs the thread should be pinned to. If empty, the thread is not pinned.
+    //! @param name: Name of the thread. If empty, the name is not changed.
     //! @param function: Function that should be run
     //! @param initFunction: Initialization function
     //! @param deinitFunction: Deinitialization function
     template <typename _function, typename _initFunction, typename _deinitFunction>
-    ThreadPoolThread(ThreadPool<_numThreadPoolQueues>& threadPool, _function&& function, _initFunction&& initFunction,
+    ThreadPoolThread(ThreadPool<_numThreadPoolQueues, _workStealing, _queue>& threadPool, Vector<U32> cpuSet,
+                     String name, _function&& function, _initFunction&& initFunction,
                      _deinitFunction&& deinitFunction);
 
     //! @brief Stops the threads while loop
@@ -53,11 +84,69 @@ public:
     void Run(_function&& function, _initFunction&& initFunction, _deinitFunction&& deinitFunction);
 
 private:
+    //! @brief Creates the local queues if work stealing is enabled
+    //! @return Array of local queues. Contains only nullptr if work stealing is disabled
+    static LocalQueueArray CreateLocalQueues();
+
+    //! @brief Creates the ring of task slots of the local queues if work stealing is enabled
+    //! @return Task slots. Contains only nullptr if work stealing is disabled
+    static std::unique_ptr<TaskSlot[]> CreateTaskSlots();
+
+    //! @brief Gets the number of task slots
+    //! @return Number of task slots
+    static constexpr U32 GetNumTaskSlots();
+
+    //! @brief Moves the task out of a slot that was popped or stolen from a local queue and releases the slot
+    //! @param slot: Task slot
+    //! @param task: Reference to a task that stores the fetched task
+    static void TakeTask(TaskSlot* slot, Task& task);
+
+    //! @brief Gets the thread pool thread that is executed by the calling thread
+    //! @return Pointer to the thread pool thread or nullptr if the calling thread is not a thread pool thread
+    static ThreadPoolThread* GetCurrentThread();
+
+    //! @brief Gets the number of tasks in the specified local queue
+    //! @param queueNum: Array number of the queue
+    //! @return Approximate number of tasks in the local queue
+    U64 GetNumLocalTasks(I32 queueNum) const;
+
+    //! @brief Pins the calling thread to its CPU set and sets its name
+    //! @remark This function must only be called by the owning thread
+    void ApplyPlacement();
+
     //! @brief Wraps a try catch block around the passed function and handles occurring exceptions
     //! @tparam _function: Type of the passed function
     //! @param function: Function that needs exception handling
     template <typename _function>
     inline void HandleExceptions(_function&& function);
+
+    //! @brief Moves all tasks of the local queues to the corresponding queues of the thread pool.
+    //! @remark This function must only be called by the owning thread after it left its main loop
+    void MoveLocalTasksToThreadPool();
+
+    //! @brief Tries to pop a task from the specified local queue
+    //! @param queueNum: Array number of the queue
+    //! @param task: Reference to a task that stores the fetched task
+    //! @return TRUE if the operation was successful, FALSE if not
+    //! @remark This function must only be called by the owning thread
+    bool TryPopLocal(I32 queueNum, Task& task);
+
+    //! @brief Tries to move a task into the next slot of the task slot ring and to push the slot to the specified local
+    //! queue
+    //! @param queueNum: Array number of the queue
+    //! @param task: Task that should be pushed. It is left unchanged if the operation fails.
+    //! @return TRUE if the operation was successful, FALSE if the local queue is full or the next task slot is still
+    //! occupied
+    //! @remark This function must only be called by the owning thread
+    bool TryPushLocal(I32 queueNum, Task& task);
+
+    //! @brief Tries to steal a task from the specified local queue
+    //! @param queueNum: Array number of the queue
+    //! @param task: Reference to a task that stores the stolen task
+    //! @return TRUE if the operation was successful, FALSE if not
+    //! @remark The task is moved out of the slot before the function returns. The caller must prevent the destruction
+    //! of this thread during the call (see ThreadPool::StealingBlocker).
+    bool TryStealLocal(I32 queueNum, Task& task);
 };
 } // namespace GDL
 
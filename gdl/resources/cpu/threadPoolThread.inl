@@ -1,6 +1,10 @@
 #pragma once
 
 #include "gdl/resources/cpu/threadPoolThread.h"
+
+#include "gdl/resources/cpu/threadAffinity.h"
+
+#include <cassert>
 #include <mutex>
 
 
@@ -8,21 +12,26 @@ namespace GDL
 {
 
 
-template <I32 _numThreadPoolQueues>
-ThreadPoolThread<_numThreadPoolQueues>::~ThreadPoolThread()
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::~ThreadPoolThread()
 {
     mThread.join();
 }
 
 
 
-template <I32 _numThreadPoolQueues>
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
 template <typename _function, typename _initFunction, typename _DeinitFunction>
-ThreadPoolThread<_numThreadPoolQueues>::ThreadPoolThread(ThreadPool<_numThreadPoolQueues>& threadPool,
-                                                         _function&& function, _initFunction&& initFunction,
-                                                         _DeinitFunction&& deinitFunction)
+ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::ThreadPoolThread(
+        ThreadPool<_numThreadPoolQueues, _workStealing, _queue>& threadPool, Vector<U32> cpuSet, String name,
+        _function&& function, _initFunction&& initFunction, _DeinitFunction&& deinitFunction)
     : mClose{false}
     , mThreadPool(threadPool)
+    , mLocalQueues{CreateLocalQueues()}
+    , mTaskSlots{CreateTaskSlots()}
+    , mNextTaskSlot{0}
+    , mCpuSet{std::move(cpuSet)}
+    , mName{std::move(name)}
     , mThread(&ThreadPoolThread::Run<_function, _initFunction, _DeinitFunction>, this, function, initFunction,
               deinitFunction)
 {
@@ -30,22 +39,29 @@ ThreadPoolThread<_numThreadPoolQueues>::ThreadPoolThread(ThreadPool<_numThreadPo
 
 
 
-template <I32 _numThreadPoolQueues>
-void ThreadPoolThread<_numThreadPoolQueues>::Close()
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+void ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::Close()
 {
     mClose = true;
 }
 
 
 
-template <I32 _numThreadPoolQueues>
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
 template <typename _function, typename _initFunction, typename _DeinitFunction>
-void ThreadPoolThread<_numThreadPoolQueues>::Run(_function&& function, _initFunction&& initFunction,
-                                                 _DeinitFunction&& deinitFunction)
+void ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::Run(_function&& function,
+                                                                        _initFunction&& initFunction,
+                                                                        _DeinitFunction&& deinitFunction)
 {
     // INFO:
     // The 3 functions have individual exception handling to ensure that the deinitialize function is called
 
+    mCurrentThread = this;
+
+    // Placement - done before the initialization, so that memory which is touched first by the initialization function
+    // is allocated on the NUMA node of the thread
+    HandleExceptions([this]() { ApplyPlacement(); });
+
     // Initialization
     HandleExceptions(initFunction);
 
@@ -55,15 +71,98 @@ void ThreadPoolThread<_numThreadPoolQueues>::Run(_function&& function, _initFunc
             function();
     });
 
+    // Tasks that are still stored in the local queues would be lost otherwise
+    if constexpr (_workStealing)
+        MoveLocalTasksToThreadPool();
+
     // Deinitialization
     HandleExceptions(deinitFunction);
+
+    mCurrentThread = nullptr;
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+typename ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::LocalQueueArray
+ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::CreateLocalQueues()
+{
+    LocalQueueArray localQueues;
+    if constexpr (_workStealing)
+        for (auto& localQueue : localQueues)
+            localQueue.reset(new WorkStealingDeque<TaskSlot*>(
+                    ThreadPool<_numThreadPoolQueues, _workStealing, _queue>::LocalQueueCapacity));
+    return localQueues;
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+std::unique_ptr<typename ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::TaskSlot[]>
+ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::CreateTaskSlots()
+{
+    if constexpr (_workStealing)
+        return std::unique_ptr<TaskSlot[]>(new TaskSlot[GetNumTaskSlots()]);
+    else
+        return nullptr;
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+constexpr U32 ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::GetNumTaskSlots()
+{
+    // Popped and stolen tasks release their slots immediately. Therefore, the number of occupied slots never exceeds
+    // the total capacity of the local queues.
+    return ThreadPool<_numThreadPoolQueues, _workStealing, _queue>::LocalQueueCapacity * _numThreadPoolQueues;
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+void ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::TakeTask(TaskSlot* slot, Task& task)
+{
+    task = std::move(slot->mTask);
+    slot->mOccupied.store(false, std::memory_order_release);
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>*
+ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::GetCurrentThread()
+{
+    return mCurrentThread;
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+U64 ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::GetNumLocalTasks(I32 queueNum) const
+{
+    static_assert(_workStealing, "Local queues are only available in work stealing mode.");
+    assert(queueNum < _numThreadPoolQueues && queueNum >= 0);
+    return mLocalQueues[queueNum]->GetSize();
 }
 
 
 
-template <I32 _numThreadPoolQueues>
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+void ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::ApplyPlacement()
+{
+    assert(mCurrentThread == this);
+
+    if (!mCpuSet.empty())
+        SetCurrentThreadAffinity(mCpuSet);
+    if (!mName.empty())
+        SetCurrentThreadName(mName);
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
 template <typename _function>
-void ThreadPoolThread<_numThreadPoolQueues>::HandleExceptions(_function&& function)
+void ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::HandleExceptions(_function&& function)
 {
     try
     {
@@ -82,4 +181,77 @@ void ThreadPoolThread<_numThreadPoolQueues>::HandleExceptions(_function&& functi
 }
 
 
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+void ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::MoveLocalTasksToThreadPool()
+{
+    static_assert(_workStealing, "Local queues are only available in work stealing mode.");
+    assert(mCurrentThread == this);
+
+    Task task;
+    for (I32 i = 0; i < _numThreadPoolQueues; ++i)
+        while (TryPopLocal(i, task))
+            mThreadPool.PushTask(i, std::move(task));
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+bool ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::TryPopLocal(I32 queueNum, Task& task)
+{
+    static_assert(_workStealing, "Local queues are only available in work stealing mode.");
+    assert(queueNum < _numThreadPoolQueues && queueNum >= 0);
+    assert(mCurrentThread == this);
+
+    TaskSlot* slot = nullptr;
+    if (!mLocalQueues[queueNum]->TryPop(slot))
+        return false;
+    TakeTask(slot, task);
+    return true;
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+bool ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::TryPushLocal(I32 queueNum, Task& task)
+{
+    static_assert(_workStealing, "Local queues are only available in work stealing mode.");
+    assert(queueNum < _numThreadPoolQueues && queueNum >= 0);
+    assert(mCurrentThread == this);
+
+    // The acquire load synchronizes with the release of the slot by the thread that took the previous task
+    TaskSlot& slot = mTaskSlots[mNextTaskSlot];
+    if (slot.mOccupied.load(std::memory_order_acquire))
+        return false;
+
+    // The slot must be marked as occupied before it is pushed, since it might be stolen and released immediately
+    slot.mTask = std::move(task);
+    slot.mOccupied.store(true, std::memory_order_relaxed);
+    if (!mLocalQueues[queueNum]->TryPush(&slot))
+    {
+        task = std::move(slot.mTask);
+        slot.mOccupied.store(false, std::memory_order_relaxed);
+        return false;
+    }
+
+    mNextTaskSlot = (mNextTaskSlot + 1) % GetNumTaskSlots();
+    return true;
+}
+
+
+
+template <I32 _numThreadPoolQueues, bool _workStealing, typename _queue>
+bool ThreadPoolThread<_numThreadPoolQueues, _workStealing, _queue>::TryStealLocal(I32 queueNum, Task& task)
+{
+    static_assert(_workStealing, "Local queues are only available in work stealing mode.");
+    assert(queueNum < _numThreadPoolQueues && queueNum >= 0);
+
+    TaskSlot* slot = nullptr;
+    if (!mLocalQueues[queueNum]->TrySteal(slot))
+        return false;
+    TakeTask(slot, task);
+    return true;
+}
+
+
 } // namespace GDL
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+
+
+namespace GDL
+{
+
+//! @brief Lock-free, fixed capacity work stealing deque (Chase-Lev). The owning thread pushes and pops values at the
+//! bottom (LIFO) while all other threads can steal values from the top (FIFO).
+//! @tparam _type: Type of the stored values. Must be trivially copyable, since values are stored in atomic slots.
+//! @remark Implementation follows: "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al. 2013).
+//! The deque does not grow. If it is full, the push fails and the owner has to store the value somewhere else.
+template <typename _type>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<_type>::value, "Work stealing deque only supports trivially copyable "
+                                                            "types. Store pointers instead.");
+
+    static constexpr U32 CacheLineSize = 64;
+
+    alignas(CacheLineSize) std::atomic<I64> mTop;
+    alignas(CacheLineSize) std::atomic<I64> mBottom;
+    alignas(CacheLineSize) const I64 mCapacity;
+    const I64 mMask;
+    std::unique_ptr<std::atomic<_type>[]> mBuffer;
+
+public:
+    //! @brief Constructs the deque with a fixed capacity
+    //! @param capacity: Maximum number of values that can be stored. Must be a power of 2.
+    explicit WorkStealingDeque(U32 capacity);
+
+    WorkStealingDeque() = delete;
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+    ~WorkStealingDeque() = default;
+
+    //! @brief Gets the capacity of the deque
+    //! @return Capacity of the deque
+    U32 GetCapacity() const;
+
+    //! @brief Gets the approximate number of values inside the deque
+    //! @return Approximate number of values
+    //! @remark The result is only exact if no other thread modifies the deque at the same time
+    U64 GetSize() const;
+
+    //! @brief Returns if the deque is empty or not
+    //! @return TRUE if the deque is empty, FALSE if not
+    //! @remark The result is only exact if no other thread modifies the deque at the same time
+    bool IsEmpty() const;
+
+    //! @brief Pushes a value to the bottom of the deque. Must only be called by the owning thread.
+    //! @param value: Value that should be pushed
+    //! @return TRUE if the operation was successful, FALSE if the deque is full
+    bool TryPush(_type value);
+
+    //! @brief Pops the last pushed value from the bottom of the deque. Must only be called by the owning thread.
+    //! @param out: Reference to a variable that stores the fetched value
+    //! @return TRUE if the operation was successful, FALSE if not
+    bool TryPop(_type& out);
+
+    //! @brief Steals the oldest value from the top of the deque. Can be called by any thread.
+    //! @param out: Reference to a variable that stores the fetched value
+    //! @return TRUE if the operation was successful, FALSE if the deque is empty or another thread won the race
+    bool TrySteal(_type& out);
+};
+
+} // namespace GDL
+
+#include "gdl/resources/cpu/workStealingDeque.inl"
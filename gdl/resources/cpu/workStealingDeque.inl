@@ -0,0 +1,115 @@
+#pragma once
+
+#include "gdl/resources/cpu/workStealingDeque.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/isPowerOf2.h"
+
+
+namespace GDL
+{
+
+template <typename _type>
+WorkStealingDeque<_type>::WorkStealingDeque(U32 capacity)
+    : mTop{0}
+    , mBottom{0}
+    , mCapacity{static_cast<I64>(capacity)}
+    , mMask{static_cast<I64>(capacity) - 1}
+    , mBuffer{nullptr}
+{
+    EXCEPTION(capacity == 0 || !IsPowerOf2(capacity), "Capacity must be a power of 2 and larger than 0.");
+    mBuffer.reset(new std::atomic<_type>[capacity]);
+}
+
+
+
+template <typename _type>
+U32 WorkStealingDeque<_type>::GetCapacity() const
+{
+    return static_cast<U32>(mCapacity);
+}
+
+
+
+template <typename _type>
+U64 WorkStealingDeque<_type>::GetSize() const
+{
+    const I64 bottom = mBottom.load(std::memory_order_relaxed);
+    const I64 top = mTop.load(std::memory_order_relaxed);
+    return (bottom > top) ? static_cast<U64>(bottom - top) : 0;
+}
+
+
+
+template <typename _type>
+bool WorkStealingDeque<_type>::IsEmpty() const
+{
+    return GetSize() == 0;
+}
+
+
+
+template <typename _type>
+bool WorkStealingDeque<_type>::TryPush(_type value)
+{
+    const I64 bottom = mBottom.load(std::memory_order_relaxed);
+    const I64 top = mTop.load(std::memory_order_acquire);
+
+    if (bottom - top >= mCapacity)
+        return false;
+
+    mBuffer[bottom & mMask].store(value, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    mBottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+
+
+template <typename _type>
+bool WorkStealingDeque<_type>::TryPop(_type& out)
+{
+    const I64 bottom = mBottom.load(std::memory_order_relaxed) - 1;
+    mBottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    I64 top = mTop.load(std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        // Deque was empty
+        mBottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    out = mBuffer[bottom & mMask].load(std::memory_order_relaxed);
+    if (top < bottom)
+        return true;
+
+    // Last value - race against thieves
+    const bool success = mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                      std::memory_order_relaxed);
+    mBottom.store(bottom + 1, std::memory_order_relaxed);
+    return success;
+}
+
+
+
+template <typename _type>
+bool WorkStealingDeque<_type>::TrySteal(_type& out)
+{
+    I64 top = mTop.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const I64 bottom = mBottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+        return false;
+
+    _type value = mBuffer[top & mMask].load(std::memory_order_relaxed);
+    if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+
+    out = value;
+    return true;
+}
+
+} // namespace GDL
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "gdl/resources/memory/frameAllocator.h"
+#include "gdl/resources/memory/memoryManager.h"
+#include "gdl/base/exception.h"
+
+namespace GDL
+{
+
+template <class _type>
+FrameAllocator<_type>::FrameAllocator() noexcept
+{
+}
+
+
+
+template <class _type>
+template <class _typeOther>
+FrameAllocator<_type>::FrameAllocator(const FrameAllocator<_typeOther>&) noexcept
+{
+}
+
+
+
+template <class _type>
+_type* FrameAllocator<_type>::allocate(std::size_t numInstances)
+{
+    return static_cast<_type*>(GetMemoryAllocationPattern()->Allocate(numInstances * sizeof(_type), alignof(_type)));
+}
+
+
+
+template <class _type>
+void FrameAllocator<_type>::deallocate(_type* pointer, std::size_t)
+{
+    GetMemoryAllocationPattern()->Deallocate(pointer, alignof(_type));
+}
+
+
+
+template <class _type>
+MemoryInterface* FrameAllocator<_type>::GetMemoryAllocationPattern()
+{
+    static MemoryInterface* memoryAP = InitializeMemoryAllocationPattern();
+    return memoryAP;
+}
+
+
+
+template <class _type>
+MemoryInterface* FrameAllocator<_type>::InitializeMemoryAllocationPattern()
+{
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    MemoryInterface* memoryAP = memoryManager.GetFrameMemory();
+    if (memoryAP == nullptr)
+    {
+        memoryAP = memoryManager.GetGeneralPurposeMemory();
+        if (memoryAP == nullptr)
+            memoryAP = memoryManager.GetHeapMemory();
+    }
+    return memoryManager.GetTrackedMemory(memoryAP);
+}
+
+
+
+template <class _type, class _typeOther>
+constexpr bool operator==(const FrameAllocator<_type>&, const FrameAllocator<_typeOther>&) noexcept
+{
+    return true;
+}
+
+
+
+template <class _type, class _typeOther>
+constexpr bool operator!=(const FrameAllocator<_type>&, const FrameAllocator<_typeOther>&) noexcept
+{
+    return false;
+}
+
+} // namespace GDL
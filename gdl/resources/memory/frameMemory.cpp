@@ -0,0 +1,134 @@
+#include "gdl/resources/memory/frameMemory.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/base/functions/isPowerOf2.h"
+
+#include <algorithm>
+
+
+namespace GDL
+{
+
+FrameMemory::FrameMemory(MemorySize memorySizePerFrame, U32 numFrames)
+    : mMemorySizePerFrame{((memorySizePerFrame.GetNumBytes() + MinAlignment - 1) / MinAlignment) * MinAlignment}
+    , mNumFrames{numFrames}
+    , mCurrentFrame{0}
+    , mCurrentFrameMemory{nullptr}
+    , mHighWaterMark{0}
+    , mCurrentFrameOffset{0}
+    , mMemory{nullptr}
+{
+    CheckConstructionParameters();
+}
+
+
+
+FrameMemory::~FrameMemory()
+{
+}
+
+
+
+void* FrameMemory::Allocate(size_t size, size_t alignment)
+{
+    DEV_EXCEPTION(size == 0, "Allocated memory size is 0.");
+    DEV_EXCEPTION(!IsInitialized(), "Frame memory is not initialized.");
+    DEV_EXCEPTION(!IsPowerOf2(alignment), "Alignment must be a power of 2.");
+
+    // All offsets are multiples of the minimal alignment, so padding is only needed for larger alignments
+    const size_t allocationSize = ((size + MinAlignment - 1) / MinAlignment) * MinAlignment +
+                                  ((alignment > MinAlignment) ? alignment - MinAlignment : 0);
+
+    const size_t offset = mCurrentFrameOffset.fetch_add(allocationSize, std::memory_order_relaxed);
+    EXCEPTION(offset + allocationSize > mMemorySizePerFrame, "No more memory available.");
+
+    U8* address = mCurrentFrameMemory + offset;
+    const size_t misalignment = Misalignment(address, alignment);
+    if (misalignment != 0)
+        address += alignment - misalignment;
+
+    return address;
+}
+
+
+
+void FrameMemory::Deallocate([[maybe_unused]] void* address, [[maybe_unused]] size_t alignment)
+{
+    DEV_EXCEPTION(address == nullptr, "Can't free a nullptr");
+    DEV_EXCEPTION(static_cast<U8*>(address) < mMemory.get() ||
+                          static_cast<U8*>(address) >= mMemory.get() + mMemorySizePerFrame * mNumFrames,
+                  "Memory address is not part of the frame memory");
+}
+
+
+
+void FrameMemory::Deinitialize()
+{
+    EXCEPTION(!IsInitialized(), "Frame memory already deinitialized.");
+
+    mMemory.reset(nullptr);
+    mCurrentFrameMemory = nullptr;
+    mCurrentFrameOffset = 0;
+}
+
+
+
+size_t FrameMemory::GetHighWaterMark() const
+{
+    return std::max(mHighWaterMark, GetUsedMemorySize());
+}
+
+
+
+size_t FrameMemory::GetUsedMemorySize() const
+{
+    return std::min(mCurrentFrameOffset.load(std::memory_order_relaxed), mMemorySizePerFrame);
+}
+
+
+
+void FrameMemory::Initialize()
+{
+    EXCEPTION(IsInitialized(), "Frame memory is already initialized");
+
+    mMemory.reset(new U8[mMemorySizePerFrame * mNumFrames]);
+    mHighWaterMark = 0;
+    SetCurrentFrame(0);
+}
+
+
+
+void FrameMemory::NextFrame()
+{
+    DEV_EXCEPTION(!IsInitialized(), "Frame memory is not initialized.");
+
+    mHighWaterMark = GetHighWaterMark();
+    SetCurrentFrame((mCurrentFrame + 1) % mNumFrames);
+}
+
+
+
+void FrameMemory::CheckConstructionParameters() const
+{
+    EXCEPTION(mMemorySizePerFrame == 0, "Memory size per frame must be bigger than 0");
+    EXCEPTION(mNumFrames == 0, "Number of frames must be bigger than 0");
+}
+
+
+
+bool FrameMemory::IsInitialized() const
+{
+    return mMemory != nullptr;
+}
+
+
+
+void FrameMemory::SetCurrentFrame(U32 frame)
+{
+    mCurrentFrame = frame;
+    mCurrentFrameMemory = mMemory.get() + mMemorySizePerFrame * frame;
+    mCurrentFrameOffset.store(0, std::memory_order_relaxed);
+}
+
+} // namespace GDL
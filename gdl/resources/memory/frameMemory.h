@@ -0,0 +1,95 @@
+#pragma once
+
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/memoryInterface.h"
+#include "gdl/resources/memory/memorySize.h"
+
+#include <atomic>
+#include <memory>
+
+
+namespace GDL
+{
+
+//! @brief Memory system for transient data that lives for a fixed number of frames. It consists of multiple equally
+//! sized buffers which are used in a round-robin fashion. Allocations are lock-free and only increment the offset of
+//! the current buffer. Deallocations don't do anything. Instead, all memory of a buffer is released at once when the
+//! buffer is reused.
+//! @remark With N buffers, memory that was allocated during a frame stays valid until NextFrame was called N times.
+//! NextFrame, Initialize and Deinitialize must not be called while other threads allocate memory from the frame memory.
+class FrameMemory : public MemoryInterface
+{
+public:
+    //! @brief Minimal alignment and granularity of all returned memory blocks
+    static constexpr size_t MinAlignment = 16;
+
+private:
+    size_t mMemorySizePerFrame;
+    U32 mNumFrames;
+    U32 mCurrentFrame;
+    U8* mCurrentFrameMemory;
+    size_t mHighWaterMark;
+    alignas(64) std::atomic<size_t> mCurrentFrameOffset;
+    std::unique_ptr<U8[]> mMemory;
+
+public:
+    //! @brief Creates the frame memory
+    //! @param memorySizePerFrame: Size of the buffer of a single frame. It is rounded up to a multiple of the minimal
+    //! alignment.
+    //! @param numFrames: Number of frames that allocated memory stays valid
+    FrameMemory(MemorySize memorySizePerFrame, U32 numFrames = 2);
+
+    FrameMemory() = delete;
+    FrameMemory(const FrameMemory&) = delete;
+    FrameMemory(FrameMemory&&) = delete;
+    FrameMemory& operator=(const FrameMemory&) = delete;
+    FrameMemory& operator=(FrameMemory&&) = delete;
+    ~FrameMemory() override;
+
+
+    //! @brief Allocates memory from the buffer of the current frame
+    //! @param size: Size of the memory that should be allocated
+    //! @param alignment: Memory alignment
+    //! @return Pointer to memory
+    //! @remark Alignments above the minimal alignment waste up to <alignment> - MinAlignment bytes
+    virtual void* Allocate(size_t size, size_t alignment = 1) override;
+
+    //! @brief Does nothing since all memory of a frame is released at once. If the DEV_EXCEPTION macro is enabled, it
+    //! is checked that the address belongs to the frame memory.
+    //! @param address: Adress that should be freed
+    //! @param alignment: Memory alignment
+    virtual void Deallocate(void* address, size_t alignment = 1) override;
+
+    //! @brief Deinitializes the frame memory
+    void Deinitialize();
+
+    //! @brief Gets the maximal memory that was used by a single frame since the initialization
+    //! @return High-water mark
+    size_t GetHighWaterMark() const;
+
+    //! @brief Gets the memory that was allocated during the current frame, including alignment padding
+    //! @return Used memory size
+    size_t GetUsedMemorySize() const;
+
+    //! @brief Initializes the frame memory
+    void Initialize();
+
+    //! @brief Starts a new frame. The buffer of the oldest frame is reused and all memory that was allocated in it is
+    //! released.
+    void NextFrame();
+
+private:
+    //! @brief Checks if the frame memory is constructed with valid parameters. Throws if not.
+    void CheckConstructionParameters() const;
+
+    //! @brief Returns if the frame memory is initialized
+    //! @return TRUE / FALSE
+    bool IsInitialized() const;
+
+    //! @brief Selects the buffer of the passed frame and resets its offset
+    //! @param frame: Index of the frame
+    void SetCurrentFrame(U32 frame);
+};
+
+} // namespace GDL
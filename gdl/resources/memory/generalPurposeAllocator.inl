@@ -49,10 +49,11 @@ MemoryInterface* GeneralPurposeAllocator<_type>::GetMemoryAllocationPattern()
 template <class _type>
 MemoryInterface* GeneralPurposeAllocator<_type>::InitializeMemoryAllocationPattern()
 {
-    MemoryInterface* memoryAP = MemoryManager::Instance().GetGeneralPurposeMemory();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    MemoryInterface* memoryAP = memoryManager.GetGeneralPurposeMemory();
     if (memoryAP == nullptr)
-        return MemoryManager::Instance().GetHeapMemory();
-    return memoryAP;
+        memoryAP = memoryManager.GetHeapMemory();
+    return memoryManager.GetTrackedMemory(memoryAP);
 }
 
 
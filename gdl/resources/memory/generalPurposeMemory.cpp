@@ -11,10 +11,11 @@
 namespace GDL
 {
 
-GeneralPurposeMemory::GeneralPurposeMemory(MemorySize memorySize)
+GeneralPurposeMemory::GeneralPurposeMemory(MemorySize memorySize, MemoryBacking backing)
     : mMemorySize{memorySize}
     , mFirstFreeMemoryPtr{nullptr}
-    , mMemory{nullptr}
+    , mBacking{backing}
+    , mMemory{}
 {
     CheckConstructionParameters();
 }
@@ -69,6 +70,13 @@ U32 GeneralPurposeMemory::CountFreeMemoryBlocks() const
 
 
 
+SpinLockStatistics GeneralPurposeMemory::GetLockStatistics() const
+{
+    return mSpinLock.GetStatistics();
+}
+
+
+
 void GeneralPurposeMemory::Deallocate(void* address, [[maybe_unused]] size_t alignment)
 {
     std::lock_guard<SpinLock> lock{mSpinLock};
@@ -98,7 +106,7 @@ void GeneralPurposeMemory::Deinitialize()
     EXCEPTION(CountAllocatedMemoryBlocksPrivate() != 0, "Can't deinitialize. Memory still in use.");
 
     mFirstFreeMemoryPtr = nullptr;
-    mMemory.reset(nullptr);
+    mMemory.Reset();
 }
 
 
@@ -109,7 +117,7 @@ void GeneralPurposeMemory::Initialize()
 
     EXCEPTION(IsInitialized(), "General purpose memory is already initialized.");
 
-    mMemory.reset(new U8[mMemorySize.GetNumBytes()]);
+    mMemory = MemoryRegion(mMemorySize.GetNumBytes(), mBacking);
     mFirstFreeMemoryPtr = GetStartOfMemory();
 
     WriteSizeToMemory(mFirstFreeMemoryPtr, mMemorySize.GetNumBytes());
@@ -118,6 +126,23 @@ void GeneralPurposeMemory::Initialize()
 
 
 
+void GeneralPurposeMemory::ReleaseUnusedMemory()
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    EXCEPTION(!IsInitialized(), "General purpose memory is not initialized.");
+
+    // The size and the link to the next free block are stored at the start of each free block and must be kept
+    constexpr size_t freeBlockHeaderSize = sizeof(size_t) + sizeof(U8*);
+
+    for (U8* currentMemoryPtr = mFirstFreeMemoryPtr; currentMemoryPtr != nullptr;
+         currentMemoryPtr = ReadLinkToNextFreeBlock(currentMemoryPtr))
+        mMemory.Release(currentMemoryPtr + freeBlockHeaderSize,
+                        ReadSizeFromMemory(currentMemoryPtr) - freeBlockHeaderSize);
+}
+
+
+
 void GeneralPurposeMemory::AddToWrittenSize(void* positionInMemory, const size_t value)
 {
     assert(positionInMemory != nullptr);
@@ -235,21 +260,21 @@ void GeneralPurposeMemory::FindFreeMemoryBlock(AllocationData& data) const
 
 U8* GeneralPurposeMemory::GetEndOfMemory() const
 {
-    return mMemory.get() + mMemorySize.GetNumBytes();
+    return mMemory.Get() + mMemorySize.GetNumBytes();
 }
 
 
 
 U8* GeneralPurposeMemory::GetStartOfMemory() const
 {
-    return mMemory.get();
+    return mMemory.Get();
 }
 
 
 
 bool GeneralPurposeMemory::IsInitialized() const
 {
-    return mMemory != nullptr;
+    return mMemory.Get() != nullptr;
 }
 
 
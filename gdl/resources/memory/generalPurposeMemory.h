@@ -4,6 +4,7 @@
 #include "gdl/base/fundamentalTypes.h"
 #include "gdl/resources/cpu/spinlock.h"
 #include "gdl/resources/memory/memoryInterface.h"
+#include "gdl/resources/memory/memoryRegion.h"
 #include "gdl/resources/memory/memorySize.h"
 
 #include <memory>
@@ -46,13 +47,15 @@ class GeneralPurposeMemory : public MemoryInterface
 
     MemorySize mMemorySize;
     U8* mFirstFreeMemoryPtr;
-    std::unique_ptr<U8[]> mMemory;
+    MemoryBacking mBacking;
+    MemoryRegion mMemory;
     mutable SpinLock mSpinLock;
 
 public:
     //! @brief Creates the general purpose memory with <memorySize> bytes of memory
     //! @param memorySize: total amount of memory
-    GeneralPurposeMemory(MemorySize memorySize);
+    //! @param backing: Type of the backing memory
+    GeneralPurposeMemory(MemorySize memorySize, MemoryBacking backing = MemoryBacking::HEAP);
 
     GeneralPurposeMemory() = delete;
     GeneralPurposeMemory(const GeneralPurposeMemory&) = delete;
@@ -84,9 +87,17 @@ public:
     //! @brief Deinitializes the general purpose memory
     void Deinitialize();
 
+    //! @brief Gets the contention statistics of the internal spinlock
+    //! @return Spinlock statistics. All values are zero if the statistics are disabled.
+    SpinLockStatistics GetLockStatistics() const;
+
     //! @brief Initializes the general purpose memory
     void Initialize();
 
+    //! @brief Returns the physical pages of all free memory blocks to the operating system. This only has an effect if
+    //! the backing memory is mapped. The pages are committed again when they are allocated.
+    void ReleaseUnusedMemory();
+
 private:
     //! @brief Increases a size_t value written in memory at the passed position.
     //! @param positionInMemory: Position in memory where the value is located
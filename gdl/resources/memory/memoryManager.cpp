@@ -1,18 +1,48 @@
 #include "gdl/resources/memory/memoryManager.h"
 
 #include "gdl/base/exception.h"
+#include "gdl/base/functions/bitScan.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
 
 
 namespace GDL
 {
 
+namespace
+{
+
+//! @brief Gets the heap memory that is used if no other memory system is available
+//! @return Heap memory
+HeapMemory& GetHeapMemoryInstance()
+{
+    static HeapMemory memory;
+    return memory;
+}
+
+} // namespace
+
+
+
+thread_local ThreadPrivateMemoryStack* MemoryManager::mCurrentThreadPrivateMemoryStack = nullptr;
+
+
+
 MemoryManager::MemoryManager()
     : mInitialized{false}
     , mThreadPrivateMemoryEnabled{false}
     , mSetupFinished{false}
     , mMemoryRequestedUninitialized{false}
     , mGeneralPurposeMemory{nullptr}
+    , mSizeClassMemory{nullptr}
     , mMemoryStack{nullptr}
+    , mFrameMemory{nullptr}
+    , mMemoryPoolLookupGranularity{1}
+    , mMemoryPoolLookupMaxElementSize{0}
+    , mMemoryPoolLookupMaxAlignment{0}
+    , mMemoryPoolLookupNumSizes{0}
 {
 }
 
@@ -24,18 +54,38 @@ void MemoryManager::Initialize()
 
     EXCEPTION(mMemoryRequestedUninitialized,
               "Can't initialize. There was a request for memory before the initialization.");
-    EXCEPTION(mGeneralPurposeMemory == nullptr && mMemoryPools.empty(),
+    EXCEPTION(mGeneralPurposeMemory == nullptr && mSizeClassMemory == nullptr && mMemoryPools.empty(),
               "Can't initialize. No memory added to memory manager.");
 
     if (mGeneralPurposeMemory != nullptr)
         mGeneralPurposeMemory->Initialize();
 
+    if (mSizeClassMemory != nullptr)
+        mSizeClassMemory->Initialize();
+
     for (auto& memoryPool : mMemoryPools)
         memoryPool.second.Initialize();
 
     if (mMemoryStack != nullptr)
         mMemoryStack->Initialize();
 
+    if (mFrameMemory != nullptr)
+        mFrameMemory->Initialize();
+
+    if (mMemoryPoolLookupTable.empty() && !mMemoryPools.empty())
+        InitializeMemoryPoolLookupTable();
+
+    if constexpr (MemoryTrackingEnabled)
+    {
+        CreateMemoryTracker(mGeneralPurposeMemory.get());
+        CreateMemoryTracker(mSizeClassMemory.get());
+        for (auto& memoryPool : mMemoryPools)
+            CreateMemoryTracker(&memoryPool.second);
+        CreateMemoryTracker(mMemoryStack.get());
+        CreateMemoryTracker(mFrameMemory.get());
+        CreateMemoryTracker(&GetHeapMemoryInstance());
+    }
+
     mSetupFinished = true;
     mInitialized = true;
 }
@@ -78,26 +128,38 @@ void MemoryManager::Deinitialize()
     if (mGeneralPurposeMemory != nullptr)
         mGeneralPurposeMemory->Deinitialize();
 
+    if (mSizeClassMemory != nullptr)
+        mSizeClassMemory->Deinitialize();
+
     for (auto& memoryPool : mMemoryPools)
         memoryPool.second.Deinitialize();
 
     if (mMemoryStack != nullptr)
         mMemoryStack->Deinitialize();
 
+    if (mFrameMemory != nullptr)
+        mFrameMemory->Deinitialize();
+
     mInitialized = false;
 }
 
 
 
-GeneralPurposeMemory* GDL::MemoryManager::GetGeneralPurposeMemory() const
+FrameMemory* MemoryManager::GetFrameMemory() const
 {
-    std::shared_lock<std::shared_mutex> lock(mMutex);
-    if (mInitialized == false)
-    {
-        mSetupFinished = true;
-        mMemoryRequestedUninitialized = true;
+    if (!IsReadyForMemoryRequests())
         return nullptr;
-    }
+    return mFrameMemory.get();
+}
+
+
+
+MemoryInterface* GDL::MemoryManager::GetGeneralPurposeMemory() const
+{
+    if (!IsReadyForMemoryRequests())
+        return nullptr;
+    if (mSizeClassMemory != nullptr)
+        return mSizeClassMemory.get();
     return mGeneralPurposeMemory.get();
 }
 
@@ -105,27 +167,37 @@ GeneralPurposeMemory* GDL::MemoryManager::GetGeneralPurposeMemory() const
 
 HeapMemory* MemoryManager::GetHeapMemory() const
 {
+    IsReadyForMemoryRequests();
+    return &GetHeapMemoryInstance();
+}
+
+MemoryTracker* MemoryManager::GetMemoryTracker(const MemoryInterface* memory) const
+{
+    if constexpr (!MemoryTrackingEnabled)
+        return nullptr;
+
     std::shared_lock<std::shared_mutex> lock(mMutex);
+    auto iterator = mMemoryTrackers.find(memory);
+    return (iterator == mMemoryTrackers.end()) ? nullptr : iterator->second.get();
+}
 
-    if (mInitialized == false)
-    {
-        mSetupFinished = true;
-        mMemoryRequestedUninitialized = true;
-    }
 
-    static HeapMemory memory;
-    return &memory;
+
+MemoryInterface* MemoryManager::GetTrackedMemory(MemoryInterface* memory) const
+{
+    if constexpr (!MemoryTrackingEnabled)
+        return memory;
+
+    MemoryTracker* memoryTracker = GetMemoryTracker(memory);
+    return (memoryTracker == nullptr) ? memory : memoryTracker;
 }
 
+
+
 MemoryStack* MemoryManager::GetMemoryStack() const
 {
-    std::shared_lock<std::shared_mutex> lock(mMutex);
-    if (mInitialized == false)
-    {
-        mSetupFinished = true;
-        mMemoryRequestedUninitialized = true;
+    if (!IsReadyForMemoryRequests())
         return nullptr;
-    }
     return mMemoryStack.get();
 }
 
@@ -133,39 +205,37 @@ MemoryStack* MemoryManager::GetMemoryStack() const
 
 MemoryPool* MemoryManager::GetMemoryPool(size_t elementSize, size_t alignment) const
 {
-    std::shared_lock<std::shared_mutex> lock(mMutex);
-    if (mInitialized == false)
+    if (!IsReadyForMemoryRequests())
+        return nullptr;
+    if (elementSize > mMemoryPoolLookupMaxElementSize || alignment > mMemoryPoolLookupMaxAlignment)
+        return nullptr;
+
+    if (mMemoryPoolLookupTable.empty())
     {
-        mSetupFinished = true;
-        mMemoryRequestedUninitialized = true;
+        for (const auto& memoryPool : mMemoryPools)
+            if (memoryPool.first >= elementSize && memoryPool.second.GetAlignment() >= alignment)
+                return &const_cast<MemoryPool&>(memoryPool.second);
         return nullptr;
     }
-    for (auto& it : mMemoryPools)
-        if (it.second.GetElementSize() >= elementSize && it.second.GetAlignment() >= alignment)
-            return &const_cast<MemoryPool&>(it.second);
 
-    return nullptr;
+    size_t sizeIndex = (elementSize + mMemoryPoolLookupGranularity - 1) / mMemoryPoolLookupGranularity;
+    size_t alignmentIndex = (alignment <= 1) ? 0 : IndexOfMostSignificantBit(alignment - 1) + 1;
+
+    return mMemoryPoolLookupTable[alignmentIndex * mMemoryPoolLookupNumSizes + sizeIndex];
 }
 
+
+
 ThreadPrivateMemoryStack* MemoryManager::GetThreadPrivateMemoryStack() const
 {
-    std::shared_lock<std::shared_mutex> lock(mMutex);
-    if (mInitialized == false)
-    {
-        mSetupFinished = true;
-        mMemoryRequestedUninitialized = true;
+    if (!IsReadyForMemoryRequests())
         return nullptr;
-    }
-
-    auto it = mThreadPrivateMemoryStacks.find(std::this_thread::get_id());
-    if (it != mThreadPrivateMemoryStacks.end())
-        return &const_cast<ThreadPrivateMemoryStack&>(it->second);
-    return nullptr;
+    return mCurrentThreadPrivateMemoryStack;
 }
 
 
 
-void MemoryManager::CreatePrivateMemoryStackForThisThread(MemorySize memorySize)
+void MemoryManager::CreatePrivateMemoryStackForThisThread(MemorySize memorySize, bool growable, MemoryBacking backing)
 {
     std::lock_guard<std::shared_mutex> lock(mMutex);
     EXCEPTION(mInitialized == false, "Memory manager needs to be initialized to add thread private memory.");
@@ -174,39 +244,61 @@ void MemoryManager::CreatePrivateMemoryStackForThisThread(MemorySize memorySize)
     EXCEPTION(mThreadPrivateMemoryStacks.find(std::this_thread::get_id()) != mThreadPrivateMemoryStacks.end(),
               "Current thread already has a thread private memory stack.");
 
-    auto[it, success] = mThreadPrivateMemoryStacks.emplace(std::this_thread::get_id(), memorySize);
+    auto[it, success] = mThreadPrivateMemoryStacks.emplace(std::piecewise_construct,
+                                                           std::forward_as_tuple(std::this_thread::get_id()),
+                                                           std::forward_as_tuple(memorySize, growable, backing));
 
     EXCEPTION(success == false, "Thread private memory stack could not be inserted into map.");
     it->second.Initialize();
+    CreateMemoryTracker(&it->second);
+    mCurrentThreadPrivateMemoryStack = &it->second;
 }
 
 
 
-void MemoryManager::CreateGeneralPurposeMemory(MemorySize memorySize)
+void MemoryManager::CreateFrameMemory(MemorySize memorySizePerFrame, U32 numFrames)
 {
     std::lock_guard<std::shared_mutex> lock(mMutex);
 
     EXCEPTION(mSetupFinished == true, "Setup process already finished.");
-    EXCEPTION(mGeneralPurposeMemory != nullptr, "Genaral purpose memory already created");
+    EXCEPTION(mFrameMemory != nullptr, "Frame memory already created");
 
-    mGeneralPurposeMemory.reset(new GeneralPurposeMemory{memorySize});
+    mFrameMemory.reset(new FrameMemory{memorySizePerFrame, numFrames});
 }
 
 
 
-void MemoryManager::CreateMemoryStack(MemorySize memorySize)
+void MemoryManager::CreateGeneralPurposeMemory(MemorySize memorySize, GeneralPurposeMemoryType type,
+                                               MemoryBacking backing)
+{
+    std::lock_guard<std::shared_mutex> lock(mMutex);
+
+    EXCEPTION(mSetupFinished == true, "Setup process already finished.");
+    EXCEPTION(mGeneralPurposeMemory != nullptr || mSizeClassMemory != nullptr,
+              "Genaral purpose memory already created");
+
+    if (type == GeneralPurposeMemoryType::SIZE_CLASS)
+        mSizeClassMemory.reset(new SizeClassMemory{memorySize, backing});
+    else
+        mGeneralPurposeMemory.reset(new GeneralPurposeMemory{memorySize, backing});
+}
+
+
+
+void MemoryManager::CreateMemoryStack(MemorySize memorySize, bool growable, MemoryBacking backing)
 {
     std::lock_guard<std::shared_mutex> lock(mMutex);
 
     EXCEPTION(mSetupFinished == true, "Setup process already finished.");
     EXCEPTION(mMemoryStack != nullptr, "Memory stack already created");
 
-    mMemoryStack.reset(new MemoryStack{memorySize});
+    mMemoryStack.reset(new MemoryStack{memorySize, growable, backing});
 }
 
 
 
-void MemoryManager::CreateMemoryPool(MemorySize elementSize, U32 numElements, size_t alignment)
+void MemoryManager::CreateMemoryPool(MemorySize elementSize, U32 numElements, size_t alignment, U32 magazineSize,
+                                     MemoryBacking backing)
 {
     std::lock_guard<std::shared_mutex> lock(mMutex);
     if (alignment == 0)
@@ -215,8 +307,28 @@ void MemoryManager::CreateMemoryPool(MemorySize elementSize, U32 numElements, si
     EXCEPTION(mMemoryPools.find(elementSize.GetNumBytes()) != mMemoryPools.end(),
               "There already is a memory pool with size " + std::to_string(elementSize.GetNumBytes()));
 
+    // Tracked pool elements need additional space for the allocation header. The pool is still found by the
+    // requested element size.
+    MemorySize poolElementSize = elementSize;
+    size_t poolAlignment = alignment;
+    if constexpr (MemoryTrackingEnabled)
+    {
+        poolAlignment = MemoryTracker::GetWrappedAlignment(alignment);
+        const size_t numBytes = elementSize.GetNumBytes() + MemoryTracker::GetHeaderSize(alignment);
+        poolElementSize = 1_B * ((numBytes + poolAlignment - 1) / poolAlignment * poolAlignment);
+    }
+
     mMemoryPools.emplace(std::piecewise_construct, std::forward_as_tuple(elementSize.GetNumBytes()),
-                         std::forward_as_tuple(elementSize, numElements, alignment));
+                         std::forward_as_tuple(poolElementSize, numElements, poolAlignment, magazineSize, backing));
+}
+
+
+
+void MemoryManager::CreateMemoryTracker(MemoryInterface* memory)
+{
+    if constexpr (MemoryTrackingEnabled)
+        if (memory != nullptr && mMemoryTrackers.find(memory) == mMemoryTrackers.end())
+            mMemoryTrackers.emplace(memory, std::make_unique<MemoryTracker>(*memory));
 }
 
 
@@ -234,7 +346,61 @@ void MemoryManager::DeletePrivateMemoryStackForThisThread()
               "There is no thread private memory stack for the current thread.");
 
     it->second.Deinitialize();
+    mMemoryTrackers.erase(&it->second);
+    mCurrentThreadPrivateMemoryStack = nullptr;
     mThreadPrivateMemoryStacks.erase(std::this_thread::get_id());
 }
 
+
+
+void MemoryManager::InitializeMemoryPoolLookupTable()
+{
+    assert(!mMemoryPools.empty());
+
+    // All pool element sizes are multiples of the granularity. Therefore, a pool either fits all element sizes that
+    // are mapped to the same table entry or none of them.
+    mMemoryPoolLookupGranularity = 0;
+    for (const auto& memoryPool : mMemoryPools)
+    {
+        mMemoryPoolLookupGranularity = std::gcd(mMemoryPoolLookupGranularity, memoryPool.first);
+        mMemoryPoolLookupMaxElementSize = std::max(mMemoryPoolLookupMaxElementSize, memoryPool.first);
+        mMemoryPoolLookupMaxAlignment = std::max(mMemoryPoolLookupMaxAlignment, memoryPool.second.GetAlignment());
+    }
+
+    // Unfavorable element sizes result in huge tables. The memory pools are searched linearly in this case.
+    mMemoryPoolLookupNumSizes = mMemoryPoolLookupMaxElementSize / mMemoryPoolLookupGranularity + 1;
+    const size_t numAlignments = IndexOfMostSignificantBit(mMemoryPoolLookupMaxAlignment) + 1;
+    if (mMemoryPoolLookupNumSizes * numAlignments > MaxMemoryPoolLookupTableSize)
+        return;
+
+    mMemoryPoolLookupTable.assign(mMemoryPoolLookupNumSizes * numAlignments, nullptr);
+
+    for (size_t alignmentIndex = 0; alignmentIndex < numAlignments; ++alignmentIndex)
+        for (size_t sizeIndex = 0; sizeIndex < mMemoryPoolLookupNumSizes; ++sizeIndex)
+            for (auto& memoryPool : mMemoryPools)
+                if (memoryPool.first >= sizeIndex * mMemoryPoolLookupGranularity &&
+                    memoryPool.second.GetAlignment() >= size_t(1) << alignmentIndex)
+                {
+                    mMemoryPoolLookupTable[alignmentIndex * mMemoryPoolLookupNumSizes + sizeIndex] =
+                            &memoryPool.second;
+                    break;
+                }
+}
+
+
+
+bool MemoryManager::IsReadyForMemoryRequests() const
+{
+    if (mInitialized)
+        return true;
+
+    std::shared_lock<std::shared_mutex> lock(mMutex);
+    if (mInitialized)
+        return true;
+
+    mSetupFinished = true;
+    mMemoryRequestedUninitialized = true;
+    return false;
+}
+
 } // namespace GDL
@@ -1,20 +1,33 @@
 #pragma once
 
+#include "gdl/resources/memory/frameMemory.h"
 #include "gdl/resources/memory/generalPurposeMemory.h"
 #include "gdl/resources/memory/heapMemory.h"
 #include "gdl/resources/memory/memoryPool.h"
 #include "gdl/resources/memory/memorySize.h"
 #include "gdl/resources/memory/memoryStack.h"
+#include "gdl/resources/memory/sizeClassMemory.h"
+#include "gdl/resources/memory/utility/memoryTracker.h"
 
 #include <atomic>
 #include <map>
 #include <memory>
 #include <shared_mutex>
 #include <thread>
+#include <vector>
 
 namespace GDL
 {
 
+//! @brief Enum class that specifies the type of the general purpose memory
+enum class GeneralPurposeMemoryType
+{
+    FIRST_FIT,
+    SIZE_CLASS
+};
+
+
+
 class MemoryManager
 {
     std::atomic_bool mInitialized;
@@ -24,9 +37,22 @@ class MemoryManager
     mutable std::shared_mutex mMutex;
 
     std::unique_ptr<GeneralPurposeMemory> mGeneralPurposeMemory;
+    std::unique_ptr<SizeClassMemory> mSizeClassMemory;
     std::unique_ptr<MemoryStack> mMemoryStack;
+    std::unique_ptr<FrameMemory> mFrameMemory;
     std::map<size_t, MemoryPool> mMemoryPools;
     std::map<std::thread::id, ThreadPrivateMemoryStack> mThreadPrivateMemoryStacks;
+    size_t mMemoryPoolLookupGranularity;
+    size_t mMemoryPoolLookupMaxElementSize;
+    size_t mMemoryPoolLookupMaxAlignment;
+    size_t mMemoryPoolLookupNumSizes;
+    std::vector<MemoryPool*> mMemoryPoolLookupTable;
+    std::map<const MemoryInterface*, std::unique_ptr<MemoryTracker>> mMemoryTrackers;
+
+    static thread_local ThreadPrivateMemoryStack* mCurrentThreadPrivateMemoryStack;
+
+    //! @brief Maximal number of entries of the memory pool lookup table
+    static constexpr size_t MaxMemoryPoolLookupTableSize = 4096;
 
     //! @brief Private ctor since this class should only be used as a singleton
     MemoryManager();
@@ -57,14 +83,36 @@ public:
     //! TRUE / FALSE
     bool IsThreadPrivateMemoryEnabled() const;
 
+    //! @brief Returns a pointer to the frame memory
+    //! @return Pointer to the frame memory if it exists. Otherwise nullptr
+    FrameMemory* GetFrameMemory() const;
+
     //! @brief Returns an memory interface pointer to the general purpose memory
     //! @return Pointer to the general purpose memory if it exists. Otherwise nullptr
-    GeneralPurposeMemory* GetGeneralPurposeMemory() const;
+    //! @remark Depending on the type that was chosen during creation, a GeneralPurposeMemory or a SizeClassMemory is
+    //! returned.
+    MemoryInterface* GetGeneralPurposeMemory() const;
 
     //! @brief Returns an memory interface pointer to the heap memory
     //! @return Pointer to the heap memory
     HeapMemory* GetHeapMemory() const;
 
+    //! @brief Returns the memory tracker that wraps the passed memory system
+    //! @param memory: Memory system of the memory manager
+    //! @return Pointer to the memory tracker if it exists. Otherwise nullptr
+    //! @remark Memory trackers only exist if the CMake option ENABLE_MEMORY_TRACKING is enabled. They are created
+    //! during initialization and live as long as the memory manager. Thread private memory stacks get their trackers
+    //! on creation.
+    MemoryTracker* GetMemoryTracker(const MemoryInterface* memory) const;
+
+    //! @brief Returns the memory interface that allocators should use for the passed memory system
+    //! @param memory: Memory system of the memory manager
+    //! @return Memory tracker of the memory system if memory tracking is enabled and the memory system itself
+    //! otherwise
+    //! @remark Tracked memory must also be freed through the tracker, since it stores a header in front of each
+    //! allocation
+    MemoryInterface* GetTrackedMemory(MemoryInterface* memory) const;
+
     //! @brief Returns an memory interface pointer to the memory stack
     //! @return Pointer to the memory stack if it exists. Otherwise nullptr
     MemoryStack* GetMemoryStack() const;
@@ -73,32 +121,75 @@ public:
     //! @param elementSize: Size of the data type which should fit into the memory pool.
     //! @param alignment: Alignment of the data type which should fit into the memory pool.
     //! @return Pointer to a fitting memory pool if it exist. Otherwise nullptr
+    //! @remark After initialization, the pool is taken from a lookup table without locking. Alignment values that are
+    //! not a power of 2 are rounded up to the next power of 2. If the table would exceed
+    //! MaxMemoryPoolLookupTableSize entries, the memory pools are searched linearly instead.
     MemoryPool* GetMemoryPool(size_t elementSize, size_t alignment) const;
 
     //! @brief Returns an memory interface pointer to the threads private memory stack
     //! @return Pointer to the threads private memory stack if it exists. Otherwise nullptr
+    //! @remark After initialization, the stack is read from a thread local variable without locking.
     ThreadPrivateMemoryStack* GetThreadPrivateMemoryStack() const;
 
     //! @brief Creates a thread private memory stack for this thread
-    //! @param memorySize: Size of the memory stack
-    void CreatePrivateMemoryStackForThisThread(MemorySize memorySize);
+    //! @param memorySize: Size of the memory stack. If the stack is growable, this is the size of each memory block.
+    //! @param growable: If TRUE, the memory stack chains additional memory blocks when it runs out of memory
+    //! @param backing: Type of the backing memory
+    void CreatePrivateMemoryStackForThisThread(MemorySize memorySize, bool growable = false,
+                                               MemoryBacking backing = MemoryBacking::HEAP);
+
+    //! @brief Creates a frame memory
+    //! @param memorySizePerFrame: Size of the buffer of a single frame
+    //! @param numFrames: Number of frames that allocated memory stays valid
+    void CreateFrameMemory(MemorySize memorySizePerFrame, U32 numFrames = 2);
 
     //! @brief Creates a general purpose memory
     //! @param memorySize: Size of the general purpose memory
-    void CreateGeneralPurposeMemory(MemorySize memorySize);
+    //! @param type: Type of the general purpose memory. FIRST_FIT creates a GeneralPurposeMemory which searches a
+    //! linked list of free memory blocks. SIZE_CLASS creates a SizeClassMemory which allocates and deallocates in
+    //! constant time.
+    //! @param backing: Type of the backing memory
+    void CreateGeneralPurposeMemory(MemorySize memorySize,
+                                    GeneralPurposeMemoryType type = GeneralPurposeMemoryType::FIRST_FIT,
+                                    MemoryBacking backing = MemoryBacking::HEAP);
 
     //! @brief Creates a memory stack
-    //! @param memorySize: Size of the memory stack
-    void CreateMemoryStack(MemorySize memorySize);
+    //! @param memorySize: Size of the memory stack. If the stack is growable, this is the size of each memory block.
+    //! @param growable: If TRUE, the memory stack chains additional memory blocks when it runs out of memory
+    //! @param backing: Type of the backing memory
+    void CreateMemoryStack(MemorySize memorySize, bool growable = false, MemoryBacking backing = MemoryBacking::HEAP);
 
     //! @brief Creates a memory pool
     //! @param elementSize: Size of a single element of the memory pool
     //! @param numElements: Number of elements that can be stored in the memory pool
     //! @param alignment: Alignment of the memory pool (default: alignment=elementSize)
+    //! @param magazineSize: Maximal number of free elements that are cached by each thread. If 0, all threads use the
+    //! shared list of free elements directly.
+    //! @param backing: Type of the backing memory. Large pools benefit from huge pages, since they reduce TLB misses.
     //! @remark If the alignment value is set to 0, the alignment is set to the element size
-    void CreateMemoryPool(MemorySize elementSize, U32 numElements, size_t alignment = 0);
+    void CreateMemoryPool(MemorySize elementSize, U32 numElements, size_t alignment = 0, U32 magazineSize = 0,
+                          MemoryBacking backing = MemoryBacking::HEAP);
 
     //! @brief Deletes the thread private memory stack for this thread
     void DeletePrivateMemoryStackForThisThread();
+
+private:
+    //! @brief Creates a memory tracker for the passed memory system if memory tracking is enabled and the memory system
+    //! isn't tracked yet
+    //! @param memory: Memory system
+    //! @remark The caller must hold the exclusive lock
+    void CreateMemoryTracker(MemoryInterface* memory);
+
+    //! @brief Sets up the lookup table of the memory pools. Each pair of element size and alignment class is mapped to
+    //! the smallest fitting memory pool. The table stays empty if it would exceed MaxMemoryPoolLookupTableSize entries.
+    //! @remark The caller must hold the exclusive lock
+    void InitializeMemoryPoolLookupTable();
+
+    //! @brief Returns if memory systems can be requested. If the memory manager is not initialized, the setup process
+    //! is finished and the request is recorded, which prohibits a later initialization.
+    //! @return TRUE if the memory manager is initialized, FALSE otherwise
+    //! @remark Memory systems can't be added or removed after the setup process. Therefore, no lock is needed to access
+    //! them if the memory manager is initialized.
+    bool IsReadyForMemoryRequests() const;
 };
 }
@@ -5,13 +5,110 @@
 #include "gdl/base/functions/isPowerOf2.h"
 #include "gdl/resources/memory/sharedFunctions.h"
 
+#include <algorithm>
+#include <cassert>
 #include <cstring>
 #include <mutex>
 
 namespace GDL
 {
 
-MemoryPool::MemoryPool(MemorySize elementSize, U32 numElements, size_t alignment)
+//! @brief Protects the registration of magazines. Lock order: registry mutex before pool lock.
+static std::mutex magazineRegistryMutex;
+
+
+
+//! @brief Thread private list of free elements of a single memory pool. The elements are linked like the ones of the
+//! shared list.
+struct MemoryPool::Magazine
+{
+    std::atomic<MemoryPool*> mPool; //!< Owning pool - nullptr if the pool detached the magazine
+    U8* mFirstElement;
+    U32 mNumElements;
+};
+
+
+
+//! @brief Owns the magazines of a single thread. When the thread exits, the cached elements are returned to the pools.
+class MemoryPool::ThreadCache
+{
+    std::vector<std::unique_ptr<Magazine>> mMagazines;
+
+public:
+    ThreadCache() = default;
+    ThreadCache(const ThreadCache&) = delete;
+    ThreadCache(ThreadCache&&) = delete;
+    ThreadCache& operator=(const ThreadCache&) = delete;
+    ThreadCache& operator=(ThreadCache&&) = delete;
+
+    ~ThreadCache()
+    {
+        std::lock_guard<std::mutex> registryLock(magazineRegistryMutex);
+        for (auto& magazine : mMagazines)
+        {
+            MemoryPool* pool = magazine->mPool.load(std::memory_order_relaxed);
+            if (pool == nullptr)
+                continue;
+
+            pool->FlushMagazine(*magazine, magazine->mNumElements);
+            pool->mMagazines.erase(std::find(pool->mMagazines.begin(), pool->mMagazines.end(), magazine.get()));
+        }
+    }
+
+    //! @brief Gets the cache of the calling thread
+    //! @return Thread cache
+    static ThreadCache& Get()
+    {
+        static thread_local ThreadCache threadCache;
+        return threadCache;
+    }
+
+    //! @brief Finds the magazine of the passed pool
+    //! @param pool: Memory pool
+    //! @return Pointer to the magazine or nullptr if the thread has no magazine for the pool
+    Magazine* FindMagazine(const MemoryPool& pool) const
+    {
+        for (auto& magazine : mMagazines)
+            if (magazine->mPool.load(std::memory_order_relaxed) == &pool)
+                return magazine.get();
+        return nullptr;
+    }
+
+    //! @brief Gets the magazine of the passed pool. If the thread has no magazine for the pool, an empty one is
+    //! registered.
+    //! @param pool: Memory pool
+    //! @return Magazine
+    Magazine& GetMagazine(MemoryPool& pool)
+    {
+        Magazine* magazine = FindMagazine(pool);
+        if (magazine != nullptr)
+            return *magazine;
+
+        std::lock_guard<std::mutex> registryLock(magazineRegistryMutex);
+        for (auto& detachedMagazine : mMagazines)
+            if (detachedMagazine->mPool.load(std::memory_order_relaxed) == nullptr)
+            {
+                magazine = detachedMagazine.get();
+                break;
+            }
+        if (magazine == nullptr)
+        {
+            mMagazines.emplace_back(new Magazine{{nullptr}, nullptr, 0});
+            magazine = mMagazines.back().get();
+        }
+
+        pool.mMagazines.push_back(magazine);
+        magazine->mFirstElement = nullptr;
+        magazine->mNumElements = 0;
+        magazine->mPool.store(&pool, std::memory_order_relaxed);
+        return *magazine;
+    }
+};
+
+
+
+MemoryPool::MemoryPool(MemorySize elementSize, U32 numElements, size_t alignment, U32 magazineSize,
+                       MemoryBacking backing)
     : mElementSize{elementSize}
     , mAlignment{alignment}
     , mNumElements{numElements}
@@ -19,7 +116,11 @@ MemoryPool::MemoryPool(MemorySize elementSize, U32 numElements, size_t alignment
     , mMemoryStart{nullptr}
     , mFirstFreeElement{nullptr}
     , mLastFreeElement{nullptr}
-    , mMemory{nullptr}
+    , mFirstUntouchedElement{nullptr}
+    , mBacking{backing}
+    , mMemory{}
+    , mMagazineSize{magazineSize}
+    , mMagazines{}
 {
     std::lock_guard<SpinLock> lock(mSpinLock);
     CheckConstructionParameters();
@@ -29,18 +130,60 @@ MemoryPool::MemoryPool(MemorySize elementSize, U32 numElements, size_t alignment
 
 MemoryPool::~MemoryPool()
 {
+    if (mMagazineSize > 0)
+    {
+        // Magazines of running threads must not refer to a destroyed pool
+        std::lock_guard<std::mutex> registryLock(magazineRegistryMutex);
+        for (auto magazine : mMagazines)
+            magazine->mPool.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 
 
 void* MemoryPool::Allocate([[maybe_unused]] size_t size, [[maybe_unused]] size_t alignment)
 {
-    std::lock_guard<SpinLock> lock(mSpinLock);
     DEV_EXCEPTION(!IsPowerOf2(alignment), "Alignment must be a power of 2.");
     DEV_EXCEPTION(alignment > mAlignment, "Alignment request can not be fulfilled.");
-    DEV_EXCEPTION(IsInitialized() == false, "Memory pool not initialized");
     DEV_EXCEPTION(size > mElementSize, "Allocation size is larger than a pool element.");
-    EXCEPTION(mFirstFreeElement == nullptr, "No more memory available.");
+
+    if (mMagazineSize > 0)
+        return AllocateCached();
+
+    std::lock_guard<SpinLock> lock(mSpinLock);
+    return AllocateShared();
+}
+
+
+
+void* MemoryPool::AllocateCached()
+{
+    DEV_EXCEPTION(IsInitialized() == false, "Memory pool not initialized");
+
+    Magazine& magazine = ThreadCache::Get().GetMagazine(*this);
+    if (magazine.mNumElements == 0)
+        RefillMagazine(magazine);
+
+    U8* allocatedMemoryPtr = magazine.mFirstElement;
+    magazine.mFirstElement = ReadAddressFromMemory(allocatedMemoryPtr);
+    --magazine.mNumElements;
+    return allocatedMemoryPtr;
+}
+
+
+
+void* MemoryPool::AllocateShared()
+{
+    DEV_EXCEPTION(IsInitialized() == false, "Memory pool not initialized");
+    EXCEPTION(mNumFreeElements == 0, "No more memory available.");
+
+    if (mFirstFreeElement == nullptr)
+    {
+        void* allocatedMemoryPtr = mFirstUntouchedElement;
+        mFirstUntouchedElement += mElementSize.GetNumBytes();
+        --mNumFreeElements;
+        return allocatedMemoryPtr;
+    }
 
     void* allocatedMemoryPtr = mFirstFreeElement;
 
@@ -58,12 +201,55 @@ void* MemoryPool::Allocate([[maybe_unused]] size_t size, [[maybe_unused]] size_t
 
 void MemoryPool::Deallocate(void* address, [[maybe_unused]] size_t alignment)
 {
+    if (mMagazineSize > 0)
+    {
+        DeallocateCached(address);
+        return;
+    }
+
     std::lock_guard<SpinLock> lock(mSpinLock);
 
 #if !(defined(NDEBUG) && defined(NDEVEXCEPTION))
     CheckDeallocation(address);
 #endif
 
+    DeallocateShared(address);
+}
+
+
+
+void MemoryPool::DeallocateCached(void* address)
+{
+#ifndef NDEBUG
+    {
+        std::lock_guard<SpinLock> lock(mSpinLock);
+        CheckDeallocation(address);
+    }
+#elif !defined(NDEVEXCEPTION)
+    // Without debug checks, only members that don't change during the pools lifetime are accessed
+    CheckDeallocation(address);
+#endif
+
+    Magazine& magazine = ThreadCache::Get().GetMagazine(*this);
+
+#ifndef NDEBUG
+    for (U8* currentPosition = magazine.mFirstElement; currentPosition != nullptr;
+         currentPosition = ReadAddressFromMemory(currentPosition))
+        DEBUG_EXCEPTION(static_cast<U8*>(address) == currentPosition, "Memory block already freed.");
+#endif
+
+    WriteAddressToMemory(static_cast<U8*>(address), magazine.mFirstElement);
+    magazine.mFirstElement = static_cast<U8*>(address);
+    ++magazine.mNumElements;
+
+    if (magazine.mNumElements > mMagazineSize)
+        FlushMagazine(magazine, magazine.mNumElements - mMagazineSize / 2);
+}
+
+
+
+void MemoryPool::DeallocateShared(void* address)
+{
     if (mLastFreeElement != nullptr)
         WriteAddressToMemory(mLastFreeElement, address);
     else
@@ -80,13 +266,20 @@ void MemoryPool::CheckMemoryConsistency() const
 {
     std::lock_guard<SpinLock> lock(mSpinLock);
     CheckMemoryConsistencyPrivate();
+
+    if (mMagazineSize > 0)
+    {
+        const Magazine* magazine = ThreadCache::Get().FindMagazine(*this);
+        if (magazine != nullptr)
+            CheckMagazineConsistency(*magazine);
+    }
 }
 
 
 
 void MemoryPool::AlignMemory()
 {
-    void* memoryStartBefAlign = mMemory.get();
+    void* memoryStartBefAlign = mMemory.Get();
     size_t memorySizeBefAlign = TotalMemorySize();
 
     mMemoryStart =
@@ -135,6 +328,8 @@ void MemoryPool::CheckDeallocation([[maybe_unused]] void* address) const
 
 // Only in debug mode, since it is expensive
 #ifndef NDEBUG
+    DEBUG_EXCEPTION(static_cast<U8*>(address) >= mFirstUntouchedElement, "Memory block was never allocated.");
+
     U8* currentPosition = mFirstFreeElement;
     while (currentPosition != nullptr)
     {
@@ -146,10 +341,31 @@ void MemoryPool::CheckDeallocation([[maybe_unused]] void* address) const
 
 
 
+void MemoryPool::CheckMagazineConsistency(const Magazine& magazine) const
+{
+    EXCEPTION(magazine.mNumElements > mMagazineSize, "Magazine stores more elements than allowed.");
+
+    U32 cachedElementsCount = 0;
+    for (U8* currentPosition = magazine.mFirstElement; currentPosition != nullptr;
+         currentPosition = ReadAddressFromMemory(currentPosition))
+    {
+        ++cachedElementsCount;
+        EXCEPTION(cachedElementsCount > magazine.mNumElements, "Found more elements in magazine than expected.");
+        EXCEPTION(currentPosition < mMemoryStart || currentPosition >= mMemoryStart + EffectiveMemorySize() ||
+                          static_cast<size_t>(currentPosition - mMemoryStart) % mElementSize.GetNumBytes() > 0,
+                  "Magazine contains an invalid memory address.");
+    }
+
+    EXCEPTION(magazine.mNumElements != cachedElementsCount, "Number of elements in magazine is not as expected.");
+}
+
+
+
 void MemoryPool::CheckMemoryConsistencyPrivate() const
 {
     EXCEPTION(IsInitialized() == false, "Memory pool not initialized");
 
+    const U32 numListElements = mNumFreeElements - NumUntouchedElements();
     U32 freeElementsCount = 0;
     U8* currentPosition = mFirstFreeElement;
 
@@ -157,12 +373,12 @@ void MemoryPool::CheckMemoryConsistencyPrivate() const
     {
         currentPosition = ReadAddressFromMemory(currentPosition);
         ++freeElementsCount;
-        EXCEPTION(freeElementsCount > mNumFreeElements, "Found more free elements than expected. Check for loops in "
+        EXCEPTION(freeElementsCount > numListElements, "Found more free elements than expected. Check for loops in "
                                                         "the list of free elements or if the free memory counter is "
                                                         "set correctly");
     }
 
-    EXCEPTION(mNumFreeElements != freeElementsCount,
+    EXCEPTION(numListElements != freeElementsCount,
               "Free memory count is not as expected. Check if it is set correctly in allocation routine.");
 }
 
@@ -170,7 +386,7 @@ void MemoryPool::CheckMemoryConsistencyPrivate() const
 
 bool MemoryPool::IsInitialized() const
 {
-    return mMemory != nullptr;
+    return mMemory.Get() != nullptr;
 }
 
 
@@ -181,7 +397,7 @@ void MemoryPool::Initialize()
 
     EXCEPTION(IsInitialized(), "Memory pool is already initialized.");
 
-    mMemory.reset(new U8[TotalMemorySize()]);
+    mMemory = MemoryRegion(TotalMemorySize(), mBacking);
 
     AlignMemory();
     InitializeFreeMemoryList();
@@ -194,19 +410,61 @@ size_t MemoryPool::GetAlignment() const
     return mAlignment;
 }
 
+MemoryBacking MemoryPool::GetBacking() const
+{
+    std::lock_guard<SpinLock> lock(mSpinLock);
+    return IsInitialized() ? mMemory.GetBacking() : mBacking;
+}
+
+void* MemoryPool::GetElement(U32 index) const
+{
+    DEV_EXCEPTION(!IsInitialized(), "Memory pool not initialized.");
+    DEV_EXCEPTION(index >= mNumElements, "Element index out of range.");
+    return mMemoryStart + static_cast<size_t>(index) * mElementSize.GetNumBytes();
+}
+
 MemorySize MemoryPool::GetElementSize() const
 {
     std::lock_guard<SpinLock> lock(mSpinLock);
     return mElementSize;
 }
 
+SpinLockStatistics MemoryPool::GetLockStatistics() const
+{
+    return mSpinLock.GetStatistics();
+}
+
+U32 MemoryPool::GetMagazineSize() const
+{
+    return mMagazineSize;
+}
+
+U32 MemoryPool::GetNumAllocatedElements() const
+{
+    std::lock_guard<std::mutex> registryLock(magazineRegistryMutex);
+    std::lock_guard<SpinLock> lock(mSpinLock);
+
+    U32 numCachedElements = 0;
+    for (const Magazine* magazine : mMagazines)
+        numCachedElements += magazine->mNumElements;
+    return mNumElements - mNumFreeElements - numCachedElements;
+}
+
+U32 MemoryPool::GetNumElements() const
+{
+    return mNumElements;
+}
+
 
 
 void MemoryPool::Deinitialize()
 {
+    std::lock_guard<std::mutex> registryLock(magazineRegistryMutex);
     std::lock_guard<SpinLock> lock(mSpinLock);
 
     EXCEPTION(IsInitialized() == false, "Memory pool already deinitialized.");
+
+    DetachMagazines();
     EXCEPTION(mNumElements != mNumFreeElements, "Can't deinitialize. Memory still in use.");
 
     CheckMemoryConsistencyPrivate();
@@ -215,26 +473,116 @@ void MemoryPool::Deinitialize()
     mMemoryStart = nullptr;
     mFirstFreeElement = nullptr;
     mLastFreeElement = nullptr;
-    mMemory.reset(nullptr);
+    mFirstUntouchedElement = nullptr;
+    mMemory.Reset();
+}
+
+
+
+void MemoryPool::DetachMagazines()
+{
+    for (auto magazine : mMagazines)
+    {
+        while (magazine->mFirstElement != nullptr)
+        {
+            U8* element = magazine->mFirstElement;
+            magazine->mFirstElement = ReadAddressFromMemory(element);
+            DeallocateShared(element);
+        }
+        magazine->mNumElements = 0;
+        magazine->mPool.store(nullptr, std::memory_order_relaxed);
+    }
+    mMagazines.clear();
+}
+
+
+
+void MemoryPool::FlushMagazine(Magazine& magazine, U32 numElements)
+{
+    if (numElements == 0)
+        return;
+
+    // Split the elements from the magazine before acquiring the lock
+    U8* firstElement = magazine.mFirstElement;
+    U8* lastElement = firstElement;
+    for (U32 i = 1; i < numElements; ++i)
+        lastElement = ReadAddressFromMemory(lastElement);
+
+    magazine.mFirstElement = ReadAddressFromMemory(lastElement);
+    magazine.mNumElements -= numElements;
+    WriteAddressToMemory(lastElement, nullptr);
+
+    std::lock_guard<SpinLock> lock(mSpinLock);
+    if (mLastFreeElement != nullptr)
+        WriteAddressToMemory(mLastFreeElement, firstElement);
+    else
+        mFirstFreeElement = firstElement;
+    mLastFreeElement = lastElement;
+    mNumFreeElements += numElements;
 }
 
 
 
 void MemoryPool::InitializeFreeMemoryList()
 {
-    mFirstFreeElement = mMemoryStart;
+    mFirstFreeElement = nullptr;
+    mLastFreeElement = nullptr;
+    mFirstUntouchedElement = mMemoryStart;
+}
 
-    U8* currentPosition = mFirstFreeElement;
 
-    // Set up linked list in free memory
-    for (U32 i = 0; i < mNumElements - 1; ++i)
+
+void MemoryPool::AppendUntouchedElements(U32 numElements)
+{
+    assert(numElements <= NumUntouchedElements());
+
+    for (U32 i = 0; i < numElements; ++i)
     {
-        void* nextAddressPtr = static_cast<void*>(currentPosition + mElementSize.GetNumBytes());
-        WriteAddressToMemory(currentPosition, nextAddressPtr);
-        currentPosition += mElementSize.GetNumBytes();
+        U8* element = mFirstUntouchedElement;
+        mFirstUntouchedElement += mElementSize.GetNumBytes();
+
+        if (mLastFreeElement != nullptr)
+            WriteAddressToMemory(mLastFreeElement, element);
+        else
+            mFirstFreeElement = element;
+
+        mLastFreeElement = element;
+        WriteAddressToMemory(mLastFreeElement, nullptr);
     }
+}
 
-    mLastFreeElement = currentPosition;
-    WriteAddressToMemory(mLastFreeElement, nullptr);
+
+
+U32 MemoryPool::NumUntouchedElements() const
+{
+    return static_cast<U32>(static_cast<size_t>(mMemoryStart + EffectiveMemorySize() - mFirstUntouchedElement) /
+                            mElementSize.GetNumBytes());
+}
+
+
+
+void MemoryPool::RefillMagazine(Magazine& magazine)
+{
+    std::lock_guard<SpinLock> lock(mSpinLock);
+    EXCEPTION(mNumFreeElements == 0, "No more memory available.");
+
+    const U32 numElements = std::min(std::max(mMagazineSize / 2, 1u), mNumFreeElements);
+    const U32 numListElements = mNumFreeElements - NumUntouchedElements();
+    if (numListElements < numElements)
+        AppendUntouchedElements(numElements - numListElements);
+
+    U8* firstElement = mFirstFreeElement;
+    U8* lastElement = firstElement;
+    for (U32 i = 1; i < numElements; ++i)
+        lastElement = ReadAddressFromMemory(lastElement);
+
+    mFirstFreeElement = ReadAddressFromMemory(lastElement);
+    if (mFirstFreeElement == nullptr)
+        mLastFreeElement = nullptr;
+    mNumFreeElements -= numElements;
+
+    WriteAddressToMemory(lastElement, magazine.mFirstElement);
+    magazine.mFirstElement = firstElement;
+    magazine.mNumElements += numElements;
 }
 }
@@ -3,9 +3,12 @@
 #include "gdl/base/fundamentalTypes.h"
 #include "gdl/resources/cpu/spinlock.h"
 #include "gdl/resources/memory/memoryInterface.h"
+#include "gdl/resources/memory/memoryRegion.h"
 #include "gdl/resources/memory/memorySize.h"
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 
 
@@ -14,8 +17,17 @@ namespace GDL
 
 //! @brief Memory system that stores equally sized memory blocks. Free memory blocks are used to keep a linked list
 //! of free elements. This way allocations and deallocations are constant time operations.
+//! @remark Elements are only added to the list of free elements when they are used for the first time. Until then,
+//! the pool doesn't touch their memory, so that a mapped pool only commits the pages that are actually used.
+//! @remark If a magazine size is specified, each thread keeps a private list (magazine) of free elements. Allocations
+//! and deallocations only use the shared list and its lock if the magazine of the calling thread is empty or full. In
+//! this case, half a magazine of elements is transferred at once. Note that the elements stored in the magazines of
+//! other threads are not available to the calling thread.
 class MemoryPool : public MemoryInterface
 {
+    struct Magazine;
+    class ThreadCache;
+
     MemorySize mElementSize;
     size_t mAlignment;
     U32 mNumElements;
@@ -23,15 +35,23 @@ class MemoryPool : public MemoryInterface
     U8* mMemoryStart;
     U8* mFirstFreeElement;
     U8* mLastFreeElement;
-    std::unique_ptr<U8[]> mMemory;
+    U8* mFirstUntouchedElement;
+    MemoryBacking mBacking;
+    MemoryRegion mMemory;
     mutable SpinLock mSpinLock;
+    U32 mMagazineSize;
+    std::vector<Magazine*> mMagazines;
 
 public:
     //! @brief Creates the memory pool with <numElements> memory slots for elements of size <elementSize>
     //! @param elementSize: Size of a single element
     //! @param numElements: Number of elements that can be stored
     //! @param alignment: Memory alignment
-    MemoryPool(MemorySize elementSize, U32 numElements, size_t alignment = 1);
+    //! @param magazineSize: Maximal number of free elements that are cached by each thread. If 0, no thread caches are
+    //! used.
+    //! @param backing: Type of the backing memory
+    MemoryPool(MemorySize elementSize, U32 numElements, size_t alignment = 1, U32 magazineSize = 0,
+               MemoryBacking backing = MemoryBacking::HEAP);
 
     MemoryPool() = delete;
     MemoryPool(const MemoryPool&) = delete;
@@ -47,6 +67,8 @@ public:
     virtual void* Allocate(size_t size, size_t alignment = 1) override;
 
     //! @brief Checks the internal consistency of the memory pool
+    //! @remark If thread caches are used, only the magazine of the calling thread is checked additionally to the
+    //! shared list of free elements
     void CheckMemoryConsistency() const;
 
     //! @brief Deallocates memory at the passed address
@@ -55,6 +77,8 @@ public:
     virtual void Deallocate(void* address, size_t alignment = 1) override;
 
     //! @brief Deinitializes the memory pool
+    //! @remark The elements cached by the magazines of all threads are returned to the pool. Therefore, no other thread
+    //! must use the pool during this call.
     void Deinitialize();
 
     //! @brief Initializes the memory pool and sets up the internal linked list of free memory blocks
@@ -64,21 +88,82 @@ public:
     //! @return Memory alignment value
     size_t GetAlignment() const;
 
+    //! @brief Gets the backing that is used by the memory of the pool
+    //! @return Backing of the memory. Before initialization, the requested backing is returned.
+    MemoryBacking GetBacking() const;
+
+    //! @brief Gets the memory slot of the element with the passed index. Elements are stored contiguously, so that the
+    //! slot of an allocated element can be found with its index and vice versa.
+    //! @param index: Index of the element
+    //! @return Memory slot of the element
+    //! @remark The memory pool must be initialized
+    void* GetElement(U32 index) const;
+
     //! @brief Gets the element size
     //! @return Element size
     MemorySize GetElementSize() const;
 
+    //! @brief Gets the maximal number of free elements that are cached by each thread
+    //! @return Magazine size. 0 if no thread caches are used.
+    U32 GetMagazineSize() const;
+
+    //! @brief Gets the number of elements that are currently allocated. Elements cached by the magazines of the threads
+    //! are not counted as allocated.
+    //! @return Number of allocated elements
+    //! @remark The result is only exact if no other thread uses the pool during this call
+    U32 GetNumAllocatedElements() const;
+
+    //! @brief Gets the number of elements that can be stored
+    //! @return Number of elements
+    U32 GetNumElements() const;
+
+    //! @brief Gets the contention statistics of the internal spinlock
+    //! @return Spinlock statistics. All values are zero if the statistics are disabled.
+    SpinLockStatistics GetLockStatistics() const;
+
 private:
     //! @brief Aligns the memory.
     void AlignMemory();
 
+    //! @brief Allocates memory from the magazine of the calling thread
+    //! @return Pointer to memory
+    void* AllocateCached();
+
+    //! @brief Allocates memory from the shared list of free elements
+    //! @return Pointer to memory
+    void* AllocateShared();
+
     //! @brief Checks if the memory pool is constructed with valid parameters. Throws if not.
     void CheckConstructionParameters() const;
 
     //! @brief Checks if the address that should be freed is valid. Throws if not.
     //! @param address: Adress that should be freed
+    //! @remark In debug builds, the shared list of free elements is searched for the address. The caller must hold the
+    //! lock in this case.
     void CheckDeallocation(void* address) const;
 
+    //! @brief Checks the consistency of a magazine. Throws if it is not consistent.
+    //! @param magazine: Magazine that should be checked
+    void CheckMagazineConsistency(const Magazine& magazine) const;
+
+    //! @brief Deallocates memory by pushing it to the magazine of the calling thread
+    //! @param address: Adress that should be freed
+    void DeallocateCached(void* address);
+
+    //! @brief Deallocates memory by appending it to the shared list of free elements
+    //! @param address: Adress that should be freed
+    void DeallocateShared(void* address);
+
+    //! @brief Returns all elements of all registered magazines to the shared list and detaches the magazines.
+    //! @remark The caller must hold the magazine registry lock and the pool lock
+    void DetachMagazines();
+
+    //! @brief Moves the passed number of elements from a magazine to the end of the shared list of free elements
+    //! @param magazine: Magazine
+    //! @param numElements: Number of elements that should be moved
+    //! @remark The caller must not hold the pool lock
+    void FlushMagazine(Magazine& magazine, U32 numElements);
+
     //! @brief Checks the internal consistency of the memory pool
     //! @remark In contrast to the public CheckConsistency, this version does not aquire a lock. This way it can be used
     //! in functions that already aquiered a lock without introducing any further locking complexity.
@@ -88,9 +173,23 @@ private:
     //! @return TRUE / FALSE
     bool IsInitialized() const;
 
-    //! @brief Initializes the internal free memory list.
+    //! @brief Initializes the internal free memory list. The list starts empty and all elements are untouched.
     void InitializeFreeMemoryList();
 
+    //! @brief Appends untouched elements to the shared list of free elements
+    //! @param numElements: Number of elements that should be appended
+    //! @remark The caller must hold the pool lock
+    void AppendUntouchedElements(U32 numElements);
+
+    //! @brief Gets the number of elements that were never used
+    //! @return Number of untouched elements
+    U32 NumUntouchedElements() const;
+
+    //! @brief Moves up to half a magazine of elements from the shared list of free elements to a magazine
+    //! @param magazine: Magazine
+    //! @remark The caller must not hold the pool lock
+    void RefillMagazine(Magazine& magazine);
+
     //! @brief Returns the memory size without the extra alignment bytes
     //! @return Memory size without the extra alignment bytes
     size_t EffectiveMemorySize() const;
@@ -0,0 +1,226 @@
+#include "gdl/resources/memory/memoryRegion.h"
+
+#include "gdl/base/exception.h"
+
+#include <cstdint>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+namespace GDL
+{
+
+//! @brief Rounds the passed size up to a multiple of the passed power of 2
+//! @param size: Size
+//! @param granularity: Granularity
+//! @return Rounded size
+static size_t RoundUp(size_t size, size_t granularity)
+{
+    return (size + granularity - 1) & ~(granularity - 1);
+}
+
+
+
+MemoryRegion::MemoryRegion()
+    : mMemory{nullptr}
+    , mSize{0}
+    , mMappedSize{0}
+    , mBacking{MemoryBacking::HEAP}
+{
+}
+
+
+
+MemoryRegion::MemoryRegion(size_t size, MemoryBacking backing)
+    : mMemory{nullptr}
+    , mSize{size}
+    , mMappedSize{0}
+    , mBacking{backing}
+{
+    EXCEPTION(size == 0, "Memory region size must be bigger than 0");
+
+#ifndef __linux__
+    mBacking = MemoryBacking::HEAP;
+#endif
+
+    if (mBacking == MemoryBacking::HUGE_PAGES && !Map(MemoryBacking::HUGE_PAGES))
+        mBacking = MemoryBacking::TRANSPARENT_HUGE_PAGES;
+
+    if (mBacking == MemoryBacking::MAPPED || mBacking == MemoryBacking::TRANSPARENT_HUGE_PAGES)
+        EXCEPTION(!Map(mBacking), "Memory mapping failed");
+
+    if (mBacking == MemoryBacking::HEAP)
+        mMemory = new U8[size];
+}
+
+
+
+MemoryRegion::MemoryRegion(MemoryRegion&& other) noexcept
+    : mMemory{std::exchange(other.mMemory, nullptr)}
+    , mSize{std::exchange(other.mSize, 0)}
+    , mMappedSize{std::exchange(other.mMappedSize, 0)}
+    , mBacking{other.mBacking}
+{
+}
+
+
+
+MemoryRegion& MemoryRegion::operator=(MemoryRegion&& other) noexcept
+{
+    if (this != &other)
+    {
+        Reset();
+        mMemory = std::exchange(other.mMemory, nullptr);
+        mSize = std::exchange(other.mSize, 0);
+        mMappedSize = std::exchange(other.mMappedSize, 0);
+        mBacking = other.mBacking;
+    }
+    return *this;
+}
+
+
+
+MemoryRegion::~MemoryRegion()
+{
+    Reset();
+}
+
+
+
+U8* MemoryRegion::Get() const
+{
+    return mMemory;
+}
+
+
+
+MemoryBacking MemoryRegion::GetBacking() const
+{
+    return mBacking;
+}
+
+
+
+size_t MemoryRegion::GetSize() const
+{
+    return mSize;
+}
+
+
+
+bool MemoryRegion::Release([[maybe_unused]] void* address, [[maybe_unused]] size_t size)
+{
+#ifdef __linux__
+    if (mMappedSize == 0)
+        return false;
+
+    // Pages of explicit huge page mappings can only be released as a whole
+    const size_t pageSize =
+            (mBacking == MemoryBacking::HUGE_PAGES) ? HugePageSize : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    const auto begin = RoundUp(reinterpret_cast<std::uintptr_t>(address), pageSize);
+    const auto end = (reinterpret_cast<std::uintptr_t>(address) + size) & ~(pageSize - 1);
+    if (end <= begin)
+        return false;
+
+    DEV_EXCEPTION(begin < reinterpret_cast<std::uintptr_t>(mMemory) ||
+                          end > reinterpret_cast<std::uintptr_t>(mMemory) + mMappedSize,
+                  "Released memory is not part of the memory region");
+
+    return madvise(reinterpret_cast<void*>(begin), end - begin, MADV_DONTNEED) == 0;
+#else
+    return false;
+#endif
+}
+
+
+
+void MemoryRegion::Reset()
+{
+    if (mMemory == nullptr)
+        return;
+
+#ifdef __linux__
+    if (mMappedSize > 0)
+        munmap(mMemory, mMappedSize);
+    else
+        delete[] mMemory;
+#else
+    delete[] mMemory;
+#endif
+
+    mMemory = nullptr;
+    mSize = 0;
+    mMappedSize = 0;
+}
+
+
+
+bool MemoryRegion::Map([[maybe_unused]] MemoryBacking backing)
+{
+#ifdef __linux__
+    constexpr int protection = PROT_READ | PROT_WRITE;
+    constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+
+    if (backing == MemoryBacking::HUGE_PAGES)
+    {
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+        // Huge pages must be reserved. Otherwise, the mapping succeeds even if the huge page pool is empty and the
+        // first access to a page without backing terminates the process.
+        constexpr int hugePageFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+        const size_t mappedSize = RoundUp(mSize, HugePageSize);
+        void* memory = mmap(nullptr, mappedSize, protection, hugePageFlags, -1, 0);
+        if (memory == MAP_FAILED)
+            return false;
+
+        mMemory = static_cast<U8*>(memory);
+        mMappedSize = mappedSize;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    if (backing == MemoryBacking::MAPPED)
+    {
+        const size_t mappedSize = RoundUp(mSize, static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+        void* memory = mmap(nullptr, mappedSize, protection, flags, -1, 0);
+        if (memory == MAP_FAILED)
+            return false;
+
+        mMemory = static_cast<U8*>(memory);
+        mMappedSize = mappedSize;
+        return true;
+    }
+
+    // Transparent huge pages are only used for 2 MiB aligned ranges. Map an extra huge page and trim the unaligned
+    // head and tail.
+    const size_t mappedSize = RoundUp(mSize, HugePageSize);
+    void* memory = mmap(nullptr, mappedSize + HugePageSize, protection, flags, -1, 0);
+    if (memory == MAP_FAILED)
+        return false;
+
+    const auto start = reinterpret_cast<std::uintptr_t>(memory);
+    const auto alignedStart = RoundUp(start, HugePageSize);
+    if (alignedStart > start)
+        munmap(memory, alignedStart - start);
+    if (alignedStart - start < HugePageSize)
+        munmap(reinterpret_cast<void*>(alignedStart + mappedSize), HugePageSize - (alignedStart - start));
+
+#ifdef MADV_HUGEPAGE
+    madvise(reinterpret_cast<void*>(alignedStart), mappedSize, MADV_HUGEPAGE);
+#endif
+
+    mMemory = reinterpret_cast<U8*>(alignedStart);
+    mMappedSize = mappedSize;
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace GDL
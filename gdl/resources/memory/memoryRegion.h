@@ -0,0 +1,85 @@
+#pragma once
+
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <cstddef>
+
+
+namespace GDL
+{
+
+//! @brief Enum class that specifies how the backing memory of a memory system is obtained from the operating system
+enum class MemoryBacking
+{
+    HEAP,                   //!< Memory is allocated with new
+    MAPPED,                 //!< Anonymous memory mapping. Pages are only committed when they are touched.
+    TRANSPARENT_HUGE_PAGES, //!< Like MAPPED, but 2 MiB aligned and marked as candidate for transparent huge pages
+    HUGE_PAGES              //!< Explicit 2 MiB huge pages from the huge page pool of the operating system
+};
+
+
+
+//! @brief Owns a contiguous region of memory which is the backing store of a memory system
+//! @remark Mapped regions reserve address space without committing it. The operating system commits a page when it
+//! is touched for the first time, so that the unused part of a large memory system does not occupy physical memory.
+//! If explicit huge pages can't be mapped, for example because the huge page pool is empty, transparent huge pages
+//! are used instead. On systems without memory mapping support, all regions use the heap. GetBacking returns the
+//! backing that is actually used.
+class MemoryRegion
+{
+public:
+    //! @brief Size and alignment of a huge page
+    static constexpr size_t HugePageSize = 2 * 1024 * 1024;
+
+private:
+    U8* mMemory;
+    size_t mSize;
+    size_t mMappedSize;
+    MemoryBacking mBacking;
+
+public:
+    //! @brief Creates an empty region
+    MemoryRegion();
+
+    //! @brief Creates a region with at least <size> bytes
+    //! @param size: Size of the region
+    //! @param backing: Requested type of backing memory
+    MemoryRegion(size_t size, MemoryBacking backing = MemoryBacking::HEAP);
+
+    MemoryRegion(const MemoryRegion&) = delete;
+    MemoryRegion(MemoryRegion&& other) noexcept;
+    MemoryRegion& operator=(const MemoryRegion&) = delete;
+    MemoryRegion& operator=(MemoryRegion&& other) noexcept;
+    ~MemoryRegion();
+
+    //! @brief Gets the start of the region
+    //! @return Start of the region. nullptr if the region is empty.
+    U8* Get() const;
+
+    //! @brief Gets the backing that is actually used by the region
+    //! @return Backing of the region
+    MemoryBacking GetBacking() const;
+
+    //! @brief Gets the usable size of the region
+    //! @return Size of the region
+    size_t GetSize() const;
+
+    //! @brief Returns the physical memory of all pages that are completely inside of the passed range to the operating
+    //! system. The address range stays valid. Released pages are filled with zeros when they are touched again.
+    //! @param address: Start of the range
+    //! @param size: Size of the range
+    //! @return TRUE if memory was released. FALSE if the range contains no complete page or the region is not mapped.
+    bool Release(void* address, size_t size);
+
+    //! @brief Frees the region
+    void Reset();
+
+private:
+    //! @brief Maps the region with the passed backing
+    //! @param backing: Backing of the region. Must not be HEAP.
+    //! @return TRUE if the mapping was successful
+    bool Map(MemoryBacking backing);
+};
+
+} // namespace GDL
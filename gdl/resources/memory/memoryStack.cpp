@@ -4,29 +4,45 @@
 #include "gdl/base/exception.h"
 #include "gdl/base/functions/alignment.h"
 #include "gdl/base/functions/isPowerOf2.h"
+#include "gdl/resources/memory/utility/numaBinding.h"
 
+#include <algorithm>
 #include <mutex>
 
 namespace GDL
 {
 
 template <>
-MemoryStackTemplate<true>::MemoryStackTemplate(MemorySize memorySize)
+MemoryStackTemplate<true>::MemoryStackTemplate(MemorySize memorySize, bool growable, MemoryBacking backing)
     : mMemorySize{memorySize}
+    , mGrowable{growable}
+    , mBacking{backing}
     , mNumAllocations{0}
+    , mNumReclaimedRemoteDeallocations{0}
+    , mCurrentBlockIndex{0}
     , mCurrentMemoryPtr{nullptr}
-    , mMemory{nullptr}
+    , mCurrentBlockEnd{nullptr}
+    , mHighWaterMark{0}
+    , mFirstBlock{MemoryRegion(), 0, 0}
     , mThreadSafetyMechanism{std::this_thread::get_id()}
+    , mNumRemoteDeallocations{0}
 {
     CheckConstructionParameters();
 }
 
 template <>
-MemoryStackTemplate<false>::MemoryStackTemplate(MemorySize memorySize)
+MemoryStackTemplate<false>::MemoryStackTemplate(MemorySize memorySize, bool growable, MemoryBacking backing)
     : mMemorySize{memorySize}
+    , mGrowable{growable}
+    , mBacking{backing}
     , mNumAllocations{0}
+    , mNumReclaimedRemoteDeallocations{0}
+    , mCurrentBlockIndex{0}
     , mCurrentMemoryPtr{nullptr}
-    , mMemory{nullptr}
+    , mCurrentBlockEnd{nullptr}
+    , mHighWaterMark{0}
+    , mFirstBlock{MemoryRegion(), 0, 0}
+    , mNumRemoteDeallocations{0}
 {
     CheckConstructionParameters();
 }
@@ -44,6 +60,7 @@ void* MemoryStackTemplate<true>::Allocate(size_t size, size_t alignment)
     DEV_EXCEPTION(mThreadSafetyMechanism != std::this_thread::get_id(),
                   "Thread private memory stack can only be accessed by owning thread");
 
+    ReclaimRemoteDeallocations();
     return AllocatePrivate(size, alignment);
 }
 
@@ -80,24 +97,38 @@ MemoryStackTemplate<true>::MemoryStackDeallocator MemoryStackTemplate<true>::Cre
 
 
 template <>
-void MemoryStackTemplate<false>::SetState(U32 numAllocations, U8* memoryPointer)
+void MemoryStackTemplate<false>::SetState(U32 numAllocations, [[maybe_unused]] U32 numReclaimedRemoteDeallocations,
+                                          U32 blockIndex, U8* memoryPointer)
 {
     std::lock_guard<SpinLock> lock(mThreadSafetyMechanism);
 
+    UpdateHighWaterMark();
     mNumAllocations = numAllocations;
-    mCurrentMemoryPtr = memoryPointer;
+    SetCurrentBlock(blockIndex, memoryPointer);
 }
 
 
 
 template <>
-void MemoryStackTemplate<true>::SetState(U32 numAllocations, U8* memoryPointer)
+void MemoryStackTemplate<true>::SetState(U32 numAllocations, U32 numReclaimedRemoteDeallocations, U32 blockIndex,
+                                         U8* memoryPointer)
 {
     DEV_EXCEPTION(mThreadSafetyMechanism != std::this_thread::get_id(),
                   "Thread private memory stack can only be accessed by owning thread");
 
-    mNumAllocations = numAllocations;
-    mCurrentMemoryPtr = memoryPointer;
+    // Remote deallocations during the lifetime of the deallocator freed allocations that existed before it was created.
+    // They are subtracted from the restored number of allocations. The running total also contains the deallocations
+    // that were already reclaimed during the lifetime of the deallocator.
+    ReclaimRemoteDeallocations();
+    const U32 numRemoteDeallocations = mNumReclaimedRemoteDeallocations - numReclaimedRemoteDeallocations;
+    DEV_EXCEPTION(numRemoteDeallocations > numAllocations, "More deallocations than allocations");
+
+    UpdateHighWaterMark();
+    mNumAllocations = numAllocations - numRemoteDeallocations;
+    if (mNumAllocations == 0)
+        SetCurrentBlock(0, mFirstBlock.mMemory.Get());
+    else
+        SetCurrentBlock(blockIndex, memoryPointer);
 }
 
 
@@ -105,9 +136,15 @@ void MemoryStackTemplate<true>::SetState(U32 numAllocations, U8* memoryPointer)
 template <>
 void MemoryStackTemplate<true>::Deallocate(void* address, [[maybe_unused]] size_t alignment)
 {
-    DEV_EXCEPTION(mThreadSafetyMechanism != std::this_thread::get_id(),
-                  "Thread private memory stack can only be accessed by owning thread");
-
+    if (mThreadSafetyMechanism != std::this_thread::get_id())
+    {
+        // The memory blocks might be modified by the owning thread, so the address can't be checked
+        DEV_EXCEPTION(address == nullptr, "Can't free a nullptr");
+        mNumRemoteDeallocations.fetch_add(1, std::memory_order_release);
+        return;
+    }
+
+    ReclaimRemoteDeallocations();
     DeallocatePrivate(address);
 }
 
@@ -128,6 +165,7 @@ void MemoryStackTemplate<true>::Deinitialize()
     EXCEPTION(mThreadSafetyMechanism != std::this_thread::get_id(),
               "Thread private memory stack can only be accessed by owning thread");
 
+    ReclaimRemoteDeallocations();
     DeinitializePrivate();
 }
 
@@ -142,6 +180,63 @@ void MemoryStackTemplate<false>::Deinitialize()
 
 
 
+template <>
+SpinLockStatistics MemoryStackTemplate<true>::GetLockStatistics() const
+{
+    return SpinLockStatistics();
+}
+
+
+
+template <>
+SpinLockStatistics MemoryStackTemplate<false>::GetLockStatistics() const
+{
+    return mThreadSafetyMechanism.GetStatistics();
+}
+
+
+
+template <>
+MemoryStackStatistics MemoryStackTemplate<true>::GetStatistics() const
+{
+    DEV_EXCEPTION(mThreadSafetyMechanism != std::this_thread::get_id(),
+                  "Thread private memory stack can only be accessed by owning thread");
+
+    return GetStatisticsPrivate();
+}
+
+
+
+template <>
+MemoryStackStatistics MemoryStackTemplate<false>::GetStatistics() const
+{
+    std::lock_guard<SpinLock> lock(mThreadSafetyMechanism);
+    return GetStatisticsPrivate();
+}
+
+
+
+template <>
+void MemoryStackTemplate<true>::ReleaseUnusedMemory()
+{
+    DEV_EXCEPTION(mThreadSafetyMechanism != std::this_thread::get_id(),
+                  "Thread private memory stack can only be accessed by owning thread");
+
+    ReclaimRemoteDeallocations();
+    ReleaseUnusedMemoryPrivate();
+}
+
+
+
+template <>
+void MemoryStackTemplate<false>::ReleaseUnusedMemory()
+{
+    std::lock_guard<SpinLock> lock(mThreadSafetyMechanism);
+    ReleaseUnusedMemoryPrivate();
+}
+
+
+
 template <>
 void MemoryStackTemplate<true>::Initialize()
 {
@@ -167,13 +262,20 @@ void* MemoryStackTemplate<_threadPrivate>::AllocatePrivate(size_t size, size_t a
     size_t misalignment = Misalignment(mCurrentMemoryPtr, alignment);
     size_t correction = ((misalignment + alignment - 1) / alignment) * alignment - misalignment;
 
-    U8* allocatedMemoryPtr = mCurrentMemoryPtr + correction;
-
     DEV_EXCEPTION(size == 0, "Allocated memory size is 0.");
     DEV_EXCEPTION(!IsInitialized(), "Memory stack not initialized.");
     DEV_EXCEPTION(!IsPowerOf2(alignment), "Alignment must be a power of 2.");
-    EXCEPTION(allocatedMemoryPtr + size > mMemory.get() + mMemorySize.GetNumBytes(), "No more memory available.");
 
+    if (correction + size > static_cast<size_t>(mCurrentBlockEnd - mCurrentMemoryPtr))
+    {
+        EXCEPTION(!mGrowable, "No more memory available.");
+
+        UseNextBlock(size + alignment);
+        misalignment = Misalignment(mCurrentMemoryPtr, alignment);
+        correction = ((misalignment + alignment - 1) / alignment) * alignment - misalignment;
+    }
+
+    U8* allocatedMemoryPtr = mCurrentMemoryPtr + correction;
     mCurrentMemoryPtr = allocatedMemoryPtr + size;
 
     ++mNumAllocations;
@@ -185,14 +287,16 @@ template <bool _threadPrivate>
 void MemoryStackTemplate<_threadPrivate>::DeallocatePrivate([[maybe_unused]] void* address)
 {
     DEV_EXCEPTION(address == nullptr, "Can't free a nullptr");
-    DEV_EXCEPTION(static_cast<U8*>(address) < mMemory.get() ||
-                          static_cast<U8*>(address) > mMemory.get() + mMemorySize.GetNumBytes(),
+    DEV_EXCEPTION(!IsAddressInsideMemory(static_cast<U8*>(address)),
                   "Memory address is not part of the stack allocators memory");
     DEV_EXCEPTION(mNumAllocations == 0, "No memory allocated that can be deallocated");
 
     --mNumAllocations;
     if (mNumAllocations == 0)
-        mCurrentMemoryPtr = mMemory.get();
+    {
+        UpdateHighWaterMark();
+        SetCurrentBlock(0, mFirstBlock.mMemory.Get());
+    }
 }
 
 template <bool _threadPrivate>
@@ -202,8 +306,49 @@ void MemoryStackTemplate<_threadPrivate>::DeinitializePrivate()
     EXCEPTION(IsInitialized() == false, "Memory stack already deinitialized.");
     EXCEPTION(mNumAllocations != 0, "Can't deinitialize. Memory still in use.");
 
-    mMemory.reset(nullptr);
+    mFirstBlock = Block{MemoryRegion(), 0, 0};
+    mAdditionalBlocks.clear();
+    mCurrentBlockIndex = 0;
     mCurrentMemoryPtr = {nullptr};
+    mCurrentBlockEnd = {nullptr};
+}
+
+template <bool _threadPrivate>
+MemoryStackStatistics MemoryStackTemplate<_threadPrivate>::GetStatisticsPrivate() const
+{
+    MemoryStackStatistics statistics;
+    if (!IsInitialized())
+        return statistics;
+
+    statistics.mUsedMemorySize = GetUsedMemorySize();
+    statistics.mHighWaterMark = std::max(mHighWaterMark, statistics.mUsedMemorySize);
+    statistics.mReservedMemorySize = mFirstBlock.mSize;
+    for (const Block& block : mAdditionalBlocks)
+        statistics.mReservedMemorySize += block.mSize;
+    statistics.mNumBlocks = static_cast<U32>(mAdditionalBlocks.size()) + 1;
+
+    return statistics;
+}
+
+template <bool _threadPrivate>
+inline typename MemoryStackTemplate<_threadPrivate>::Block&
+MemoryStackTemplate<_threadPrivate>::GetBlock(U32 blockIndex)
+{
+    return (blockIndex == 0) ? mFirstBlock : mAdditionalBlocks[blockIndex - 1];
+}
+
+template <bool _threadPrivate>
+inline const typename MemoryStackTemplate<_threadPrivate>::Block&
+MemoryStackTemplate<_threadPrivate>::GetBlock(U32 blockIndex) const
+{
+    return (blockIndex == 0) ? mFirstBlock : mAdditionalBlocks[blockIndex - 1];
+}
+
+template <bool _threadPrivate>
+inline size_t MemoryStackTemplate<_threadPrivate>::GetUsedMemorySize() const
+{
+    const Block& block = GetBlock(mCurrentBlockIndex);
+    return block.mOffset + static_cast<size_t>(mCurrentMemoryPtr - block.mMemory.Get());
 }
 
 template <bool _threadPrivate>
@@ -211,9 +356,85 @@ void MemoryStackTemplate<_threadPrivate>::InitializePrivate()
 {
     EXCEPTION(IsInitialized(), "Memory stack is already initialized");
 
-    mMemory.reset(new U8[mMemorySize.GetNumBytes()]);
+    const size_t blockSize = mMemorySize.GetNumBytes();
+    mFirstBlock = Block{MemoryRegion(blockSize, mBacking), blockSize, 0};
+
+    // Thread private stacks are only used by the creating thread. Keep their memory on its NUMA node.
+    if constexpr (_threadPrivate)
+        BindMemoryToCurrentNumaNode(mFirstBlock.mMemory.Get(), blockSize);
+
     mNumAllocations = 0;
-    mCurrentMemoryPtr = mMemory.get();
+    mNumRemoteDeallocations.store(0, std::memory_order_relaxed);
+    mHighWaterMark = 0;
+    SetCurrentBlock(0, mFirstBlock.mMemory.Get());
+}
+
+template <bool _threadPrivate>
+inline void MemoryStackTemplate<_threadPrivate>::ReclaimRemoteDeallocations()
+{
+    if (mNumRemoteDeallocations.load(std::memory_order_relaxed) == 0)
+        return;
+
+    const U32 numRemoteDeallocations = mNumRemoteDeallocations.exchange(0, std::memory_order_acquire);
+    DEV_EXCEPTION(numRemoteDeallocations > mNumAllocations, "More deallocations than allocations");
+
+    mNumAllocations -= numRemoteDeallocations;
+    mNumReclaimedRemoteDeallocations += numRemoteDeallocations;
+    if (mNumAllocations == 0)
+    {
+        UpdateHighWaterMark();
+        SetCurrentBlock(0, mFirstBlock.mMemory.Get());
+    }
+}
+
+template <bool _threadPrivate>
+void MemoryStackTemplate<_threadPrivate>::ReleaseUnusedMemoryPrivate()
+{
+    DEV_EXCEPTION(!IsInitialized(), "Memory stack not initialized.");
+
+    mAdditionalBlocks.resize(mCurrentBlockIndex);
+    GetBlock(mCurrentBlockIndex)
+            .mMemory.Release(mCurrentMemoryPtr, static_cast<size_t>(mCurrentBlockEnd - mCurrentMemoryPtr));
+}
+
+template <bool _threadPrivate>
+inline void MemoryStackTemplate<_threadPrivate>::SetCurrentBlock(U32 blockIndex, U8* memoryPointer)
+{
+    mCurrentBlockIndex = blockIndex;
+    mCurrentMemoryPtr = memoryPointer;
+    const Block& block = GetBlock(blockIndex);
+    mCurrentBlockEnd = block.mMemory.Get() + block.mSize;
+}
+
+template <bool _threadPrivate>
+inline void MemoryStackTemplate<_threadPrivate>::UpdateHighWaterMark()
+{
+    mHighWaterMark = std::max(mHighWaterMark, GetUsedMemorySize());
+}
+
+template <bool _threadPrivate>
+void MemoryStackTemplate<_threadPrivate>::UseNextBlock(size_t minBlockSize)
+{
+    const Block& currentBlock = GetBlock(mCurrentBlockIndex);
+    const size_t offset = currentBlock.mOffset + currentBlock.mSize;
+    const U32 nextBlockIndex = mCurrentBlockIndex + 1;
+
+    if (nextBlockIndex > mAdditionalBlocks.size())
+        mAdditionalBlocks.push_back(Block{MemoryRegion(), 0, 0});
+
+    // Blocks behind the current one are unused. A retained block that is too small can be replaced.
+    Block& nextBlock = GetBlock(nextBlockIndex);
+    if (nextBlock.mSize < minBlockSize)
+    {
+        nextBlock.mSize = std::max(mMemorySize.GetNumBytes(), minBlockSize);
+        nextBlock.mMemory = MemoryRegion(nextBlock.mSize, mBacking);
+
+        if constexpr (_threadPrivate)
+            BindMemoryToCurrentNumaNode(nextBlock.mMemory.Get(), nextBlock.mSize);
+    }
+    nextBlock.mOffset = offset;
+
+    SetCurrentBlock(nextBlockIndex, nextBlock.mMemory.Get());
 }
 
 
@@ -226,10 +447,27 @@ void MemoryStackTemplate<_threadPrivate>::CheckConstructionParameters() const
 
 
 
+template <bool _threadPrivate>
+bool MemoryStackTemplate<_threadPrivate>::IsAddressInsideMemory(const U8* address) const
+{
+    if (!IsInitialized())
+        return false;
+
+    for (U32 i = 0; i <= mCurrentBlockIndex; ++i)
+    {
+        const Block& block = GetBlock(i);
+        if (address >= block.mMemory.Get() && address <= block.mMemory.Get() + block.mSize)
+            return true;
+    }
+    return false;
+}
+
+
+
 template <bool _threadPrivate>
 bool MemoryStackTemplate<_threadPrivate>::IsInitialized() const
 {
-    return mMemory != nullptr;
+    return mFirstBlock.mMemory.Get() != nullptr;
 }
 
 
@@ -238,6 +476,8 @@ template <bool _threadPrivate>
 MemoryStackTemplate<_threadPrivate>::MemoryStackDeallocator::MemoryStackDeallocator(MemoryStackTemplate& memoryStack)
     : mMemoryStack{memoryStack}
     , mStoredNumAllocations{memoryStack.mNumAllocations}
+    , mStoredNumReclaimedRemoteDeallocations{memoryStack.mNumReclaimedRemoteDeallocations}
+    , mStoredBlockIndex{memoryStack.mCurrentBlockIndex}
     , mStoredPointer{memoryStack.mCurrentMemoryPtr}
 {
 }
@@ -247,7 +487,8 @@ MemoryStackTemplate<_threadPrivate>::MemoryStackDeallocator::MemoryStackDealloca
 template <bool _threadPrivate>
 MemoryStackTemplate<_threadPrivate>::MemoryStackDeallocator::~MemoryStackDeallocator()
 {
-    mMemoryStack.SetState(mStoredNumAllocations, mStoredPointer);
+    mMemoryStack.SetState(mStoredNumAllocations, mStoredNumReclaimedRemoteDeallocations, mStoredBlockIndex,
+                          mStoredPointer);
 }
 
 
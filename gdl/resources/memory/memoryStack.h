@@ -4,18 +4,43 @@
 #include "gdl/base/fundamentalTypes.h"
 #include "gdl/resources/cpu/spinlock.h"
 #include "gdl/resources/memory/memoryInterface.h"
+#include "gdl/resources/memory/memoryRegion.h"
 #include "gdl/resources/memory/memorySize.h"
+#include <atomic>
 #include <memory>
 #include <thread>
+#include <vector>
 
 namespace GDL
 {
 
 
+//! @brief Usage statistics of a memory stack
+struct MemoryStackStatistics
+{
+    size_t mUsedMemorySize = 0;     //!< Memory in use, including alignment padding and skipped ends of memory blocks
+    size_t mHighWaterMark = 0;      //!< Maximal used memory since the initialization of the memory stack
+    size_t mReservedMemorySize = 0; //!< Total size of all memory blocks, including retained unused ones
+    U32 mNumBlocks = 0;             //!< Number of memory blocks
+};
+
+
+
 //! @brief Memory system that can only allocate memory from its end. The memory is only freed all at once if the number
 //! of allocations equals the number of deallocations. The template bool defines how multithreading is handled.
 //! @tparam  _threadPrivate: TRUE if the memory stack can only be accessed by a single thread. FALSE if the memory stack
 //! is accessable by multiple threads and needs to be protected by a mutex
+//! @remark A growable memory stack chains additional memory blocks if the current one runs out of memory instead of
+//! throwing. Blocks are never released before deinitialization. They are reused after the stack is reset by a memory
+//! stack deallocator or by deallocating all allocations, so that a stack which is reset each frame stops allocating
+//! once its high-water mark is reached.
+//! @remark Memory of a thread private memory stack can be deallocated by any thread. Since a deallocation only
+//! decrements the number of allocations, foreign threads just increment a lock-free counter of remote
+//! deallocations. The owning thread reclaims them on its next allocation, deallocation or stack reset. Handing a buffer
+//! to another thread doesn't require a copy, but the stack is only reset after the owner touched it again. Remote
+//! deallocations during the lifetime of a memory stack deallocator are applied to the allocations that existed before
+//! it was created. Allocations made during its lifetime are released by the deallocator and must not be freed by other
+//! threads.
 template <bool _threadPrivate>
 class MemoryStackTemplate : public MemoryInterface
 {
@@ -30,6 +55,8 @@ public:
 
         MemoryStackTemplate& mMemoryStack;
         U32 mStoredNumAllocations = 0;
+        U32 mStoredNumReclaimedRemoteDeallocations = 0;
+        U32 mStoredBlockIndex = 0;
         U8* mStoredPointer = nullptr;
 
         //! @brief Ctor
@@ -46,16 +73,35 @@ public:
     };
 
 private:
+    //! @brief Contiguous memory block of the memory stack
+    struct Block
+    {
+        MemoryRegion mMemory;
+        size_t mSize;
+        size_t mOffset; //!< Total size of all preceding blocks
+    };
+
     MemorySize mMemorySize;
+    bool mGrowable;
+    MemoryBacking mBacking;
     U32 mNumAllocations;
+    U32 mNumReclaimedRemoteDeallocations; //!< Running total of reclaimed remote deallocations. Only used by the owner.
+    U32 mCurrentBlockIndex;
     U8* mCurrentMemoryPtr;
-    std::unique_ptr<U8[]> mMemory;
-    ThreadSafetyMechanism mThreadSafetyMechanism;
+    U8* mCurrentBlockEnd;
+    size_t mHighWaterMark;
+    Block mFirstBlock;
+    std::vector<Block> mAdditionalBlocks;
+    mutable ThreadSafetyMechanism mThreadSafetyMechanism;
+    alignas(64) std::atomic<U32> mNumRemoteDeallocations;
 
 public:
     //! @brief Creates the thread private memory stack with <memorySize> bytes of memory
-    //! @param memorySize: total amount of memory
-    MemoryStackTemplate(MemorySize memorySize);
+    //! @param memorySize: total amount of memory. If the memory stack is growable, this is the size of the first and
+    //! every additional memory block. Larger blocks are only created for allocations that don't fit into a single one.
+    //! @param growable: If TRUE, new memory blocks are chained if the memory stack runs out of memory
+    //! @param backing: Type of the backing memory of all memory blocks
+    MemoryStackTemplate(MemorySize memorySize, bool growable = false, MemoryBacking backing = MemoryBacking::HEAP);
 
     MemoryStackTemplate() = delete;
     MemoryStackTemplate(const MemoryStackTemplate&) = delete;
@@ -74,14 +120,30 @@ public:
     //! @brief Deallocates memory at the passed address
     //! @param address: Adress that should be freed
     //! @param alignment: Memory alignment
+    //! @remark If a thread private memory stack is accessed by a thread that doesn't own it, the deallocation is
+    //! deferred until the owning thread accesses the stack again
     virtual void Deallocate(void* address, size_t alignment = 1) override;
 
     //! @brief Deinitializes the memory stack
     void Deinitialize();
 
+    //! @brief Gets the contention statistics of the internal spinlock
+    //! @return Spinlock statistics. All values are zero if the statistics are disabled or if the memory stack is
+    //! thread private.
+    SpinLockStatistics GetLockStatistics() const;
+
+    //! @brief Gets the usage statistics of the memory stack
+    //! @return Memory stack statistics
+    MemoryStackStatistics GetStatistics() const;
+
     //! @brief Initializes the memory stack
     void Initialize();
 
+    //! @brief Returns memory that is currently not in use to the operating system. Retained memory blocks behind the
+    //! current one are freed. If the backing memory is mapped, the physical pages behind the top of the stack are
+    //! released too. They are committed again when the stack grows into them.
+    void ReleaseUnusedMemory();
+
     //! @brief Creates a memory stack deallocator for the memory stack
     //! @return New memory stack allocator instance
     [[nodiscard]] MemoryStackDeallocator CreateMemoryStackDeallocator();
@@ -106,15 +168,64 @@ private:
     //! @brief Class internal function that initializes the memory stack
     void InitializePrivate();
 
+    //! @brief Gets the memory block with the passed index
+    //! @param blockIndex: Block index
+    //! @return Memory block
+    //! @remark The first block is stored separately, so that non-growable stacks don't need any additional heap
+    //! allocations
+    inline Block& GetBlock(U32 blockIndex);
+
+    //! @brief Gets the memory block with the passed index
+    //! @param blockIndex: Block index
+    //! @return Memory block
+    inline const Block& GetBlock(U32 blockIndex) const;
+
+    //! @brief Class internal function that gets the usage statistics of the memory stack
+    //! @return Memory stack statistics
+    MemoryStackStatistics GetStatisticsPrivate() const;
+
+    //! @brief Gets the memory that is currently in use, including alignment padding and skipped ends of memory blocks
+    //! @return Used memory size
+    inline size_t GetUsedMemorySize() const;
+
+    //! @brief Returns if the passed address is inside one of the memory blocks that are currently in use
+    //! @param: address: Address that should be checked
+    //! @return TRUE / FALSE
+    bool IsAddressInsideMemory(const U8* address) const;
+
     //! @brief Returns if the memory stack is initialized
     //! @return TRUE / FALSE
     bool IsInitialized() const;
 
-    //! @brief Sets the number of allocations and the current memory pointer
+    //! @brief Applies all deallocations that were done by threads which don't own the memory stack. Must only be
+    //! called by the owning thread.
+    inline void ReclaimRemoteDeallocations();
+
+    //! @brief Class internal function that returns unused memory to the operating system
+    void ReleaseUnusedMemoryPrivate();
+
+    //! @brief Sets the current memory block and the current memory pointer
+    //! @param blockIndex: Index of the new current memory block
+    //! @param memoryPointer: New position of the memory pointer. It must be part of the new current block.
+    inline void SetCurrentBlock(U32 blockIndex, U8* memoryPointer);
+
+    //! @brief Sets the number of allocations, the current memory block and the current memory pointer
     //! @param numAllocations: New number of allocations
+    //! @param numReclaimedRemoteDeallocations: Number of reclaimed remote deallocations when the state was stored. All
+    //! remote deallocations since then are subtracted from the new number of allocations.
+    //! @param blockIndex: Index of the new current memory block
     //! @param memoryPointer: New position of the memory pointer
     //! @remark This function is only ment to be used by the stack deallocator class
-    void SetState(U32 numAllocations, U8* memoryPointer);
+    void SetState(U32 numAllocations, U32 numReclaimedRemoteDeallocations, U32 blockIndex, U8* memoryPointer);
+
+    //! @brief Updates the high-water mark with the currently used memory. This needs to be done before the memory stack
+    //! is reset.
+    inline void UpdateHighWaterMark();
+
+    //! @brief Continues with the next memory block. If there is no retained block that can store the requested number
+    //! of bytes, a new one is created.
+    //! @param minBlockSize: Minimal size of the next block
+    void UseNextBlock(size_t minBlockSize);
 };
 
 
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/memoryPool.h"
+#include "gdl/resources/memory/memoryRegion.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace GDL
+{
+
+template <typename _type>
+class ObjectPool;
+
+
+
+//! @brief 32 bit handle of an object inside of an object pool. It combines the index of the objects memory slot with
+//! the generation of the slot. The generation changes each time an object is created or destroyed in the slot, so
+//! that handles of destroyed objects are detected even if the slot was reused.
+//! @tparam _type: Type of the referenced object
+template <typename _type>
+class ObjectHandle
+{
+    friend class ObjectPool<_type>;
+
+public:
+    static constexpr U32 NumIndexBits = 20;
+    static constexpr U32 NumGenerationBits = 32 - NumIndexBits;
+    static constexpr U32 IndexMask = (1u << NumIndexBits) - 1;
+    static constexpr U32 GenerationMask = (1u << NumGenerationBits) - 1;
+
+    //! @brief Maximal number of objects that can be referenced. The largest index is reserved for null handles.
+    static constexpr U32 MaxNumObjects = IndexMask;
+
+private:
+    U32 mValue;
+
+    //! @brief Creates a handle from a slot index and a generation
+    //! @param index: Index of the memory slot
+    //! @param generation: Generation of the memory slot
+    constexpr ObjectHandle(U32 index, U32 generation);
+
+public:
+    //! @brief Creates a null handle which doesn't reference any object
+    constexpr ObjectHandle();
+
+    constexpr ObjectHandle(const ObjectHandle&) = default;
+    constexpr ObjectHandle(ObjectHandle&&) = default;
+    constexpr ObjectHandle& operator=(const ObjectHandle&) = default;
+    constexpr ObjectHandle& operator=(ObjectHandle&&) = default;
+    ~ObjectHandle() = default;
+
+    //! @brief Gets the generation of the referenced memory slot
+    //! @return Generation
+    constexpr U32 GetGeneration() const;
+
+    //! @brief Gets the index of the referenced memory slot
+    //! @return Index
+    constexpr U32 GetIndex() const;
+
+    //! @brief Gets the raw value of the handle
+    //! @return Value of the handle
+    constexpr U32 GetValue() const;
+
+    //! @brief Returns if the handle is a null handle
+    //! @return TRUE / FALSE
+    constexpr bool IsNull() const;
+
+    //! @brief Compares two handles
+    //! @param other: Other handle
+    //! @return TRUE if both handles reference the same slot and generation
+    constexpr bool operator==(const ObjectHandle& other) const;
+
+    //! @brief Compares two handles
+    //! @param other: Other handle
+    //! @return TRUE if the handles reference different slots or generations
+    constexpr bool operator!=(const ObjectHandle& other) const;
+};
+
+
+
+//! @brief Stores objects of a single type inside of a memory pool and references them with generation checked 32 bit
+//! handles instead of pointers.
+//! @tparam _type: Type of the stored objects
+//! @remark Objects never move, so pointers to them stay valid until they are destroyed. Destroyed slots are reused by
+//! the next created objects, which keeps the live objects densely packed. ForEach visits them in memory order.
+//! @remark The object pool is not thread safe.
+template <typename _type>
+class ObjectPool
+{
+public:
+    using Handle = ObjectHandle<_type>;
+
+    //! @brief Size of a memory slot. Each slot must be able to store a pointer of the memory pools free list.
+    static constexpr size_t SlotSize = ((std::max(sizeof(_type), sizeof(void*)) + alignof(_type) - 1) /
+                                        alignof(_type)) * alignof(_type);
+
+private:
+    MemoryPool mMemoryPool;
+    U8* mFirstSlot;
+    U32 mNumObjects;
+    std::vector<U32> mGenerations;
+    std::vector<U64> mLiveSlots;
+
+public:
+    //! @brief Creates an object pool which can store up to <capacity> objects
+    //! @param capacity: Maximal number of objects
+    //! @param backing: Type of the backing memory
+    ObjectPool(U32 capacity, MemoryBacking backing = MemoryBacking::HEAP);
+
+    ObjectPool() = delete;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+    ~ObjectPool();
+
+    //! @brief Destroys all objects
+    void Clear();
+
+    //! @brief Constructs a new object inside of the pool
+    //! @tparam _args: Parameter pack of the arguments that should be passed to the objects constructor
+    //! @param args: Arguments that should be passed to the objects constructor
+    //! @return Handle of the new object
+    template <typename... _args>
+    Handle Create(_args&&... args);
+
+    //! @brief Destroys the object that is referenced by the passed handle
+    //! @param handle: Handle of the object. It must be valid.
+    void Destroy(Handle handle);
+
+    //! @brief Calls the passed function for each live object in memory order
+    //! @tparam _function: Type of the function
+    //! @param function: Function that is called with a reference to each object. It may destroy the object it was
+    //! called with, but no other object.
+    template <typename _function>
+    void ForEach(_function function);
+
+    //! @brief Calls the passed function for each live object in memory order
+    //! @tparam _function: Type of the function
+    //! @param function: Function that is called with a const reference to each object
+    template <typename _function>
+    void ForEach(_function function) const;
+
+    //! @brief Gets the object that is referenced by the passed handle
+    //! @param handle: Handle of the object
+    //! @return Pointer to the object. nullptr if the handle is a null handle or if the object was destroyed.
+    inline _type* Get(Handle handle);
+
+    //! @brief Gets the object that is referenced by the passed handle
+    //! @param handle: Handle of the object
+    //! @return Pointer to the object. nullptr if the handle is a null handle or if the object was destroyed.
+    inline const _type* Get(Handle handle) const;
+
+    //! @brief Gets the maximal number of objects
+    //! @return Capacity
+    U32 GetCapacity() const;
+
+    //! @brief Gets the handle of an object inside of the pool
+    //! @param object: Object
+    //! @return Handle of the object
+    Handle GetHandle(const _type& object) const;
+
+    //! @brief Gets the number of live objects
+    //! @return Number of objects
+    U32 GetNumObjects() const;
+
+    //! @brief Returns if the passed handle references a live object
+    //! @param handle: Handle that should be checked
+    //! @return TRUE / FALSE
+    inline bool IsValid(Handle handle) const;
+
+private:
+    //! @brief Gets the object inside of the slot with the passed index
+    //! @param index: Slot index
+    //! @return Pointer to the object
+    inline _type* GetObject(U32 index) const;
+};
+
+
+} // namespace GDL
+
+
+#include "gdl/resources/memory/objectPool.inl"
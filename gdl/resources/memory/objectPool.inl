@@ -0,0 +1,244 @@
+#pragma once
+
+#include "gdl/resources/memory/objectPool.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/bitScan.h"
+
+#include <new>
+#include <utility>
+
+namespace GDL
+{
+
+// ObjectHandle -------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+constexpr ObjectHandle<_type>::ObjectHandle(U32 index, U32 generation)
+    : mValue{(generation << NumIndexBits) | index}
+{
+}
+
+
+
+template <typename _type>
+constexpr ObjectHandle<_type>::ObjectHandle()
+    : mValue{IndexMask}
+{
+}
+
+
+
+template <typename _type>
+constexpr U32 ObjectHandle<_type>::GetGeneration() const
+{
+    return mValue >> NumIndexBits;
+}
+
+
+
+template <typename _type>
+constexpr U32 ObjectHandle<_type>::GetIndex() const
+{
+    return mValue & IndexMask;
+}
+
+
+
+template <typename _type>
+constexpr U32 ObjectHandle<_type>::GetValue() const
+{
+    return mValue;
+}
+
+
+
+template <typename _type>
+constexpr bool ObjectHandle<_type>::IsNull() const
+{
+    return GetIndex() == IndexMask;
+}
+
+
+
+template <typename _type>
+constexpr bool ObjectHandle<_type>::operator==(const ObjectHandle& other) const
+{
+    return mValue == other.mValue;
+}
+
+
+
+template <typename _type>
+constexpr bool ObjectHandle<_type>::operator!=(const ObjectHandle& other) const
+{
+    return mValue != other.mValue;
+}
+
+
+
+// ObjectPool ---------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+ObjectPool<_type>::ObjectPool(U32 capacity, MemoryBacking backing)
+    : mMemoryPool{SlotSize * 1_B, capacity, alignof(_type), 0, backing}
+    , mFirstSlot{nullptr}
+    , mNumObjects{0}
+    , mGenerations(capacity, 0)
+    , mLiveSlots((capacity + 63) / 64, 0)
+{
+    EXCEPTION(capacity > Handle::MaxNumObjects,
+              "Capacity must not exceed " + std::to_string(Handle::MaxNumObjects) + " objects.");
+
+    mMemoryPool.Initialize();
+    mFirstSlot = static_cast<U8*>(mMemoryPool.GetElement(0));
+}
+
+
+
+template <typename _type>
+ObjectPool<_type>::~ObjectPool()
+{
+    Clear();
+    mMemoryPool.Deinitialize();
+}
+
+
+
+template <typename _type>
+void ObjectPool<_type>::Clear()
+{
+    ForEach([this](_type& object) { Destroy(GetHandle(object)); });
+}
+
+
+
+template <typename _type>
+template <typename... _args>
+typename ObjectPool<_type>::Handle ObjectPool<_type>::Create(_args&&... args)
+{
+    void* memory = mMemoryPool.Allocate(SlotSize, alignof(_type));
+    try
+    {
+        new (memory) _type(std::forward<_args>(args)...);
+    }
+    catch (...)
+    {
+        mMemoryPool.Deallocate(memory, alignof(_type));
+        throw;
+    }
+
+    const U32 index = static_cast<U32>(static_cast<size_t>(static_cast<U8*>(memory) - mFirstSlot) / SlotSize);
+
+    // Live slots have odd generations, so that a handle never matches an empty slot
+    mGenerations[index] = (mGenerations[index] + 1) & Handle::GenerationMask;
+    mLiveSlots[index / 64] |= U64(1) << (index % 64);
+    ++mNumObjects;
+
+    return Handle(index, mGenerations[index]);
+}
+
+
+
+template <typename _type>
+void ObjectPool<_type>::Destroy(Handle handle)
+{
+    DEV_EXCEPTION(!IsValid(handle), "Handle doesn't reference a live object.");
+
+    const U32 index = handle.GetIndex();
+    _type* object = GetObject(index);
+    object->~_type();
+
+    mGenerations[index] = (mGenerations[index] + 1) & Handle::GenerationMask;
+    mLiveSlots[index / 64] &= ~(U64(1) << (index % 64));
+    --mNumObjects;
+
+    mMemoryPool.Deallocate(object, alignof(_type));
+}
+
+
+
+template <typename _type>
+template <typename _function>
+void ObjectPool<_type>::ForEach(_function function)
+{
+    for (U32 i = 0; i < mLiveSlots.size(); ++i)
+        for (U64 liveSlots = mLiveSlots[i]; liveSlots != 0; liveSlots &= liveSlots - 1)
+            function(*GetObject(i * 64 + IndexOfLeastSignificantBit(liveSlots)));
+}
+
+
+
+template <typename _type>
+template <typename _function>
+void ObjectPool<_type>::ForEach(_function function) const
+{
+    for (U32 i = 0; i < mLiveSlots.size(); ++i)
+        for (U64 liveSlots = mLiveSlots[i]; liveSlots != 0; liveSlots &= liveSlots - 1)
+            function(static_cast<const _type&>(*GetObject(i * 64 + IndexOfLeastSignificantBit(liveSlots))));
+}
+
+
+
+template <typename _type>
+inline _type* ObjectPool<_type>::Get(Handle handle)
+{
+    return IsValid(handle) ? GetObject(handle.GetIndex()) : nullptr;
+}
+
+
+
+template <typename _type>
+inline const _type* ObjectPool<_type>::Get(Handle handle) const
+{
+    return IsValid(handle) ? GetObject(handle.GetIndex()) : nullptr;
+}
+
+
+
+template <typename _type>
+U32 ObjectPool<_type>::GetCapacity() const
+{
+    return static_cast<U32>(mGenerations.size());
+}
+
+
+
+template <typename _type>
+typename ObjectPool<_type>::Handle ObjectPool<_type>::GetHandle(const _type& object) const
+{
+    const U8* address = reinterpret_cast<const U8*>(&object);
+    DEV_EXCEPTION(address < mFirstSlot || address >= mFirstSlot + GetCapacity() * SlotSize ||
+                          static_cast<size_t>(address - mFirstSlot) % SlotSize != 0,
+                  "Object is not part of the object pool.");
+
+    const U32 index = static_cast<U32>(static_cast<size_t>(address - mFirstSlot) / SlotSize);
+    return Handle(index, mGenerations[index]);
+}
+
+
+
+template <typename _type>
+U32 ObjectPool<_type>::GetNumObjects() const
+{
+    return mNumObjects;
+}
+
+
+
+template <typename _type>
+inline bool ObjectPool<_type>::IsValid(Handle handle) const
+{
+    const U32 index = handle.GetIndex();
+    return index < mGenerations.size() && mGenerations[index] == handle.GetGeneration();
+}
+
+
+
+template <typename _type>
+inline _type* ObjectPool<_type>::GetObject(U32 index) const
+{
+    return std::launder(reinterpret_cast<_type*>(mFirstSlot + static_cast<size_t>(index) * SlotSize));
+}
+
+} // namespace GDL
@@ -51,14 +51,15 @@ MemoryInterface* PoolAllocator<_type>::GetMemoryAllocationPattern()
 template <class _type>
 MemoryInterface* PoolAllocator<_type>::InitializeMemoryAllocationPattern()
 {
-    MemoryInterface* memoryAP = MemoryManager::Instance().GetMemoryPool(sizeof(_type), alignof(_type));
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    MemoryInterface* memoryAP = memoryManager.GetMemoryPool(sizeof(_type), alignof(_type));
     if (memoryAP == nullptr)
     {
-        memoryAP = MemoryManager::Instance().GetGeneralPurposeMemory();
+        memoryAP = memoryManager.GetGeneralPurposeMemory();
         if (memoryAP == nullptr)
-            return MemoryManager::Instance().GetHeapMemory();
+            memoryAP = memoryManager.GetHeapMemory();
     }
-    return memoryAP;
+    return memoryManager.GetTrackedMemory(memoryAP);
 }
 
 
@@ -0,0 +1,733 @@
+#include "gdl/resources/memory/sizeClassMemory.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/base/functions/bitScan.h"
+#include "gdl/base/functions/isPowerOf2.h"
+#include "gdl/resources/memory/sharedFunctions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <mutex>
+
+namespace GDL
+{
+
+SizeClassMemory::SizeClassMemory(MemorySize memorySize, MemoryBacking backing)
+    : mMemorySize{memorySize}
+    , mMemoryStart{nullptr}
+    , mMemoryEnd{nullptr}
+    , mSlabBase{nullptr}
+    , mNumAllocatedMemoryBlocks{0}
+    , mFirstLevelBitmap{0}
+    , mSecondLevelBitmaps{}
+    , mFreeBlocks{}
+    , mSlabs{}
+    , mIsSlab{}
+    , mBacking{backing}
+    , mMemory{}
+{
+    CheckConstructionParameters();
+}
+
+
+
+SizeClassMemory::~SizeClassMemory()
+{
+}
+
+
+
+void* SizeClassMemory::Allocate(size_t size, size_t alignment)
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    DEV_EXCEPTION(size == 0, "Allocated memory size is 0.");
+    DEV_EXCEPTION(!IsInitialized(), "Size class memory is not initialized.");
+    DEV_EXCEPTION(!IsPowerOf2(alignment), "Alignment must be a power of 2.");
+
+    void* address = nullptr;
+
+    U32 sizeClass = GetSlabSizeClass(size, alignment);
+    if (sizeClass < NumSlabSizeClasses && (mSlabs[sizeClass] != nullptr || CreateSlab(sizeClass) != nullptr))
+        address = AllocateSlabElement(sizeClass);
+    else
+        address = AllocateBlock(size, alignment);
+
+    ++mNumAllocatedMemoryBlocks;
+    return address;
+}
+
+
+
+void SizeClassMemory::CheckMemoryConsistency() const
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    CheckMemoryConsistencyPrivate();
+}
+
+
+
+U32 SizeClassMemory::CountAllocatedMemoryBlocks() const
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    return mNumAllocatedMemoryBlocks;
+}
+
+
+
+U32 SizeClassMemory::CountFreeMemoryBlocks() const
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    EXCEPTION(!IsInitialized(), "Size class memory is not initialized.");
+
+    U32 numFreeMemoryBlocks = 0;
+    for (BlockHeader* block = reinterpret_cast<BlockHeader*>(mMemoryStart); GetBlockSize(block) != 0;
+         block = GetNextPhysicalBlock(block))
+        if (IsBlockFree(block))
+            ++numFreeMemoryBlocks;
+
+    return numFreeMemoryBlocks;
+}
+
+
+
+void SizeClassMemory::Deallocate(void* address, [[maybe_unused]] size_t alignment)
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    DEV_EXCEPTION(!IsInitialized(), "Size class memory is not initialized.");
+    DEV_EXCEPTION(address == nullptr, "Can't free a nullptr");
+    DEV_EXCEPTION(!IsAddressInsideMemory(static_cast<U8*>(address)),
+                  "Memory address is not part of the size class memory");
+
+    U8* memory = static_cast<U8*>(address);
+    if (IsSlabElement(memory))
+        DeallocateSlabElement(memory);
+    else
+    {
+        BlockHeader* block = reinterpret_cast<BlockHeader*>(memory - BlockOverhead);
+        CheckDeallocatedBlock(block);
+        DeallocateBlock(block);
+    }
+
+    --mNumAllocatedMemoryBlocks;
+}
+
+
+
+void SizeClassMemory::Deinitialize()
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    EXCEPTION(!IsInitialized(), "Size class memory is already deinitialized.");
+    EXCEPTION(mNumAllocatedMemoryBlocks != 0, "Can't deinitialize. Memory still in use.");
+
+    mMemoryStart = nullptr;
+    mMemoryEnd = nullptr;
+    mSlabBase = nullptr;
+    mIsSlab.clear();
+    mMemory.Reset();
+}
+
+
+
+size_t SizeClassMemory::GetFreeMemorySize() const
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    EXCEPTION(!IsInitialized(), "Size class memory is not initialized.");
+
+    size_t freeMemorySize = 0;
+    for (BlockHeader* block = reinterpret_cast<BlockHeader*>(mMemoryStart); GetBlockSize(block) != 0;
+         block = GetNextPhysicalBlock(block))
+        if (IsBlockFree(block))
+            freeMemorySize += GetBlockSize(block);
+
+    return freeMemorySize;
+}
+
+
+
+size_t SizeClassMemory::GetLargestFreeMemoryBlockSize() const
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    EXCEPTION(!IsInitialized(), "Size class memory is not initialized.");
+
+    if (mFirstLevelBitmap == 0)
+        return 0;
+
+    // The largest block is in the highest non-empty size class
+    U32 firstLevelIndex = IndexOfMostSignificantBit(mFirstLevelBitmap);
+    U32 secondLevelIndex = IndexOfMostSignificantBit(mSecondLevelBitmaps[firstLevelIndex]);
+
+    size_t largestFreeMemoryBlockSize = 0;
+    for (BlockHeader* block = mFreeBlocks[firstLevelIndex][secondLevelIndex]; block != nullptr;
+         block = block->mNextFreeBlock)
+        largestFreeMemoryBlockSize = std::max(largestFreeMemoryBlockSize, GetBlockSize(block));
+
+    return largestFreeMemoryBlockSize;
+}
+
+
+
+SpinLockStatistics SizeClassMemory::GetLockStatistics() const
+{
+    return mSpinLock.GetStatistics();
+}
+
+
+
+void SizeClassMemory::Initialize()
+{
+    std::lock_guard<SpinLock> lock{mSpinLock};
+
+    EXCEPTION(IsInitialized(), "Size class memory is already initialized.");
+
+    mMemory = MemoryRegion(mMemorySize.GetNumBytes() + MinAlignment, mBacking);
+    mMemoryStart = mMemory.Get() + (MinAlignment - Misalignment(mMemory.Get(), MinAlignment)) % MinAlignment;
+    mMemoryEnd = mMemoryStart + mMemorySize.GetNumBytes() / MinAlignment * MinAlignment;
+
+    mNumAllocatedMemoryBlocks = 0;
+    mFirstLevelBitmap = 0;
+    mSecondLevelBitmaps.fill(0);
+    for (auto& freeBlocks : mFreeBlocks)
+        freeBlocks.fill(nullptr);
+    mSlabs.fill(nullptr);
+
+    mSlabBase = mMemoryStart - Misalignment(mMemoryStart, SlabSize);
+    mIsSlab.assign((static_cast<size_t>(mMemoryEnd - mSlabBase) + SlabSize - 1) / SlabSize, false);
+
+    // One free block that spans the whole memory followed by a used block of size 0 that marks the end of the memory
+    BlockHeader* block = reinterpret_cast<BlockHeader*>(mMemoryStart);
+    block->mPrevPhysicalBlock = nullptr;
+    SetBlockSize(block, static_cast<size_t>(mMemoryEnd - mMemoryStart) - 2 * BlockOverhead, true);
+
+    BlockHeader* lastBlock = GetNextPhysicalBlock(block);
+    lastBlock->mPrevPhysicalBlock = block;
+    SetBlockSize(lastBlock, 0, false);
+
+    InsertFreeBlock(block);
+}
+
+
+
+void SizeClassMemory::AddSlabToList(Slab* slab)
+{
+    assert(slab != nullptr);
+
+    Slab* firstSlab = mSlabs[slab->mSizeClass];
+    slab->mNextSlab = firstSlab;
+    slab->mPrevSlab = nullptr;
+    if (firstSlab != nullptr)
+        firstSlab->mPrevSlab = slab;
+    mSlabs[slab->mSizeClass] = slab;
+}
+
+
+
+void* SizeClassMemory::AllocateBlock(size_t size, size_t alignment)
+{
+    EXCEPTION(size > mMemorySize.GetNumBytes(), "No properly sized memory block available.");
+
+    size_t blockSize = std::max((size + MinAlignment - 1) / MinAlignment * MinAlignment, MinBlockSize);
+
+    // Worst case: The front of the found block needs to be split off and the gap must be large enough for a free block
+    size_t searchSize = blockSize;
+    if (alignment > MinAlignment)
+        searchSize += alignment + BlockOverhead;
+
+    BlockHeader* block = FindFreeBlock(searchSize);
+    EXCEPTION(block == nullptr, "No properly sized memory block available.");
+
+    RemoveFreeBlock(block);
+    if (alignment > MinAlignment)
+        block = TrimBlockFront(block, alignment);
+    TrimBlockBack(block, blockSize);
+    SetBlockSize(block, GetBlockSize(block), false);
+
+    return GetBlockMemory(block);
+}
+
+
+
+void* SizeClassMemory::AllocateSlabElement(U32 sizeClass)
+{
+    Slab* slab = mSlabs[sizeClass];
+    assert(slab != nullptr);
+
+    U8* element = nullptr;
+    if (slab->mFirstFreeElement != nullptr)
+    {
+        element = slab->mFirstFreeElement;
+        slab->mFirstFreeElement = ReadAddressFromMemory(element);
+    }
+    else
+    {
+        assert(slab->mFirstUnusedElement < slab->mEndOfElements);
+        element = slab->mFirstUnusedElement;
+        slab->mFirstUnusedElement += (sizeClass + 1) * MinAlignment;
+    }
+    ++slab->mNumUsedElements;
+
+    // Full slabs are not part of the list
+    if (slab->mFirstFreeElement == nullptr && slab->mFirstUnusedElement == slab->mEndOfElements)
+        RemoveSlabFromList(slab);
+
+    return element;
+}
+
+
+
+void SizeClassMemory::CheckConstructionParameters() const
+{
+    EXCEPTION(mMemorySize.GetNumBytes() < 2 * BlockOverhead + MinBlockSize + MinAlignment,
+              "Memory size must be at least " + std::to_string(2 * BlockOverhead + MinBlockSize + MinAlignment) +
+                      " bytes");
+    EXCEPTION(mMemorySize.GetNumBytes() >= size_t(1) << (FirstLevelShift + NumFirstLevelIndices - 1),
+              "Memory size exceeds the maximal supported size");
+}
+
+
+
+void SizeClassMemory::CheckDeallocatedBlock([[maybe_unused]] const BlockHeader* block) const
+{
+    DEV_EXCEPTION(!IsAligned(block, MinAlignment) || IsBlockFree(block) ||
+                          (block->mPrevPhysicalBlock != nullptr &&
+                           GetNextPhysicalBlock(block->mPrevPhysicalBlock) != block) ||
+                          !IsAddressInsideMemory(reinterpret_cast<U8*>(GetNextPhysicalBlock(block))),
+                  "Deallocated address is not an allocated memory block or was already freed");
+}
+
+
+
+void SizeClassMemory::CheckMemoryConsistencyPrivate() const
+{
+    EXCEPTION(!IsInitialized(), "Size class memory is not initialized.");
+
+    U32 numFreeBlocks = 0;
+    U32 numAllocatedMemoryBlocks = 0;
+    const BlockHeader* prevBlock = nullptr;
+    const BlockHeader* block = reinterpret_cast<const BlockHeader*>(mMemoryStart);
+    while (GetBlockSize(block) != 0)
+    {
+        EXCEPTION(!IsAddressInsideMemory(reinterpret_cast<const U8*>(block)), "Block is outside of the memory.");
+        EXCEPTION(block->mPrevPhysicalBlock != prevBlock, "Link to previous physical block is broken.");
+
+        U8* memory = GetBlockMemory(block);
+        if (IsBlockFree(block))
+        {
+            EXCEPTION(prevBlock != nullptr && IsBlockFree(prevBlock), "Found two neighbouring free blocks.");
+            ++numFreeBlocks;
+        }
+        else if (IsAligned(memory, SlabSize) && IsSlabElement(memory))
+        {
+            const Slab* slab = reinterpret_cast<const Slab*>(memory);
+            const size_t elementSize = (slab->mSizeClass + 1) * MinAlignment;
+            EXCEPTION(GetBlockSize(block) < SlabSize, "Slab block is too small.");
+            EXCEPTION(slab->mSizeClass >= NumSlabSizeClasses, "Invalid slab size class.");
+
+            U32 numFreeElements = 0;
+            for (U8* element = slab->mFirstFreeElement; element != nullptr; element = ReadAddressFromMemory(element))
+            {
+                ++numFreeElements;
+                EXCEPTION(element < memory + MaxSlabElementSize || element >= slab->mFirstUnusedElement ||
+                                  (element - memory - MaxSlabElementSize) % elementSize != 0,
+                          "Found invalid element in the free element list of a slab.");
+                EXCEPTION(numFreeElements > slab->mNumUsedElements + (SlabSize / elementSize),
+                          "Found more free elements than expected. Check for loops in the free element list.");
+            }
+
+            size_t numTouchedElements =
+                    static_cast<size_t>(slab->mFirstUnusedElement - memory - MaxSlabElementSize) / elementSize;
+            EXCEPTION(numFreeElements + slab->mNumUsedElements != numTouchedElements,
+                      "Number of used slab elements is not as expected.");
+
+            bool isFull = slab->mFirstFreeElement == nullptr && slab->mFirstUnusedElement == slab->mEndOfElements;
+            bool isListed = slab->mPrevSlab != nullptr || mSlabs[slab->mSizeClass] == slab;
+            EXCEPTION(isFull == isListed, "Slab list contains a full slab or misses a slab with free elements.");
+
+            numAllocatedMemoryBlocks += slab->mNumUsedElements;
+        }
+        else
+            ++numAllocatedMemoryBlocks;
+
+        prevBlock = block;
+        block = GetNextPhysicalBlock(block);
+    }
+    EXCEPTION(reinterpret_cast<const U8*>(block) != mMemoryEnd - BlockOverhead, "Last block is not at memory end.");
+    EXCEPTION(block->mPrevPhysicalBlock != prevBlock, "Link to previous physical block is broken.");
+    EXCEPTION(numAllocatedMemoryBlocks != mNumAllocatedMemoryBlocks,
+              "Number of allocated memory blocks is not as expected.");
+
+
+    U32 numListedFreeBlocks = 0;
+    for (U32 i = 0; i < NumFirstLevelIndices; ++i)
+    {
+        EXCEPTION(((mFirstLevelBitmap >> i) & 1) != (mSecondLevelBitmaps[i] != 0 ? 1U : 0U),
+                  "First level bitmap does not match second level bitmaps.");
+        for (U32 j = 0; j < NumSecondLevelIndices; ++j)
+        {
+            EXCEPTION(((mSecondLevelBitmaps[i] >> j) & 1) != (mFreeBlocks[i][j] != nullptr ? 1U : 0U),
+                      "Second level bitmap does not match free lists.");
+
+            const BlockHeader* prevFreeBlock = nullptr;
+            for (const BlockHeader* freeBlock = mFreeBlocks[i][j]; freeBlock != nullptr;
+                 freeBlock = freeBlock->mNextFreeBlock)
+            {
+                U32 firstLevelIndex = 0;
+                U32 secondLevelIndex = 0;
+                MapSizeToIndices(GetBlockSize(freeBlock), firstLevelIndex, secondLevelIndex);
+
+                EXCEPTION(!IsBlockFree(freeBlock), "Free list contains a used block.");
+                EXCEPTION(firstLevelIndex != i || secondLevelIndex != j, "Free block is in the wrong free list.");
+                EXCEPTION(freeBlock->mPrevFreeBlock != prevFreeBlock, "Link to previous free block is broken.");
+                EXCEPTION(++numListedFreeBlocks > numFreeBlocks,
+                          "Found more listed free blocks than expected. Check for loops in the free lists.");
+                prevFreeBlock = freeBlock;
+            }
+        }
+    }
+    EXCEPTION(numListedFreeBlocks != numFreeBlocks, "Free lists miss some free blocks.");
+
+
+    for (U32 i = 0; i < NumSlabSizeClasses; ++i)
+    {
+        const Slab* prevSlab = nullptr;
+        for (const Slab* slab = mSlabs[i]; slab != nullptr; slab = slab->mNextSlab)
+        {
+            EXCEPTION(!IsSlabElement(reinterpret_cast<const U8*>(slab)), "Slab list contains an unknown slab.");
+            EXCEPTION(slab->mSizeClass != i, "Slab is in the wrong slab list.");
+            EXCEPTION(slab->mPrevSlab != prevSlab, "Link to previous slab is broken.");
+            prevSlab = slab;
+        }
+    }
+}
+
+
+
+SizeClassMemory::Slab* SizeClassMemory::CreateSlab(U32 sizeClass)
+{
+    if (FindFreeBlock(SlabSize + SlabSize + BlockOverhead) == nullptr)
+        return nullptr;
+
+    U8* memory = static_cast<U8*>(AllocateBlock(SlabSize, SlabSize));
+    assert(IsAligned(memory, SlabSize));
+
+    const size_t elementSize = (sizeClass + 1) * MinAlignment;
+
+    Slab* slab = reinterpret_cast<Slab*>(memory);
+    slab->mFirstFreeElement = nullptr;
+    slab->mFirstUnusedElement = memory + MaxSlabElementSize;
+    slab->mEndOfElements = slab->mFirstUnusedElement + (SlabSize - MaxSlabElementSize) / elementSize * elementSize;
+    slab->mSizeClass = sizeClass;
+    slab->mNumUsedElements = 0;
+
+    mIsSlab[GetSlabIndex(memory)] = true;
+    AddSlabToList(slab);
+
+    return slab;
+}
+
+
+
+void SizeClassMemory::DeallocateBlock(BlockHeader* block)
+{
+    SetBlockSize(block, GetBlockSize(block), true);
+
+    BlockHeader* prevBlock = block->mPrevPhysicalBlock;
+    if (prevBlock != nullptr && IsBlockFree(prevBlock))
+    {
+        RemoveFreeBlock(prevBlock);
+        SetBlockSize(prevBlock, GetBlockSize(prevBlock) + BlockOverhead + GetBlockSize(block), true);
+        block = prevBlock;
+        GetNextPhysicalBlock(block)->mPrevPhysicalBlock = block;
+    }
+
+    BlockHeader* nextBlock = GetNextPhysicalBlock(block);
+    if (IsBlockFree(nextBlock))
+    {
+        RemoveFreeBlock(nextBlock);
+        SetBlockSize(block, GetBlockSize(block) + BlockOverhead + GetBlockSize(nextBlock), true);
+        GetNextPhysicalBlock(block)->mPrevPhysicalBlock = block;
+    }
+
+    InsertFreeBlock(block);
+}
+
+
+
+void SizeClassMemory::DeallocateSlabElement(U8* address)
+{
+    const size_t slabIndex = GetSlabIndex(address);
+    U8* memory = mSlabBase + slabIndex * SlabSize;
+    Slab* slab = reinterpret_cast<Slab*>(memory);
+
+    DEV_EXCEPTION(address < memory + MaxSlabElementSize || address >= slab->mFirstUnusedElement ||
+                          (address - memory - MaxSlabElementSize) % ((slab->mSizeClass + 1) * MinAlignment) != 0,
+                  "Deallocated address is not an allocated slab element");
+
+    bool wasFull = slab->mFirstFreeElement == nullptr && slab->mFirstUnusedElement == slab->mEndOfElements;
+
+    WriteAddressToMemory(address, slab->mFirstFreeElement);
+    slab->mFirstFreeElement = address;
+    --slab->mNumUsedElements;
+
+    if (wasFull)
+        AddSlabToList(slab);
+    else if (slab->mNumUsedElements == 0 && (slab->mNextSlab != nullptr || slab->mPrevSlab != nullptr))
+    {
+        // Keep the last slab of a size class to avoid repeated slab creation and destruction
+        RemoveSlabFromList(slab);
+        mIsSlab[slabIndex] = false;
+        DeallocateBlock(reinterpret_cast<BlockHeader*>(memory - BlockOverhead));
+    }
+}
+
+
+
+SizeClassMemory::BlockHeader* SizeClassMemory::FindFreeBlock(size_t size) const
+{
+    // Round up to the next size class, so that every block of the found size class is large enough
+    if (size >= SmallBlockSize)
+        size += (size_t(1) << (IndexOfMostSignificantBit(size) - NumSecondLevelIndicesLog2)) - 1;
+
+    U32 firstLevelIndex = 0;
+    U32 secondLevelIndex = 0;
+    MapSizeToIndices(size, firstLevelIndex, secondLevelIndex);
+    if (firstLevelIndex >= NumFirstLevelIndices)
+        return nullptr;
+
+    U32 secondLevelBitmap = mSecondLevelBitmaps[firstLevelIndex] & (~U32(0) << secondLevelIndex);
+    if (secondLevelBitmap == 0)
+    {
+        U32 firstLevelBitmap = 0;
+        if (firstLevelIndex + 1 < NumFirstLevelIndices)
+            firstLevelBitmap = mFirstLevelBitmap & (~U32(0) << (firstLevelIndex + 1));
+        if (firstLevelBitmap == 0)
+            return nullptr;
+
+        firstLevelIndex = IndexOfLeastSignificantBit(firstLevelBitmap);
+        secondLevelBitmap = mSecondLevelBitmaps[firstLevelIndex];
+    }
+    secondLevelIndex = IndexOfLeastSignificantBit(secondLevelBitmap);
+
+    return mFreeBlocks[firstLevelIndex][secondLevelIndex];
+}
+
+
+
+size_t SizeClassMemory::GetBlockSize(const BlockHeader* block)
+{
+    return block->mSizeAndFlags & ~FreeFlag;
+}
+
+
+
+U8* SizeClassMemory::GetBlockMemory(const BlockHeader* block)
+{
+    return reinterpret_cast<U8*>(const_cast<BlockHeader*>(block)) + BlockOverhead;
+}
+
+
+
+SizeClassMemory::BlockHeader* SizeClassMemory::GetNextPhysicalBlock(const BlockHeader* block)
+{
+    return reinterpret_cast<BlockHeader*>(GetBlockMemory(block) + GetBlockSize(block));
+}
+
+
+
+U32 SizeClassMemory::GetSlabSizeClass(size_t size, size_t alignment)
+{
+    if (size > MaxSlabElementSize || alignment > MaxSlabElementSize)
+        return NumSlabSizeClasses;
+
+    // Elements start at an offset of MaxSlabElementSize from the slab start, which is aligned to SlabSize. Therefore,
+    // all elements are aligned if the element size is a multiple of the alignment.
+    const size_t granularity = std::max(alignment, MinAlignment);
+    const size_t elementSize = (size + granularity - 1) / granularity * granularity;
+    if (elementSize > MaxSlabElementSize)
+        return NumSlabSizeClasses;
+
+    return static_cast<U32>(elementSize / MinAlignment - 1);
+}
+
+
+
+size_t SizeClassMemory::GetSlabIndex(const U8* address) const
+{
+    return static_cast<size_t>(address - mSlabBase) / SlabSize;
+}
+
+
+
+void SizeClassMemory::InsertFreeBlock(BlockHeader* block)
+{
+    assert(IsBlockFree(block));
+
+    U32 firstLevelIndex = 0;
+    U32 secondLevelIndex = 0;
+    MapSizeToIndices(GetBlockSize(block), firstLevelIndex, secondLevelIndex);
+
+    BlockHeader* firstBlock = mFreeBlocks[firstLevelIndex][secondLevelIndex];
+    block->mNextFreeBlock = firstBlock;
+    block->mPrevFreeBlock = nullptr;
+    if (firstBlock != nullptr)
+        firstBlock->mPrevFreeBlock = block;
+
+    mFreeBlocks[firstLevelIndex][secondLevelIndex] = block;
+    mFirstLevelBitmap |= U32(1) << firstLevelIndex;
+    mSecondLevelBitmaps[firstLevelIndex] |= U32(1) << secondLevelIndex;
+}
+
+
+
+bool SizeClassMemory::IsAddressInsideMemory(const U8* address) const
+{
+    return address >= mMemoryStart && address < mMemoryEnd;
+}
+
+
+
+bool SizeClassMemory::IsBlockFree(const BlockHeader* block)
+{
+    return (block->mSizeAndFlags & FreeFlag) != 0;
+}
+
+
+
+bool SizeClassMemory::IsInitialized() const
+{
+    return mMemory.Get() != nullptr;
+}
+
+
+
+bool SizeClassMemory::IsSlabElement(const U8* address) const
+{
+    return mIsSlab[GetSlabIndex(address)];
+}
+
+
+
+void SizeClassMemory::MapSizeToIndices(size_t size, U32& firstLevelIndex, U32& secondLevelIndex)
+{
+    if (size < SmallBlockSize)
+    {
+        firstLevelIndex = 0;
+        secondLevelIndex = static_cast<U32>(size / MinAlignment);
+    }
+    else
+    {
+        U32 mostSignificantBit = IndexOfMostSignificantBit(size);
+        firstLevelIndex = mostSignificantBit - FirstLevelShift + 1;
+        secondLevelIndex = static_cast<U32>(size >> (mostSignificantBit - NumSecondLevelIndicesLog2)) ^
+                           NumSecondLevelIndices;
+    }
+}
+
+
+
+void SizeClassMemory::RemoveSlabFromList(Slab* slab)
+{
+    assert(slab != nullptr);
+
+    if (slab->mPrevSlab != nullptr)
+        slab->mPrevSlab->mNextSlab = slab->mNextSlab;
+    else
+        mSlabs[slab->mSizeClass] = slab->mNextSlab;
+
+    if (slab->mNextSlab != nullptr)
+        slab->mNextSlab->mPrevSlab = slab->mPrevSlab;
+
+    slab->mNextSlab = nullptr;
+    slab->mPrevSlab = nullptr;
+}
+
+
+
+void SizeClassMemory::RemoveFreeBlock(BlockHeader* block)
+{
+    assert(IsBlockFree(block));
+
+    BlockHeader* prevFreeBlock = block->mPrevFreeBlock;
+    BlockHeader* nextFreeBlock = block->mNextFreeBlock;
+
+    if (nextFreeBlock != nullptr)
+        nextFreeBlock->mPrevFreeBlock = prevFreeBlock;
+
+    if (prevFreeBlock != nullptr)
+        prevFreeBlock->mNextFreeBlock = nextFreeBlock;
+    else
+    {
+        U32 firstLevelIndex = 0;
+        U32 secondLevelIndex = 0;
+        MapSizeToIndices(GetBlockSize(block), firstLevelIndex, secondLevelIndex);
+
+        assert(mFreeBlocks[firstLevelIndex][secondLevelIndex] == block);
+        mFreeBlocks[firstLevelIndex][secondLevelIndex] = nextFreeBlock;
+        if (nextFreeBlock == nullptr)
+        {
+            mSecondLevelBitmaps[firstLevelIndex] &= ~(U32(1) << secondLevelIndex);
+            if (mSecondLevelBitmaps[firstLevelIndex] == 0)
+                mFirstLevelBitmap &= ~(U32(1) << firstLevelIndex);
+        }
+    }
+}
+
+
+
+void SizeClassMemory::SetBlockSize(BlockHeader* block, size_t size, bool free)
+{
+    assert(size % MinAlignment == 0);
+    block->mSizeAndFlags = size | (free ? FreeFlag : 0);
+}
+
+
+
+SizeClassMemory::BlockHeader* SizeClassMemory::TrimBlockFront(BlockHeader* block, size_t alignment)
+{
+    U8* memory = GetBlockMemory(block);
+    size_t gap = (alignment - Misalignment(memory, alignment)) % alignment;
+    if (gap == 0)
+        return block;
+
+    // The split off part must be large enough to form a free block
+    if (gap < BlockOverhead + MinBlockSize)
+        gap += alignment;
+    assert(gap + MinBlockSize <= GetBlockSize(block) + BlockOverhead);
+
+    BlockHeader* alignedBlock = reinterpret_cast<BlockHeader*>(memory + gap - BlockOverhead);
+    alignedBlock->mPrevPhysicalBlock = block;
+    SetBlockSize(alignedBlock, GetBlockSize(block) - gap, true);
+    GetNextPhysicalBlock(alignedBlock)->mPrevPhysicalBlock = alignedBlock;
+
+    SetBlockSize(block, gap - BlockOverhead, true);
+    InsertFreeBlock(block);
+
+    return alignedBlock;
+}
+
+
+
+void SizeClassMemory::TrimBlockBack(BlockHeader* block, size_t size)
+{
+    const size_t blockSize = GetBlockSize(block);
+    if (blockSize < size + BlockOverhead + MinBlockSize)
+        return;
+
+    BlockHeader* remainingBlock = reinterpret_cast<BlockHeader*>(GetBlockMemory(block) + size);
+    remainingBlock->mPrevPhysicalBlock = block;
+    SetBlockSize(remainingBlock, blockSize - size - BlockOverhead, true);
+    GetNextPhysicalBlock(remainingBlock)->mPrevPhysicalBlock = remainingBlock;
+
+    SetBlockSize(block, size, IsBlockFree(block));
+    InsertFreeBlock(remainingBlock);
+}
+
+} // namespace GDL
@@ -0,0 +1,277 @@
+#pragma once
+
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/spinlock.h"
+#include "gdl/resources/memory/memoryInterface.h"
+#include "gdl/resources/memory/memoryRegion.h"
+#include "gdl/resources/memory/memorySize.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+
+namespace GDL
+{
+
+//! @brief General purpose memory with segregated size classes. It is capable of returning memory blocks of arbitrary
+//! size and alignment in constant time, independent of the fragmentation of the managed memory.
+//! @remark Small allocations are served by slabs. A slab is a memory block of fixed size which is split into equally
+//! sized elements. Each size class keeps a list of slabs with free elements. Large allocations and the slabs
+//! themselves are managed by a two level segregated fit (TLSF) allocator. It sorts free blocks into size classes that
+//! are indexed by two levels of bitmaps, so that a fitting free block is found with a few bit scans. Each block stores
+//! a link to its physical predecessor, which makes merging of neighbouring free blocks a constant time operation. For
+//! details about the TLSF allocator see: http://www.gii.upv.es/tlsf/
+class SizeClassMemory : public MemoryInterface
+{
+public:
+    //! @brief Minimal alignment and granularity of all returned memory blocks
+    static constexpr size_t MinAlignment = 16;
+
+    //! @brief Maximal element size of the slab size classes. Larger allocations are served by the TLSF allocator.
+    static constexpr size_t MaxSlabElementSize = 256;
+
+    //! @brief Size of a single slab
+    static constexpr size_t SlabSize = 65536;
+
+private:
+    //! @brief Header of each memory block that is managed by the TLSF allocator. The links to other free blocks are only
+    //! valid if the block is free. They are stored inside the memory that is returned to the user if the block is used.
+    struct BlockHeader
+    {
+        BlockHeader* mPrevPhysicalBlock;
+        size_t mSizeAndFlags;
+        BlockHeader* mNextFreeBlock;
+        BlockHeader* mPrevFreeBlock;
+    };
+
+    //! @brief Header of a slab. It is stored at the beginning of the slab.
+    struct Slab
+    {
+        Slab* mNextSlab;
+        Slab* mPrevSlab;
+        U8* mFirstFreeElement;
+        U8* mFirstUnusedElement;
+        U8* mEndOfElements;
+        U32 mSizeClass;
+        U32 mNumUsedElements;
+    };
+
+    static constexpr size_t BlockOverhead = offsetof(BlockHeader, mNextFreeBlock);
+    static constexpr size_t MinBlockSize = sizeof(BlockHeader) - BlockOverhead;
+    static constexpr size_t FreeFlag = 1;
+    static constexpr U32 NumSecondLevelIndicesLog2 = 5;
+    static constexpr U32 NumSecondLevelIndices = 1 << NumSecondLevelIndicesLog2;
+    static constexpr U32 FirstLevelShift = NumSecondLevelIndicesLog2 + 4;
+    static constexpr size_t SmallBlockSize = size_t(1) << FirstLevelShift;
+    static constexpr U32 NumFirstLevelIndices = 32;
+    static constexpr U32 NumSlabSizeClasses = MaxSlabElementSize / MinAlignment;
+
+    static_assert(size_t(1) << (FirstLevelShift - NumSecondLevelIndicesLog2) == MinAlignment,
+                  "Linear size classes of the first level must match the minimal alignment");
+    static_assert(sizeof(Slab) <= MaxSlabElementSize, "Slab header does not fit in front of the first element");
+
+    MemorySize mMemorySize;
+    U8* mMemoryStart;
+    U8* mMemoryEnd;
+    U8* mSlabBase;
+    U32 mNumAllocatedMemoryBlocks;
+    U32 mFirstLevelBitmap;
+    std::array<U32, NumFirstLevelIndices> mSecondLevelBitmaps;
+    std::array<std::array<BlockHeader*, NumSecondLevelIndices>, NumFirstLevelIndices> mFreeBlocks;
+    std::array<Slab*, NumSlabSizeClasses> mSlabs;
+    std::vector<bool> mIsSlab;
+    MemoryBacking mBacking;
+    MemoryRegion mMemory;
+    mutable SpinLock mSpinLock;
+
+public:
+    //! @brief Creates the size class memory with <memorySize> bytes of memory
+    //! @param memorySize: total amount of memory
+    //! @param backing: Type of the backing memory
+    SizeClassMemory(MemorySize memorySize, MemoryBacking backing = MemoryBacking::HEAP);
+
+    SizeClassMemory() = delete;
+    SizeClassMemory(const SizeClassMemory&) = delete;
+    SizeClassMemory(SizeClassMemory&&) = delete;
+    SizeClassMemory& operator=(const SizeClassMemory&) = delete;
+    SizeClassMemory& operator=(SizeClassMemory&&) = delete;
+    ~SizeClassMemory() override;
+
+
+    //! @brief Allocates memory
+    //! @param size: Size of the memory that should be allocated
+    //! @param alignment: Memory alignment
+    //! @return Pointer to memory
+    virtual void* Allocate(size_t size, size_t alignment = 1) override;
+
+    //! @brief Checks the internal consistency of the size class memory. Throws if it is not consistent.
+    void CheckMemoryConsistency() const;
+
+    //! @brief Returns the number of allocated memory blocks
+    //! @return Number of allocated memory blocks
+    U32 CountAllocatedMemoryBlocks() const;
+
+    //! @brief Counts and returns the number of free memory blocks of the TLSF allocator
+    //! @return Number of free memory blocks
+    //! @remark Free elements of slabs are not counted
+    U32 CountFreeMemoryBlocks() const;
+
+    //! @brief Deallocates memory at the passed address
+    //! @param address: Adress that should be freed
+    //! @param alignment: Memory alignment
+    virtual void Deallocate(void* address, size_t alignment = 1) override;
+
+    //! @brief Deinitializes the size class memory
+    void Deinitialize();
+
+    //! @brief Gets the total size of all free memory blocks of the TLSF allocator
+    //! @return Free memory size
+    //! @remark Free elements of slabs are not included
+    size_t GetFreeMemorySize() const;
+
+    //! @brief Gets the size of the largest free memory block of the TLSF allocator.
+    //! @return Size of the largest free memory block
+    //! @remark Together with the free memory size, this value can be used to measure the external fragmentation
+    size_t GetLargestFreeMemoryBlockSize() const;
+
+    //! @brief Gets the contention statistics of the internal spinlock
+    //! @return Spinlock statistics. All values are zero if the statistics are disabled.
+    SpinLockStatistics GetLockStatistics() const;
+
+    //! @brief Initializes the size class memory
+    void Initialize();
+
+private:
+    //! @brief Adds a slab to the front of the slab list of its size class
+    //! @param slab: Slab
+    void AddSlabToList(Slab* slab);
+
+    //! @brief Allocates a memory block from the TLSF allocator
+    //! @param size: Size of the memory that should be allocated
+    //! @param alignment: Memory alignment
+    //! @return Pointer to memory
+    void* AllocateBlock(size_t size, size_t alignment);
+
+    //! @brief Allocates an element of the first slab of a size class
+    //! @param sizeClass: Size class of the element
+    //! @return Pointer to memory
+    //! @remark The slab list of the size class must not be empty
+    void* AllocateSlabElement(U32 sizeClass);
+
+    //! @brief Checks if the size class memory is constructed with valid parameters. Throws if not.
+    void CheckConstructionParameters() const;
+
+    //! @brief Checks if the address that should be freed is a valid allocated TLSF memory block. Throws if not.
+    //! @param block: Header of the memory block that should be freed
+    void CheckDeallocatedBlock(const BlockHeader* block) const;
+
+    //! @brief Checks the internal consistency of the size class memory. Throws if it is not consistent.
+    //! @remark In contrast to the public version, this function does not aquire a lock.
+    void CheckMemoryConsistencyPrivate() const;
+
+    //! @brief Creates a new slab for the passed size class and adds it to the size classes slab list
+    //! @param sizeClass: Size class
+    //! @return Pointer to the new slab. If there is no free memory block that can store a slab, nullptr is returned.
+    Slab* CreateSlab(U32 sizeClass);
+
+    //! @brief Deallocates a memory block of the TLSF allocator and merges it with its free neighbours
+    //! @param block: Header of the memory block that should be freed
+    void DeallocateBlock(BlockHeader* block);
+
+    //! @brief Deallocates an element of a slab. Empty slabs are returned to the TLSF allocator if there are other slabs
+    //! with free elements in the same size class.
+    //! @param address: Adress that should be freed
+    void DeallocateSlabElement(U8* address);
+
+    //! @brief Finds a free memory block that can store at least <size> bytes
+    //! @param size: Requested size
+    //! @return Header of a fitting free block or nullptr if there is none
+    BlockHeader* FindFreeBlock(size_t size) const;
+
+    //! @brief Gets the size of a memory block
+    //! @param block: Block header
+    //! @return Size of the memory block
+    static inline size_t GetBlockSize(const BlockHeader* block);
+
+    //! @brief Gets the memory that belongs to a block header
+    //! @param block: Block header
+    //! @return Pointer to the memory of the block
+    static inline U8* GetBlockMemory(const BlockHeader* block);
+
+    //! @brief Gets the header of the physically following memory block
+    //! @param block: Block header
+    //! @return Header of the next memory block
+    static inline BlockHeader* GetNextPhysicalBlock(const BlockHeader* block);
+
+    //! @brief Gets the index of the slab size class that can store an allocation with the passed parameters
+    //! @param size: Allocation size
+    //! @param alignment: Allocation alignment
+    //! @return Index of the slab size class. If the allocation can't be stored in a slab, NumSlabSizeClasses is
+    //! returned.
+    static inline U32 GetSlabSizeClass(size_t size, size_t alignment);
+
+    //! @brief Gets the index of the slab which contains the passed address
+    //! @param address: Address
+    //! @return Slab index
+    inline size_t GetSlabIndex(const U8* address) const;
+
+    //! @brief Inserts a free block into the free list of its size class
+    //! @param block: Free block
+    void InsertFreeBlock(BlockHeader* block);
+
+    //! @brief Returns if the passed address is inside the boundaries of the managed memory
+    //! @param: address: Address that should be checked
+    //! @return TRUE / FALSE
+    inline bool IsAddressInsideMemory(const U8* address) const;
+
+    //! @brief Returns if a memory block is free
+    //! @param block: Block header
+    //! @return TRUE / FALSE
+    static inline bool IsBlockFree(const BlockHeader* block);
+
+    //! @brief Returns if the size class memory is initialized
+    //! @return TRUE / FALSE
+    bool IsInitialized() const;
+
+    //! @brief Returns if the passed address belongs to a slab
+    //! @param: address: Address that should be checked
+    //! @return TRUE / FALSE
+    inline bool IsSlabElement(const U8* address) const;
+
+    //! @brief Calculates the first and second level index of the size class that contains the passed size
+    //! @param size: Block size
+    //! @param firstLevelIndex: First level index
+    //! @param secondLevelIndex: Second level index
+    static inline void MapSizeToIndices(size_t size, U32& firstLevelIndex, U32& secondLevelIndex);
+
+    //! @brief Removes a slab from the slab list of its size class
+    //! @param slab: Slab
+    void RemoveSlabFromList(Slab* slab);
+
+    //! @brief Removes a free block from the free list of its size class
+    //! @param block: Free block
+    void RemoveFreeBlock(BlockHeader* block);
+
+    //! @brief Sets the size and the flags of a memory block
+    //! @param block: Block header
+    //! @param size: Size of the block
+    //! @param free: TRUE if the block is free, FALSE otherwise
+    static inline void SetBlockSize(BlockHeader* block, size_t size, bool free);
+
+    //! @brief Splits the front of a free block so that its memory has the requested alignment. The split off part is
+    //! added to the free lists.
+    //! @param block: Block header
+    //! @param alignment: Alignment
+    //! @return Header of the aligned block
+    BlockHeader* TrimBlockFront(BlockHeader* block, size_t alignment);
+
+    //! @brief Splits the unneeded memory at the end of a block and adds it as new free block to the free lists
+    //! @param block: Block header
+    //! @param size: Needed size
+    void TrimBlockBack(BlockHeader* block, size_t size);
+};
+
+} // namespace GDL
@@ -50,14 +50,15 @@ MemoryInterface* StackAllocator<_type>::GetMemoryAllocationPattern()
 template <class _type>
 MemoryInterface* StackAllocator<_type>::InitializeMemoryAllocationPattern()
 {
-    MemoryInterface* memoryAP = MemoryManager::Instance().GetMemoryStack();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    MemoryInterface* memoryAP = memoryManager.GetMemoryStack();
     if (memoryAP == nullptr)
     {
-        memoryAP = MemoryManager::Instance().GetGeneralPurposeMemory();
+        memoryAP = memoryManager.GetGeneralPurposeMemory();
         if (memoryAP == nullptr)
-            return MemoryManager::Instance().GetHeapMemory();
+            memoryAP = memoryManager.GetHeapMemory();
     }
-    return memoryAP;
+    return memoryManager.GetTrackedMemory(memoryAP);
 }
 
 
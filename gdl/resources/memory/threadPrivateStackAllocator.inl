@@ -44,24 +44,28 @@ void ThreadPrivateStackAllocator<_type>::deallocate(_type* pointer, std::size_t)
 template <class _type>
 MemoryInterface* ThreadPrivateStackAllocator<_type>::GetMemoryAllocationPattern()
 {
-    MemoryInterface* memoryAP = MemoryManager::Instance().GetThreadPrivateMemoryStack();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    MemoryInterface* memoryAP = memoryManager.GetThreadPrivateMemoryStack();
     if (memoryAP == nullptr)
     {
-        DEV_EXCEPTION(MemoryManager::Instance().IsThreadPrivateMemoryEnabled(),
+        DEV_EXCEPTION(memoryManager.IsThreadPrivateMemoryEnabled(),
                       "No thread private memory created for the calling thread.");
         static MemoryInterface* alternativeMemoryAP = InitializeAlternativeMemoryAllocationPattern();
         return alternativeMemoryAP;
     }
+    if constexpr (MemoryTrackingEnabled)
+        return memoryManager.GetTrackedMemory(memoryAP);
     return memoryAP;
 }
 
 template <class _type>
 MemoryInterface* ThreadPrivateStackAllocator<_type>::InitializeAlternativeMemoryAllocationPattern()
 {
-    MemoryInterface* memoryAP = MemoryManager::Instance().GetGeneralPurposeMemory();
+    MemoryManager& memoryManager = MemoryManager::Instance();
+    MemoryInterface* memoryAP = memoryManager.GetGeneralPurposeMemory();
     if (memoryAP == nullptr)
-        return MemoryManager::Instance().GetHeapMemory();
-    return memoryAP;
+        memoryAP = memoryManager.GetHeapMemory();
+    return memoryManager.GetTrackedMemory(memoryAP);
 }
 
 
@@ -0,0 +1,415 @@
+#include "gdl/resources/memory/utility/memoryTracker.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/bitScan.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <new>
+#include <ostream>
+
+
+namespace GDL
+{
+
+namespace
+{
+
+//! @brief Adds a value to a counter that is only modified by the calling thread. Other threads might read the counter
+//! concurrently, so it needs to be atomic, but no read-modify-write operation is necessary.
+//! @param counter: Counter
+//! @param value: Value
+inline void AddToOwnedCounter(std::atomic<U64>& counter, U64 value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+
+
+//! @brief Raises a maximum that is only modified by the calling thread to the passed value if it is smaller
+//! @param maximum: Maximum
+//! @param value: Value
+inline void UpdateOwnedMaximum(std::atomic<U64>& maximum, U64 value)
+{
+    if (maximum.load(std::memory_order_relaxed) < value)
+        maximum.store(value, std::memory_order_relaxed);
+}
+
+
+
+//! @brief Writes a string as JSON string literal
+//! @param stream: Output stream
+//! @param string: String
+void WriteJsonString(std::ostream& stream, const std::string& string)
+{
+    static constexpr const char* hexDigits = "0123456789abcdef";
+
+    stream << '"';
+    for (char character : string)
+    {
+        if (character == '"' || character == '\\')
+            stream << '\\' << character;
+        else if (static_cast<unsigned char>(character) < 0x20)
+            stream << "\\u00" << hexDigits[(character >> 4) & 0xF] << hexDigits[character & 0xF];
+        else
+            stream << character;
+    }
+    stream << '"';
+}
+
+
+
+//! @brief Writes a string as CSV field
+//! @param stream: Output stream
+//! @param string: String
+void WriteCsvString(std::ostream& stream, const std::string& string)
+{
+    stream << '"';
+    for (char character : string)
+    {
+        if (character == '"')
+            stream << '"';
+        stream << character;
+    }
+    stream << '"';
+}
+
+} // namespace
+
+
+
+std::atomic<U64> MemoryTracker::mNextId = 1;
+thread_local const char* MemoryTracker::mCurrentTag = MemoryTracker::UntaggedTag;
+thread_local std::array<MemoryTracker::CachedThreadCounters, MemoryTracker::NumCachedThreadCounters>
+        MemoryTracker::mCachedThreadCounters = {};
+
+
+
+void MemoryTracker::UsageCounters::AddAllocation(U64 size)
+{
+    const U64 currentBytes = mCurrentBytes.load(std::memory_order_relaxed) + size;
+    mCurrentBytes.store(currentBytes, std::memory_order_relaxed);
+    UpdateOwnedMaximum(mPeakBytes, currentBytes - mRemotelyFreedBytes.load(std::memory_order_relaxed));
+}
+
+
+
+void MemoryTracker::UsageCounters::AddDeallocation(U64 size, bool isOwner)
+{
+    if (isOwner)
+        mCurrentBytes.store(mCurrentBytes.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+    else
+        mRemotelyFreedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+
+
+U64 MemoryTracker::UsageCounters::GetCurrentBytes() const
+{
+    // Concurrent remote deallocations might be visible before the corresponding allocations
+    const U64 remotelyFreedBytes = mRemotelyFreedBytes.load(std::memory_order_relaxed);
+    const U64 currentBytes = mCurrentBytes.load(std::memory_order_relaxed);
+    return (currentBytes > remotelyFreedBytes) ? currentBytes - remotelyFreedBytes : 0;
+}
+
+
+
+MemoryTracker::ThreadCounters::~ThreadCounters()
+{
+    for (auto& tagCounters : mTagCounters)
+        delete tagCounters.load(std::memory_order_relaxed);
+}
+
+
+
+MemoryTracker::TagCounters& MemoryTracker::ThreadCounters::GetTagCounters(U32 tagIndex)
+{
+    TagCounters* tagCounters = mTagCounters[tagIndex].load(std::memory_order_relaxed);
+    if (tagCounters == nullptr)
+    {
+        tagCounters = new TagCounters;
+        mTagCounters[tagIndex].store(tagCounters, std::memory_order_release);
+    }
+    return *tagCounters;
+}
+
+
+
+MemoryTracker::MemoryTracker(MemoryInterface& memory)
+    : mMemory{memory}
+    , mId{mNextId.fetch_add(1, std::memory_order_relaxed)}
+    , mTagNames{}
+    , mThreadCountersMutex{}
+    , mThreadCounters{}
+{
+    mTagNames[0] = UntaggedTag;
+}
+
+
+
+void* MemoryTracker::Allocate(size_t size, size_t alignment)
+{
+    const size_t headerSize = GetHeaderSize(alignment);
+    U8* memory = static_cast<U8*>(mMemory.Allocate(size + headerSize, GetWrappedAlignment(alignment)));
+    U8* address = memory + headerSize;
+
+    ThreadCounters& threadCounters = GetThreadCounters();
+    const U32 tagIndex = GetTagIndex(mCurrentTag);
+    new (address - sizeof(AllocationHeader)) AllocationHeader{size, GetTimestamp(), &threadCounters, tagIndex,
+                                                              static_cast<U32>(headerSize)};
+
+    TagCounters& counters = threadCounters.GetTagCounters(tagIndex);
+    const U32 bucket = std::min(IndexOfMostSignificantBit(size | 1), MemoryTagStatistics::NumHistogramBuckets - 1);
+    AddToOwnedCounter(counters.mNumAllocations, 1);
+    AddToOwnedCounter(counters.mAllocatedBytes, size);
+    AddToOwnedCounter(counters.mSizeHistogram[bucket], 1);
+    counters.mUsage.AddAllocation(size);
+    threadCounters.mUsage.AddAllocation(size);
+
+    return address;
+}
+
+
+
+void MemoryTracker::Deallocate(void* address, size_t alignment)
+{
+    DEV_EXCEPTION(address == nullptr, "Can't free a nullptr");
+
+    // The header must be copied before the memory is freed
+    U8* bytes = static_cast<U8*>(address);
+    const AllocationHeader header = *reinterpret_cast<const AllocationHeader*>(bytes - sizeof(AllocationHeader));
+    mMemory.Deallocate(bytes - header.mHeaderSize, GetWrappedAlignment(alignment));
+
+    ThreadCounters& threadCounters = GetThreadCounters();
+    TagCounters& counters = threadCounters.GetTagCounters(header.mTagIndex);
+    const U64 lifetime = GetTimestamp() - header.mTimestamp;
+    AddToOwnedCounter(counters.mNumDeallocations, 1);
+    AddToOwnedCounter(counters.mDeallocatedBytes, header.mSize);
+    AddToOwnedCounter(counters.mTotalLifetime, lifetime);
+    UpdateOwnedMaximum(counters.mMaxLifetime, lifetime);
+
+    // The allocating thread created the counters of the tag, so they exist
+    ThreadCounters& owner = *header.mThreadCounters;
+    const bool isOwner = &owner == &threadCounters;
+    owner.mTagCounters[header.mTagIndex].load(std::memory_order_acquire)->mUsage.AddDeallocation(header.mSize, isOwner);
+    owner.mUsage.AddDeallocation(header.mSize, isOwner);
+}
+
+
+
+U64 MemoryTracker::GetCurrentMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(mThreadCountersMutex);
+
+    U64 currentBytes = 0;
+    for (const auto& [threadId, threadCounters] : mThreadCounters)
+        currentBytes += threadCounters->mUsage.GetCurrentBytes();
+    return currentBytes;
+}
+
+
+
+size_t MemoryTracker::GetHeaderSize(size_t alignment)
+{
+    const size_t wrappedAlignment = GetWrappedAlignment(alignment);
+    return (sizeof(AllocationHeader) + wrappedAlignment - 1) / wrappedAlignment * wrappedAlignment;
+}
+
+
+
+U64 MemoryTracker::GetPeakMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(mThreadCountersMutex);
+
+    U64 peakBytes = 0;
+    for (const auto& [threadId, threadCounters] : mThreadCounters)
+        peakBytes += threadCounters->mUsage.mPeakBytes.load(std::memory_order_relaxed);
+    return peakBytes;
+}
+
+
+
+std::vector<MemoryTagStatistics> MemoryTracker::GetStatistics()
+{
+    std::vector<MemoryTagStatistics> mergedStatistics(MaxNumTags);
+    {
+        std::lock_guard<std::mutex> lock(mThreadCountersMutex);
+        for (const auto& [threadId, threadCounters] : mThreadCounters)
+            for (U32 i = 0; i < MaxNumTags; ++i)
+            {
+                const TagCounters* source = threadCounters->mTagCounters[i].load(std::memory_order_acquire);
+                if (source == nullptr)
+                    continue;
+
+                MemoryTagStatistics& target = mergedStatistics[i];
+                target.mNumAllocations += source->mNumAllocations.load(std::memory_order_relaxed);
+                target.mNumDeallocations += source->mNumDeallocations.load(std::memory_order_relaxed);
+                target.mAllocatedBytes += source->mAllocatedBytes.load(std::memory_order_relaxed);
+                target.mDeallocatedBytes += source->mDeallocatedBytes.load(std::memory_order_relaxed);
+                target.mCurrentBytes += source->mUsage.GetCurrentBytes();
+                target.mPeakBytes += source->mUsage.mPeakBytes.load(std::memory_order_relaxed);
+                target.mTotalLifetime += source->mTotalLifetime.load(std::memory_order_relaxed);
+                target.mMaxLifetime =
+                        std::max(target.mMaxLifetime, source->mMaxLifetime.load(std::memory_order_relaxed));
+                for (U32 j = 0; j < MemoryTagStatistics::NumHistogramBuckets; ++j)
+                    target.mSizeHistogram[j] += source->mSizeHistogram[j].load(std::memory_order_relaxed);
+            }
+    }
+
+    std::map<std::string, MemoryTagStatistics> statisticsByName;
+    for (U32 i = 0; i < MaxNumTags; ++i)
+    {
+        const char* name = mTagNames[i].load(std::memory_order_acquire);
+        const MemoryTagStatistics& merged = mergedStatistics[i];
+        if (name == nullptr || (merged.mNumAllocations == 0 && merged.mNumDeallocations == 0))
+            continue;
+
+        MemoryTagStatistics& statistics = statisticsByName[name];
+        statistics.mTag = name;
+        statistics.mNumAllocations += merged.mNumAllocations;
+        statistics.mNumDeallocations += merged.mNumDeallocations;
+        statistics.mAllocatedBytes += merged.mAllocatedBytes;
+        statistics.mDeallocatedBytes += merged.mDeallocatedBytes;
+        statistics.mCurrentBytes += merged.mCurrentBytes;
+        statistics.mPeakBytes += merged.mPeakBytes;
+        statistics.mTotalLifetime += merged.mTotalLifetime;
+        statistics.mMaxLifetime = std::max(statistics.mMaxLifetime, merged.mMaxLifetime);
+        for (U32 j = 0; j < MemoryTagStatistics::NumHistogramBuckets; ++j)
+            statistics.mSizeHistogram[j] += merged.mSizeHistogram[j];
+    }
+
+    std::vector<MemoryTagStatistics> statistics;
+    statistics.reserve(statisticsByName.size());
+    for (auto& [name, tagStatistics] : statisticsByName)
+        statistics.push_back(std::move(tagStatistics));
+    return statistics;
+}
+
+
+
+size_t MemoryTracker::GetWrappedAlignment(size_t alignment)
+{
+    return std::max(alignment, alignof(AllocationHeader));
+}
+
+
+
+void MemoryTracker::WriteCsv(std::ostream& stream)
+{
+    stream << "tag,allocations,deallocations,allocated_bytes,deallocated_bytes,current_bytes,peak_bytes,"
+              "total_lifetime_ns,max_lifetime_ns";
+    for (U32 i = 0; i < MemoryTagStatistics::NumHistogramBuckets; ++i)
+        stream << ",size_" << (U64(1) << i);
+    stream << '\n';
+
+    for (const MemoryTagStatistics& statistics : GetStatistics())
+    {
+        WriteCsvString(stream, statistics.mTag);
+        stream << ',' << statistics.mNumAllocations << ',' << statistics.mNumDeallocations << ','
+               << statistics.mAllocatedBytes << ',' << statistics.mDeallocatedBytes << ',' << statistics.mCurrentBytes
+               << ',' << statistics.mPeakBytes << ',' << statistics.mTotalLifetime << ',' << statistics.mMaxLifetime;
+        for (U64 count : statistics.mSizeHistogram)
+            stream << ',' << count;
+        stream << '\n';
+    }
+}
+
+
+
+void MemoryTracker::WriteJson(std::ostream& stream)
+{
+    const std::vector<MemoryTagStatistics> tagStatistics = GetStatistics();
+
+    stream << "{\"current_bytes\":" << GetCurrentMemorySize() << ",\"peak_bytes\":" << GetPeakMemorySize()
+           << ",\"tags\":[";
+    for (U32 i = 0; i < tagStatistics.size(); ++i)
+    {
+        const MemoryTagStatistics& statistics = tagStatistics[i];
+        if (i > 0)
+            stream << ',';
+        stream << "{\"tag\":";
+        WriteJsonString(stream, statistics.mTag);
+        stream << ",\"allocations\":" << statistics.mNumAllocations
+               << ",\"deallocations\":" << statistics.mNumDeallocations
+               << ",\"allocated_bytes\":" << statistics.mAllocatedBytes
+               << ",\"deallocated_bytes\":" << statistics.mDeallocatedBytes
+               << ",\"current_bytes\":" << statistics.mCurrentBytes << ",\"peak_bytes\":" << statistics.mPeakBytes
+               << ",\"total_lifetime_ns\":" << statistics.mTotalLifetime
+               << ",\"max_lifetime_ns\":" << statistics.mMaxLifetime << ",\"size_histogram\":[";
+        for (U32 j = 0; j < MemoryTagStatistics::NumHistogramBuckets; ++j)
+            stream << ((j > 0) ? "," : "") << statistics.mSizeHistogram[j];
+        stream << "]}";
+    }
+    stream << "]}\n";
+}
+
+
+
+MemoryTracker::ThreadCounters& MemoryTracker::GetThreadCounters()
+{
+    CachedThreadCounters& cachedThreadCounters = mCachedThreadCounters[mId % NumCachedThreadCounters];
+    if (cachedThreadCounters.mTrackerId == mId)
+        return *cachedThreadCounters.mThreadCounters;
+
+    std::lock_guard<std::mutex> lock(mThreadCountersMutex);
+    std::unique_ptr<ThreadCounters>& threadCounters = mThreadCounters[std::this_thread::get_id()];
+    if (threadCounters == nullptr)
+        threadCounters = std::make_unique<ThreadCounters>();
+
+    cachedThreadCounters = {mId, threadCounters.get()};
+    return *threadCounters;
+}
+
+
+
+U32 MemoryTracker::GetTagIndex(const char* tag)
+{
+    if (tag == nullptr || tag == UntaggedTag)
+        return 0;
+
+    // Open addressing with linear probing. Index 0 is reserved for untagged allocations and also collects all
+    // allocations with tags that don't fit into the table anymore.
+    const size_t hash = reinterpret_cast<size_t>(tag) >> 3;
+    for (U32 i = 0; i < MaxNumTags - 1; ++i)
+    {
+        const U32 index = 1 + static_cast<U32>((hash + i) % (MaxNumTags - 1));
+        const char* name = mTagNames[index].load(std::memory_order_acquire);
+        if (name == tag)
+            return index;
+        if (name == nullptr)
+        {
+            if (mTagNames[index].compare_exchange_strong(name, tag, std::memory_order_acq_rel))
+                return index;
+            if (name == tag)
+                return index;
+        }
+    }
+    return 0;
+}
+
+
+
+U64 MemoryTracker::GetTimestamp()
+{
+    return static_cast<U64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+}
+
+
+
+MemoryTrackingScope::MemoryTrackingScope(const char* tag)
+    : mPreviousTag{MemoryTracker::mCurrentTag}
+{
+    MemoryTracker::mCurrentTag = tag;
+}
+
+
+
+MemoryTrackingScope::~MemoryTrackingScope()
+{
+    MemoryTracker::mCurrentTag = mPreviousTag;
+}
+
+} // namespace GDL
@@ -0,0 +1,259 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/memory/memoryInterface.h"
+
+#include <array>
+#include <atomic>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+#define MEMORY_TRACKING_STRINGIFY_DETAIL(value) #value
+#define MEMORY_TRACKING_STRINGIFY(value) MEMORY_TRACKING_STRINGIFY_DETAIL(value)
+
+//! @brief Creates a tag string from the current file and line. It can be passed to a MemoryTrackingScope to record
+//! allocations per call site.
+#define MEMORY_TRACKING_CALLSITE __FILE__ ":" MEMORY_TRACKING_STRINGIFY(__LINE__)
+
+
+namespace GDL
+{
+
+//! @brief Merged allocation statistics of a single tag
+struct MemoryTagStatistics
+{
+    //! @brief Number of buckets of the allocation size histogram. The last bucket also counts all bigger sizes.
+    static constexpr U32 NumHistogramBuckets = 32;
+
+    std::string mTag;                                      //!< Name of the tag
+    U64 mNumAllocations = 0;                               //!< Number of allocations
+    U64 mNumDeallocations = 0;                             //!< Number of deallocations
+    U64 mAllocatedBytes = 0;                               //!< Total number of allocated bytes
+    U64 mDeallocatedBytes = 0;                             //!< Total number of deallocated bytes
+    U64 mCurrentBytes = 0;                                 //!< Number of currently allocated bytes
+    U64 mPeakBytes = 0;                                    //!< Maximal number of simultaneously allocated bytes
+    U64 mTotalLifetime = 0;                                //!< Sum of the lifetimes of all deallocations in ns
+    U64 mMaxLifetime = 0;                                  //!< Maximal lifetime of a deallocated allocation in ns
+    std::array<U64, NumHistogramBuckets> mSizeHistogram{}; //!< Bucket i counts sizes in [2^i, 2^(i+1))
+};
+
+
+
+//! @brief If TRUE, the memory manager wraps all its memory systems with memory trackers. Enable it with the CMake
+//! option ENABLE_MEMORY_TRACKING.
+#ifdef MEMORY_TRACKING
+constexpr bool MemoryTrackingEnabled = true;
+#else
+constexpr bool MemoryTrackingEnabled = false;
+#endif
+
+
+
+//! @brief Memory interface that wraps another memory interface and records statistics of all allocations that pass
+//! through it. Allocations are assigned to the tag of the innermost MemoryTrackingScope of the allocating thread.
+//! @remark The size, tag and timestamp of each allocation are stored in a small header in front of the returned
+//! memory. Therefore, each allocation requests GetHeaderSize(alignment) additional bytes from the wrapped memory.
+//! @remark Counters are kept per thread and merged on demand. A thread only writes its own counters, so that no atomic
+//! read-modify-write operations are needed. The only exception are deallocations of memory that was allocated by
+//! another thread. They are subtracted from the current usage of the allocating thread with an atomic addition.
+class MemoryTracker : public MemoryInterface
+{
+public:
+    //! @brief Maximal number of distinct tags. Further tags are recorded as untagged.
+    static constexpr U32 MaxNumTags = 256;
+
+    //! @brief Tag of allocations outside of any tracking scope
+    static constexpr const char* UntaggedTag = "untagged";
+
+private:
+    friend class MemoryTrackingScope;
+
+    //! @brief Number of trackers per thread whose counters can be found without locking
+    static constexpr U32 NumCachedThreadCounters = 16;
+
+    //! @brief Memory usage of the allocations of a single thread. Only the allocating thread modifies the current and
+    //! peak usage. Deallocations by other threads are accumulated separately.
+    struct UsageCounters
+    {
+        std::atomic<U64> mCurrentBytes = 0;
+        std::atomic<U64> mPeakBytes = 0;
+        std::atomic<U64> mRemotelyFreedBytes = 0;
+
+        //! @brief Records an allocation of the owning thread
+        //! @param size: Size of the allocation
+        void AddAllocation(U64 size);
+
+        //! @brief Records a deallocation
+        //! @param size: Size of the allocation
+        //! @param isOwner: TRUE if the calling thread is the owning thread
+        void AddDeallocation(U64 size, bool isOwner);
+
+        //! @brief Gets the number of bytes that are currently allocated
+        //! @return Number of bytes
+        U64 GetCurrentBytes() const;
+    };
+
+    //! @brief Counters of a single tag that are only modified by a single thread
+    struct TagCounters
+    {
+        std::atomic<U64> mNumAllocations = 0;
+        std::atomic<U64> mNumDeallocations = 0;
+        std::atomic<U64> mAllocatedBytes = 0;
+        std::atomic<U64> mDeallocatedBytes = 0;
+        std::atomic<U64> mTotalLifetime = 0;
+        std::atomic<U64> mMaxLifetime = 0;
+        std::array<std::atomic<U64>, MemoryTagStatistics::NumHistogramBuckets> mSizeHistogram{};
+        UsageCounters mUsage;
+    };
+
+    //! @brief Counters of a single thread. The counters of a tag are created when the thread uses the tag for the first
+    //! time.
+    struct ThreadCounters
+    {
+        UsageCounters mUsage;
+        std::array<std::atomic<TagCounters*>, MaxNumTags> mTagCounters{};
+
+        ThreadCounters() = default;
+        ThreadCounters(const ThreadCounters&) = delete;
+        ThreadCounters(ThreadCounters&&) = delete;
+        ThreadCounters& operator=(const ThreadCounters&) = delete;
+        ThreadCounters& operator=(ThreadCounters&&) = delete;
+        ~ThreadCounters();
+
+        //! @brief Gets the counters of a tag. They are created if they don't exist yet.
+        //! @param tagIndex: Index of the tag
+        //! @return Counters of the tag
+        //! @remark This function must only be called by the owning thread
+        TagCounters& GetTagCounters(U32 tagIndex);
+    };
+
+    //! @brief Data that is stored in front of each allocation
+    struct AllocationHeader
+    {
+        size_t mSize;
+        U64 mTimestamp;
+        ThreadCounters* mThreadCounters;
+        U32 mTagIndex;
+        U32 mHeaderSize;
+    };
+
+    //! @brief Entry of the thread local cache that maps trackers to the counters of the thread
+    struct CachedThreadCounters
+    {
+        U64 mTrackerId = 0;
+        ThreadCounters* mThreadCounters = nullptr;
+    };
+
+    MemoryInterface& mMemory;
+    U64 mId;
+    std::array<std::atomic<const char*>, MaxNumTags> mTagNames;
+    mutable std::mutex mThreadCountersMutex;
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadCounters>> mThreadCounters;
+
+    static std::atomic<U64> mNextId;
+    static thread_local const char* mCurrentTag;
+    static thread_local std::array<CachedThreadCounters, NumCachedThreadCounters> mCachedThreadCounters;
+
+public:
+    //! @brief Creates a memory tracker for the passed memory interface
+    //! @param memory: Memory interface that performs the allocations. It must outlive the tracker.
+    MemoryTracker(MemoryInterface& memory);
+
+    MemoryTracker() = delete;
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker(MemoryTracker&&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(MemoryTracker&&) = delete;
+    ~MemoryTracker() override = default;
+
+
+    //! @brief Allocates memory from the wrapped memory interface and records the allocation
+    //! @param size: Size of the memory that should be allocated
+    //! @param alignment: Memory alignment
+    //! @return Pointer to memory
+    virtual void* Allocate(size_t size, size_t alignment = 1) override;
+
+    //! @brief Deallocates memory with the wrapped memory interface and records the deallocation
+    //! @param address: Adress that should be freed
+    //! @param alignment: Memory alignment
+    //! @remark The address must have been allocated through the tracker
+    virtual void Deallocate(void* address, size_t alignment = 1) override;
+
+    //! @brief Gets the number of bytes that are currently allocated through the tracker
+    //! @return Number of currently allocated bytes
+    U64 GetCurrentMemorySize() const;
+
+    //! @brief Gets the number of additional bytes that the tracker requests from the wrapped memory for each allocation
+    //! @param alignment: Alignment of the allocation
+    //! @return Size of the allocation header including the padding that is needed to keep the alignment
+    static size_t GetHeaderSize(size_t alignment);
+
+    //! @brief Gets the maximal number of bytes that were allocated at the same time
+    //! @return Peak number of allocated bytes
+    //! @remark The peak usage of each thread is recorded separately. The result is the sum of these peaks. It is exact
+    //! if only a single thread uses the tracker and an upper bound otherwise.
+    U64 GetPeakMemorySize() const;
+
+    //! @brief Merges the counters of all threads and returns the statistics of each tag, sorted by the tag names
+    //! @return Statistics of all tags that were used
+    //! @remark Tags are identified by the address of their string. Different strings with the same content are merged
+    //! into a single entry. The peak usage of a tag is the sum of the peaks of all threads and strings.
+    std::vector<MemoryTagStatistics> GetStatistics();
+
+    //! @brief Gets the alignment of the memory that the tracker requests from the wrapped memory
+    //! @param alignment: Alignment of the allocation
+    //! @return Alignment of the wrapped allocation
+    static size_t GetWrappedAlignment(size_t alignment);
+
+    //! @brief Writes the statistics as CSV table with one line per tag
+    //! @param stream: Output stream
+    void WriteCsv(std::ostream& stream);
+
+    //! @brief Writes the statistics as JSON object
+    //! @param stream: Output stream
+    void WriteJson(std::ostream& stream);
+
+private:
+    //! @brief Gets the counters of the calling thread. They are created if they don't exist yet.
+    //! @return Counters of the calling thread
+    ThreadCounters& GetThreadCounters();
+
+    //! @brief Gets the index of the passed tag. The tag is added if it is not known yet.
+    //! @param tag: Tag
+    //! @return Tag index
+    U32 GetTagIndex(const char* tag);
+
+    //! @brief Gets the current timestamp in nanoseconds
+    //! @return Timestamp
+    static U64 GetTimestamp();
+};
+
+
+
+//! @brief Sets the tag of all allocations of the calling thread that are recorded by memory trackers during the
+//! lifetime of an instance. The previous tag is restored on destruction, so scopes can be nested.
+class MemoryTrackingScope
+{
+    const char* mPreviousTag;
+
+public:
+    //! @brief Ctor
+    //! @param tag: Tag of the allocations. The string must stay valid as long as the trackers exist, which is the case
+    //! for string literals and MEMORY_TRACKING_CALLSITE.
+    MemoryTrackingScope(const char* tag);
+
+    MemoryTrackingScope() = delete;
+    MemoryTrackingScope(const MemoryTrackingScope&) = delete;
+    MemoryTrackingScope(MemoryTrackingScope&&) = delete;
+    MemoryTrackingScope& operator=(const MemoryTrackingScope&) = delete;
+    MemoryTrackingScope& operator=(MemoryTrackingScope&&) = delete;
+    ~MemoryTrackingScope();
+};
+
+} // namespace GDL
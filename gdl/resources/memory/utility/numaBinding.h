@@ -0,0 +1,66 @@
+#pragma once
+
+#include "gdl/base/fundamentalTypes.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+
+namespace GDL
+{
+
+//! @brief Gets the NUMA node of the logical CPU that currently executes the calling thread
+//! @return NUMA node or -1 if it can't be determined
+inline I32 GetCurrentNumaNode()
+{
+#ifdef __linux__
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+        return -1;
+    return static_cast<I32>(node);
+#else
+    return -1;
+#endif
+}
+
+
+
+//! @brief Asks the operating system to place the pages of the passed memory range on the NUMA node of the calling
+//! thread. Only pages that are completely inside of the range are affected.
+//! @param address: Start address of the memory range
+//! @param size: Size of the memory range in bytes
+//! @return TRUE if the policy was applied, FALSE otherwise
+//! @remark This is only a hint. Pages that are not touched yet are allocated on the preferred node and already touched
+//! pages are moved if possible. It has only an effect if the calling thread is pinned to the CPUs of a single node.
+//! Failures are not treated as errors, since the memory stays usable.
+inline bool BindMemoryToCurrentNumaNode([[maybe_unused]] void* address, [[maybe_unused]] size_t size)
+{
+#ifdef __linux__
+    constexpr U32 numNodeMaskBits = sizeof(unsigned long) * 8;
+
+    const I32 node = GetCurrentNumaNode();
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    if (node < 0 || static_cast<U32>(node) >= numNodeMaskBits || pageSize <= 0)
+        return false;
+
+    const auto pageMask = static_cast<std::uintptr_t>(pageSize - 1);
+    const auto begin = (reinterpret_cast<std::uintptr_t>(address) + pageMask) & ~pageMask;
+    const auto end = (reinterpret_cast<std::uintptr_t>(address) + size) & ~pageMask;
+    if (end <= begin)
+        return false;
+
+    const unsigned long nodeMask = 1ul << node;
+    return syscall(SYS_mbind, begin, end - begin, MPOL_PREFERRED, &nodeMask, numNodeMaskBits + 1, MPOL_MF_MOVE) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace GDL
@@ -0,0 +1,220 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/container/flatHashMap.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+
+using namespace GDL;
+
+
+
+// Helper functions ---------------------------------------------------------------------------------------------------
+
+//! @brief Hash function that maps all keys to the same value, so that every key collides
+struct CollidingHash
+{
+    size_t operator()(I32) const
+    {
+        return 42;
+    }
+};
+
+
+
+//! @brief Checks that a flat hash map and an unordered map contain the same elements
+template <typename _map, typename _reference>
+void CheckEqual(const _map& map, const _reference& reference)
+{
+    BOOST_CHECK(map.size() == reference.size());
+
+    size_t numIteratedElements = 0;
+    for (const auto& [key, value] : map)
+    {
+        BOOST_CHECK(reference.at(key) == value);
+        ++numIteratedElements;
+    }
+    BOOST_CHECK(numIteratedElements == reference.size());
+
+    for (const auto& [key, value] : reference)
+    {
+        BOOST_CHECK(map.contains(key));
+        BOOST_CHECK(map.at(key) == value);
+    }
+}
+
+
+
+// Tests --------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Insert_and_Find)
+{
+    FlatHashMap<I32, I32> map;
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.capacity() == 0);
+    BOOST_CHECK(map.find(1) == map.end());
+    BOOST_CHECK(map.begin() == map.end());
+
+    auto [iterator, inserted] = map.emplace(1, 10);
+    BOOST_CHECK(inserted);
+    BOOST_CHECK(iterator->first == 1);
+    BOOST_CHECK(iterator->second == 10);
+
+    // Existing keys are not overwritten
+    std::tie(iterator, inserted) = map.insert({1, 20});
+    BOOST_CHECK(!inserted);
+    BOOST_CHECK(iterator->second == 10);
+
+    map[2] = 20;
+    BOOST_CHECK(map[3] == 0);
+    BOOST_CHECK(map.size() == 3);
+    BOOST_CHECK(map.count(2) == 1);
+    BOOST_CHECK(map.count(4) == 0);
+    BOOST_CHECK(map.find(2)->second == 20);
+    BOOST_CHECK(map.find(4) == map.end());
+    BOOST_CHECK_THROW(map.at(4), Exception);
+
+    map.at(3) = 30;
+    BOOST_CHECK(std::as_const(map).at(3) == 30);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Growth)
+{
+    constexpr I32 numElements = 10000;
+
+    FlatHashMap<I32, I32> map;
+    std::unordered_map<I32, I32> reference;
+    for (I32 i = 0; i < numElements; ++i)
+    {
+        map.emplace(i * 7, i);
+        reference.emplace(i * 7, i);
+        BOOST_CHECK(map.size() * 8 <= map.capacity() * 7);
+    }
+    CheckEqual(map, reference);
+    BOOST_CHECK(!map.contains(numElements * 7));
+
+    FlatHashMap<I32, I32> reserved;
+    reserved.reserve(numElements);
+    const size_t capacity = reserved.capacity();
+    for (I32 i = 0; i < numElements; ++i)
+        reserved.emplace(i, i);
+    BOOST_CHECK(reserved.capacity() == capacity);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Erase)
+{
+    constexpr I32 numElements = 1000;
+
+    FlatHashMap<I32, I32> map;
+    std::unordered_map<I32, I32> reference;
+    for (I32 i = 0; i < numElements; ++i)
+    {
+        map.emplace(i, -i);
+        reference.emplace(i, -i);
+    }
+
+    for (I32 i = 0; i < numElements; i += 3)
+    {
+        BOOST_CHECK(map.erase(i) == 1);
+        reference.erase(i);
+    }
+    BOOST_CHECK(map.erase(0) == 0);
+    CheckEqual(map, reference);
+
+    // Erase while iterating
+    for (auto iterator = map.begin(); iterator != map.end();)
+        if (iterator->first % 2 == 0)
+        {
+            reference.erase(iterator->first);
+            iterator = map.erase(iterator);
+        }
+        else
+            ++iterator;
+    CheckEqual(map, reference);
+
+    // Reinsert into deleted slots without growing the table
+    const size_t capacity = map.capacity();
+    for (I32 i = 0; i < numElements; i += 2)
+    {
+        map.emplace(i, i);
+        reference.emplace(i, i);
+    }
+    BOOST_CHECK(map.capacity() == capacity);
+    CheckEqual(map, reference);
+
+    map.clear();
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.begin() == map.end());
+    BOOST_CHECK(map.capacity() == capacity);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Collisions)
+{
+    // Every key lands in the same group, so lookups have to probe through full groups and deleted slots
+    constexpr I32 numElements = 200;
+
+    FlatHashMapTemplate<I32, I32, CollidingHash, std::equal_to<I32>, std::allocator<std::pair<I32, I32>>> map;
+    std::unordered_map<I32, I32> reference;
+    for (I32 i = 0; i < numElements; ++i)
+    {
+        map.emplace(i, i);
+        reference.emplace(i, i);
+    }
+    CheckEqual(map, reference);
+
+    for (I32 i = 0; i < numElements; i += 2)
+    {
+        map.erase(i);
+        reference.erase(i);
+    }
+    CheckEqual(map, reference);
+    for (I32 i = 0; i < numElements; i += 2)
+        BOOST_CHECK(!map.contains(i));
+
+    // Many insertions and deletions fill the table with deleted slots which must be cleaned up by rehashing
+    for (I32 i = 0; i < 20 * numElements; ++i)
+    {
+        map.emplace(numElements + i, i);
+        map.erase(numElements + i);
+    }
+    CheckEqual(map, reference);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Copy_and_Move)
+{
+    FlatHashMap<std::string, Vector<I32>> map;
+    for (I32 i = 0; i < 100; ++i)
+        map.emplace("key " + std::to_string(i), Vector<I32>(static_cast<size_t>(i), i));
+
+    FlatHashMap<std::string, Vector<I32>> copy(map);
+    BOOST_CHECK(copy.size() == map.size());
+    BOOST_CHECK(copy.at("key 42") == map.at("key 42"));
+
+    FlatHashMap<std::string, Vector<I32>> moved(std::move(map));
+    BOOST_CHECK(moved.size() == 100);
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.capacity() == 0);
+    BOOST_CHECK(moved.at("key 99").size() == 99);
+
+    map = copy;
+    BOOST_CHECK(map.size() == 100);
+    map = std::move(moved);
+    BOOST_CHECK(map.at("key 7") == Vector<I32>(7, 7));
+    BOOST_CHECK(moved.empty());
+
+    map.erase("key 7");
+    BOOST_CHECK(!map.contains("key 7"));
+    BOOST_CHECK(copy.contains("key 7"));
+}
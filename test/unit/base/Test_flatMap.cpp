@@ -0,0 +1,136 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/container/flatMap.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/base/fundamentalTypes.h"
+
+#include <map>
+#include <string>
+#include <tuple>
+
+
+using namespace GDL;
+
+
+
+// Helper functions ---------------------------------------------------------------------------------------------------
+
+//! @brief Checks that a flat map and a std::map contain the same elements in the same order
+template <typename _map, typename _reference>
+void CheckEqual(const _map& map, const _reference& reference)
+{
+    BOOST_REQUIRE(map.size() == reference.size());
+
+    auto referenceIterator = reference.begin();
+    for (const auto& [key, value] : map)
+    {
+        BOOST_CHECK(key == referenceIterator->first);
+        BOOST_CHECK(value == referenceIterator->second);
+        ++referenceIterator;
+    }
+}
+
+
+
+// Tests --------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Insert_and_Find)
+{
+    FlatMap<I32, I32> map;
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.find(1) == map.end());
+
+    auto [iterator, inserted] = map.emplace(5, 50);
+    BOOST_CHECK(inserted);
+    BOOST_CHECK(iterator->first == 5);
+    BOOST_CHECK(iterator->second == 50);
+
+    // Existing keys are not overwritten
+    std::tie(iterator, inserted) = map.insert({5, 10});
+    BOOST_CHECK(!inserted);
+    BOOST_CHECK(iterator->second == 50);
+
+    map[1] = 10;
+    BOOST_CHECK(map[3] == 0);
+    BOOST_CHECK(map.size() == 3);
+    BOOST_CHECK(map.count(1) == 1);
+    BOOST_CHECK(map.count(2) == 0);
+    BOOST_CHECK(map.find(1)->second == 10);
+    BOOST_CHECK(map.find(2) == map.end());
+    BOOST_CHECK(map.find(6) == map.end());
+    BOOST_CHECK_THROW(map.at(2), Exception);
+
+    map.at(3) = 30;
+    BOOST_CHECK(std::as_const(map).at(3) == 30);
+
+    BOOST_CHECK(map.lower_bound(3)->first == 3);
+    BOOST_CHECK(map.upper_bound(3)->first == 5);
+    BOOST_CHECK(map.lower_bound(4)->first == 5);
+    BOOST_CHECK(map.upper_bound(5) == map.end());
+    BOOST_CHECK(map.begin()->first == 1);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Order_and_Erase)
+{
+    constexpr I32 numElements = 1000;
+
+    FlatMap<I32, I32, std::greater<I32>> map;
+    std::map<I32, I32, std::greater<I32>> reference;
+    for (I32 i = 0; i < numElements; ++i)
+    {
+        const I32 key = (i * 7919) % numElements;
+        map.emplace(key, i);
+        reference.emplace(key, i);
+    }
+    CheckEqual(map, reference);
+
+    for (I32 i = 0; i < numElements; i += 3)
+    {
+        BOOST_CHECK(map.erase(i) == 1);
+        reference.erase(i);
+    }
+    BOOST_CHECK(map.erase(0) == 0);
+    CheckEqual(map, reference);
+
+    for (auto iterator = map.begin(); iterator != map.end();)
+        if (iterator->first % 2 == 0)
+        {
+            reference.erase(iterator->first);
+            iterator = map.erase(iterator);
+        }
+        else
+            ++iterator;
+    CheckEqual(map, reference);
+
+    const size_t capacity = map.capacity();
+    map.clear();
+    BOOST_CHECK(map.empty());
+    BOOST_CHECK(map.capacity() == capacity);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Copy_and_Move)
+{
+    FlatMap<std::string, Vector<I32>> map;
+    map.reserve(100);
+    BOOST_CHECK(map.capacity() >= 100);
+    for (I32 i = 0; i < 100; ++i)
+        map.emplace("key " + std::to_string(i), Vector<I32>(static_cast<size_t>(i), i));
+
+    FlatMap<std::string, Vector<I32>> copy(map);
+    BOOST_CHECK(copy.size() == map.size());
+    BOOST_CHECK(copy.at("key 42") == map.at("key 42"));
+
+    FlatMap<std::string, Vector<I32>> moved(std::move(map));
+    BOOST_CHECK(moved.size() == 100);
+    BOOST_CHECK(moved.at("key 99").size() == 99);
+
+    map = std::move(moved);
+    BOOST_CHECK(map.at("key 7") == Vector<I32>(7, 7));
+    map.erase("key 7");
+    BOOST_CHECK(!map.contains("key 7"));
+    BOOST_CHECK(copy.contains("key 7"));
+}
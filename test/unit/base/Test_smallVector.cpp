@@ -0,0 +1,215 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/container/smallVector.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "test/tools/ExceptionChecks.h"
+
+#include <string>
+
+
+using namespace GDL;
+
+
+
+// Helper classes -----------------------------------------------------------------------------------------------------
+
+//! @brief Class that counts its living instances to detect missing or duplicate destructor calls
+class Tracked
+{
+    I32 mValue;
+
+public:
+    static inline I32 numInstances = 0;
+
+    Tracked(I32 value = 0)
+        : mValue{value}
+    {
+        ++numInstances;
+    }
+
+    Tracked(const Tracked& other)
+        : mValue{other.mValue}
+    {
+        ++numInstances;
+    }
+
+    Tracked(Tracked&& other) noexcept
+        : mValue{other.mValue}
+    {
+        other.mValue = -1;
+        ++numInstances;
+    }
+
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) = default;
+
+    ~Tracked()
+    {
+        --numInstances;
+    }
+
+    I32 GetValue() const
+    {
+        return mValue;
+    }
+
+    bool operator==(const Tracked& other) const
+    {
+        return mValue == other.mValue;
+    }
+};
+
+
+
+// Tests --------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Construction)
+{
+    SmallVector<I32, 4> empty;
+    BOOST_CHECK(empty.empty());
+    BOOST_CHECK(empty.is_inline());
+    BOOST_CHECK(empty.capacity() == 4);
+    BOOST_CHECK(empty.begin() == empty.end());
+
+    SmallVector<I32, 4> zeros(3);
+    BOOST_CHECK(zeros.size() == 3);
+    BOOST_CHECK(zeros.is_inline());
+    for (I32 value : zeros)
+        BOOST_CHECK(value == 0);
+
+    SmallVector<I32, 4> values(6, 7);
+    BOOST_CHECK(values.size() == 6);
+    BOOST_CHECK(!values.is_inline());
+    for (I32 value : values)
+        BOOST_CHECK(value == 7);
+
+    SmallVector<I32, 4> list = {1, 2, 3};
+    BOOST_CHECK(list.size() == 3);
+    BOOST_CHECK(list.front() == 1);
+    BOOST_CHECK(list.back() == 3);
+    BOOST_CHECK(list.at(1) == 2);
+    BOOST_CHECK_THROW(list.at(3), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(list[3], Exception);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Spill_to_Allocator)
+{
+    Tracked::numInstances = 0;
+    {
+        SmallVector<Tracked, 4> vector;
+        for (I32 i = 0; i < 4; ++i)
+            vector.emplace_back(i);
+        BOOST_CHECK(vector.is_inline());
+        BOOST_CHECK(Tracked::numInstances == 4);
+
+        vector.push_back(Tracked(4));
+        BOOST_CHECK(!vector.is_inline());
+        BOOST_CHECK(vector.capacity() == 8);
+        BOOST_CHECK(Tracked::numInstances == 5);
+
+        // The pushed value references an element that is moved during the reallocation
+        for (I32 i = 5; i < 8; ++i)
+            vector.emplace_back(i);
+        vector.push_back(vector[0]);
+        BOOST_CHECK(vector.size() == 9);
+        BOOST_CHECK(vector.back().GetValue() == 0);
+        for (I32 i = 0; i < 8; ++i)
+            BOOST_CHECK(vector[static_cast<size_t>(i)].GetValue() == i);
+
+        vector.pop_back();
+        BOOST_CHECK(Tracked::numInstances == 8);
+    }
+    BOOST_CHECK(Tracked::numInstances == 0);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Resize_and_Erase)
+{
+    Tracked::numInstances = 0;
+    {
+        SmallVectorS<Tracked, 4> vector;
+        vector.resize(3, Tracked(5));
+        BOOST_CHECK(vector.is_inline());
+        BOOST_CHECK(Tracked::numInstances == 3);
+
+        vector.resize(6, vector[0]);
+        BOOST_CHECK(!vector.is_inline());
+        BOOST_CHECK(vector.size() == 6);
+        for (const auto& element : vector)
+            BOOST_CHECK(element.GetValue() == 5);
+
+        vector.resize(2);
+        BOOST_CHECK(Tracked::numInstances == 2);
+        vector.resize(4);
+        BOOST_CHECK(vector[3].GetValue() == 0);
+
+        vector[1] = Tracked(1);
+        vector[2] = Tracked(2);
+        auto iterator = vector.erase(vector.begin() + 1);
+        BOOST_CHECK(iterator->GetValue() == 2);
+        BOOST_CHECK(vector.size() == 3);
+        BOOST_CHECK(Tracked::numInstances == 3);
+
+        const size_t capacity = vector.capacity();
+        vector.clear();
+        BOOST_CHECK(vector.empty());
+        BOOST_CHECK(vector.capacity() == capacity);
+        BOOST_CHECK(Tracked::numInstances == 0);
+
+        vector.reserve(2 * capacity);
+        BOOST_CHECK(vector.capacity() == 2 * capacity);
+    }
+    BOOST_CHECK(Tracked::numInstances == 0);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Copy_and_Move)
+{
+    Tracked::numInstances = 0;
+    {
+        SmallVectorTPS<Tracked, 4> inlineVector = {1, 2, 3};
+        SmallVectorTPS<Tracked, 4> heapVector = {1, 2, 3, 4, 5, 6};
+
+        // Copy
+        SmallVectorTPS<Tracked, 4> copy(heapVector);
+        BOOST_CHECK(copy == heapVector);
+        copy = inlineVector;
+        BOOST_CHECK(copy == inlineVector);
+        BOOST_CHECK(copy != heapVector);
+        BOOST_CHECK(Tracked::numInstances == 12);
+
+        // Moving an inline vector moves the elements
+        SmallVectorTPS<Tracked, 4> movedInline(std::move(inlineVector));
+        BOOST_CHECK(movedInline.is_inline());
+        BOOST_CHECK(movedInline == copy);
+        BOOST_CHECK(inlineVector.empty());
+
+        // Moving an allocated vector steals the memory
+        const Tracked* data = heapVector.data();
+        SmallVectorTPS<Tracked, 4> movedHeap(std::move(heapVector));
+        BOOST_CHECK(movedHeap.data() == data);
+        BOOST_CHECK(heapVector.empty());
+        BOOST_CHECK(heapVector.is_inline());
+        BOOST_CHECK(heapVector.capacity() == 4);
+        BOOST_CHECK(Tracked::numInstances == 12);
+
+        // Move assignment frees the memory of the target
+        movedHeap = std::move(movedInline);
+        BOOST_CHECK(movedHeap.is_inline());
+        BOOST_CHECK(movedHeap == copy);
+        BOOST_CHECK(Tracked::numInstances == 6);
+
+        heapVector = SmallVectorTPS<Tracked, 4>(8, Tracked(3));
+        BOOST_CHECK(heapVector.size() == 8);
+        BOOST_CHECK(!heapVector.is_inline());
+    }
+    BOOST_CHECK(Tracked::numInstances == 0);
+
+    SmallVector<std::string, 2> strings = {"a", "b", "c"};
+    SmallVector<std::string, 2> movedStrings(std::move(strings));
+    BOOST_CHECK(movedStrings.back() == "c");
+}
@@ -0,0 +1,221 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/container/soaVector.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/base/simd/directAccess.h"
+#include "gdl/base/simd/intrinsics.h"
+
+
+using namespace GDL;
+using namespace GDL::simd;
+
+
+
+// Helper functions ---------------------------------------------------------------------------------------------------
+
+//! @brief Creates the values of an entry
+template <typename _registerType, U32 _numColumns>
+typename SoAVector<_registerType, _numColumns>::Entry CreateEntry(U32 index)
+{
+    typename SoAVector<_registerType, _numColumns>::Entry entry;
+    for (U32 i = 0; i < _numColumns; ++i)
+        entry[i] = static_cast<typename SoAVector<_registerType, _numColumns>::Type>(index * 10 + i + 1);
+    return entry;
+}
+
+
+
+//! @brief Checks that all values behind the last entry are zero
+template <typename _registerType, U32 _numColumns>
+void CheckPadding(const SoAVector<_registerType, _numColumns>& soa)
+{
+    constexpr U32 registerSize = SoAVector<_registerType, _numColumns>::NumRegisterValues;
+    for (U32 i = 0; i < _numColumns; ++i)
+        for (U32 j = soa.GetSize(); j < soa.GetNumRegisters() * registerSize; ++j)
+            BOOST_CHECK(soa.GetColumn(i)[j] == 0);
+}
+
+
+
+// Tests --------------------------------------------------------------------------------------------------------------
+
+template <typename _registerType>
+void TestConstructionAndResize()
+{
+    constexpr U32 numColumns = 3;
+    constexpr U32 registerSize = numRegisterValues<_registerType>;
+
+    SoAVector<_registerType, numColumns> empty;
+    BOOST_CHECK(empty.GetSize() == 0);
+    BOOST_CHECK(empty.GetNumRegisters() == 0);
+
+    SoAVector<_registerType, numColumns> soa(registerSize + 1);
+    BOOST_CHECK(soa.GetSize() == registerSize + 1);
+    BOOST_CHECK(soa.GetNumRegisters() == 2);
+    BOOST_CHECK(soa.GetCapacity() == 2 * registerSize);
+
+    for (U32 i = 0; i < numColumns; ++i)
+    {
+        BOOST_CHECK(IsAligned(soa.GetColumn(i), alignmentBytes<_registerType>));
+        for (U32 j = 0; j < soa.GetSize(); ++j)
+            BOOST_CHECK(soa(j, i) == 0);
+    }
+
+    for (U32 i = 0; i < soa.GetSize(); ++i)
+        soa.Set(i, CreateEntry<_registerType, numColumns>(i));
+
+    // Growing keeps the values
+    soa.Resize(5 * registerSize);
+    for (U32 i = 0; i < registerSize + 1; ++i)
+        BOOST_CHECK(soa.Get(i) == (CreateEntry<_registerType, numColumns>(i)));
+    for (U32 i = registerSize + 1; i < soa.GetSize(); ++i)
+        BOOST_CHECK(soa(i, 2) == 0);
+
+    // Shrinking resets the padding
+    soa.Resize(registerSize + 1);
+    CheckPadding(soa);
+
+    soa.Clear();
+    BOOST_CHECK(soa.GetSize() == 0);
+    BOOST_CHECK(soa.GetCapacity() == 5 * registerSize);
+    CheckPadding(soa);
+}
+
+BOOST_AUTO_TEST_CASE(Construction_and_Resize)
+{
+    TestConstructionAndResize<__m128>();
+    TestConstructionAndResize<__m128d>();
+#ifdef __AVX2__
+    TestConstructionAndResize<__m256>();
+    TestConstructionAndResize<__m256d>();
+#endif // __AVX2__
+}
+
+
+
+template <typename _registerType>
+void TestPushBackAndMove()
+{
+    constexpr U32 numColumns = 2;
+    constexpr U32 numEntries = 37;
+
+    SoAVector<_registerType, numColumns> soa;
+    for (U32 i = 0; i < numEntries; ++i)
+        soa.PushBack(CreateEntry<_registerType, numColumns>(i));
+
+    BOOST_CHECK(soa.GetSize() == numEntries);
+    for (U32 i = 0; i < numEntries; ++i)
+        BOOST_CHECK(soa.Get(i) == (CreateEntry<_registerType, numColumns>(i)));
+    CheckPadding(soa);
+
+    SoAVector<_registerType, numColumns> copy(soa);
+    BOOST_CHECK(copy.Get(numEntries - 1) == soa.Get(numEntries - 1));
+
+    SoAVector<_registerType, numColumns> moved(std::move(soa));
+    BOOST_CHECK(moved.GetSize() == numEntries);
+    BOOST_CHECK(moved.Get(numEntries - 1) == copy.Get(numEntries - 1));
+    BOOST_CHECK(soa.GetSize() == 0);
+    BOOST_CHECK(soa.GetCapacity() == 0);
+
+    soa = std::move(moved);
+    BOOST_CHECK(soa.GetSize() == numEntries);
+    BOOST_CHECK(moved.GetCapacity() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(PushBack_and_Move)
+{
+    TestPushBackAndMove<__m128>();
+    TestPushBackAndMove<__m128d>();
+#ifdef __AVX2__
+    TestPushBackAndMove<__m256>();
+    TestPushBackAndMove<__m256d>();
+#endif // __AVX2__
+}
+
+
+
+template <typename _registerType>
+void TestRegisterAccess()
+{
+    constexpr U32 numColumns = 3;
+    constexpr U32 registerSize = numRegisterValues<_registerType>;
+    using Type = decltype(GetDataType<_registerType>());
+
+    SoAVector<_registerType, numColumns> soa(2 * registerSize);
+    for (U32 i = 0; i < soa.GetSize(); ++i)
+        soa.Set(i, CreateEntry<_registerType, numColumns>(i));
+
+    // Add the first column to the last one
+    for (U32 i = 0; i < soa.GetNumRegisters(); ++i)
+        soa.StoreRegister(i, 2, _mm_add(soa.LoadRegister(i, 0), soa.LoadRegister(i, 2)));
+
+    for (U32 i = 0; i < soa.GetSize(); ++i)
+        BOOST_CHECK(soa(i, 2) == static_cast<Type>(i * 20 + 4));
+    BOOST_CHECK(GetValue(soa.GetColumnRegisters(1)[1], 0) == soa(registerSize, 1));
+}
+
+BOOST_AUTO_TEST_CASE(Register_Access)
+{
+    TestRegisterAccess<__m128>();
+    TestRegisterAccess<__m128d>();
+#ifdef __AVX2__
+    TestRegisterAccess<__m256>();
+    TestRegisterAccess<__m256d>();
+#endif // __AVX2__
+}
+
+
+
+template <typename _registerType, U32 _numColumns>
+void TestAoSBlocks()
+{
+    constexpr U32 registerSize = numRegisterValues<_registerType>;
+    constexpr U32 numEntries = registerSize + registerSize / 2;
+
+    SoAVector<_registerType, _numColumns> soa(numEntries);
+    for (U32 i = 0; i < numEntries; ++i)
+        soa.Set(i, CreateEntry<_registerType, _numColumns>(i));
+
+    // Load
+    for (U32 i = 0; i < soa.GetNumRegisters(); ++i)
+    {
+        auto block = soa.LoadAoSBlock(i);
+        for (U32 j = 0; j < registerSize; ++j)
+        {
+            const U32 index = i * registerSize + j;
+            for (U32 k = 0; k < _numColumns; ++k)
+                if (index < numEntries)
+                    BOOST_CHECK(GetValue(block[j], k) == soa(index, k));
+                else
+                    BOOST_CHECK(GetValue(block[j], k) == 0);
+        }
+    }
+
+    // Store
+    SoAVector<_registerType, _numColumns> other(numEntries);
+    for (U32 i = 0; i < soa.GetNumRegisters(); ++i)
+    {
+        auto block = soa.LoadAoSBlock(i);
+        for (auto& reg : block)
+            reg = _mm_add(reg, _mm_set1<_registerType>(1));
+        other.StoreAoSBlock(i, block);
+    }
+
+    for (U32 i = 0; i < numEntries; ++i)
+        for (U32 j = 0; j < _numColumns; ++j)
+            BOOST_CHECK(other(i, j) == soa(i, j) + 1);
+    CheckPadding(other);
+}
+
+BOOST_AUTO_TEST_CASE(AoS_Blocks)
+{
+    TestAoSBlocks<__m128, 1>();
+    TestAoSBlocks<__m128, 3>();
+    TestAoSBlocks<__m128, 4>();
+    TestAoSBlocks<__m128d, 2>();
+#ifdef __AVX2__
+    TestAoSBlocks<__m256, 3>();
+    TestAoSBlocks<__m256, 8>();
+    TestAoSBlocks<__m256d, 3>();
+#endif // __AVX2__
+}
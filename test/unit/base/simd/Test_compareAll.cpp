@@ -110,6 +110,10 @@ BOOST_AUTO_TEST_CASE(All_Equal)
     TestCompareAllEqual<__m256>();
     TestCompareAllEqual<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestCompareAllEqual<__m512>();
+    TestCompareAllEqual<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -216,6 +220,10 @@ BOOST_AUTO_TEST_CASE(All_Less_Equal)
     TestCompareAllLessEqual<__m256>();
     TestCompareAllLessEqual<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestCompareAllLessEqual<__m512>();
+    TestCompareAllLessEqual<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -316,6 +324,10 @@ BOOST_AUTO_TEST_CASE(All_Greater_Than)
     TestCompareAllGreaterThan<__m256>();
     TestCompareAllGreaterThan<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestCompareAllGreaterThan<__m512>();
+    TestCompareAllGreaterThan<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -416,6 +428,10 @@ BOOST_AUTO_TEST_CASE(All_Less_Than)
     TestCompareAllLessThan<__m256>();
     TestCompareAllLessThan<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestCompareAllLessThan<__m512>();
+    TestCompareAllLessThan<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -455,4 +471,8 @@ BOOST_AUTO_TEST_CASE(Memory_Zero)
     TestCompareMemoryZero<__m256>();
     TestCompareMemoryZero<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestCompareMemoryZero<__m512>();
+    TestCompareMemoryZero<__m512d>();
+#endif // __AVX512F__
 }
@@ -84,6 +84,17 @@ void TestSetValue()
         simd::SetValue<6>(reg1, 7);
         simd::SetValue<7>(reg1, 8);
     }
+    if constexpr (simd::numRegisterValues<_registerType>> 8)
+    {
+        simd::SetValue<8>(reg1, 9);
+        simd::SetValue<9>(reg1, 10);
+        simd::SetValue<10>(reg1, 11);
+        simd::SetValue<11>(reg1, 12);
+        simd::SetValue<12>(reg1, 13);
+        simd::SetValue<13>(reg1, 14);
+        simd::SetValue<14>(reg1, 15);
+        simd::SetValue<15>(reg1, 16);
+    }
 
     BOOST_CHECK(reg1 != ApproxZero<_registerType>());
 
@@ -116,4 +127,8 @@ BOOST_AUTO_TEST_CASE(Set_Value)
     TestSetValue<__m256>();
     TestSetValue<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestSetValue<__m512>();
+    TestSetValue<__m512d>();
+#endif // __AVX512F__
 }
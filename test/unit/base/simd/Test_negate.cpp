@@ -138,4 +138,8 @@ BOOST_AUTO_TEST_CASE(Test_Negate_All)
     TestNegateAll<__m256>();
     TestNegateAll<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestNegateAll<__m512>();
+    TestNegateAll<__m512d>();
+#endif // __AVX512F__
 }
@@ -66,6 +66,23 @@ BOOST_AUTO_TEST_CASE(Register_sum_m256d)
 #endif // __AVX2__
 
 
+#ifdef __AVX512F__
+
+BOOST_AUTO_TEST_CASE(Register_sum_m512)
+{
+    TestRegisterSum<__m512>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Register_sum_m512d)
+{
+    TestRegisterSum<__m512d>();
+}
+
+#endif // __AVX512F__
+
+
 
 // Test register array sum  -------------------------------------------------------------------------------------------
 
@@ -151,6 +168,23 @@ BOOST_AUTO_TEST_CASE(Register_Array_Sum_m256d)
 #endif //__AVX2__
 
 
+#ifdef __AVX512F__
+
+BOOST_AUTO_TEST_CASE(Register_Array_Sum_m512)
+{
+    TestRegisterArraySum<__m512>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Register_Array_Sum_m512d)
+{
+    TestRegisterArraySum<__m512d>();
+}
+
+#endif // __AVX512F__
+
+
 
 // Test register array square sum  ------------------------------------------------------------------------------------
 
@@ -235,6 +269,23 @@ BOOST_AUTO_TEST_CASE(Register_Array_SquareSum_m256d)
 #endif //__AVX2__
 
 
+#ifdef __AVX512F__
+
+BOOST_AUTO_TEST_CASE(Register_Array_SquareSum_m512)
+{
+    TestRegisterArraySquareSum<__m512>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Register_Array_SquareSum_m512d)
+{
+    TestRegisterArraySquareSum<__m512d>();
+}
+
+#endif // __AVX512F__
+
+
 
 // Test register multi sum --------------------------------------------------------------------------------------------
 
@@ -290,3 +341,20 @@ BOOST_AUTO_TEST_CASE(Register_Multi_Sum_m256)
 }
 
 #endif
+
+
+#ifdef __AVX512F__
+
+BOOST_AUTO_TEST_CASE(Register_Multi_Sum_m512d)
+{
+    TestRegisterMultiSum<__m512d>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Register_Multi_Sum_m512)
+{
+    TestRegisterMultiSum<__m512>();
+}
+
+#endif // __AVX512F__
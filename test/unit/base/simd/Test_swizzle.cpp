@@ -218,6 +218,10 @@ BOOST_AUTO_TEST_CASE(Test_Blend_Index)
     TestBlendIndex<__m256>();
     TestBlendIndex<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestBlendIndex<__m512>();
+    TestBlendIndex<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -253,6 +257,10 @@ BOOST_AUTO_TEST_CASE(Test_Blend_Above_Index)
     TestBlendAboveIndex<__m256>();
     TestBlendAboveIndex<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestBlendAboveIndex<__m512>();
+    TestBlendAboveIndex<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -288,6 +296,10 @@ BOOST_AUTO_TEST_CASE(Test_Blend_Below_Index)
     TestBlendBelowIndex<__m256>();
     TestBlendBelowIndex<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestBlendBelowIndex<__m512>();
+    TestBlendBelowIndex<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -325,6 +337,10 @@ BOOST_AUTO_TEST_CASE(Test_Blend_In_Range)
     TestBlendInRange<__m256>();
     TestBlendInRange<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestBlendInRange<__m512>();
+    TestBlendInRange<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -423,6 +439,10 @@ BOOST_AUTO_TEST_CASE(Test_Broadcast_Across_Lanes)
     TestBroadcastAcrossLanes<__m256>();
     TestBroadcastAcrossLanes<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestBroadcastAcrossLanes<__m512>();
+    TestBroadcastAcrossLanes<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -492,6 +512,18 @@ void TestExchange()
         TestExchangeTest<_registerType, _idx0, 7>();
     }
 
+    if constexpr (numRegVals > 8)
+    {
+        TestExchangeTest<_registerType, _idx0, 8>();
+        TestExchangeTest<_registerType, _idx0, 9>();
+        TestExchangeTest<_registerType, _idx0, 10>();
+        TestExchangeTest<_registerType, _idx0, 11>();
+        TestExchangeTest<_registerType, _idx0, 12>();
+        TestExchangeTest<_registerType, _idx0, 13>();
+        TestExchangeTest<_registerType, _idx0, 14>();
+        TestExchangeTest<_registerType, _idx0, 15>();
+    }
+
     if constexpr (_idx0 + 1 < numRegVals)
         TestExchange<_registerType, _idx0 + 1>();
 }
@@ -506,6 +538,10 @@ BOOST_AUTO_TEST_CASE(Test_Exchange)
     TestExchange<__m256>();
     TestExchange<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestExchange<__m512>();
+    TestExchange<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -1093,6 +1129,26 @@ void TestSwap()
             TestSwapTest<_registerType, _idx0, 7>();
     }
 
+    if constexpr (numRegVals > 8)
+    {
+        if constexpr (_idx0 != 8)
+            TestSwapTest<_registerType, _idx0, 8>();
+        if constexpr (_idx0 != 9)
+            TestSwapTest<_registerType, _idx0, 9>();
+        if constexpr (_idx0 != 10)
+            TestSwapTest<_registerType, _idx0, 10>();
+        if constexpr (_idx0 != 11)
+            TestSwapTest<_registerType, _idx0, 11>();
+        if constexpr (_idx0 != 12)
+            TestSwapTest<_registerType, _idx0, 12>();
+        if constexpr (_idx0 != 13)
+            TestSwapTest<_registerType, _idx0, 13>();
+        if constexpr (_idx0 != 14)
+            TestSwapTest<_registerType, _idx0, 14>();
+        if constexpr (_idx0 != 15)
+            TestSwapTest<_registerType, _idx0, 15>();
+    }
+
 
     if constexpr (_idx0 + 1 < numRegVals)
         TestSwap<_registerType, _idx0 + 1>();
@@ -1107,6 +1163,10 @@ BOOST_AUTO_TEST_CASE(Test_Swap)
     TestSwap<__m256>();
     TestSwap<__m256d>();
 #endif // __AVX2__
+#ifdef __AVX512F__
+    TestSwap<__m512>();
+    TestSwap<__m512d>();
+#endif // __AVX512F__
 }
 
 
@@ -0,0 +1,26 @@
+#include <boost/test/unit_test.hpp>
+
+
+#include "gdl/base/simd/_transpose/transpose_m512.h"
+#include "test/unit/base/simd/transpose_test_template_register.h"
+
+
+
+#ifdef __AVX512F__
+
+// Transpose 16x16 ----------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Test_transpose16x16)
+{
+    TestTranspose<__m512, 16, 16>();
+}
+
+
+
+#else // __AVX512F__
+
+BOOST_AUTO_TEST_CASE(No_test)
+{
+}
+
+#endif // __AVX512F__
@@ -0,0 +1,26 @@
+#include <boost/test/unit_test.hpp>
+
+
+#include "gdl/base/simd/_transpose/transpose_m512d.h"
+#include "test/unit/base/simd/transpose_test_template_register.h"
+
+
+
+#ifdef __AVX512F__
+
+// Transpose 8x8 ------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Test_transpose8x8)
+{
+    TestTranspose<__m512d, 8, 8>();
+}
+
+
+
+#else // __AVX512F__
+
+BOOST_AUTO_TEST_CASE(No_test)
+{
+}
+
+#endif // __AVX512F__
@@ -17,4 +17,13 @@ BOOST_AUTO_TEST_CASE(Calc_Min_Num_Array_Registers)
     BOOST_CHECK(simd::CalcMinNumArrayRegisters<__m256d>(13) == 4);
     BOOST_CHECK(simd::CalcMinNumArrayRegisters<__m256d>(4) == 1);
 #endif // __AVX2__
+#ifdef __AVX512F__
+    BOOST_CHECK(simd::CalcMinNumArrayRegisters<__m512>(13) == 1);
+    BOOST_CHECK(simd::CalcMinNumArrayRegisters<__m512>(17) == 2);
+    BOOST_CHECK(simd::CalcMinNumArrayRegisters<__m512d>(13) == 2);
+    BOOST_CHECK(simd::CalcMinNumArrayRegisters<__m512d>(4) == 1);
+#endif // __AVX512F__
 }
+
+
+
@@ -243,6 +243,19 @@ void Transpose8x8(__m256, __m256, __m256, __m256, __m256, __m256, __m256, __m256
                   __m256&, __m256&, __m256&, __m256&) noexcept;
 #endif // __AVX2__
 
+#ifdef __AVX512F__
+// __m512d
+template <U32, U32, bool, bool>
+void Transpose8x8(__m512d, __m512d, __m512d, __m512d, __m512d, __m512d, __m512d, __m512d, __m512d&, __m512d&, __m512d&,
+                  __m512d&, __m512d&, __m512d&, __m512d&, __m512d&) noexcept;
+
+// __m512
+template <U32, U32, bool, bool>
+void Transpose16x16(__m512, __m512, __m512, __m512, __m512, __m512, __m512, __m512, __m512, __m512, __m512, __m512,
+                    __m512, __m512, __m512, __m512, __m512&, __m512&, __m512&, __m512&, __m512&, __m512&, __m512&,
+                    __m512&, __m512&, __m512&, __m512&, __m512&, __m512&, __m512&, __m512&, __m512&) noexcept;
+#endif // __AVX512F__
+
 } // namespace GDL::simd
 
 
@@ -347,6 +360,7 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 4)
             Transpose1x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3],
                                                                                       out[0]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose1x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3], in[4],
                                                                                       out[0]);
@@ -359,6 +373,7 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 8)
             Transpose1x8<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3], in[4],
                                                                                       in[5], in[6], in[7], out[0]);
+#endif // __AVX2__
     }
     else if constexpr (_rows == 2)
     {
@@ -372,6 +387,7 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 4)
             Transpose2x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3],
                                                                                       out[0], out[1]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose2x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3], in[4],
                                                                                       out[0], out[1]);
@@ -384,6 +400,7 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 8)
             Transpose2x8<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], out[0], out[1]);
+#endif // __AVX2__
     }
     else if constexpr (_rows == 3)
     {
@@ -398,6 +415,7 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 4)
             Transpose3x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3],
                                                                                       out[0], out[1], out[2]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose3x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3], in[4],
                                                                                       out[0], out[1], out[2]);
@@ -410,6 +428,7 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 8)
             Transpose3x8<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], out[0], out[1], out[2]);
+#endif // __AVX2__
     }
     else if constexpr (_rows == 4)
     {
@@ -425,6 +444,7 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 4)
             Transpose4x4<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3],
                                                                                       out[0], out[1], out[2], out[3]);
+#ifdef __AVX2__
         else if constexpr (_cols == 5)
             Transpose4x5<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(in[0], in[1], in[2], in[3], in[4],
                                                                                       out[0], out[1], out[2], out[3]);
@@ -437,7 +457,9 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
         else if constexpr (_cols == 8)
             Transpose4x8<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
                     in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], out[0], out[1], out[2], out[3]);
+#endif // __AVX2__
     }
+#ifdef __AVX2__
     else if constexpr (_rows == 5)
     {
         if constexpr (_cols == 1)
@@ -552,6 +574,17 @@ void TransposeData(std::array<_registerType, _cols>& in, std::array<_registerTyp
                     in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], out[0], out[1], out[2], out[3], out[4],
                     out[5], out[6], out[7]);
     }
+#endif // __AVX2__
+#ifdef __AVX512F__
+    else if constexpr (_rows == 16)
+    {
+        if constexpr (_cols == 16)
+            Transpose16x16<_firstRowIn, _firstRowOut, _overwriteUnused, _unusedSetZero>(
+                    in[0], in[1], in[2], in[3], in[4], in[5], in[6], in[7], in[8], in[9], in[10], in[11], in[12],
+                    in[13], in[14], in[15], out[0], out[1], out[2], out[3], out[4], out[5], out[6], out[7], out[8],
+                    out[9], out[10], out[11], out[12], out[13], out[14], out[15]);
+    }
+#endif // __AVX512F__
 }
 
 
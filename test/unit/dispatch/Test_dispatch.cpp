@@ -0,0 +1,242 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/approx.h"
+#include "gdl/base/exception.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/dispatch/kernels.h"
+#include "gdl/math/serial/matSerial.h"
+#include "gdl/math/simd/vec2fSSE.h"
+#include "gdl/math/simd/vec3fSSE.h"
+#include "gdl/physics/collision/functions/orientation.h"
+#include "gdl/physics/collision/functions/pointAreaTests.h"
+#include "gdl/physics/collision/functions/pointVolumeTests.h"
+
+#include <array>
+#include <vector>
+
+
+using namespace GDL;
+using namespace GDL::simd;
+
+
+
+// Helper functions ---------------------------------------------------------------------------------------------------
+
+//! @brief Gets all instruction sets that are supported by the CPU
+std::vector<InstructionSet> GetSupportedInstructionSets()
+{
+    std::vector<InstructionSet> instructionSets;
+    for (InstructionSet instructionSet : {InstructionSet::SSE4_2, InstructionSet::AVX2, InstructionSet::AVX512})
+        if (IsSupported(instructionSet))
+            instructionSets.push_back(instructionSet);
+    return instructionSets;
+}
+
+
+
+//! @brief Creates a matrix with small integer values, so that all tested operations are exact
+template <typename _type, U32 _size>
+std::array<_type, _size * _size> CreateMatrix(U32 seed)
+{
+    std::array<_type, _size * _size> data;
+    for (U32 i = 0; i < data.size(); ++i)
+        data[i] = static_cast<_type>(static_cast<I32>((i * 7 + seed) % 11) - 5);
+    return data;
+}
+
+
+
+//! @brief Creates a diagonally dominant matrix
+template <typename _type, U32 _size>
+std::array<_type, _size * _size> CreateSystemMatrix()
+{
+    std::array<_type, _size * _size> data = CreateMatrix<_type, _size>(3);
+    for (U32 i = 0; i < _size; ++i)
+        data[i * _size + i] = static_cast<_type>(6 * _size);
+    return data;
+}
+
+
+
+// Tests --------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Instruction_Set_Selection)
+{
+    const InstructionSet supported = GetSupportedInstructionSet();
+    BOOST_CHECK(IsSupported(InstructionSet::SSE4_2));
+    BOOST_CHECK(IsSupported(supported));
+    BOOST_CHECK(GetInstructionSet(GetName(supported)) == supported);
+    BOOST_CHECK_THROW([[maybe_unused]] auto unknown = GetInstructionSet(std::string("SSE2")), Exception);
+
+    for (InstructionSet instructionSet : GetSupportedInstructionSets())
+    {
+        Dispatch::SetInstructionSet(instructionSet);
+        BOOST_CHECK(Dispatch::GetInstructionSet() == instructionSet);
+    }
+
+    if (supported != InstructionSet::AVX512)
+        BOOST_CHECK_THROW(Dispatch::SetInstructionSet(InstructionSet::AVX512), Exception);
+
+    Dispatch::ResetInstructionSet();
+    BOOST_CHECK(IsSupported(Dispatch::GetInstructionSet()));
+}
+
+
+
+template <typename _type, U32 _size>
+void TestMatrixKernels()
+{
+    const auto lhs = CreateMatrix<_type, _size>(0);
+    const auto rhs = CreateMatrix<_type, _size>(5);
+
+    const auto expMultiply = (MatSerial<_type, _size, _size>(lhs) * MatSerial<_type, _size, _size>(rhs)).Data();
+    const auto expTranspose = MatSerial<_type, _size, _size>(lhs).Transpose().Data();
+
+    for (InstructionSet instructionSet : GetSupportedInstructionSets())
+    {
+        Dispatch::SetInstructionSet(instructionSet);
+
+        const auto multiply = Dispatch::Multiply<_type, _size>(lhs, rhs);
+        const auto transpose = Dispatch::Transpose<_type, _size>(lhs);
+        for (U32 i = 0; i < _size * _size; ++i)
+        {
+            BOOST_CHECK(multiply[i] == Approx(expMultiply[i]));
+            BOOST_CHECK(transpose[i] == Approx(expTranspose[i]));
+        }
+    }
+    Dispatch::ResetInstructionSet();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Matrix_Kernels)
+{
+    TestMatrixKernels<F32, 4>();
+    TestMatrixKernels<F32, 16>();
+    TestMatrixKernels<F32, 64>();
+    TestMatrixKernels<F64, 8>();
+    TestMatrixKernels<F64, 32>();
+}
+
+
+
+template <typename _type, U32 _size>
+void TestSolverKernels()
+{
+    using namespace GDL::Solver;
+
+    const auto A = CreateSystemMatrix<_type, _size>();
+    std::array<_type, _size> exp;
+    for (U32 i = 0; i < _size; ++i)
+        exp[i] = static_cast<_type>(static_cast<I32>(i % 5) - 2);
+
+    std::array<_type, _size> r = {{0}};
+    for (U32 i = 0; i < _size; ++i)
+        for (U32 j = 0; j < _size; ++j)
+            r[i] += A[j * _size + i] * exp[j];
+
+    for (InstructionSet instructionSet : GetSupportedInstructionSets())
+    {
+        Dispatch::SetInstructionSet(instructionSet);
+
+        const std::array<std::array<_type, _size>, 4> results = {{Dispatch::Gauss<Pivot::NONE, _type, _size>(A, r),
+                                                                   Dispatch::Gauss<Pivot::PARTIAL, _type, _size>(A, r),
+                                                                   Dispatch::LU<Pivot::NONE, _type, _size>(A, r),
+                                                                   Dispatch::LU<Pivot::PARTIAL, _type, _size>(A, r)}};
+        for (const auto& result : results)
+            for (U32 i = 0; i < _size; ++i)
+                BOOST_CHECK(result[i] == Approx(exp[i], 100 * _size));
+    }
+    Dispatch::ResetInstructionSet();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Solver_Kernels)
+{
+    TestSolverKernels<F32, 4>();
+    TestSolverKernels<F32, 16>();
+    TestSolverKernels<F32, 32>();
+    TestSolverKernels<F64, 8>();
+    TestSolverKernels<F64, 64>();
+}
+
+
+
+#ifndef NDEVEXCEPTION
+BOOST_AUTO_TEST_CASE(Solver_Kernels_Exceptions)
+{
+    using namespace GDL::Solver;
+
+    const std::array<F32, 16> A = {{0}};
+    const std::array<F32, 4> r = {{1, 2, 3, 4}};
+    const auto gauss = Dispatch::Gauss<Pivot::PARTIAL, F32, 4>;
+
+    for (InstructionSet instructionSet : GetSupportedInstructionSets())
+    {
+        Dispatch::SetInstructionSet(instructionSet);
+        BOOST_CHECK_THROW([[maybe_unused]] auto result = gauss(A, r), Exception);
+    }
+    Dispatch::ResetInstructionSet();
+}
+#endif // NDEVEXCEPTION
+
+
+
+BOOST_AUTO_TEST_CASE(Collision_Kernels)
+{
+    constexpr U32 numPoints = 20;
+
+    std::array<std::array<F32, 2>, numPoints> points2;
+    std::array<std::array<F32, 3>, numPoints> points3;
+    for (U32 i = 0; i < numPoints; ++i)
+    {
+        const F32 x = static_cast<F32>(static_cast<I32>(i % 7) - 3);
+        const F32 y = static_cast<F32>(static_cast<I32>(i % 5) - 2);
+        const F32 z = static_cast<F32>(static_cast<I32>(i % 3) - 1);
+        points2[i] = {{x, y}};
+        points3[i] = {{x, y, z}};
+    }
+
+    const std::array<std::array<F32, 2>, 3> circle = {{{{2, 0}}, {{0, 2}}, {{-2, 0}}}};
+    const std::array<std::array<F32, 3>, 4> sphere = {{{{0, 2, 0}}, {{2, 0, 0}}, {{-2, 0, 0}}, {{0, 0, 2}}}};
+    BOOST_REQUIRE(Orientation(Vec3fSSE(sphere[0]), Vec3fSSE(sphere[1]), Vec3fSSE(sphere[2]), Vec3fSSE(sphere[3])) > 0);
+
+    std::array<F32, numPoints> expOrientation2;
+    std::array<F32, numPoints> expOrientation3;
+    std::array<F32, numPoints> expCircle;
+    std::array<F32, numPoints> expSphere;
+    for (U32 i = 0; i < numPoints; ++i)
+    {
+        expOrientation2[i] = Orientation(Vec2fSSE(circle[0]), Vec2fSSE(circle[1]), Vec2fSSE(points2[i]));
+        expOrientation3[i] = Orientation(Vec3fSSE(sphere[0]), Vec3fSSE(sphere[1]), Vec3fSSE(sphere[2]),
+                                         Vec3fSSE(points3[i]));
+        expCircle[i] = PointInsideCircle(Vec2fSSE(points2[i]), Vec2fSSE(circle[0]), Vec2fSSE(circle[1]),
+                                         Vec2fSSE(circle[2]));
+        expSphere[i] = PointInsideSphere(Vec3fSSE(points3[i]), Vec3fSSE(sphere[0]), Vec3fSSE(sphere[1]),
+                                         Vec3fSSE(sphere[2]), Vec3fSSE(sphere[3]));
+    }
+
+    for (InstructionSet instructionSet : GetSupportedInstructionSets())
+    {
+        Dispatch::SetInstructionSet(instructionSet);
+
+        std::array<F32, numPoints> orientation2;
+        std::array<F32, numPoints> orientation3;
+        std::array<F32, numPoints> insideCircle;
+        std::array<F32, numPoints> insideSphere;
+        Dispatch::Orientation(circle[0], circle[1], points2.data(), numPoints, orientation2.data());
+        Dispatch::Orientation(sphere[0], sphere[1], sphere[2], points3.data(), numPoints, orientation3.data());
+        Dispatch::PointInsideCircle(circle, points2.data(), numPoints, insideCircle.data());
+        Dispatch::PointInsideSphere(sphere, points3.data(), numPoints, insideSphere.data());
+
+        for (U32 i = 0; i < numPoints; ++i)
+        {
+            BOOST_CHECK(orientation2[i] == Approx(expOrientation2[i]));
+            BOOST_CHECK(orientation3[i] == Approx(expOrientation3[i]));
+            BOOST_CHECK(insideCircle[i] == Approx(expCircle[i]));
+            BOOST_CHECK(insideSphere[i] == Approx(expSphere[i]));
+        }
+    }
+    Dispatch::ResetInstructionSet();
+}
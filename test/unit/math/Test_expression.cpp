@@ -0,0 +1,319 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/math/serial/matSerial.h"
+#include "gdl/math/serial/vecSerial.h"
+#include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/vecSIMD.h"
+
+#include "test/tools/arrayValueComparison.h"
+
+#include <array>
+
+
+using namespace GDL;
+
+
+
+// Helper functions ---------------------------------------------------------------------------------------------------
+
+//! @brief Creates an array with pseudo random values that are exactly representable, so that the results of all
+//! evaluation orders are identical
+template <typename _type, U32 _size>
+std::array<_type, _size> CreateValues(U32 seed)
+{
+    std::array<_type, _size> values;
+    for (U32 i = 0; i < _size; ++i)
+        values[i] = static_cast<_type>(static_cast<I32>((i * 7 + seed * 13) % 23) - 11) / static_cast<_type>(4);
+    return values;
+}
+
+
+
+//! @brief Calculates the column major reference result of lhs * rhs + add
+template <typename _type, U32 _rows, U32 _inner, U32 _cols>
+std::array<_type, _rows * _cols> ReferenceProduct(const std::array<_type, _rows * _inner>& lhs,
+                                                  const std::array<_type, _inner * _cols>& rhs,
+                                                  const std::array<_type, _rows * _cols>& add, _type factor = 1)
+{
+    std::array<_type, _rows * _cols> result = add;
+    for (U32 i = 0; i < _cols; ++i)
+        for (U32 j = 0; j < _inner; ++j)
+            for (U32 k = 0; k < _rows; ++k)
+                result[i * _rows + k] += factor * lhs[j * _rows + k] * rhs[i * _inner + j];
+    return result;
+}
+
+
+
+// Element-wise operations --------------------------------------------------------------------------------------------
+
+template <template <typename, U32, U32> class _matrix, template <typename, U32, bool> class _vector, typename _type,
+          U32 _rows, U32 _cols>
+void ElementWiseTest()
+{
+    auto valA = CreateValues<_type, _rows * _cols>(1);
+    auto valB = CreateValues<_type, _rows * _cols>(2);
+    auto valC = CreateValues<_type, _rows * _cols>(3);
+    _matrix<_type, _rows, _cols> A(valA);
+    _matrix<_type, _rows, _cols> B(valB);
+    _matrix<_type, _rows, _cols> C(valC);
+
+    std::array<_type, _rows * _cols> expSum;
+    std::array<_type, _rows * _cols> expDifference;
+    std::array<_type, _rows * _cols> expScaled;
+    for (U32 i = 0; i < _rows * _cols; ++i)
+    {
+        expSum[i] = valA[i] + valB[i] + valC[i];
+        expDifference[i] = valA[i] - valB[i];
+        expScaled[i] = 2 * valA[i] - valB[i] * static_cast<_type>(0.5) + valC[i];
+    }
+
+    _matrix<_type, _rows, _cols> sum = Lazy(A) + B + C;
+    BOOST_CHECK(CheckCloseArray(sum.Data(), expSum));
+    BOOST_CHECK(sum == (A + B) + C);
+
+    _matrix<_type, _rows, _cols> difference = Lazy(A) - B;
+    BOOST_CHECK(CheckCloseArray(difference.Data(), expDifference));
+
+    _matrix<_type, _rows, _cols> scaled = 2 * Lazy(A) - Lazy(B) * 0.5 + C;
+    BOOST_CHECK(CheckCloseArray(scaled.Data(), expScaled));
+
+    // destination is an operand
+    A = Lazy(A) + B + C;
+    BOOST_CHECK(CheckCloseArray(A.Data(), expSum));
+
+
+    auto valX = CreateValues<_type, _rows>(4);
+    auto valY = CreateValues<_type, _rows>(5);
+    _vector<_type, _rows, true> x(valX);
+    _vector<_type, _rows, true> y(valY);
+
+    std::array<_type, _rows> expVec;
+    for (U32 i = 0; i < _rows; ++i)
+        expVec[i] = valX[i] - 3 * valY[i];
+
+    _vector<_type, _rows, true> z = x - 3 * Lazy(y);
+    BOOST_CHECK(CheckCloseArray(z.Data(), expVec));
+
+    y = Lazy(x) - Lazy(y) * 3;
+    BOOST_CHECK(CheckCloseArray(y.Data(), expVec));
+
+
+    // row vectors
+    auto valR = CreateValues<_type, _cols>(6);
+    auto valS = CreateValues<_type, _cols>(7);
+    _vector<_type, _cols, false> r(valR);
+    _vector<_type, _cols, false> s(valS);
+
+    std::array<_type, _cols> expRow;
+    for (U32 i = 0; i < _cols; ++i)
+        expRow[i] = valR[i] + 2 * valS[i];
+
+    _vector<_type, _cols, false> t = Lazy(r) + Lazy(s) * 2;
+    BOOST_CHECK(CheckCloseArray(t.Data(), expRow));
+}
+
+
+
+template <template <typename, U32, U32> class _matrix, template <typename, U32, bool> class _vector, typename _type>
+void ElementWiseTestAllSizes()
+{
+    ElementWiseTest<_matrix, _vector, _type, 1, 1>();
+    ElementWiseTest<_matrix, _vector, _type, 3, 5>();
+    ElementWiseTest<_matrix, _vector, _type, 8, 3>();
+    ElementWiseTest<_matrix, _vector, _type, 17, 4>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Element_Wise_Serial)
+{
+    ElementWiseTestAllSizes<MatSerial, VecSerial, F32>();
+    ElementWiseTestAllSizes<MatSerial, VecSerial, F64>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Element_Wise_SSE)
+{
+    ElementWiseTestAllSizes<MatSIMD, VecSIMD, F32>();
+    ElementWiseTestAllSizes<MatSIMD, VecSIMD, F64>();
+}
+
+
+
+// Matrix - vector products -------------------------------------------------------------------------------------------
+
+template <template <typename, U32, U32> class _matrix, template <typename, U32, bool> class _vector, typename _type,
+          U32 _rows, U32 _cols>
+void MatrixVectorTest()
+{
+    auto valA = CreateValues<_type, _rows * _cols>(1);
+    auto valX = CreateValues<_type, _cols>(2);
+    auto valB = CreateValues<_type, _rows>(3);
+    _matrix<_type, _rows, _cols> A(valA);
+    _vector<_type, _cols, true> x(valX);
+    _vector<_type, _rows, true> b(valB);
+
+    _vector<_type, _rows, true> product = Lazy(A) * x;
+    BOOST_CHECK(CheckCloseArray(product.Data(), ReferenceProduct<_type, _rows, _cols, 1>(valA, valX, {{0}})));
+
+    _vector<_type, _rows, true> fma = Lazy(A) * x + b;
+    BOOST_CHECK(CheckCloseArray(fma.Data(), ReferenceProduct<_type, _rows, _cols, 1>(valA, valX, valB)));
+
+    _vector<_type, _rows, true> fms = b - 2 * (Lazy(A) * x);
+    BOOST_CHECK(CheckCloseArray(fms.Data(), ReferenceProduct<_type, _rows, _cols, 1>(valA, valX, valB, -2)));
+
+    _vector<_type, _rows, true> scaledSum = (Lazy(A) * x) * 0.5 + b + b;
+    std::array<_type, _rows> expScaledSum = ReferenceProduct<_type, _rows, _cols, 1>(valA, valX, valB, 0.5);
+    for (U32 i = 0; i < _rows; ++i)
+        expScaledSum[i] += valB[i];
+    BOOST_CHECK(CheckCloseArray(scaledSum.Data(), expScaledSum));
+}
+
+
+
+template <template <typename, U32, U32> class _matrix, template <typename, U32, bool> class _vector, typename _type>
+void MatrixVectorTestAllSizes()
+{
+    MatrixVectorTest<_matrix, _vector, _type, 1, 1>();
+    MatrixVectorTest<_matrix, _vector, _type, 3, 5>();
+    MatrixVectorTest<_matrix, _vector, _type, 7, 2>();
+    MatrixVectorTest<_matrix, _vector, _type, 16, 16>();
+    MatrixVectorTest<_matrix, _vector, _type, 37, 11>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Matrix_Vector_Serial)
+{
+    MatrixVectorTestAllSizes<MatSerial, VecSerial, F32>();
+    MatrixVectorTestAllSizes<MatSerial, VecSerial, F64>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Matrix_Vector_SSE)
+{
+    MatrixVectorTestAllSizes<MatSIMD, VecSIMD, F32>();
+    MatrixVectorTestAllSizes<MatSIMD, VecSIMD, F64>();
+}
+
+
+
+// Matrix - matrix products -------------------------------------------------------------------------------------------
+
+template <template <typename, U32, U32> class _matrix, typename _type, U32 _rows, U32 _inner, U32 _cols>
+void MatrixMatrixTest()
+{
+    auto valA = CreateValues<_type, _rows * _inner>(1);
+    auto valB = CreateValues<_type, _inner * _cols>(2);
+    auto valC = CreateValues<_type, _rows * _cols>(3);
+    auto valD = CreateValues<_type, _rows * _inner>(4);
+    _matrix<_type, _rows, _inner> A(valA);
+    _matrix<_type, _inner, _cols> B(valB);
+    _matrix<_type, _rows, _cols> C(valC);
+    _matrix<_type, _rows, _inner> D(valD);
+
+    _matrix<_type, _rows, _cols> fma = Lazy(A) * B + C;
+    BOOST_CHECK(CheckCloseArray(fma.Data(), ReferenceProduct<_type, _rows, _inner, _cols>(valA, valB, valC)));
+    BOOST_CHECK(fma == A * B + C);
+
+    _matrix<_type, _rows, _cols> fms = C - Lazy(A) * B * 3;
+    BOOST_CHECK(CheckCloseArray(fms.Data(), ReferenceProduct<_type, _rows, _inner, _cols>(valA, valB, valC, -3)));
+
+    // Operand that is not a leaf
+    std::array<_type, _rows * _inner> valAD;
+    for (U32 i = 0; i < _rows * _inner; ++i)
+        valAD[i] = valA[i] + valD[i];
+
+    _matrix<_type, _rows, _cols> sumProduct = (Lazy(A) + D) * B + C;
+    BOOST_CHECK(CheckCloseArray(sumProduct.Data(), ReferenceProduct<_type, _rows, _inner, _cols>(valAD, valB, valC)));
+}
+
+
+
+template <template <typename, U32, U32> class _matrix, typename _type>
+void MatrixMatrixTestAllSizes()
+{
+    MatrixMatrixTest<_matrix, _type, 1, 1, 1>();
+    MatrixMatrixTest<_matrix, _type, 4, 4, 4>();
+    MatrixMatrixTest<_matrix, _type, 5, 3, 6>();
+    MatrixMatrixTest<_matrix, _type, 13, 9, 2>();
+    // large enough to use the GEMM kernel
+    MatrixMatrixTest<_matrix, _type, 100, 97, 101>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Matrix_Matrix_Serial)
+{
+    MatrixMatrixTestAllSizes<MatSerial, F32>();
+    MatrixMatrixTestAllSizes<MatSerial, F64>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Matrix_Matrix_SSE)
+{
+    MatrixMatrixTestAllSizes<MatSIMD, F32>();
+    MatrixMatrixTestAllSizes<MatSIMD, F64>();
+}
+
+
+
+// Aliasing -----------------------------------------------------------------------------------------------------------
+
+template <template <typename, U32, U32> class _matrix, template <typename, U32, bool> class _vector, typename _type,
+          U32 _size>
+void AliasingTest()
+{
+    auto valA = CreateValues<_type, _size * _size>(1);
+    auto valB = CreateValues<_type, _size * _size>(2);
+    auto valX = CreateValues<_type, _size>(3);
+    auto valY = CreateValues<_type, _size>(4);
+    _matrix<_type, _size, _size> A(valA);
+    _matrix<_type, _size, _size> B(valB);
+    _vector<_type, _size, true> x(valX);
+    _vector<_type, _size, true> y(valY);
+
+    x = Lazy(A) * x + y;
+    BOOST_CHECK(CheckCloseArray(x.Data(), ReferenceProduct<_type, _size, _size, 1>(valA, valX, valY)));
+
+    y = y + Lazy(A) * y;
+    BOOST_CHECK(CheckCloseArray(y.Data(), ReferenceProduct<_type, _size, _size, 1>(valA, valY, valY)));
+
+    A = Lazy(A) * B;
+    BOOST_CHECK(CheckCloseArray(A.Data(), ReferenceProduct<_type, _size, _size, _size>(valA, valB, {{0}})));
+
+    _matrix<_type, _size, _size> C(valA);
+    B = Lazy(C) * B + B;
+    BOOST_CHECK(CheckCloseArray(B.Data(), ReferenceProduct<_type, _size, _size, _size>(valA, valB, valB)));
+}
+
+
+
+template <template <typename, U32, U32> class _matrix, template <typename, U32, bool> class _vector, typename _type>
+void AliasingTestAllSizes()
+{
+    AliasingTest<_matrix, _vector, _type, 1>();
+    AliasingTest<_matrix, _vector, _type, 5>();
+    AliasingTest<_matrix, _vector, _type, 16>();
+    AliasingTest<_matrix, _vector, _type, 100>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Aliasing_Serial)
+{
+    AliasingTestAllSizes<MatSerial, VecSerial, F32>();
+    AliasingTestAllSizes<MatSerial, VecSerial, F64>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Aliasing_SSE)
+{
+    AliasingTestAllSizes<MatSIMD, VecSIMD, F32>();
+    AliasingTestAllSizes<MatSIMD, VecSIMD, F64>();
+}
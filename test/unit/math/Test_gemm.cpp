@@ -0,0 +1,147 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/approx.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/simd/utility.h"
+#include "gdl/math/gemm/gemm.h"
+#include "gdl/math/serial/matSerial.h"
+#include "gdl/math/simd/matSIMD.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+
+using namespace GDL;
+
+
+
+// Helper functions ---------------------------------------------------------------------------------------------------
+
+//! @brief Creates a column major matrix with small integer values, so that all products and sums are exact
+template <typename _type>
+std::vector<_type> CreateMatrix(U32 rows, U32 cols, U32 ld, U32 seed)
+{
+    std::vector<_type> data(static_cast<size_t>(ld) * cols, static_cast<_type>(-1000));
+    for (U32 j = 0; j < cols; ++j)
+        for (U32 i = 0; i < rows; ++i)
+            data[i + j * ld] = static_cast<_type>(static_cast<I32>((i * 3 + j * 7 + seed) % 9) - 4);
+    return data;
+}
+
+
+
+//! @brief Multiplies two column major matrices with a simple triple loop and adds the result to C
+template <typename _type>
+void MultiplyReference(U32 m, U32 n, U32 k, const std::vector<_type>& A, U32 lda, const std::vector<_type>& B, U32 ldb,
+                       std::vector<_type>& C, U32 ldc)
+{
+    for (U32 j = 0; j < n; ++j)
+        for (U32 p = 0; p < k; ++p)
+            for (U32 i = 0; i < m; ++i)
+                C[i + j * ldc] += A[i + p * lda] * B[p + j * ldb];
+}
+
+
+
+//! @brief Checks the GEMM kernel of a register type for multiple matrix sizes. The sizes are chosen so that partially
+//! filled micro tiles and multiple cache blocks in each dimension occur.
+template <typename _registerType>
+void TestGEMMKernel()
+{
+    using Type = decltype(simd::GetDataType<_registerType>());
+    using Kernel = GEMMKernel<_registerType>;
+
+    const std::array<std::array<U32, 3>, 6> sizes = {{{{1, 1, 1}},
+                                                      {{Kernel::MR, Kernel::NR, 3}},
+                                                      {{Kernel::MR + 1, Kernel::NR - 1, 17}},
+                                                      {{Kernel::MC + 5, 2 * Kernel::NR + 3, Kernel::KC + 7}},
+                                                      {{37, Kernel::NC + 2, 5}},
+                                                      {{3, 50, 2 * Kernel::KC + 1}}}};
+
+    for (const auto& [m, n, k] : sizes)
+    {
+        // Leading dimensions larger than the number of rows make sure that only the selected rows are accessed
+        const U32 lda = m + 3;
+        const U32 ldb = k + 1;
+        const U32 ldc = m + 2;
+
+        const std::vector<Type> A = CreateMatrix<Type>(m, k, lda, 0);
+        const std::vector<Type> B = CreateMatrix<Type>(k, n, ldb, 5);
+        std::vector<Type> C = CreateMatrix<Type>(m, n, ldc, 2);
+        std::vector<Type> expC = C;
+
+        MultiplyReference(m, n, k, A, lda, B, ldb, expC, ldc);
+        Kernel::Multiply(m, n, k, A.data(), lda, B.data(), ldb, C.data(), ldc);
+
+        BOOST_CHECK(C == expC);
+    }
+}
+
+
+
+// Tests --------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(GEMM_Kernel)
+{
+    TestGEMMKernel<__m128>();
+    TestGEMMKernel<__m128d>();
+#ifdef __AVX2__
+    TestGEMMKernel<__m256>();
+    TestGEMMKernel<__m256d>();
+#endif // __AVX2__
+#ifdef __AVX512F__
+    TestGEMMKernel<__m512>();
+    TestGEMMKernel<__m512d>();
+#endif // __AVX512F__
+}
+
+
+
+BOOST_AUTO_TEST_CASE(GEMM_Empty)
+{
+    std::vector<F32> A(4, 1), B(4, 1), C(4, 2);
+    GEMM<F32>(2, 2, 0, A.data(), 2, B.data(), 2, C.data(), 2);
+    GEMM<F32>(0, 2, 2, A.data(), 2, B.data(), 2, C.data(), 2);
+    BOOST_CHECK(C == std::vector<F32>(4, 2));
+}
+
+
+
+template <template <typename, U32, U32> class _matrix, typename _type>
+void LargeMatrixMultiplicationTest()
+{
+    constexpr U32 rows = 101;
+    constexpr U32 inner = 97;
+    constexpr U32 cols = 103;
+    static_assert(IsGEMMBeneficial<_type>(rows, cols, inner));
+
+    std::array<_type, rows * inner> dataA;
+    std::array<_type, inner * cols> dataB;
+    std::array<_type, rows * cols> dataC = {{0}};
+    const std::vector<_type> A = CreateMatrix<_type>(rows, inner, rows, 1);
+    const std::vector<_type> B = CreateMatrix<_type>(inner, cols, inner, 4);
+    std::vector<_type> C(rows * cols, 0);
+    MultiplyReference(rows, cols, inner, A, rows, B, inner, C, rows);
+    std::copy(A.begin(), A.end(), dataA.begin());
+    std::copy(B.begin(), B.end(), dataB.begin());
+    std::copy(C.begin(), C.end(), dataC.begin());
+
+    // Too large for the stack of some threads
+    const auto a = std::make_unique<_matrix<_type, rows, inner>>(dataA);
+    const auto b = std::make_unique<_matrix<_type, inner, cols>>(dataB);
+    const auto expC = std::make_unique<_matrix<_type, rows, cols>>(dataC);
+
+    BOOST_CHECK(*a * *b == *expC);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Large_Matrix_Multiplication)
+{
+    LargeMatrixMultiplicationTest<MatSerial, F32>();
+    LargeMatrixMultiplicationTest<MatSerial, F64>();
+    LargeMatrixMultiplicationTest<MatSIMD, F32>();
+    LargeMatrixMultiplicationTest<MatSIMD, F64>();
+}
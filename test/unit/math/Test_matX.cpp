@@ -0,0 +1,208 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/matX.h"
+#include "gdl/math/simd/vecSIMD.h"
+#include "gdl/math/simd/vecX.h"
+
+#include "test/tools/arrayValueComparison.h"
+#include "test/tools/ExceptionChecks.h"
+
+#include <array>
+
+
+using namespace GDL;
+
+
+
+// Helper functions ---------------------------------------------------------------------------------------------------
+
+//! @brief Creates a matrix with pseudo random values and returns it together with its column major data
+template <typename _type>
+std::pair<MatX<_type>, Vector<_type>> CreateMatrix(U32 rows, U32 cols, U32 seed)
+{
+    Vector<_type> values(rows * cols);
+    for (U32 i = 0; i < values.size(); ++i)
+        values[i] = static_cast<_type>(static_cast<I32>((i * 7 + seed * 13) % 23) - 11) / static_cast<_type>(4);
+
+    return {MatX<_type>(rows, cols, values.data()), values};
+}
+
+
+
+// Construction and Data function -------------------------------------------------------------------------------------
+
+template <typename _type>
+void CtorDataTest()
+{
+    std::array<_type, 15> expA = {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14}};
+
+    // pointer ctor
+    MatX<_type> A(3, 5, expA.data());
+    BOOST_CHECK(A.Rows() == 3 && A.Cols() == 5);
+    BOOST_CHECK(CheckCloseArray(A.Data(), Vector<_type>(expA.begin(), expA.end())));
+
+    // initializer list ctor
+    MatX<_type> B(3, 5, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14});
+    BOOST_CHECK(A == B);
+    BOOST_CHECK_THROW(MatX<_type>(3, 4, {0, 1, 2}), Exception);
+
+    // ctor from static matrix
+    MatX<_type> C{MatSIMD<_type, 3, 5>(expA)};
+    BOOST_CHECK(A == C);
+
+    // size ctor - all values 0
+    MatX<_type> D(13, 7);
+    BOOST_CHECK(CheckArrayZero(D.Data()));
+
+    // vector ctors
+    std::array<_type, 5> expV = {{1, 2, 3, 4, 5}};
+    VecX<_type> v0(5, expV.data());
+    VecX<_type> v1 = {1, 2, 3, 4, 5};
+    VecX<_type> v2{VecSIMD<_type, 5, true>(expV)};
+    BOOST_CHECK(v0.Size() == 5);
+    BOOST_CHECK(CheckCloseArray(v0.Data(), Vector<_type>(expV.begin(), expV.end())));
+    BOOST_CHECK(v0 == v1);
+    BOOST_CHECK(v0 == v2);
+    BOOST_CHECK(v0 != VecX<_type>(5));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Construction)
+{
+    CtorDataTest<F32>();
+    CtorDataTest<F64>();
+}
+
+
+
+// Comparison and access ----------------------------------------------------------------------------------------------
+
+template <typename _type>
+void ComparisonAccessTest()
+{
+    auto [A, values] = CreateMatrix<_type>(11, 6, 1);
+
+    for (U32 i = 0; i < 11; ++i)
+        for (U32 j = 0; j < 6; ++j)
+            BOOST_CHECK(A(i, j) == Approx<_type>(values[j * 11 + i]));
+
+    MatX<_type> B = A;
+    BOOST_CHECK(A == B);
+
+    values[65] += 1;
+    BOOST_CHECK(A != MatX<_type>(11, 6, values.data()));
+    BOOST_CHECK(A != MatX<_type>(6, 11, values.data()));
+
+    B.SetZero();
+    BOOST_CHECK(CheckArrayZero(B.Data()));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Comparison_Access)
+{
+    ComparisonAccessTest<F32>();
+    ComparisonAccessTest<F64>();
+}
+
+
+
+// Addition -----------------------------------------------------------------------------------------------------------
+
+template <typename _type>
+void AdditionTest()
+{
+    auto [A, valuesA] = CreateMatrix<_type>(13, 5, 1);
+    auto [B, valuesB] = CreateMatrix<_type>(13, 5, 2);
+
+    Vector<_type> expValues(valuesA.size());
+    for (U32 i = 0; i < expValues.size(); ++i)
+        expValues[i] = valuesA[i] + valuesB[i];
+
+    MatX<_type> C = A + B;
+    BOOST_CHECK(CheckCloseArray(C.Data(), expValues));
+
+    A += B;
+    BOOST_CHECK(A == C);
+
+    GDL_CHECK_THROW_DEV_DISABLE(A += MatX<_type>(5, 13), Exception);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Addition)
+{
+    AdditionTest<F32>();
+    AdditionTest<F64>();
+}
+
+
+
+// Multiplication -----------------------------------------------------------------------------------------------------
+
+template <typename _type>
+void MultiplicationTest(U32 rows, U32 inner, U32 cols)
+{
+    auto [A, valuesA] = CreateMatrix<_type>(rows, inner, 1);
+    auto [B, valuesB] = CreateMatrix<_type>(inner, cols, 2);
+
+    Vector<_type> expValues(rows * cols, 0);
+    for (U32 j = 0; j < cols; ++j)
+        for (U32 k = 0; k < inner; ++k)
+            for (U32 i = 0; i < rows; ++i)
+                expValues[j * rows + i] += valuesA[k * rows + i] * valuesB[j * inner + k];
+
+    MatX<_type> C = A * B;
+    BOOST_CHECK(C.Rows() == rows && C.Cols() == cols);
+    BOOST_CHECK(C == MatX<_type>(rows, cols, expValues.data()));
+
+
+    // Matrix-vector multiplication
+    VecX<_type> x(inner, valuesB.data());
+    VecX<_type> y = A * x;
+    BOOST_CHECK(y == VecX<_type>(rows, expValues.data()));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Multiplication)
+{
+    MultiplicationTest<F32>(3, 5, 4);
+    MultiplicationTest<F64>(3, 5, 4);
+    MultiplicationTest<F32>(17, 13, 11);
+    MultiplicationTest<F64>(17, 13, 11);
+    MultiplicationTest<F32>(101, 97, 103);
+    MultiplicationTest<F64>(101, 97, 103);
+
+    GDL_CHECK_THROW_DEV_DISABLE([[maybe_unused]] auto C = MatX<F32>(3, 4) * MatX<F32>(3, 4), Exception);
+}
+
+
+
+// Comparison with static matrix --------------------------------------------------------------------------------------
+
+template <typename _type>
+void StaticComparisonTest()
+{
+    std::array<_type, 35> valuesA;
+    std::array<_type, 30> valuesB;
+    for (U32 i = 0; i < valuesA.size(); ++i)
+        valuesA[i] = static_cast<_type>(i % 9) - 4;
+    for (U32 i = 0; i < valuesB.size(); ++i)
+        valuesB[i] = static_cast<_type>(i % 5) + 1;
+
+    MatSIMD<_type, 7, 5> A(valuesA);
+    MatSIMD<_type, 5, 6> B(valuesB);
+
+    BOOST_CHECK(MatX<_type>(A) * MatX<_type>(B) == MatX<_type>(A * B));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Static_Comparison)
+{
+    StaticComparisonTest<F32>();
+    StaticComparisonTest<F64>();
+}
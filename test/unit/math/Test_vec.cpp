@@ -59,6 +59,12 @@ void SSECtorTest()
         expA[i] = static_cast<_type>(i);
 
     BOOST_CHECK(CheckCloseArray(a.Data(), expA));
+
+    // Unused values of the last register must be zero
+    VecSIMD<_type, numVectorVals, _isCol> b(expA);
+    BOOST_CHECK(CheckCloseArray(b.Data(), expA));
+    for (U32 i = numVectorVals; i < numArrayReg * numRegVals; ++i)
+        BOOST_CHECK(simd::GetValue(b.DataSSE()[numArrayReg - 1], i % numRegVals) == Approx<_type>(0));
 }
 
 
@@ -0,0 +1,146 @@
+#include <boost/test/unit_test.hpp>
+
+#include "test/unit/math/solver/solverTests.h"
+
+
+#include "gdl/math/simd/matSIMD.h"
+#include "gdl/math/simd/matX.h"
+#include "gdl/math/simd/vecSIMD.h"
+#include "gdl/math/simd/vecX.h"
+#include "gdl/math/solver/lu.h"
+
+#include <algorithm>
+
+
+
+using namespace GDL;
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+using namespace GDL::Solver;
+
+template <typename _type, U32 _size>
+using SIMDSolverPtr = VecSIMD<_type, _size, true> (*)(const MatSIMD<_type, _size, _size>&,
+                                                      const VecSIMD<_type, _size, true>&);
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+//! @brief Converts the static system into a runtime sized one, solves it and converts the result back.
+template <Pivot _pivot, typename _type, U32 _size>
+VecSIMD<_type, _size, true> LUX(const MatSIMD<_type, _size, _size>& A, const VecSIMD<_type, _size, true>& r)
+{
+    VecX<_type> x = LU<_pivot, _type>(MatX<_type>(A), VecX<_type>(r));
+
+    std::array<_type, _size> data{};
+    for (U32 i = 0; i < _size; ++i)
+        data[i] = x[i];
+
+    return VecSIMD<_type, _size, true>(data);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type, Pivot _pivot, U32... _sizes>
+void TestLUX()
+{
+    (SolverTests<_type, _sizes, SIMDSolverPtr<_type, _sizes>>::template RunTests<_pivot>(
+             &LUX<_pivot, _type, _sizes>),
+     ...);
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+template <typename _type, Pivot _pivot>
+void TestLUXLargeSystem(U32 size, _type tolerance)
+{
+    Vector<_type> matValues(size * size);
+    Vector<_type> expValues(size);
+
+    for (U32 i = 0; i < size; ++i)
+    {
+        expValues[i] = static_cast<_type>(i % 7 + 1);
+        for (U32 j = 0; j < size; ++j)
+        {
+            _type value = static_cast<_type>(1) / static_cast<_type>(1 + std::max(i, j) - std::min(i, j));
+            matValues[j * size + i] = (i == j) ? value + static_cast<_type>(size) : value;
+        }
+    }
+
+    MatX<_type> A(size, size, matValues.data());
+    VecX<_type> expRes(size, expValues.data());
+    VecX<_type> r = A * expRes;
+
+
+    VecX<_type> res = LU<_pivot>(A, r);
+    auto factorization = LUFactorization<_pivot>(A);
+    VecX<_type> resFactorization = LU<_pivot>(factorization, r);
+
+    for (U32 i = 0; i < size; ++i)
+    {
+        BOOST_CHECK_CLOSE_FRACTION(res[i], expRes[i], tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(resFactorization[i], expRes[i], tolerance);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Test_LUX_NoPivot_F32)
+{
+    TestLUX<F32, Pivot::NONE, 2, 3, 4, 5, 6, 7, 8, 9>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Test_LUX_NoPivot_F64)
+{
+    TestLUX<F64, Pivot::NONE, 2, 3, 4, 5, 6, 7, 8, 9>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Test_LUX_PartialPivot_F32)
+{
+    TestLUX<F32, Pivot::PARTIAL, 2, 3, 4, 5, 6, 7, 8, 9>();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Test_LUX_PartialPivot_F64)
+{
+    TestLUX<F64, Pivot::PARTIAL, 2, 3, 4, 5, 6, 7, 8, 9>();
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Test_LUX_Large_System)
+{
+    for (U32 size : {1, 17, 37, 64})
+    {
+        TestLUXLargeSystem<F32, Pivot::NONE>(size, 1E-4f);
+        TestLUXLargeSystem<F32, Pivot::PARTIAL>(size, 1E-4f);
+        TestLUXLargeSystem<F64, Pivot::NONE>(size, 1E-12);
+        TestLUXLargeSystem<F64, Pivot::PARTIAL>(size, 1E-12);
+    }
+}
+
+
+
+// --------------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(Test_LUX_Size_Mismatch)
+{
+    BOOST_CHECK_THROW([[maybe_unused]] auto res = LU(MatX<F32>(3, 4), VecX<F32>(3)), Exception);
+    BOOST_CHECK_THROW([[maybe_unused]] auto res = LU(MatX<F32>(4, 4), VecX<F32>(3)), Exception);
+}
@@ -50,8 +50,10 @@ void TestQR()
     }
     else
     {
+        // The SIMD version sums the squares and dot products in a different order than the serial version. This makes
+        // the error of the first result value of the 8x8 system slightly bigger than the default tolerance.
         SIMDSolverPtr<_type, _rows, _cols> solver = Solver::QR<_pivot, _type, _rows, _cols>;
-        SolverTests<_type, _rows, decltype(solver)>::template RunTests<_pivot>(solver);
+        SolverTests<_type, _rows, decltype(solver), 250>::template RunTests<_pivot>(solver);
     }
 }
 
@@ -80,17 +82,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_2x2_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_2x2_F32_SIMD)
-//{
-//    TestQR<F32, 2, 2, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_2x2_F32_SIMD)
+{
+    TestQR<F32, 2, 2, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_2x2_F64_SIMD)
-//{
-//    TestQR<F64, 2, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_2x2_F64_SIMD)
+{
+    TestQR<F64, 2, 2, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -110,17 +112,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_3x3_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_3x3_F32_SIMD)
-//{
-//    TestQR<F32, 3, 3, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_3x3_F32_SIMD)
+{
+    TestQR<F32, 3, 3, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_3x3_F64_SIMD)
-//{
-//    TestQR<F64, 3, 3, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_3x3_F64_SIMD)
+{
+    TestQR<F64, 3, 3, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -140,10 +142,10 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_4x4_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_4x4_F32_SIMD)
-//{
-//    TestQR<F32, 4, 4, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_4x4_F32_SIMD)
+{
+    TestQR<F32, 4, 4, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -170,17 +172,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_5x5_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_5x5_F32_SIMD)
-//{
-//    TestQR<F32, 5, 5, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_5x5_F32_SIMD)
+{
+    TestQR<F32, 5, 5, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_5x5_F64_SIMD)
-//{
-//    TestQR<F64, 5, 5, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_5x5_F64_SIMD)
+{
+    TestQR<F64, 5, 5, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -200,17 +202,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_6x6_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_6x6_F32_SIMD)
-//{
-//    TestQR<F32, 6, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_6x6_F32_SIMD)
+{
+    TestQR<F32, 6, 6, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_6x6_F64_SIMD)
-//{
-//    TestQR<F64, 6, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_6x6_F64_SIMD)
+{
+    TestQR<F64, 6, 6, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -230,17 +232,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_7x7_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_7x7_F32_SIMD)
-//{
-//    TestQR<F32, 7, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_7x7_F32_SIMD)
+{
+    TestQR<F32, 7, 7, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_7x7_F64_SIMD)
-//{
-//    TestQR<F64, 7, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_7x7_F64_SIMD)
+{
+    TestQR<F64, 7, 7, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -267,10 +269,10 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_8x8_F32_SIMD)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_8x8_F64_SIMD)
-//{
-//    TestQR<F64, 8, 8, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_8x8_F64_SIMD)
+{
+    TestQR<F64, 8, 8, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -290,17 +292,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_9x9_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_9x9_F32_SIMD)
-//{
-//    TestQR<F32, 9, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_9x9_F32_SIMD)
+{
+    TestQR<F32, 9, 9, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_9x9_F64_SIMD)
-//{
-//    TestQR<F64, 9, Pivot::NONE, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_NoPivot_9x9_F64_SIMD)
+{
+    TestQR<F64, 9, 9, Pivot::NONE, SolverType::SIMD>();
+}
 
 
 
@@ -328,17 +330,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_2x2_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_2x2_F32_SIMD)
-//{
-//    TestQR<F32, 2, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_2x2_F32_SIMD)
+{
+    TestQR<F32, 2, 2, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_2x2_F64_SIMD)
-//{
-//    TestQR<F64, 2, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_2x2_F64_SIMD)
+{
+    TestQR<F64, 2, 2, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
@@ -358,17 +360,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_3x3_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_3x3_F32_SIMD)
-//{
-//    TestQR<F32, 3, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_3x3_F32_SIMD)
+{
+    TestQR<F32, 3, 3, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_3x3_F64_SIMD)
-//{
-//    TestQR<F64, 3, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_3x3_F64_SIMD)
+{
+    TestQR<F64, 3, 3, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
@@ -388,17 +390,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_4x4_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_4x4_F32_SIMD)
-//{
-//    TestQR<F32, 4, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_4x4_F32_SIMD)
+{
+    TestQR<F32, 4, 4, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_4x4_F64_SIMD)
-//{
-//    TestQR<F64, 4, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_4x4_F64_SIMD)
+{
+    TestQR<F64, 4, 4, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
@@ -418,17 +420,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_5x5_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_5x5_F32_SIMD)
-//{
-//    TestQR<F32, 5, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_5x5_F32_SIMD)
+{
+    TestQR<F32, 5, 5, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_5x5_F64_SIMD)
-//{
-//    TestQR<F64, 5, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_5x5_F64_SIMD)
+{
+    TestQR<F64, 5, 5, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
@@ -448,17 +450,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_6x6_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_6x6_F32_SIMD)
-//{
-//    TestQR<F32, 6, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_6x6_F32_SIMD)
+{
+    TestQR<F32, 6, 6, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_6x6_F64_SIMD)
-//{
-//    TestQR<F64, 6, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_6x6_F64_SIMD)
+{
+    TestQR<F64, 6, 6, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
@@ -478,17 +480,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_7x7_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_7x7_F32_SIMD)
-//{
-//    TestQR<F32, 7, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_7x7_F32_SIMD)
+{
+    TestQR<F32, 7, 7, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_7x7_F64_SIMD)
-//{
-//    TestQR<F64, 7, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_7x7_F64_SIMD)
+{
+    TestQR<F64, 7, 7, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
@@ -508,17 +510,17 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_8x8_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_8x8_F32_SIMD)
-//{
-//    TestQR<F32, 8, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_8x8_F32_SIMD)
+{
+    TestQR<F32, 8, 8, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_8x8_F64_SIMD)
-//{
-//    TestQR<F64, 8, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_8x8_F64_SIMD)
+{
+    TestQR<F64, 8, 8, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
@@ -538,14 +540,14 @@ BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_9x9_F64_Serial)
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_9x9_F32_SIMD)
-//{
-//    TestQR<F32, 9, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_9x9_F32_SIMD)
+{
+    TestQR<F32, 9, 9, Pivot::PARTIAL, SolverType::SIMD>();
+}
 
 
 
-// BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_9x9_F64_SIMD)
-//{
-//    TestQR<F64, 9, Pivot::PARTIAL, SolverType::SIMD>();
-//}
+BOOST_AUTO_TEST_CASE(Test_QR_PartialPivot_9x9_F64_SIMD)
+{
+    TestQR<F64, 9, 9, Pivot::PARTIAL, SolverType::SIMD>();
+}
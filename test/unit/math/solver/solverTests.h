@@ -12,7 +12,12 @@ using namespace GDL::Solver;
 
 
 
-template <typename _type, U32 _size, typename _solver>
+//! @brief Common tests of all solvers
+//! @tparam _type: Data type
+//! @tparam _size: System size
+//! @tparam _solver: Solver function pointer type
+//! @tparam _tolerance: Tolerance factor of the result comparisons
+template <typename _type, U32 _size, typename _solver, U32 _tolerance = 150>
 class SolverTests
 {
 
@@ -57,7 +62,7 @@ private:
     //! @param A: Matrix
     //! @param r: Right-hand side vector
     //! @param expRes: Expected result
-    static void SolveAndCheckResult(_solver solver, Matrix A, Vector r, Vector expRes);
+    static void SolveAndCheckResult(_solver solver, const Matrix& A, const Vector& r, const Vector& expRes);
 
     //! @brief Tests if pivoting is really turned off
     //! @param solver: Solver
@@ -11,9 +11,9 @@
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
 template <Pivot _pivot>
-void SolverTests<_type, _size, _solver>::RunTests(_solver solver)
+void SolverTests<_type, _size, _solver, _tolerance>::RunTests(_solver solver)
 {
     static bool alreadyTested = false;
     EXCEPTION(alreadyTested, "Testcase already tested. Copy and paste error?");
@@ -49,8 +49,8 @@ void SolverTests<_type, _size, _solver>::RunTests(_solver solver)
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-auto SolverTests<_type, _size, _solver>::GetPermutationIndices()
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+auto SolverTests<_type, _size, _solver, _tolerance>::GetPermutationIndices()
 {
     using permArr = std::array<U32, _size>;
 
@@ -119,8 +119,8 @@ auto SolverTests<_type, _size, _solver>::GetPermutationIndices()
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-std::array<_type, _size> SolverTests<_type, _size, _solver>::GetResultData()
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+std::array<_type, _size> SolverTests<_type, _size, _solver, _tolerance>::GetResultData()
 {
     if constexpr (_size == 2)
         return {{1, 2}};
@@ -156,8 +156,8 @@ std::array<_type, _size> SolverTests<_type, _size, _solver>::GetResultData()
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-std::array<_type, _size> SolverTests<_type, _size, _solver>::GetRhsData()
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+std::array<_type, _size> SolverTests<_type, _size, _solver, _tolerance>::GetRhsData()
 {
     if constexpr (_size == 2)
         return {{7, -7}};
@@ -192,8 +192,8 @@ std::array<_type, _size> SolverTests<_type, _size, _solver>::GetRhsData()
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-std::array<_type, _size * _size> SolverTests<_type, _size, _solver>::GetTransposedMatrixData()
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+std::array<_type, _size * _size> SolverTests<_type, _size, _solver, _tolerance>::GetTransposedMatrixData()
 {
     if constexpr (_size == 2)
         // clang-format off
@@ -282,20 +282,21 @@ std::array<_type, _size * _size> SolverTests<_type, _size, _solver>::GetTranspos
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-void SolverTests<_type, _size, _solver>::SolveAndCheckResult(_solver solver, Matrix A, Vector r, Vector expRes)
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+void SolverTests<_type, _size, _solver, _tolerance>::SolveAndCheckResult(_solver solver, const Matrix& A,
+                                                                         const Vector& r, const Vector& expRes)
 {
     Vector res = solver(A, r);
 
-    BOOST_CHECK(CheckCloseArray(res.Data(), expRes.Data(), 150));
+    BOOST_CHECK(CheckCloseArray(res.Data(), expRes.Data(), _tolerance));
 }
 
 
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-void SolverTests<_type, _size, _solver>::TestNoPivoting(_solver solver)
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+void SolverTests<_type, _size, _solver, _tolerance>::TestNoPivoting(_solver solver)
 {
     std::array<_type, _size* _size> matrixValues = GetTransposedMatrixData();
     matrixValues[0] = 0;
@@ -312,8 +313,8 @@ void SolverTests<_type, _size, _solver>::TestNoPivoting(_solver solver)
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-void SolverTests<_type, _size, _solver>::TestPivoting(_solver solver)
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+void SolverTests<_type, _size, _solver, _tolerance>::TestPivoting(_solver solver)
 {
 
     auto permutations = GetPermutationIndices();
@@ -362,8 +363,8 @@ void SolverTests<_type, _size, _solver>::TestPivoting(_solver solver)
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-void SolverTests<_type, _size, _solver>::TestSolve(_solver solver)
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+void SolverTests<_type, _size, _solver, _tolerance>::TestSolve(_solver solver)
 {
     Matrix A = Matrix(GetTransposedMatrixData()).Transpose();
 
@@ -378,8 +379,8 @@ void SolverTests<_type, _size, _solver>::TestSolve(_solver solver)
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-void SolverTests<_type, _size, _solver>::TestSIMDPivotingUnusedValues([[maybe_unused]] _solver solver)
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+void SolverTests<_type, _size, _solver, _tolerance>::TestSIMDPivotingUnusedValues([[maybe_unused]] _solver solver)
 {
     if constexpr (isSIMD)
     {
@@ -430,8 +431,8 @@ void SolverTests<_type, _size, _solver>::TestSIMDPivotingUnusedValues([[maybe_un
 
 // --------------------------------------------------------------------------------------------------------------------
 
-template <typename _type, U32 _size, typename _solver>
-void SolverTests<_type, _size, _solver>::TestSingularMatrixException(_solver solver)
+template <typename _type, U32 _size, typename _solver, U32 _tolerance>
+void SolverTests<_type, _size, _solver, _tolerance>::TestSingularMatrixException(_solver solver)
 {
     std::array<_type, _size* _size> matData = GetTransposedMatrixData();
 
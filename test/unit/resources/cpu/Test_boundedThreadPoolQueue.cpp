@@ -0,0 +1,58 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/boundedThreadPoolQueue.h"
+
+using namespace GDL;
+
+
+
+//! @brief Checks that pushes to a full queue fail if the overflow policy is not SPILL
+BOOST_AUTO_TEST_CASE(Bounded)
+{
+    constexpr U64 capacity = 4;
+    BoundedThreadPoolQueue<U32, capacity, OverflowPolicy::BLOCK> queue;
+
+    BOOST_CHECK(queue.GetCapacity() == capacity);
+    BOOST_CHECK(queue.IsEmpty());
+
+    for (U32 i = 0; i < capacity; ++i)
+        BOOST_CHECK(queue.TryPush(U32{i}));
+    BOOST_CHECK(queue.TryPush(U32{capacity}) == false);
+    BOOST_CHECK(queue.GetSize() == capacity);
+    BOOST_CHECK(queue.GetNumOverflowValues() == 0);
+
+    U32 value = 0;
+    for (U32 i = 0; i < capacity; ++i)
+    {
+        BOOST_CHECK(queue.TryPop(value));
+        BOOST_CHECK(value == i);
+    }
+    BOOST_CHECK(queue.TryPop(value) == false);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+
+
+//! @brief Checks that values are spilled into the overflow list and fetched after the ring buffer is empty
+BOOST_AUTO_TEST_CASE(Spill)
+{
+    constexpr U64 capacity = 4;
+    constexpr U32 numValues = 10;
+    BoundedThreadPoolQueue<U32, capacity, OverflowPolicy::SPILL> queue;
+
+    for (U32 i = 0; i < numValues; ++i)
+        BOOST_CHECK(queue.TryPush(U32{i}));
+    BOOST_CHECK(queue.GetSize() == numValues);
+    BOOST_CHECK(queue.GetNumOverflowValues() == numValues - capacity);
+
+    U32 value = 0;
+    for (U32 i = 0; i < numValues; ++i)
+    {
+        BOOST_CHECK(queue.TryPop(value));
+        BOOST_CHECK(value == i);
+    }
+    BOOST_CHECK(queue.TryPop(value) == false);
+    BOOST_CHECK(queue.GetNumOverflowValues() == 0);
+    BOOST_CHECK(queue.IsEmpty());
+}
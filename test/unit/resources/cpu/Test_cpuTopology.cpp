@@ -0,0 +1,144 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/exception.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/cpuTopology.h"
+
+#include "test/tools/ExceptionChecks.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+using namespace GDL;
+namespace fs = std::filesystem;
+
+
+// Fixture %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Creates a fake sysfs tree of a system with 2 packages, 2 cores per package and 2 hardware threads per core.
+//! Each package is a NUMA node. The node ids have a gap (0 and 2). Logical CPU 1 is offline.
+struct FakeSysfs
+{
+    fs::path mPath;
+
+    FakeSysfs()
+        : mPath{fs::temp_directory_path() / ("gdl_fake_sysfs_" + std::to_string(std::hash<std::thread::id>{}(
+                                                                           std::this_thread::get_id())))}
+    {
+        fs::remove_all(mPath);
+        Write("cpu/online", "0,2-7");
+
+        // cpu: core, package
+        // 0: 0, 0   2: 1, 0   4: 0, 1   6: 1, 1
+        // 1: 0, 0   3: 1, 0   5: 0, 1   7: 1, 1
+        for (U32 cpu = 0; cpu < 8; ++cpu)
+        {
+            const std::string topology = "cpu/cpu" + std::to_string(cpu) + "/topology/";
+            Write(topology + "core_id", std::to_string((cpu / 2) % 2));
+            Write(topology + "physical_package_id", std::to_string(cpu / 4));
+        }
+
+        Write("node/node0/cpulist", "0-3");
+        Write("node/node2/cpulist", "4-7");
+        fs::create_directories(mPath / "node/power");
+    }
+
+    FakeSysfs(const FakeSysfs&) = delete;
+    FakeSysfs(FakeSysfs&&) = delete;
+    FakeSysfs& operator=(const FakeSysfs&) = delete;
+    FakeSysfs& operator=(FakeSysfs&&) = delete;
+
+    ~FakeSysfs()
+    {
+        fs::remove_all(mPath);
+    }
+
+    //! @brief Writes a single line into a file of the fake sysfs tree
+    void Write(const std::string& file, const std::string& content)
+    {
+        const fs::path path = mPath / file;
+        fs::create_directories(path.parent_path());
+        std::ofstream(path) << content << "\n";
+    }
+};
+
+
+
+// Tests %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+
+BOOST_AUTO_TEST_CASE(Parse_Cpu_List)
+{
+    BOOST_CHECK(CpuTopology::ParseCpuList("0") == Vector<U32>({0}));
+    BOOST_CHECK(CpuTopology::ParseCpuList("0-3") == Vector<U32>({0, 1, 2, 3}));
+    BOOST_CHECK(CpuTopology::ParseCpuList("8,0-2,5") == Vector<U32>({0, 1, 2, 5, 8}));
+    BOOST_CHECK(CpuTopology::ParseCpuList("1,1-2") == Vector<U32>({1, 2}));
+    BOOST_CHECK(CpuTopology::ParseCpuList("").empty());
+
+    BOOST_CHECK_THROW(CpuTopology::ParseCpuList("3-1"), Exception);
+    BOOST_CHECK_THROW(CpuTopology::ParseCpuList("a"), Exception);
+    BOOST_CHECK_THROW(CpuTopology::ParseCpuList("1,,2"), Exception);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Fake_Topology)
+{
+    FakeSysfs sysfs;
+    CpuTopology topology(sysfs.mPath.string());
+
+    BOOST_CHECK(topology.GetNumCpus() == 7);
+    BOOST_CHECK(topology.GetNumCores() == 4);
+    BOOST_CHECK(topology.GetNumPackages() == 2);
+    BOOST_CHECK(topology.GetNumNodes() == 2);
+
+    const auto& cpus = topology.GetCpus();
+    BOOST_CHECK(cpus[0].mId == 0);
+    BOOST_CHECK(cpus[1].mId == 2);
+    BOOST_CHECK(cpus[1].mCoreId == 1);
+    BOOST_CHECK(cpus[6].mId == 7);
+    BOOST_CHECK(cpus[6].mPackageId == 1);
+    BOOST_CHECK(cpus[6].mNodeId == 1);
+
+    BOOST_CHECK(topology.GetCpusOfNode(0) == Vector<U32>({0, 2, 3}));
+    BOOST_CHECK(topology.GetCpusOfNode(1) == Vector<U32>({4, 5, 6, 7}));
+    GDL_CHECK_THROW_DEV_DISABLE(topology.GetCpusOfNode(2), Exception);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Cpu_Sets)
+{
+    FakeSysfs sysfs;
+    CpuTopology topology(sysfs.mPath.string());
+
+    using Sets = Vector<Vector<U32>>;
+    BOOST_CHECK(topology.GetCpuSets(CpuSetGranularity::CPU) == Sets({{0}, {2}, {3}, {4}, {5}, {6}, {7}}));
+    BOOST_CHECK(topology.GetCpuSets(CpuSetGranularity::CPU, true) == Sets({{0}, {4}, {2}, {5}, {3}, {6}, {7}}));
+    BOOST_CHECK(topology.GetCpuSets(CpuSetGranularity::CORE) == Sets({{0}, {2, 3}, {4, 5}, {6, 7}}));
+    BOOST_CHECK(topology.GetCpuSets(CpuSetGranularity::CORE, true) == Sets({{0}, {4, 5}, {2, 3}, {6, 7}}));
+    BOOST_CHECK(topology.GetCpuSets(CpuSetGranularity::NODE) == Sets({{0, 2, 3}, {4, 5, 6, 7}}));
+}
+
+
+
+//! @brief Checks the fallback if no sysfs information is available and the topology of the current system
+BOOST_AUTO_TEST_CASE(Fallback_And_System)
+{
+    CpuTopology fallback("/non/existing/path");
+    BOOST_CHECK(fallback.GetNumCpus() == std::max(1u, std::thread::hardware_concurrency()));
+    BOOST_CHECK(fallback.GetNumCores() == fallback.GetNumCpus());
+    BOOST_CHECK(fallback.GetNumNodes() == 1);
+    BOOST_CHECK(fallback.GetNumPackages() == 1);
+    BOOST_CHECK(fallback.GetCpuSets(CpuSetGranularity::NODE).size() == 1);
+
+    CpuTopology system;
+    BOOST_CHECK(system.GetNumCpus() > 0);
+    BOOST_CHECK(system.GetNumCores() > 0 && system.GetNumCores() <= system.GetNumCpus());
+    BOOST_CHECK(system.GetNumNodes() > 0 && system.GetNumNodes() <= system.GetNumCpus());
+    BOOST_CHECK(system.GetCpuSets(CpuSetGranularity::CORE).size() == system.GetNumCores());
+}
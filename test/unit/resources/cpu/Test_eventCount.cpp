@@ -0,0 +1,113 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/eventCount.h"
+#include "gdl/resources/cpu/utility/deadlockTerminationTimer.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+
+using namespace GDL;
+
+
+
+//! @brief Checks that a cancelled or outdated wait does not block
+BOOST_AUTO_TEST_CASE(Prepare_Cancel_And_Outdated_Wait)
+{
+    DeadlockTerminationTimer dtt;
+    EventCount eventCount;
+
+    BOOST_CHECK(eventCount.GetNumWaiters() == 0);
+    eventCount.NotifyOne();
+    eventCount.NotifyAll();
+
+    U32 key = eventCount.PrepareWait();
+    BOOST_CHECK(eventCount.GetNumWaiters() == 1);
+    eventCount.CancelWait();
+    BOOST_CHECK(eventCount.GetNumWaiters() == 0);
+
+    // Notification between PrepareWait and Wait must not get lost
+    key = eventCount.PrepareWait();
+    eventCount.NotifyOne();
+    eventCount.Wait(key);
+    BOOST_CHECK(eventCount.GetNumWaiters() == 0);
+}
+
+
+
+//! @brief Checks that NotifyOne wakes a single thread and NotifyAll wakes all remaining threads
+BOOST_AUTO_TEST_CASE(Notify_One_And_All)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 numThreads = 4;
+
+    EventCount eventCount;
+    std::atomic<U32> numWokenUp = 0;
+    std::array<std::thread, numThreads> threads;
+
+    for (auto& thread : threads)
+        thread = std::thread([&]() {
+            eventCount.Wait(eventCount.PrepareWait());
+            ++numWokenUp;
+        });
+
+    while (eventCount.GetNumWaiters() != numThreads)
+        std::this_thread::yield();
+
+    eventCount.NotifyOne();
+    while (numWokenUp != 1)
+        std::this_thread::yield();
+    BOOST_CHECK(eventCount.GetNumWaiters() == numThreads - 1);
+
+    eventCount.NotifyAll();
+    for (auto& thread : threads)
+        thread.join();
+
+    BOOST_CHECK(numWokenUp == numThreads);
+    BOOST_CHECK(eventCount.GetNumWaiters() == 0);
+}
+
+
+
+//! @brief Producer consumer stress test. Every produced value must be consumed without lost wake-ups.
+BOOST_AUTO_TEST_CASE(No_Lost_Wake_Ups)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 numValues = 20000;
+
+    EventCount eventCount;
+    std::atomic<U32> numAvailable = 0;
+    U32 numConsumed = 0;
+
+    std::thread consumer([&]() {
+        while (numConsumed < numValues)
+        {
+            U32 available = numAvailable.load();
+            if (available > 0 && numAvailable.compare_exchange_strong(available, available - 1))
+            {
+                ++numConsumed;
+                continue;
+            }
+
+            const U32 key = eventCount.PrepareWait();
+            if (numAvailable.load() > 0)
+            {
+                eventCount.CancelWait();
+                continue;
+            }
+            eventCount.Wait(key);
+        }
+    });
+
+    for (U32 i = 0; i < numValues; ++i)
+    {
+        ++numAvailable;
+        eventCount.NotifyOne();
+        if (i % 64 == 0)
+            std::this_thread::yield();
+    }
+
+    consumer.join();
+    BOOST_CHECK(numConsumed == numValues);
+}
@@ -0,0 +1,137 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/exception.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/mpmcRingBuffer.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace GDL;
+
+
+
+//! @brief Checks construction and the constructor exceptions
+BOOST_AUTO_TEST_CASE(Construction)
+{
+    BOOST_CHECK_NO_THROW(MPMCRingBuffer<U32>(16));
+    BOOST_CHECK_THROW(MPMCRingBuffer<U32>(0), Exception);
+    BOOST_CHECK_THROW(MPMCRingBuffer<U32>(1), Exception);
+    BOOST_CHECK_THROW(MPMCRingBuffer<U32>(15), Exception);
+
+    MPMCRingBuffer<U32> ringBuffer(32);
+    BOOST_CHECK(ringBuffer.GetCapacity() == 32);
+    BOOST_CHECK(ringBuffer.GetSize() == 0);
+    BOOST_CHECK(ringBuffer.IsEmpty());
+}
+
+
+
+//! @brief Checks FIFO order, full and empty states and the wrap around of the indices
+BOOST_AUTO_TEST_CASE(Push_Pop)
+{
+    constexpr U32 capacity = 8;
+    MPMCRingBuffer<U32> ringBuffer(capacity);
+
+    U32 value = 0;
+    BOOST_CHECK(ringBuffer.TryPop(value) == false);
+
+    for (U32 round = 0; round < 3; ++round)
+    {
+        for (U32 i = 0; i < capacity; ++i)
+            BOOST_CHECK(ringBuffer.TryPush(U32{round * 100 + i}));
+        BOOST_CHECK(ringBuffer.GetSize() == capacity);
+        BOOST_CHECK(ringBuffer.TryPush(U32{1000}) == false);
+
+        for (U32 i = 0; i < capacity / 2; ++i)
+        {
+            BOOST_CHECK(ringBuffer.TryPop(value));
+            BOOST_CHECK(value == round * 100 + i);
+        }
+        for (U32 i = 0; i < capacity / 2; ++i)
+            BOOST_CHECK(ringBuffer.TryPush(U32{round * 100 + capacity + i}));
+        BOOST_CHECK(ringBuffer.TryPush(U32{1000}) == false);
+
+        for (U32 i = capacity / 2; i < capacity + capacity / 2; ++i)
+        {
+            BOOST_CHECK(ringBuffer.TryPop(value));
+            BOOST_CHECK(value == round * 100 + i);
+        }
+        BOOST_CHECK(ringBuffer.IsEmpty());
+        BOOST_CHECK(ringBuffer.TryPop(value) == false);
+    }
+}
+
+
+
+//! @brief Checks that failed pushes do not move the value and that remaining values are destroyed
+BOOST_AUTO_TEST_CASE(Value_Lifetime)
+{
+    auto value = std::make_shared<U32>(42);
+
+    {
+        MPMCRingBuffer<std::shared_ptr<U32>> ringBuffer(2);
+        auto copy = value;
+        BOOST_CHECK(ringBuffer.TryPush(std::move(copy)));
+        copy = value;
+        BOOST_CHECK(ringBuffer.TryPush(std::move(copy)));
+        copy = value;
+        BOOST_CHECK(ringBuffer.TryPush(std::move(copy)) == false);
+        BOOST_CHECK(copy != nullptr);
+        BOOST_CHECK(value.use_count() == 4);
+    }
+
+    BOOST_CHECK(value.use_count() == 1);
+}
+
+
+
+//! @brief Checks that every value is fetched exactly once if multiple producers compete with multiple consumers
+BOOST_AUTO_TEST_CASE(Thread_Safety)
+{
+    constexpr U32 numProducers = 4;
+    constexpr U32 numConsumers = 4;
+    constexpr U32 numValuesPerProducer = 50000;
+    constexpr U32 numValues = numProducers * numValuesPerProducer;
+
+    MPMCRingBuffer<U32> ringBuffer(64);
+    std::vector<std::atomic<U32>> fetchCount(numValues);
+    for (auto& count : fetchCount)
+        count = 0;
+
+    std::atomic<U32> numFetched = 0;
+    std::array<std::thread, numProducers> producers;
+    std::array<std::thread, numConsumers> consumers;
+
+    for (U32 i = 0; i < numConsumers; ++i)
+        consumers[i] = std::thread([&]() {
+            U32 value = 0;
+            while (numFetched < numValues)
+                if (ringBuffer.TryPop(value))
+                {
+                    ++fetchCount[value];
+                    ++numFetched;
+                }
+                else
+                    std::this_thread::yield();
+        });
+
+    for (U32 i = 0; i < numProducers; ++i)
+        producers[i] = std::thread([&, i]() {
+            for (U32 j = 0; j < numValuesPerProducer; ++j)
+                while (!ringBuffer.TryPush(i * numValuesPerProducer + j))
+                    std::this_thread::yield();
+        });
+
+    for (auto& producer : producers)
+        producer.join();
+    for (auto& consumer : consumers)
+        consumer.join();
+
+    BOOST_CHECK(ringBuffer.IsEmpty());
+    for (const auto& count : fetchCount)
+        BOOST_CHECK(count == 1);
+}
@@ -0,0 +1,174 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/exception.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/parallelFor.h"
+#include "gdl/resources/cpu/utility/deadlockTerminationTimer.h"
+
+#include "test/tools/ExceptionChecks.h"
+
+#include <array>
+#include <atomic>
+
+using namespace GDL;
+
+constexpr std::array<Partitioner, 4> partitioners = {{Partitioner::RECURSIVE, Partitioner::STATIC,
+                                                      Partitioner::DYNAMIC, Partitioner::GUIDED}};
+
+
+// Helper functions %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+
+//! @brief Checks that every index of a range is visited exactly once for all partitioners
+//! @tparam _workStealing: Work stealing mode of the thread pool
+//! @param numThreads: Number of worker threads
+template <bool _workStealing>
+void CheckAllIndicesVisitedOnce(U32 numThreads)
+{
+    DeadlockTerminationTimer dtt;
+    ThreadPool<1, _workStealing> tp(numThreads);
+
+    constexpr std::array<U64, 5> grainSizes = {{1, 7, 64, 1000, 5000}};
+    constexpr U64 begin = 13;
+    constexpr U64 end = 4013;
+
+    for (auto partitioner : partitioners)
+        for (auto grainSize : grainSizes)
+        {
+            Vector<std::atomic<U32>> visits(end);
+            for (auto& visit : visits)
+                visit = 0;
+
+            ParallelFor(tp, begin, end, grainSize,
+                        [&](U64 chunkBegin, U64 chunkEnd) {
+                            BOOST_CHECK(chunkBegin < chunkEnd);
+                            for (U64 i = chunkBegin; i < chunkEnd; ++i)
+                                ++visits[i];
+                        },
+                        partitioner);
+
+            for (U64 i = 0; i < end; ++i)
+                BOOST_CHECK(visits[i] == ((i < begin) ? 0 : 1));
+        }
+
+    tp.Deinitialize();
+}
+
+
+
+// Tests %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+
+//! @brief Checks if all indices are processed. A thread pool without worker threads has to be processed by the calling
+//! thread.
+BOOST_AUTO_TEST_CASE(ParallelFor_Visit_All_Indices)
+{
+    CheckAllIndicesVisitedOnce<false>(0);
+    CheckAllIndicesVisitedOnce<false>(3);
+    CheckAllIndicesVisitedOnce<true>(0);
+    CheckAllIndicesVisitedOnce<true>(3);
+}
+
+
+
+//! @brief Checks the loop bodies that are called once per index and empty ranges
+BOOST_AUTO_TEST_CASE(ParallelFor_Index_Body_And_Empty_Range)
+{
+    DeadlockTerminationTimer dtt;
+    ThreadPool tp(2);
+
+    constexpr U64 numIndices = 1000;
+    Vector<std::atomic<U32>> visits(numIndices);
+    for (auto& visit : visits)
+        visit = 0;
+
+    for (auto partitioner : partitioners)
+        ParallelFor(tp, 0, numIndices, 10, [&](U64 i) { ++visits[i]; }, partitioner);
+
+    for (const auto& visit : visits)
+        BOOST_CHECK(visit == partitioners.size());
+
+    U32 counter = 0;
+    ParallelFor(tp, 5, 5, 1, [&](U64) { ++counter; });
+    BOOST_CHECK(counter == 0);
+
+    GDL_CHECK_THROW_DEV_DISABLE(ParallelFor(tp, 0, 10, 0, [](U64) {}), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(ParallelFor(tp, 10, 0, 1, [](U64) {}), Exception);
+
+    tp.Deinitialize();
+}
+
+
+
+//! @brief Checks the reduction results
+BOOST_AUTO_TEST_CASE(ParallelReduce_Sum)
+{
+    DeadlockTerminationTimer dtt;
+    ThreadPool<1, true> tp(3);
+
+    constexpr U64 numValues = 100000;
+    constexpr U64 expectedSum = numValues * (numValues - 1) / 2;
+
+    auto sumRange = [](U64 chunkBegin, U64 chunkEnd) {
+        U64 sum = 0;
+        for (U64 i = chunkBegin; i < chunkEnd; ++i)
+            sum += i;
+        return sum;
+    };
+    auto add = [](const U64& lhs, const U64& rhs) { return lhs + rhs; };
+
+    for (auto partitioner : partitioners)
+        BOOST_CHECK(ParallelReduce(tp, 0, numValues, 256, U64{0}, sumRange, add, partitioner) == expectedSum);
+
+    BOOST_CHECK(ParallelReduce(tp, 3, 3, 256, U64{42}, sumRange, add) == 42);
+
+    auto max = [](const U64& lhs, const U64& rhs) { return std::max(lhs, rhs); };
+    auto maxRange = [](U64, U64 chunkEnd) { return chunkEnd - 1; };
+    BOOST_CHECK(ParallelReduce(tp, 0, numValues, 100, U64{0}, maxRange, max, Partitioner::GUIDED) == numValues - 1);
+
+    tp.Deinitialize();
+}
+
+
+
+//! @brief Checks if exceptions of the loop body are rethrown in the calling thread
+BOOST_AUTO_TEST_CASE(ParallelFor_Exceptions)
+{
+    DeadlockTerminationTimer dtt;
+    ThreadPool tp(2);
+
+    for (auto partitioner : partitioners)
+        BOOST_CHECK_THROW(ParallelFor(tp, 0, 10000, 10,
+                                      [](U64 i) {
+                                          if (i == 5000)
+                                              THROW("Failed");
+                                      },
+                                      partitioner),
+                          Exception);
+
+    // Worker threads must still be alive
+    BOOST_CHECK(tp.GetNumThreads() == 2);
+    BOOST_CHECK(tp.GetExceptionLogSize() == 0);
+    tp.Deinitialize();
+}
+
+
+
+//! @brief Checks nested parallel loops. The outer loop bodies have to help processing the inner loops.
+BOOST_AUTO_TEST_CASE(ParallelFor_Nested)
+{
+    DeadlockTerminationTimer dtt;
+    ThreadPool<1, true> tp(3);
+
+    constexpr U64 numOuter = 16;
+    constexpr U64 numInner = 500;
+    std::atomic<U64> counter = 0;
+
+    ParallelFor(tp, 0, numOuter, 1, [&](U64) {
+        ParallelFor(tp, 0, numInner, 16, [&](U64) { counter.fetch_add(1, std::memory_order_relaxed); });
+    });
+
+    BOOST_CHECK(counter == numOuter * numInner);
+    tp.Deinitialize();
+}
@@ -5,6 +5,7 @@
 #include "gdl/resources/cpu/spinlock.h"
 
 #include <array>
+#include <chrono>
 #include <atomic>
 #include <mutex>
 #include <thread>
@@ -13,8 +14,10 @@ using namespace GDL;
 
 
 
-//! @brief Checks error free construction and destruction
-BOOST_AUTO_TEST_CASE(thread_safety)
+//! @brief Increments a shared value from multiple threads and checks that no increment got lost
+//! @tparam _spinLock: Spinlock type
+template <typename _spinLock>
+void TestThreadSafety()
 {
     constexpr U32 numThreads = 10;
     constexpr U32 numIterations = 10000;
@@ -22,14 +25,14 @@ BOOST_AUTO_TEST_CASE(thread_safety)
     std::array<std::thread, numThreads> threads;
 
     U32 value = 0;
-    SpinLock sp;
+    _spinLock sp;
 
     for (U32 i = 0; i < numThreads; ++i)
         threads[i] = std::thread([&value, &sp]() {
 
             for (U32 j = 0; j < numIterations; ++j)
             {
-                std::lock_guard<SpinLock> lock(sp);
+                std::lock_guard<_spinLock> lock(sp);
                 value++;
             }
         });
@@ -39,3 +42,107 @@ BOOST_AUTO_TEST_CASE(thread_safety)
 
     BOOST_CHECK(value == numThreads * numIterations);
 }
+
+
+
+//! @brief Checks error free construction and destruction
+BOOST_AUTO_TEST_CASE(thread_safety)
+{
+    TestThreadSafety<SpinLock>();
+    TestThreadSafety<TTASSpinLockTemplate<false>>();
+    TestThreadSafety<TTASSpinLockTemplate<true>>();
+    TestThreadSafety<TicketSpinLockTemplate<false>>();
+    TestThreadSafety<TicketSpinLockTemplate<true>>();
+}
+
+
+
+//! @brief Checks that try_lock fails if the lock is already locked
+//! @tparam _spinLock: Spinlock type
+template <typename _spinLock>
+void TestTryLock()
+{
+    _spinLock sp;
+    BOOST_CHECK(sp.try_lock());
+    BOOST_CHECK(!sp.try_lock());
+    sp.unlock();
+
+    sp.lock();
+    std::thread([&sp]() { BOOST_CHECK(!sp.try_lock()); }).join();
+    sp.unlock();
+
+    std::thread([&sp]() {
+        BOOST_CHECK(sp.try_lock());
+        sp.unlock();
+    }).join();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(try_lock)
+{
+    TestTryLock<TTASSpinLockTemplate<false>>();
+    TestTryLock<TTASSpinLockTemplate<true>>();
+    TestTryLock<TicketSpinLockTemplate<false>>();
+    TestTryLock<TicketSpinLockTemplate<true>>();
+}
+
+
+
+//! @brief Checks the collected contention statistics
+//! @tparam _spinLock: Spinlock type
+template <typename _spinLock>
+void TestStatistics()
+{
+    _spinLock sp;
+
+    for (U32 i = 0; i < 5; ++i)
+    {
+        std::lock_guard<_spinLock> lock(sp);
+    }
+    BOOST_CHECK(sp.try_lock());
+    BOOST_CHECK(!sp.try_lock());
+    sp.unlock();
+
+    SpinLockStatistics statistics = sp.GetStatistics();
+    BOOST_CHECK(statistics.mNumAcquisitions == 6);
+    BOOST_CHECK(statistics.mNumContendedAcquisitions == 0);
+    BOOST_CHECK(statistics.mNumSpinCycles == 0);
+
+    // Force a contended acquisition
+    std::atomic_bool waiting = false;
+    sp.lock();
+    std::thread thread([&]() {
+        waiting = true;
+        std::lock_guard<_spinLock> lock(sp);
+    });
+    while (!waiting)
+        std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    sp.unlock();
+    thread.join();
+
+    statistics = sp.GetStatistics();
+    BOOST_CHECK(statistics.mNumAcquisitions == 8);
+    BOOST_CHECK(statistics.mNumContendedAcquisitions == 1);
+    BOOST_CHECK(statistics.mNumSpinCycles > 0);
+
+    sp.ResetStatistics();
+    statistics = sp.GetStatistics();
+    BOOST_CHECK(statistics.mNumAcquisitions == 0);
+    BOOST_CHECK(statistics.mNumContendedAcquisitions == 0);
+    BOOST_CHECK(statistics.mNumSpinCycles == 0);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(statistics)
+{
+    TestStatistics<TTASSpinLockTemplate<true>>();
+    TestStatistics<TicketSpinLockTemplate<true>>();
+
+    TTASSpinLockTemplate<false> sp;
+    sp.lock();
+    sp.unlock();
+    BOOST_CHECK(sp.GetStatistics().mNumAcquisitions == 0);
+}
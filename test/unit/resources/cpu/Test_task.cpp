@@ -0,0 +1,166 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/task.h"
+#include "gdl/resources/memory/utility/heapAllocationCounter.h"
+
+#include <array>
+#include <utility>
+
+using namespace GDL;
+
+
+
+// Helper classes %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Callable object that counts its constructions, destructions and executions
+//! @tparam _paddingSize: Size of an additional member that controls the size of the object
+template <U32 _paddingSize>
+struct CountingFunctor
+{
+    I32& mNumLiving;
+    I32& mNumExecutions;
+    std::array<U8, _paddingSize> mPadding = {};
+
+    CountingFunctor(I32& numLiving, I32& numExecutions)
+        : mNumLiving{numLiving}
+        , mNumExecutions{numExecutions}
+    {
+        ++mNumLiving;
+    }
+
+    CountingFunctor(const CountingFunctor& other)
+        : mNumLiving{other.mNumLiving}
+        , mNumExecutions{other.mNumExecutions}
+        , mPadding{other.mPadding}
+    {
+        ++mNumLiving;
+    }
+
+    CountingFunctor(CountingFunctor&& other) noexcept
+        : mNumLiving{other.mNumLiving}
+        , mNumExecutions{other.mNumExecutions}
+        , mPadding{other.mPadding}
+    {
+        ++mNumLiving;
+    }
+
+    CountingFunctor& operator=(const CountingFunctor&) = delete;
+    CountingFunctor& operator=(CountingFunctor&&) = delete;
+
+    ~CountingFunctor()
+    {
+        --mNumLiving;
+    }
+
+    void operator()()
+    {
+        ++mNumExecutions;
+    }
+};
+
+
+
+//! @brief Checks construction, execution, moving and destruction of a task for the passed functor type
+//! @tparam _functor: Functor type
+template <typename _functor>
+void CheckTaskLifetime()
+{
+    I32 numLiving = 0;
+    I32 numExecutions = 0;
+
+    {
+        Task task(_functor(numLiving, numExecutions));
+        BOOST_CHECK(numLiving == 1);
+        BOOST_CHECK(task.IsEmpty() == false);
+
+        task.Execute();
+        BOOST_CHECK(numExecutions == 1);
+
+        Task movedTask(std::move(task));
+        BOOST_CHECK(task.IsEmpty());
+        BOOST_CHECK(movedTask.IsEmpty() == false);
+        BOOST_CHECK(numLiving == 1);
+
+        movedTask.Execute();
+        BOOST_CHECK(numExecutions == 2);
+
+        Task assignedTask;
+        BOOST_CHECK(assignedTask.IsEmpty());
+        assignedTask = std::move(movedTask);
+        BOOST_CHECK(movedTask.IsEmpty());
+        BOOST_CHECK(numLiving == 1);
+
+        // Overwriting a non empty task must destroy the old callable object
+        _functor functor(numLiving, numExecutions);
+        Task otherTask(functor);
+        BOOST_CHECK(numLiving == 3);
+        assignedTask = std::move(otherTask);
+        BOOST_CHECK(numLiving == 2);
+
+        assignedTask.Execute();
+        BOOST_CHECK(numExecutions == 3);
+    }
+
+    BOOST_CHECK(numLiving == 0);
+}
+
+
+
+// Tests %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+
+
+//! @brief Checks which callable objects are stored inside of the task
+BOOST_AUTO_TEST_CASE(Internal_Storage)
+{
+    using SmallFunctor = CountingFunctor<8>;
+    using LargeFunctor = CountingFunctor<Task::BufferSize>;
+
+    struct ThrowingMove
+    {
+        ThrowingMove() = default;
+        ThrowingMove(const ThrowingMove&) = default;
+        ThrowingMove(ThrowingMove&&) noexcept(false) {}
+        ThrowingMove& operator=(const ThrowingMove&) = default;
+        ThrowingMove& operator=(ThrowingMove&&) = default;
+        ~ThrowingMove() = default;
+        void operator()() {}
+    };
+
+    BOOST_CHECK(Task::IsStoredInternally<SmallFunctor>());
+    BOOST_CHECK(Task::IsStoredInternally<LargeFunctor>() == false);
+    BOOST_CHECK(Task::IsStoredInternally<ThrowingMove>() == false);
+}
+
+
+
+//! @brief Checks the lifetime of stored callable objects
+BOOST_AUTO_TEST_CASE(Lifetime)
+{
+    CheckTaskLifetime<CountingFunctor<8>>();
+    CheckTaskLifetime<CountingFunctor<Task::BufferSize>>();
+}
+
+
+
+//! @brief Checks that tasks with small captures do not allocate memory
+BOOST_AUTO_TEST_CASE(No_Allocations_For_Small_Captures)
+{
+    I32 counter = 0;
+    std::array<I32, 4> values = {{1, 2, 3, 4}};
+
+    HeapAllocationCounter hac;
+    {
+        Task task([&counter, values]() {
+            for (auto value : values)
+                counter += value;
+        });
+        Task movedTask(std::move(task));
+        movedTask.Execute();
+    }
+
+    BOOST_CHECK(counter == 10);
+    BOOST_CHECK(hac.GetNumNewCalls() == 0);
+    BOOST_CHECK(hac.GetNumDeleteCalls() == 0);
+}
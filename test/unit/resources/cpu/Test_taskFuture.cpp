@@ -0,0 +1,167 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/exception.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/taskFuture.h"
+
+#include "test/tools/ExceptionChecks.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace GDL;
+
+
+
+//! @brief Checks setting and getting values
+BOOST_AUTO_TEST_CASE(Promise_And_Future)
+{
+    TaskFuture<I32> invalidFuture;
+    BOOST_CHECK(invalidFuture.IsValid() == false);
+
+    TaskPromise<I32> promise;
+    TaskFuture<I32> future = promise.GetFuture();
+    TaskFuture<I32> futureCopy = future;
+
+    BOOST_CHECK(future.IsValid());
+    BOOST_CHECK(future.IsReady() == false);
+
+    promise.SetValue(42);
+    BOOST_CHECK(future.IsReady());
+    BOOST_CHECK(futureCopy.IsReady());
+    BOOST_CHECK(future.HasException() == false);
+    BOOST_CHECK(future.Get() == 42);
+    BOOST_CHECK(futureCopy.Get() == 42);
+    GDL_CHECK_THROW_DEV_DISABLE(promise.SetValue(1), Exception);
+
+    TaskPromise<void> promiseVoid;
+    TaskFuture<void> futureVoid = promiseVoid.GetFuture();
+    BOOST_CHECK(futureVoid.IsReady() == false);
+    promiseVoid.SetValue();
+    BOOST_CHECK(futureVoid.IsReady());
+    BOOST_CHECK_NO_THROW(futureVoid.Get());
+}
+
+
+
+//! @brief Checks the exception handling
+BOOST_AUTO_TEST_CASE(Exceptions)
+{
+    TaskPromise<I32> promise;
+    TaskFuture<I32> future = promise.GetFuture();
+    promise.ExecuteAndSetResult([]() -> I32 { THROW("Failed"); });
+
+    BOOST_CHECK(future.IsReady());
+    BOOST_CHECK(future.HasException());
+    BOOST_CHECK_THROW(future.Get(), Exception);
+
+    // Destroyed promise without result
+    TaskFuture<void> brokenFuture;
+    {
+        TaskPromise<void> brokenPromise;
+        brokenFuture = brokenPromise.GetFuture();
+    }
+    BOOST_CHECK(brokenFuture.IsReady());
+    BOOST_CHECK_THROW(brokenFuture.Get(), Exception);
+
+    // Moved promise should not break the future
+    TaskPromise<I32> movedPromise;
+    TaskFuture<I32> movedFuture = movedPromise.GetFuture();
+    {
+        TaskPromise<I32> newPromise = std::move(movedPromise);
+        newPromise.ExecuteAndSetResult([]() { return 3; });
+    }
+    BOOST_CHECK(movedFuture.Get() == 3);
+}
+
+
+
+//! @brief Checks if continuations are executed when the future becomes ready
+BOOST_AUTO_TEST_CASE(OnReady)
+{
+    U32 counter = 0;
+
+    TaskPromise<I32> promise;
+    TaskFuture<I32> future = promise.GetFuture();
+    future.OnReady([&counter]() { ++counter; });
+    future.OnReady([&counter]() { ++counter; });
+    BOOST_CHECK(counter == 0);
+
+    promise.SetValue(1);
+    BOOST_CHECK(counter == 2);
+
+    // Already ready -> executed immediately
+    future.OnReady([&counter]() { ++counter; });
+    BOOST_CHECK(counter == 3);
+}
+
+
+
+//! @brief Checks the fan-in of multiple futures
+BOOST_AUTO_TEST_CASE(WhenAll_Fan_In)
+{
+    TaskPromise<I32> promiseInt;
+    TaskPromise<F32> promiseFloat;
+    TaskPromise<void> promiseVoid;
+
+    TaskFuture<void> all = WhenAll(promiseInt.GetFuture(), promiseFloat.GetFuture(), promiseVoid.GetFuture());
+    BOOST_CHECK(all.IsReady() == false);
+
+    promiseInt.SetValue(1);
+    promiseVoid.SetValue();
+    BOOST_CHECK(all.IsReady() == false);
+    promiseFloat.SetValue(2.f);
+    BOOST_CHECK(all.IsReady());
+    BOOST_CHECK(all.HasException() == false);
+
+    // No dependencies
+    BOOST_CHECK(WhenAll().IsReady());
+    BOOST_CHECK(WhenAll(Vector<TaskFuture<I32>>()).IsReady());
+
+    // Exception forwarding
+    Vector<TaskPromise<I32>> promises(4);
+    Vector<TaskFuture<I32>> futures;
+    for (auto& promise : promises)
+        futures.push_back(promise.GetFuture());
+
+    TaskFuture<void> allVector = WhenAll(futures);
+    promises[0].SetValue(0);
+    promises[1].ExecuteAndSetResult([]() -> I32 { THROW("Failed"); });
+    promises[2].SetValue(2);
+    BOOST_CHECK(allVector.IsReady() == false);
+    promises[3].SetValue(3);
+    BOOST_CHECK(allVector.IsReady());
+    BOOST_CHECK(allVector.HasException());
+    BOOST_CHECK_THROW(allVector.Get(), Exception);
+}
+
+
+
+//! @brief Checks that a fan-in becomes ready exactly once if its dependencies are finished by multiple threads
+BOOST_AUTO_TEST_CASE(WhenAll_Thread_Safety)
+{
+    constexpr U32 numThreads = 4;
+    constexpr U32 numDependencies = 1000;
+
+    Vector<TaskPromise<U32>> promises(numDependencies);
+    Vector<TaskFuture<U32>> futures;
+    for (auto& promise : promises)
+        futures.push_back(promise.GetFuture());
+
+    std::atomic<U32> numReadyCalls = 0;
+    TaskFuture<void> all = WhenAll(futures);
+    all.OnReady([&numReadyCalls]() { ++numReadyCalls; });
+
+    std::array<std::thread, numThreads> threads;
+    for (U32 i = 0; i < numThreads; ++i)
+        threads[i] = std::thread([&promises, i]() {
+            for (U32 j = i; j < numDependencies; j += numThreads)
+                promises[j].SetValue(j);
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    BOOST_CHECK(all.IsReady());
+    BOOST_CHECK(numReadyCalls == 1);
+}
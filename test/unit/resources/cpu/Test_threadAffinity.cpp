@@ -0,0 +1,54 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/exception.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/string.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/threadAffinity.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace GDL;
+
+
+
+//! @brief Pins a thread to a single CPU and checks the affinity afterwards
+BOOST_AUTO_TEST_CASE(Affinity)
+{
+    std::thread thread([]() {
+        const Vector<U32> initialAffinity = GetCurrentThreadAffinity();
+        BOOST_REQUIRE(!initialAffinity.empty());
+        BOOST_CHECK(std::is_sorted(initialAffinity.begin(), initialAffinity.end()));
+
+        const U32 cpu = initialAffinity.back();
+        SetCurrentThreadAffinity({cpu});
+        BOOST_CHECK(GetCurrentThreadAffinity() == Vector<U32>{cpu});
+
+        std::this_thread::yield();
+        BOOST_CHECK(GetCurrentCpu() == static_cast<I32>(cpu));
+
+        SetCurrentThreadAffinity(initialAffinity);
+        BOOST_CHECK(GetCurrentThreadAffinity() == initialAffinity);
+
+        BOOST_CHECK_THROW(SetCurrentThreadAffinity({}), Exception);
+        BOOST_CHECK_THROW(SetCurrentThreadAffinity({1u << 20}), Exception);
+        BOOST_CHECK(GetCurrentThreadAffinity() == initialAffinity);
+    });
+    thread.join();
+}
+
+
+
+//! @brief Sets a thread name and checks that long names are truncated
+BOOST_AUTO_TEST_CASE(Name)
+{
+    std::thread thread([]() {
+        SetCurrentThreadName("gdl worker");
+        BOOST_CHECK(GetCurrentThreadName() == "gdl worker");
+
+        SetCurrentThreadName("a very long thread name");
+        BOOST_CHECK(GetCurrentThreadName() == String("a very long thread name").substr(0, MaxThreadNameLength));
+    });
+    thread.join();
+}
@@ -2,11 +2,17 @@
 
 #include "gdl/base/exception.h"
 #include "gdl/base/time.h"
+#include "gdl/base/string.h"
+#include "gdl/base/container/vector.h"
+#include "gdl/resources/cpu/threadAffinity.h"
 #include "gdl/resources/cpu/threadPool.h"
 #include "gdl/resources/cpu/utility/deadlockTerminationTimer.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <mutex>
+#include <utility>
 
 using namespace GDL;
 using namespace std::chrono_literals;
@@ -429,3 +435,530 @@ BOOST_AUTO_TEST_CASE(MultiQueue_LIFO_ThreadDestruction)
     BOOST_CHECK(tp.GetNumTasks(2) == 1);
     BOOST_CHECK(tp.GetNumTasks(3) == 2);
 }
+
+
+
+// Thread pool tests (work stealing) %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+
+//! @brief Submits tasks recursively from inside of the worker threads until the passed depth is reached
+//! @param threadPool: Thread pool
+//! @param counter: Counts the number of executed tasks
+//! @param depth: Remaining recursion depth
+template <I32 _numQueues>
+void RecursiveTask(ThreadPool<_numQueues, true>& threadPool, std::atomic<U32>& counter, U32 depth)
+{
+    ++counter;
+    if (depth == 0)
+        return;
+    for (U32 i = 0; i < 2; ++i)
+        threadPool.Submit(_numQueues - 1, [&threadPool, &counter, depth] {
+            RecursiveTask(threadPool, counter, depth - 1);
+        });
+}
+
+
+//! @brief Tests the construction and deinitialization of a work stealing thread pool
+BOOST_AUTO_TEST_CASE(WorkStealing_Construction_And_Deinitialization)
+{
+    DeadlockTerminationTimer dtt;
+    ThreadPool<1, true> tp(100);
+}
+
+
+//! @brief Checks if all tasks that are submitted from inside of the worker threads are processed
+BOOST_AUTO_TEST_CASE(WorkStealing_Submit_From_Worker_Threads)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 depth = 12;
+    constexpr U32 numExpectedTasks = (1 << (depth + 1)) - 1;
+
+    ThreadPool<1, true> tp(4);
+    std::atomic<U32> counter = 0;
+
+    tp.Submit([&] { RecursiveTask(tp, counter, depth); });
+
+    while (counter < numExpectedTasks)
+        std::this_thread::yield();
+
+    BOOST_CHECK(counter == numExpectedTasks);
+    BOOST_CHECK(tp.HasTasks() == false);
+    BOOST_CHECK(tp.GetNumTasks() == 0);
+}
+
+
+//! @brief Checks if threads that are not managed by the thread pool can steal tasks from the local queues of the
+//! worker threads
+BOOST_AUTO_TEST_CASE(WorkStealing_External_Thread_Steals_Tasks)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 numSubTasks = 100;
+
+    ThreadPool<1, true> tp(1);
+    std::thread::id parentThreadID = std::this_thread::get_id();
+    std::atomic<U32> counterParent = 0;
+    std::atomic_bool blockWorker = true;
+    std::atomic_bool workerBlocked = false;
+
+    // The worker fills its local queue and gets blocked afterwards
+    tp.Submit([&] {
+        for (U32 i = 0; i < numSubTasks; ++i)
+            tp.Submit([&] {
+                if (parentThreadID == std::this_thread::get_id())
+                    ++counterParent;
+            });
+        tp.Submit([&] {
+            workerBlocked = true;
+            while (blockWorker)
+                std::this_thread::yield();
+        });
+    });
+
+    while (!workerBlocked)
+        std::this_thread::yield();
+    BOOST_CHECK(tp.GetNumTasks() == numSubTasks);
+
+    // The worker takes the blocking task from the bottom of its local queue - the parent steals from the top
+    while (counterParent < numSubTasks)
+        tp.TryExecuteTask();
+    blockWorker = false;
+
+    BOOST_CHECK(counterParent == numSubTasks);
+    BOOST_CHECK(tp.HasTasks() == false);
+}
+
+
+//! @brief Checks that tasks which remain in the local queues of closed threads are moved to the shared queue
+BOOST_AUTO_TEST_CASE(WorkStealing_Close_Threads_With_Local_Tasks)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 numSubTasks = 50;
+
+    ThreadPool<1, true> tp(1);
+    std::atomic<U32> counter = 0;
+    std::atomic_bool subTasksSubmitted = false;
+
+    tp.Submit([&] {
+        for (U32 i = 0; i < numSubTasks; ++i)
+            tp.Submit([&] { ++counter; });
+        subTasksSubmitted = true;
+    });
+
+    while (!subTasksSubmitted)
+        std::this_thread::yield();
+    tp.CloseAllThreads();
+
+    BOOST_CHECK(tp.GetNumThreads() == 0);
+    BOOST_CHECK(tp.GetNumTasks() + counter == numSubTasks);
+
+    while (tp.TryExecuteTask())
+        ;
+    BOOST_CHECK(counter == numSubTasks);
+    BOOST_CHECK(tp.HasTasks() == false);
+}
+
+
+//! @brief Checks that sleeping threads steal the tasks of a worker that is blocked by its current task
+BOOST_AUTO_TEST_CASE(WorkStealing_Sleeping_Threads_Steal_Local_Tasks)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 numRepetitions = 100;
+    constexpr U32 numSubTasks = 20;
+
+    ThreadPool<1, true> tp;
+    tp.SetIdleThresholds(0, 0);
+    tp.StartThreads(2);
+
+    for (U32 i = 0; i < numRepetitions; ++i)
+    {
+        std::atomic<U32> counter = 0;
+        std::atomic_bool finished = false;
+
+        // Only the other thread can process the local tasks while the submitting worker is blocked
+        tp.Submit([&] {
+            for (U32 j = 0; j < numSubTasks; ++j)
+                tp.Submit([&] { ++counter; });
+            while (counter < numSubTasks)
+                std::this_thread::yield();
+            finished = true;
+        });
+
+        while (!finished)
+            std::this_thread::yield();
+    }
+
+    tp.Deinitialize();
+}
+
+
+//! @brief Checks that tasks can query the number of tasks while the threads are closed
+BOOST_AUTO_TEST_CASE(WorkStealing_Query_Tasks_During_Close)
+{
+    DeadlockTerminationTimer dtt;
+
+    ThreadPool<1, true> tp(2);
+    std::atomic_bool taskStarted = false;
+    std::atomic_bool foundTasks = false;
+
+    tp.Submit([&] {
+        taskStarted = true;
+        const auto end = std::chrono::steady_clock::now() + 20ms;
+        while (std::chrono::steady_clock::now() < end)
+            if (tp.HasTasks() || tp.GetNumTasks() > 0)
+                foundTasks = true;
+    });
+
+    while (!taskStarted)
+        std::this_thread::yield();
+    tp.CloseAllThreads();
+
+    BOOST_CHECK(tp.GetNumThreads() == 0);
+    BOOST_CHECK(foundTasks == false);
+}
+
+
+//! @brief Checks if the queue priorities are kept in work stealing mode
+BOOST_AUTO_TEST_CASE(WorkStealing_MultiQueue_Submit_And_Process)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr I32 numQueues = 3;
+    constexpr U32 depth = 8;
+    constexpr U32 numExpectedTasks = (1 << (depth + 1)) - 1;
+
+    ThreadPool<numQueues, true> tp;
+    std::atomic<U32> counter = 0;
+
+    tp.StartThreads(4, [&]() {
+        for (I32 i = 0; i < numQueues; ++i)
+            if (tp.TryExecuteTask(i))
+                break;
+    });
+
+    tp.Submit(0, [&] { RecursiveTask(tp, counter, depth); });
+
+    while (counter < numExpectedTasks)
+        std::this_thread::yield();
+
+    for (I32 i = 0; i < numQueues; ++i)
+        BOOST_CHECK(tp.HasTasks(i) == false);
+
+
+    // Tasks in a lower queue are only processed if the higher priority queues are empty
+    tp.CloseAllThreads();
+    std::atomic<U32> lowPriorityCounter = 0;
+    std::atomic_bool highPriorityPending = true;
+
+    tp.Submit(1, [&] {
+        if (!highPriorityPending)
+            ++lowPriorityCounter;
+    });
+    tp.Submit(0, [&] { highPriorityPending = false; });
+
+    tp.StartThreads(1, [&]() {
+        for (I32 i = 0; i < numQueues; ++i)
+            if (tp.TryExecuteTask(i))
+                break;
+    });
+
+    while (tp.HasTasks(0) || tp.HasTasks(1))
+        std::this_thread::yield();
+    tp.CloseAllThreads();
+
+    BOOST_CHECK(lowPriorityCounter == 1);
+}
+
+
+
+// Thread pool tests (futures and task graphs) %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+
+//! @brief Checks if results and exceptions of submitted tasks are stored in the returned futures
+BOOST_AUTO_TEST_CASE(Futures_Submit_With_Future)
+{
+    DeadlockTerminationTimer dtt;
+    ThreadPool tp(2);
+
+    TaskFuture<I32> future = tp.SubmitWithFuture([](I32 a, I32 b) { return a + b; }, 3, 4);
+    TaskFuture<void> futureVoid = tp.SubmitWithFuture([]() { std::this_thread::sleep_for(1ms); });
+    TaskFuture<I32> futureException = tp.SubmitWithFuture([]() -> I32 { THROW("Failed"); });
+
+    tp.Wait(future);
+    tp.Wait(futureVoid);
+    tp.Wait(futureException);
+
+    BOOST_CHECK(future.Get() == 7);
+    BOOST_CHECK_NO_THROW(futureVoid.Get());
+    BOOST_CHECK_THROW(futureException.Get(), Exception);
+
+    // Task exceptions are stored in the future and not in the exception log
+    BOOST_CHECK(tp.GetExceptionLogSize() == 0);
+    tp.Deinitialize();
+}
+
+
+//! @brief Checks if a waiting thread executes pending tasks
+BOOST_AUTO_TEST_CASE(Futures_Wait_Helps_Executing_Tasks)
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 numTasks = 100;
+
+    // No worker threads - all tasks have to be processed by the waiting thread
+    ThreadPool<2> tp;
+    std::atomic<U32> counter = 0;
+
+    Vector<TaskFuture<void>> futures;
+    for (U32 i = 0; i < numTasks; ++i)
+        futures.push_back(tp.SubmitWithFuture(i % 2, [&counter]() { ++counter; }));
+
+    tp.Wait(WhenAll(futures));
+    BOOST_CHECK(counter == numTasks);
+    BOOST_CHECK(tp.HasTasks(0) == false);
+    BOOST_CHECK(tp.HasTasks(1) == false);
+
+
+    // Worker thread waits for a sub task inside of a task
+    tp.StartThreads(1, [&tp]() { tp.TryExecuteTask(0); });
+    TaskFuture<I32> future = tp.SubmitWithFuture(0, [&tp]() {
+        TaskFuture<I32> subFuture = tp.SubmitWithFuture(0, []() { return 5; });
+        tp.Wait(subFuture);
+        return subFuture.Get() * 2;
+    });
+
+    tp.Wait(future);
+    BOOST_CHECK(future.Get() == 10);
+    tp.Deinitialize();
+}
+
+
+//! @brief Checks if continuations are scheduled after their dependencies are ready and get the correct results
+template <bool _workStealing>
+void TestTaskGraph()
+{
+    DeadlockTerminationTimer dtt;
+    constexpr U32 numBranches = 32;
+
+    ThreadPool<1, _workStealing> tp(4);
+    std::atomic_bool releaseRoot = false;
+
+    TaskFuture<I32> root = tp.SubmitWithFuture([&releaseRoot]() {
+        while (!releaseRoot)
+            std::this_thread::yield();
+        return 1;
+    });
+
+    // Fan-out
+    Vector<TaskFuture<I32>> branches;
+    for (U32 i = 0; i < numBranches; ++i)
+        branches.push_back(tp.SubmitContinuation(root, [i](const I32& value) { return value + static_cast<I32>(i); }));
+
+    BOOST_CHECK(root.IsReady() == false);
+    for (const auto& branch : branches)
+        BOOST_CHECK(branch.IsReady() == false);
+
+    // Fan-in
+    TaskFuture<I32> sum = tp.SubmitContinuation(WhenAll(branches), [&branches]() {
+        I32 result = 0;
+        for (const auto& branch : branches)
+        {
+            BOOST_CHECK(branch.IsReady());
+            result += branch.Get();
+        }
+        return result;
+    });
+
+    TaskFuture<void> failed = tp.SubmitContinuation(sum, [](const I32&) { THROW("Failed"); });
+    TaskFuture<I32> skipped = tp.SubmitContinuation(failed, []() { return 0; });
+
+    releaseRoot = true;
+    tp.Wait(sum);
+    tp.Wait(skipped);
+
+    constexpr I32 expectedSum = numBranches + numBranches * (numBranches - 1) / 2;
+    BOOST_CHECK(sum.Get() == expectedSum);
+    BOOST_CHECK_THROW(failed.Get(), Exception);
+    BOOST_CHECK_THROW(skipped.Get(), Exception);
+
+    // Dependency is already ready
+    TaskFuture<I32> lateContinuation = tp.SubmitContinuation(sum, [](const I32& value) { return value + 1; });
+    tp.Wait(lateContinuation);
+    BOOST_CHECK(lateContinuation.Get() == expectedSum + 1);
+
+    tp.Deinitialize();
+}
+
+
+BOOST_AUTO_TEST_CASE(Futures_Task_Graph)
+{
+    TestTaskGraph<false>();
+}
+
+
+BOOST_AUTO_TEST_CASE(Futures_Task_Graph_Work_Stealing)
+{
+    TestTaskGraph<true>();
+}
+
+
+
+// Bounded queues %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Submits more tasks than the bounded queue can store and checks that all of them are executed
+//! @tparam _overflowPolicy: Overflow policy of the queue
+//! @tparam _workStealing: Work stealing mode of the thread pool
+template <OverflowPolicy _overflowPolicy, bool _workStealing>
+void TestBoundedQueue()
+{
+    constexpr U64 capacity = 16;
+    constexpr U32 numTasks = 1000;
+    using QueueType = BoundedThreadPoolQueue<Task, capacity, _overflowPolicy>;
+
+    DeadlockTerminationTimer dtt;
+
+    // Without worker threads, the submitting thread has to handle full queues
+    {
+        ThreadPool<1, _workStealing, QueueType> tp(0);
+        U32 counter = 0;
+        for (U32 i = 0; i < numTasks; ++i)
+            tp.Submit([&counter]() { ++counter; });
+
+        if constexpr (_overflowPolicy == OverflowPolicy::SPILL)
+        {
+            BOOST_CHECK(counter == 0);
+            BOOST_CHECK(tp.GetNumTasks() == numTasks);
+        }
+        else
+            BOOST_CHECK(tp.GetNumTasks() <= capacity);
+
+        while (tp.TryExecuteTask())
+            ;
+        BOOST_CHECK(counter == numTasks);
+        tp.Deinitialize();
+    }
+
+    // Worker threads submit recursively
+    {
+        ThreadPool<1, _workStealing, QueueType> tp(3);
+        std::atomic<U32> counter = 0;
+        for (U32 i = 0; i < numTasks; ++i)
+            tp.Submit([&]() {
+                ++counter;
+                tp.Submit([&counter]() { ++counter; });
+            });
+
+        while (counter < 2 * numTasks)
+            std::this_thread::yield();
+        BOOST_CHECK(tp.GetExceptionLogSize() == 0);
+        tp.Deinitialize();
+    }
+}
+
+
+
+BOOST_AUTO_TEST_CASE(BoundedQueue_Overflow_Policies)
+{
+    TestBoundedQueue<OverflowPolicy::BLOCK, false>();
+    TestBoundedQueue<OverflowPolicy::SPILL, false>();
+    TestBoundedQueue<OverflowPolicy::INLINE, false>();
+    TestBoundedQueue<OverflowPolicy::BLOCK, true>();
+    TestBoundedQueue<OverflowPolicy::SPILL, true>();
+    TestBoundedQueue<OverflowPolicy::INLINE, true>();
+}
+
+
+
+// Idle strategy %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Checks that idle threads go to sleep and are woken up by new tasks
+//! @tparam _workStealing: Work stealing mode of the thread pool
+template <bool _workStealing>
+void TestIdleThreadsSleep()
+{
+    constexpr U32 numThreads = 3;
+
+    DeadlockTerminationTimer dtt;
+    ThreadPool<1, _workStealing> tp(numThreads);
+
+    BOOST_CHECK(tp.GetNumIdleSpins() == tp.DefaultNumIdleSpins);
+    BOOST_CHECK(tp.GetNumIdleYields() == tp.DefaultNumIdleYields);
+    tp.SetIdleThresholds(16, 4);
+    BOOST_CHECK(tp.GetNumIdleSpins() == 16);
+    BOOST_CHECK(tp.GetNumIdleYields() == 4);
+
+    for (U32 round = 0; round < 10; ++round)
+    {
+        while (tp.GetNumSleepingThreads() != numThreads)
+            std::this_thread::yield();
+
+        std::atomic<U32> counter = 0;
+        for (U32 i = 0; i < 100; ++i)
+            tp.Submit([&]() {
+                ++counter;
+                tp.Submit([&counter]() { ++counter; });
+            });
+
+        while (counter != 200)
+            std::this_thread::yield();
+    }
+
+    // Closing sleeping threads must not deadlock
+    while (tp.GetNumSleepingThreads() != numThreads)
+        std::this_thread::yield();
+    tp.CloseThreads(1);
+    BOOST_CHECK(tp.GetNumThreads() == numThreads - 1);
+    tp.Deinitialize();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Idle_Threads_Sleep)
+{
+    TestIdleThreadsSleep<false>();
+    TestIdleThreadsSleep<true>();
+}
+
+
+
+// Thread placement %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+
+//! @brief Checks that the worker threads are pinned to the specified CPU sets before their initialization function is
+//! called and that they are named correctly
+BOOST_AUTO_TEST_CASE(Thread_Placement)
+{
+    DeadlockTerminationTimer dtt;
+
+    const Vector<U32> processAffinity = GetCurrentThreadAffinity();
+    BOOST_REQUIRE(!processAffinity.empty());
+    const Vector<Vector<U32>> cpuSets = {{processAffinity.back()}, processAffinity};
+
+    std::mutex mutex;
+    Vector<std::pair<String, Vector<U32>>> placements;
+
+    ThreadPool tp;
+    BOOST_CHECK_THROW(tp.SetThreadAffinities({{}}), Exception);
+    tp.SetThreadAffinities(cpuSets);
+    tp.SetThreadName("worker");
+    tp.StartThreads(3, [&tp]() { tp.TryExecuteTask(); },
+                    [&]() {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        placements.emplace_back(GetCurrentThreadName(), GetCurrentThreadAffinity());
+                    },
+                    []() {});
+
+    // Threads that are started after resetting the affinities are not pinned
+    tp.SetThreadAffinities({});
+    tp.StartThreads(1, [&tp]() { tp.TryExecuteTask(); },
+                    [&]() {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        placements.emplace_back(GetCurrentThreadName(), GetCurrentThreadAffinity());
+                    },
+                    []() {});
+    tp.Deinitialize();
+
+    BOOST_REQUIRE(placements.size() == 4);
+    std::sort(placements.begin(), placements.end());
+    for (U32 i = 0; i < 4; ++i)
+    {
+        BOOST_CHECK(placements[i].first == "worker" + ToString(i));
+        BOOST_CHECK(placements[i].second == ((i < 3) ? cpuSets[i % 2] : processAffinity));
+    }
+}
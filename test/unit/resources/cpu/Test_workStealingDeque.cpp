@@ -0,0 +1,125 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/exception.h"
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/resources/cpu/workStealingDeque.h"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace GDL;
+
+
+
+//! @brief Checks construction and the constructor exceptions
+BOOST_AUTO_TEST_CASE(Construction)
+{
+    BOOST_CHECK_NO_THROW(WorkStealingDeque<U32>(16));
+    BOOST_CHECK_THROW(WorkStealingDeque<U32>(0), Exception);
+    BOOST_CHECK_THROW(WorkStealingDeque<U32>(15), Exception);
+
+    WorkStealingDeque<U32> deque(32);
+    BOOST_CHECK(deque.GetCapacity() == 32);
+    BOOST_CHECK(deque.GetSize() == 0);
+    BOOST_CHECK(deque.IsEmpty());
+}
+
+
+
+//! @brief Checks that the owner gets values in LIFO order and thieves in FIFO order
+BOOST_AUTO_TEST_CASE(Push_Pop_Steal)
+{
+    constexpr U32 capacity = 8;
+    WorkStealingDeque<U32> deque(capacity);
+
+    U32 value = 0;
+    BOOST_CHECK(deque.TryPop(value) == false);
+    BOOST_CHECK(deque.TrySteal(value) == false);
+
+    for (U32 i = 0; i < capacity; ++i)
+        BOOST_CHECK(deque.TryPush(i));
+    BOOST_CHECK(deque.GetSize() == capacity);
+
+    // Deque is full
+    BOOST_CHECK(deque.TryPush(capacity) == false);
+
+    BOOST_CHECK(deque.TryPop(value));
+    BOOST_CHECK(value == capacity - 1);
+
+    BOOST_CHECK(deque.TrySteal(value));
+    BOOST_CHECK(value == 0);
+
+    BOOST_CHECK(deque.TrySteal(value));
+    BOOST_CHECK(value == 1);
+
+    BOOST_CHECK(deque.TryPop(value));
+    BOOST_CHECK(value == capacity - 2);
+    BOOST_CHECK(deque.GetSize() == capacity - 4);
+
+    // Indices wrap around the internal buffer
+    for (U32 i = 0; i < 4; ++i)
+        BOOST_CHECK(deque.TryPush(100 + i));
+    BOOST_CHECK(deque.TryPush(200) == false);
+
+    for (U32 i = 0; i < 4; ++i)
+    {
+        BOOST_CHECK(deque.TryPop(value));
+        BOOST_CHECK(value == 103 - i);
+    }
+    for (U32 i = 2; i < capacity - 2; ++i)
+    {
+        BOOST_CHECK(deque.TrySteal(value));
+        BOOST_CHECK(value == i);
+    }
+
+    BOOST_CHECK(deque.IsEmpty());
+    BOOST_CHECK(deque.TryPop(value) == false);
+    BOOST_CHECK(deque.TrySteal(value) == false);
+}
+
+
+
+//! @brief Checks that every value is fetched exactly once if multiple thieves compete with the owner
+BOOST_AUTO_TEST_CASE(Thread_Safety)
+{
+    constexpr U32 numThieves = 4;
+    constexpr U32 numValues = 100000;
+
+    WorkStealingDeque<U32> deque(64);
+    std::vector<std::atomic<U32>> fetchCount(numValues);
+    for (auto& count : fetchCount)
+        count = 0;
+
+    std::atomic_bool ownerFinished = false;
+    std::array<std::thread, numThieves> thieves;
+
+    for (auto& thief : thieves)
+        thief = std::thread([&]() {
+            U32 value = 0;
+            while (!ownerFinished || !deque.IsEmpty())
+                if (deque.TrySteal(value))
+                    ++fetchCount[value];
+        });
+
+    U32 value = 0;
+    for (U32 i = 0; i < numValues; ++i)
+    {
+        while (!deque.TryPush(i))
+            if (deque.TryPop(value))
+                ++fetchCount[value];
+
+        if (i % 3 == 0 && deque.TryPop(value))
+            ++fetchCount[value];
+    }
+    while (deque.TryPop(value))
+        ++fetchCount[value];
+    ownerFinished = true;
+
+    for (auto& thief : thieves)
+        thief.join();
+
+    for (U32 i = 0; i < numValues; ++i)
+        BOOST_CHECK(fetchCount[i] == 1);
+}
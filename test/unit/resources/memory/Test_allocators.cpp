@@ -4,6 +4,7 @@
 #include "gdl/base/fundamentalTypes.h"
 #include "gdl/base/functions/alignment.h"
 #include "gdl/resources/cpu/utility/deadlockTerminationTimer.h"
+#include "gdl/resources/memory/frameAllocator.h"
 #include "gdl/resources/memory/generalPurposeAllocator.h"
 #include "gdl/resources/memory/poolAllocator.h"
 #include "gdl/resources/memory/stackAllocator.h"
@@ -15,6 +16,7 @@
 #include "memoryManagerSetup.h"
 #include "test/tools/ExceptionChecks.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <map>
@@ -73,6 +75,16 @@ void CheckNoAllocations<PoolAllocator>(const HeapAllocationCounter& hac)
 }
 
 
+template <>
+void CheckNoAllocations<FrameAllocator>(const HeapAllocationCounter& hac)
+{
+#if !(defined(NO_GENERAL_PURPOSE_MEMORY) && defined(NO_FRAME_MEMORY))
+    BOOST_CHECK(hac.CheckNumCallsExpected(0, 0));
+#else
+    BOOST_CHECK(!hac.CheckNumCallsExpected(0, 0));
+#endif
+}
+
 template <>
 void CheckNoAllocations<StackAllocator>(const HeapAllocationCounter& hac)
 {
@@ -111,6 +123,7 @@ BOOST_AUTO_TEST_CASE(ComparisonOperators)
 
     BOOST_CHECK_NO_THROW(ComparisonOperatorsTest<GeneralPurposeAllocator>());
     BOOST_CHECK_NO_THROW(ComparisonOperatorsTest<PoolAllocator>());
+    BOOST_CHECK_NO_THROW(ComparisonOperatorsTest<FrameAllocator>());
     BOOST_CHECK_NO_THROW(ComparisonOperatorsTest<StackAllocator>());
     BOOST_CHECK_NO_THROW(ComparisonOperatorsTest<ThreadPrivateStackAllocator>());
 
@@ -155,6 +168,7 @@ BOOST_AUTO_TEST_CASE(Vector)
     InitializeMemoryManager();
 
     BOOST_CHECK_NO_THROW(VectorTest<GeneralPurposeAllocator>());
+    BOOST_CHECK_NO_THROW(VectorTest<FrameAllocator>());
     BOOST_CHECK_NO_THROW(VectorTest<StackAllocator>());
     BOOST_CHECK_NO_THROW(VectorTest<ThreadPrivateStackAllocator>());
     DeinitializeMemoryManager();
@@ -202,6 +216,7 @@ BOOST_AUTO_TEST_CASE(Map)
 
     BOOST_CHECK_NO_THROW(MapTest<GeneralPurposeAllocator>());
     BOOST_CHECK_NO_THROW(MapTest<PoolAllocator>());
+    BOOST_CHECK_NO_THROW(MapTest<FrameAllocator>());
     BOOST_CHECK_NO_THROW(MapTest<StackAllocator>());
     BOOST_CHECK_NO_THROW(MapTest<ThreadPrivateStackAllocator>());
 
@@ -244,6 +259,9 @@ void ThreadSafetyTest()
             {
 #ifndef NO_THREAD_PRIVATE_MEMORY_STACK
                 GetMemoryManager().CreatePrivateMemoryStackForThisThread(1_MB);
+#endif
+#ifdef MEMORY_TRACKING
+                WarmUpMemoryTrackers();
 #endif
                 ++threadsReady;
                 while (startTest == false)
@@ -310,6 +328,7 @@ BOOST_AUTO_TEST_CASE(Thread_Safety)
 
     BOOST_CHECK_NO_THROW(ThreadSafetyTest<GeneralPurposeAllocator>());
     BOOST_CHECK_NO_THROW(ThreadSafetyTest<PoolAllocator>());
+    BOOST_CHECK_NO_THROW(ThreadSafetyTest<FrameAllocator>());
     BOOST_CHECK_NO_THROW(ThreadSafetyTest<StackAllocator>());
     BOOST_CHECK_NO_THROW(ThreadSafetyTest<ThreadPrivateStackAllocator>());
 
@@ -365,3 +384,47 @@ BOOST_AUTO_TEST_CASE(Unique_Ptr)
 #endif
     DeinitializeMemoryManager();
 }
+
+
+
+// Memory tracking ----------------------------------------------------------------------------------------------------
+
+#ifdef MEMORY_TRACKING
+//! @brief Checks if the allocations of the allocators are recorded by the memory trackers of the memory manager
+BOOST_AUTO_TEST_CASE(Memory_Tracking)
+{
+    InitializeMemoryManager();
+    MemoryManager& memoryManager = GetMemoryManager();
+
+    MemoryInterface* memory = memoryManager.GetMemoryPool(sizeof(AlignedStruct), alignof(AlignedStruct));
+    if (memory == nullptr)
+        memory = memoryManager.GetGeneralPurposeMemory();
+    if (memory == nullptr)
+        memory = memoryManager.GetHeapMemory();
+    MemoryTracker* memoryTracker = memoryManager.GetMemoryTracker(memory);
+    BOOST_REQUIRE(memoryTracker != nullptr);
+
+    {
+        MemoryTrackingScope scope("pool allocator");
+        std::vector<UniquePtrP<AlignedStruct>> objects;
+        for (U32 i = 0; i < 10; ++i)
+        {
+            objects.push_back(MakeUniqueP<AlignedStruct>(static_cast<I32>(i)));
+            BOOST_CHECK(IsAligned(objects.back().get(), alignment));
+            BOOST_CHECK(objects.back()->mMember == static_cast<I32>(i));
+        }
+        BOOST_CHECK(memoryTracker->GetCurrentMemorySize() == 10 * sizeof(AlignedStruct));
+    }
+    BOOST_CHECK(memoryTracker->GetCurrentMemorySize() == 0);
+
+    std::vector<MemoryTagStatistics> statistics = memoryTracker->GetStatistics();
+    auto iterator = std::find_if(statistics.begin(), statistics.end(),
+                                 [](const MemoryTagStatistics& entry) { return entry.mTag == "pool allocator"; });
+    BOOST_REQUIRE(iterator != statistics.end());
+    BOOST_CHECK(iterator->mNumAllocations == 10);
+    BOOST_CHECK(iterator->mNumDeallocations == 10);
+    BOOST_CHECK(iterator->mPeakBytes == 10 * sizeof(AlignedStruct));
+
+    DeinitializeMemoryManager();
+}
+#endif // MEMORY_TRACKING
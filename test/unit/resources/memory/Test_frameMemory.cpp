@@ -0,0 +1,164 @@
+#include <boost/test/unit_test.hpp>
+#include "test/tools/ExceptionChecks.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/resources/memory/frameMemory.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+using namespace GDL;
+
+BOOST_AUTO_TEST_CASE(Construction_Destruction)
+{
+    BOOST_CHECK_NO_THROW(FrameMemory(100_B));
+    BOOST_CHECK_NO_THROW(FrameMemory(100_B, 3));
+
+    BOOST_CHECK_THROW(FrameMemory(0_B), Exception);
+    BOOST_CHECK_THROW(FrameMemory(100_B, 0), Exception);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Initialization_Deinitialization)
+{
+    FrameMemory fm{1_KiB};
+
+    GDL_CHECK_THROW_DEV_DISABLE(fm.Allocate(20), Exception);
+    fm.Initialize();
+
+    // already initialized
+    BOOST_CHECK_THROW(fm.Initialize(), Exception);
+
+    void* address = fm.Allocate(20);
+    fm.Deallocate(address);
+    fm.Deinitialize();
+
+    // already deinitialized
+    BOOST_CHECK_THROW(fm.Deinitialize(), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(fm.Allocate(20), Exception);
+}
+
+
+
+//! @brief Checks that memory stays valid for the specified number of frames and is reused afterwards
+BOOST_AUTO_TEST_CASE(Allocation_and_Frames)
+{
+    constexpr U32 numFrames = 3;
+    constexpr size_t allocationSize = 40;
+    constexpr size_t memorySizePerFrame = 256;
+    FrameMemory fm{memorySizePerFrame * 1_B, numFrames};
+
+    fm.Initialize();
+
+    GDL_CHECK_THROW_DEV_DISABLE(fm.Allocate(0), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(fm.Allocate(10, 3), Exception);
+
+    std::array<U8*, numFrames + 1> addresses;
+    for (U32 i = 0; i <= numFrames; ++i)
+    {
+        addresses[i] = static_cast<U8*>(fm.Allocate(allocationSize));
+        std::fill(addresses[i], addresses[i] + allocationSize, static_cast<U8>(i));
+
+        // Sizes are rounded up to the minimal alignment
+        BOOST_CHECK(fm.GetUsedMemorySize() == 48);
+
+        // Memory of the previous frames is still untouched
+        for (U32 j = (i < numFrames) ? 0 : 1; j < i; ++j)
+            BOOST_CHECK(std::all_of(addresses[j], addresses[j] + allocationSize,
+                                    [j](U8 value) { return value == static_cast<U8>(j); }));
+
+        fm.NextFrame();
+        BOOST_CHECK(fm.GetUsedMemorySize() == 0);
+    }
+
+    // The buffer of the first frame is reused after all other buffers
+    BOOST_CHECK(addresses[numFrames] == addresses[0]);
+
+    // Deallocation only checks the address
+    GDL_CHECK_THROW_DEV_DISABLE(fm.Deallocate(nullptr), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(fm.Deallocate(addresses[0] - 1), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(fm.Deallocate(addresses[0] + numFrames * memorySizePerFrame), Exception);
+    BOOST_CHECK_NO_THROW(fm.Deallocate(addresses[1]));
+
+    // Exceeding the memory of a frame
+    for (U32 i = 0; i < memorySizePerFrame / 64; ++i)
+        fm.Allocate(64);
+    BOOST_CHECK_THROW(fm.Allocate(1), Exception);
+    BOOST_CHECK(fm.GetHighWaterMark() == memorySizePerFrame);
+
+    fm.NextFrame();
+    BOOST_CHECK_NO_THROW(fm.Allocate(memorySizePerFrame));
+
+    fm.Deinitialize();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Alignment)
+{
+    FrameMemory fm{4_KiB};
+    fm.Initialize();
+
+    for (size_t alignment = 1; alignment <= 512; alignment *= 2)
+    {
+        void* address = fm.Allocate(1, alignment);
+        BOOST_CHECK(IsAligned(address, alignment));
+        BOOST_CHECK(IsAligned(address, FrameMemory::MinAlignment));
+    }
+
+    fm.Deinitialize();
+}
+
+
+
+//! @brief Checks that concurrent allocations from multiple threads never overlap
+BOOST_AUTO_TEST_CASE(Thread_Safety)
+{
+    constexpr U32 numThreads = 4;
+    constexpr U32 numAllocationsPerThread = 1000;
+    constexpr size_t allocationSize = 24;
+    constexpr U32 numFrames = 5;
+
+    FrameMemory fm{1_MiB};
+    fm.Initialize();
+
+    for (U32 frame = 0; frame < numFrames; ++frame)
+    {
+        std::atomic_bool startAllocation = false;
+        std::atomic_bool overlap = false;
+        std::vector<std::thread> threads;
+
+        for (U32 i = 0; i < numThreads; ++i)
+            threads.emplace_back([&, i]() {
+                std::vector<U8*> addresses;
+                while (!startAllocation)
+                    std::this_thread::yield();
+
+                for (U32 j = 0; j < numAllocationsPerThread; ++j)
+                {
+                    addresses.push_back(static_cast<U8*>(fm.Allocate(allocationSize)));
+                    std::fill(addresses.back(), addresses.back() + allocationSize, static_cast<U8>(i));
+                }
+                for (U8* address : addresses)
+                    if (!std::all_of(address, address + allocationSize,
+                                     [i](U8 value) { return value == static_cast<U8>(i); }))
+                        overlap = true;
+            });
+
+        startAllocation = true;
+        for (auto& thread : threads)
+            thread.join();
+
+        BOOST_CHECK(!overlap);
+        BOOST_CHECK(fm.GetUsedMemorySize() == numThreads * numAllocationsPerThread * 32);
+        fm.NextFrame();
+    }
+
+    fm.Deinitialize();
+}
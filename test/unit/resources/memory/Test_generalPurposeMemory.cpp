@@ -5,6 +5,7 @@
 #include "gdl/base/functions/alignment.h"
 #include "gdl/resources/memory/generalPurposeMemory.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <thread>
@@ -791,6 +792,45 @@ BOOST_AUTO_TEST_CASE(Multiple_Initialization)
 }
 
 
+//! @brief Checks that releasing the free memory keeps the internal linked list of free memory blocks intact
+BOOST_AUTO_TEST_CASE(Release_Unused_Memory)
+{
+    constexpr U32 numAllocations = 4;
+    constexpr size_t allocationSize = 20000;
+    constexpr MemorySize memorySize = 256_KiB;
+
+    GeneralPurposeMemory gpm{memorySize, MemoryBacking::MAPPED};
+    std::array<U8*, numAllocations> addresses;
+
+    BOOST_CHECK_THROW(gpm.ReleaseUnusedMemory(), Exception);
+    gpm.Initialize();
+
+    for (U32 i = 0; i < numAllocations; ++i)
+    {
+        addresses[i] = static_cast<U8*>(gpm.Allocate(allocationSize));
+        std::fill(addresses[i], addresses[i] + allocationSize, static_cast<U8>(i + 1));
+    }
+    gpm.Deallocate(addresses[1]);
+    BOOST_CHECK(gpm.CountFreeMemoryBlocks() == 2);
+
+    gpm.ReleaseUnusedMemory();
+    BOOST_CHECK(gpm.CountFreeMemoryBlocks() == 2);
+    BOOST_CHECK(gpm.CountAllocatedMemoryBlocks() == numAllocations - 1);
+    for (U32 i : {0, 2, 3})
+        BOOST_CHECK(std::all_of(addresses[i], addresses[i] + allocationSize,
+                                [i](U8 value) { return value == static_cast<U8>(i + 1); }));
+
+    addresses[1] = static_cast<U8*>(gpm.Allocate(allocationSize));
+    std::fill(addresses[1], addresses[1] + allocationSize, 2);
+
+    for (U32 i = 0; i < numAllocations; ++i)
+        gpm.Deallocate(addresses[i]);
+    BOOST_CHECK(gpm.CountFreeMemoryBlocks() == 1);
+    gpm.Deinitialize();
+}
+
+
+
 //! @brief Checks if the public functions of the general purpose memory are thread safe
 //! @remark Initialize and deinitialize are not tested, since I didn't find a good test
 BOOST_AUTO_TEST_CASE(Thread_Safety)
@@ -2,6 +2,12 @@
 
 #include "gdl/base/exception.h"
 
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
 
 using namespace GDL;
 
@@ -22,10 +28,15 @@ BOOST_AUTO_TEST_CASE(General)
 // Already created/enabled exceptions
 #ifndef NO_GENERAL_PURPOSE_MEMORY
     BOOST_CHECK_THROW(memoryManager.CreateGeneralPurposeMemory(1_MB), Exception);
+    BOOST_CHECK_THROW(memoryManager.CreateGeneralPurposeMemory(1_MB, GeneralPurposeMemoryType::SIZE_CLASS),
+                      Exception);
 #endif
 #ifndef NO_MEMORY_STACK
     BOOST_CHECK_THROW(memoryManager.CreateMemoryStack(1_MB), Exception);
 #endif
+#ifndef NO_FRAME_MEMORY
+    BOOST_CHECK_THROW(memoryManager.CreateFrameMemory(1_MB), Exception);
+#endif
 #ifndef NO_MEMORY_POOL
     BOOST_CHECK_THROW(memoryManager.CreateMemoryPool(32_B, 100), Exception);
 #endif
@@ -40,6 +51,17 @@ BOOST_AUTO_TEST_CASE(General)
     // Initialize
     BOOST_CHECK_NO_THROW(memoryManager.Initialize());
 
+#ifdef SIZE_CLASS_MEMORY
+    BOOST_CHECK(dynamic_cast<SizeClassMemory*>(memoryManager.GetGeneralPurposeMemory()) != nullptr);
+#elif !defined(NO_GENERAL_PURPOSE_MEMORY)
+    BOOST_CHECK(dynamic_cast<GeneralPurposeMemory*>(memoryManager.GetGeneralPurposeMemory()) != nullptr);
+#endif
+#ifndef NO_FRAME_MEMORY
+    BOOST_CHECK(memoryManager.GetFrameMemory() != nullptr);
+#else
+    BOOST_CHECK(memoryManager.GetFrameMemory() == nullptr);
+#endif
+
 
 
 // Addition and deletion of thread private stacks
@@ -77,6 +99,7 @@ BOOST_AUTO_TEST_CASE(General)
     // Setup yet not finished
     memoryManager.CreateGeneralPurposeMemory(1_MB);
     memoryManager.CreateMemoryStack(1_MB);
+    memoryManager.CreateFrameMemory(1_MB);
     memoryManager.CreateMemoryPool(32_B, 100);
     memoryManager.EnableThreadPrivateMemory();
 
@@ -85,6 +108,7 @@ BOOST_AUTO_TEST_CASE(General)
     // These checked functions end the setup process and make the memory manager uninitializeable;
     BOOST_CHECK(memoryManager.GetGeneralPurposeMemory() == nullptr);
     BOOST_CHECK(memoryManager.GetMemoryStack() == nullptr);
+    BOOST_CHECK(memoryManager.GetFrameMemory() == nullptr);
     BOOST_CHECK(memoryManager.GetMemoryPool(12, 4) == nullptr);
     BOOST_CHECK(memoryManager.GetThreadPrivateMemoryStack() == nullptr);
 
@@ -100,10 +124,76 @@ BOOST_AUTO_TEST_CASE(General)
     // Exceptions because memory setup is already finished
     BOOST_CHECK_THROW(memoryManager.CreateGeneralPurposeMemory(1_MB), Exception);
     BOOST_CHECK_THROW(memoryManager.CreateMemoryStack(1_MB), Exception);
+    BOOST_CHECK_THROW(memoryManager.CreateFrameMemory(1_MB), Exception);
     BOOST_CHECK_THROW(memoryManager.CreateMemoryPool(32_B, 100), Exception);
     BOOST_CHECK_THROW(memoryManager.EnableThreadPrivateMemory(), Exception);
 }
 
+
+
+//! @brief Checks if the lookup table and the thread local cache return the same memory systems as a search
+BOOST_AUTO_TEST_CASE(Memory_System_Lookup)
+{
+#if !(defined(NO_GENERAL_PURPOSE_MEMORY) && defined(NO_MEMORY_POOL) && defined(NO_MEMORY_STACK) &&                     \
+      defined(NO_THREAD_PRIVATE_MEMORY_STACK))
+    MemoryManager& memoryManager = GetMemoryManager();
+    InitializeMemoryManager();
+
+#ifdef LARGE_MEMORY_POOL
+    const std::vector<std::pair<size_t, size_t>> pools = {{32, 32}, {64, 64}, {128, 128}, {40008, 8}};
+#else
+    const std::vector<std::pair<size_t, size_t>> pools = {{32, 32}, {64, 64}, {128, 128}};
+#endif
+
+    std::vector<size_t> elementSizes(257);
+    std::iota(elementSizes.begin(), elementSizes.end(), 0);
+    elementSizes.insert(elementSizes.end(), {40007, 40008, 40009});
+
+    for (size_t elementSize : elementSizes)
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            size_t expectedPoolElementSize = 0;
+#ifndef NO_MEMORY_POOL
+            for (const auto& [poolElementSize, poolAlignment] : pools)
+                if (poolElementSize >= elementSize && poolAlignment >= alignment)
+                {
+                    expectedPoolElementSize = poolElementSize;
+                    break;
+                }
+#endif
+            MemoryPool* memoryPool = memoryManager.GetMemoryPool(elementSize, alignment);
+            size_t poolElementSize = (memoryPool == nullptr) ? 0 : memoryPool->GetElementSize().GetNumBytes();
+            BOOST_CHECK(poolElementSize == expectedPoolElementSize);
+        }
+
+#ifndef NO_THREAD_PRIVATE_MEMORY_STACK
+    ThreadPrivateMemoryStack* threadPrivateMemoryStack = memoryManager.GetThreadPrivateMemoryStack();
+    BOOST_CHECK(threadPrivateMemoryStack != nullptr);
+
+    std::atomic_bool noStackBeforeCreation = false;
+    std::atomic_bool ownStackAfterCreation = false;
+    std::atomic_bool noStackAfterDeletion = false;
+    std::thread thread([&]() {
+        noStackBeforeCreation = memoryManager.GetThreadPrivateMemoryStack() == nullptr;
+        memoryManager.CreatePrivateMemoryStackForThisThread(1_MB);
+        ThreadPrivateMemoryStack* otherThreadPrivateMemoryStack = memoryManager.GetThreadPrivateMemoryStack();
+        ownStackAfterCreation = otherThreadPrivateMemoryStack != nullptr &&
+                                otherThreadPrivateMemoryStack != threadPrivateMemoryStack;
+        memoryManager.DeletePrivateMemoryStackForThisThread();
+        noStackAfterDeletion = memoryManager.GetThreadPrivateMemoryStack() == nullptr;
+    });
+    thread.join();
+
+    BOOST_CHECK(noStackBeforeCreation);
+    BOOST_CHECK(ownStackAfterCreation);
+    BOOST_CHECK(noStackAfterDeletion);
+    BOOST_CHECK(memoryManager.GetThreadPrivateMemoryStack() == threadPrivateMemoryStack);
+#endif
+
+    DeinitializeMemoryManager();
+#endif
+}
+
 #else // TEST_THREAD_SAFETY
 
 #include "gdl/base/fundamentalTypes.h"
@@ -111,8 +201,11 @@ BOOST_AUTO_TEST_CASE(General)
 #include "gdl/resources/memory/memoryManager.h"
 
 #include <atomic>
+#include <numeric>
 #include <iostream>
 #include <thread>
+#include <utility>
+#include <vector>
 #include <vector>
 
 
@@ -81,6 +81,7 @@ BOOST_AUTO_TEST_CASE(Allocation_and_Deallocation)
 
     std::array<void*, numElements> refAddresses{addresses};
     BOOST_CHECK_NO_THROW(mp.CheckMemoryConsistency());
+    BOOST_CHECK(mp.GetNumAllocatedElements() == numElements);
 
     std::array<U32, 4> indices{{4, 1, 2, 0}};
     for (U32 i = 0; i < indices.size(); ++i)
@@ -90,6 +91,7 @@ BOOST_AUTO_TEST_CASE(Allocation_and_Deallocation)
         addresses[index] = nullptr;
     }
     BOOST_CHECK_NO_THROW(mp.CheckMemoryConsistency());
+    BOOST_CHECK(mp.GetNumAllocatedElements() == numElements - indices.size());
 
     for (U32 i = 0; i < indices.size(); ++i)
         BOOST_CHECK_NO_THROW(addresses[indices[i]] = mp.Allocate(elementSize.GetNumBytes()));
@@ -299,11 +301,100 @@ BOOST_AUTO_TEST_CASE(Thread_Safety)
         threads[i].join();
 
     BOOST_CHECK(exceptionThrown == false);
+
+    const SpinLockStatistics statistics = mp.GetLockStatistics();
+    if constexpr (SpinLockStatisticsEnabled)
+        BOOST_CHECK(statistics.mNumAcquisitions >= 2 * numThreads * numThreadAllocs * numAllocationRuns);
+    else
+        BOOST_CHECK(statistics.mNumAcquisitions == 0);
+
     BOOST_CHECK_NO_THROW(mp.Deinitialize());
 }
 
 
 
+//! @brief Checks allocations and deallocations with thread caches. Elements that are cached by the magazine of a thread
+//! are returned to the pool if the thread exits or the pool is deinitialized.
+BOOST_AUTO_TEST_CASE(Magazines)
+{
+    constexpr MemorySize elementSize = 16_B;
+    constexpr U32 numElements = 10;
+    constexpr U32 magazineSize = 4;
+
+    MemoryPool mp(elementSize, numElements, 1, magazineSize);
+    BOOST_CHECK(mp.GetMagazineSize() == magazineSize);
+    GDL_CHECK_THROW_DEV_DISABLE(mp.Allocate(16), Exception);
+
+    for (U32 run = 0; run < 2; ++run)
+    {
+        mp.Initialize();
+
+        std::array<void*, numElements> addresses;
+        for (U32 i = 0; i < numElements; ++i)
+            addresses[i] = mp.Allocate(elementSize.GetNumBytes());
+        BOOST_CHECK_THROW(mp.Allocate(elementSize.GetNumBytes()), Exception);
+        BOOST_CHECK_NO_THROW(mp.CheckMemoryConsistency());
+        BOOST_CHECK(mp.GetNumAllocatedElements() == numElements);
+
+        for (U32 i = 0; i < numElements; ++i)
+            for (U32 j = i + 1; j < numElements; ++j)
+                BOOST_CHECK(addresses[i] != addresses[j]);
+
+        for (U32 i = 0; i < numElements; ++i)
+        {
+            mp.Deallocate(addresses[i]);
+            BOOST_CHECK_NO_THROW(mp.CheckMemoryConsistency());
+        }
+        GDL_CHECK_THROW_DEBUG_DISABLE(mp.Deallocate(addresses[numElements - 1]), Exception);
+        GDL_CHECK_THROW_DEV_DISABLE(mp.Deallocate(static_cast<U8*>(addresses[0]) + 1), Exception);
+
+        // The calling thread still caches some elements. They are returned during deinitialization.
+        BOOST_CHECK(mp.GetNumAllocatedElements() == 0);
+        addresses[0] = mp.Allocate(elementSize.GetNumBytes());
+        BOOST_CHECK(mp.GetNumAllocatedElements() == 1);
+        BOOST_CHECK_THROW(mp.Deinitialize(), Exception);
+        mp.Deallocate(addresses[0]);
+        BOOST_CHECK_NO_THROW(mp.Deinitialize());
+    }
+
+    // Elements cached by other threads are returned when the threads exit
+    constexpr U32 numThreads = 4;
+    MemoryPool mpThreads(elementSize, 1000, 1, 16);
+    mpThreads.Initialize();
+
+    std::atomic_bool exceptionThrown = false;
+    std::vector<std::thread> threads;
+    for (U32 i = 0; i < numThreads; ++i)
+        threads.emplace_back([&]() {
+            try
+            {
+                std::array<void*, 50> addresses;
+                for (U32 run = 0; run < 100; ++run)
+                {
+                    for (auto& address : addresses)
+                        address = mpThreads.Allocate(elementSize.GetNumBytes());
+                    mpThreads.CheckMemoryConsistency();
+                    for (auto& address : addresses)
+                        mpThreads.Deallocate(address);
+                }
+                // Leave some elements in the magazine
+                mpThreads.Deallocate(mpThreads.Allocate(elementSize.GetNumBytes()));
+            }
+            catch (...)
+            {
+                exceptionThrown = true;
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    BOOST_CHECK(exceptionThrown == false);
+    BOOST_CHECK_NO_THROW(mpThreads.CheckMemoryConsistency());
+    BOOST_CHECK_NO_THROW(mpThreads.Deinitialize());
+}
+
+
+
 //! @brief This test checks if the number of allocations is as expected
 //! @remark The exceptions in the other tests call new due to the internal usage of strings. This makes it hard to
 //! keep track of the expected number of allocations since it can vary for each exception depending on the message.
@@ -333,3 +424,57 @@ BOOST_AUTO_TEST_CASE(No_hidden_allocations)
     BOOST_CHECK(gnc.GetNumNewCalls() == 2);
     BOOST_CHECK(gnc.GetNumDeleteCalls() == 2);
 }
+
+
+
+//! @brief Checks that elements are only touched when they are used for the first time and that previously used
+//! elements are reused before untouched ones
+BOOST_AUTO_TEST_CASE(Lazy_Initialization_and_Backing)
+{
+    constexpr MemorySize elementSize = 64_B;
+    constexpr U32 numElements = 100000;
+
+    MemoryPool mp(elementSize, numElements, 64, 0, MemoryBacking::MAPPED);
+    BOOST_CHECK(mp.GetBacking() == MemoryBacking::MAPPED);
+    mp.Initialize();
+
+    std::vector<void*> addresses;
+    for (U32 i = 0; i < 10; ++i)
+        addresses.push_back(mp.Allocate(elementSize.GetNumBytes()));
+    for (U32 i = 1; i < addresses.size(); ++i)
+        BOOST_CHECK(static_cast<U8*>(addresses[i]) == static_cast<U8*>(addresses[i - 1]) + elementSize.GetNumBytes());
+    for (U32 i = 0; i < addresses.size(); ++i)
+        BOOST_CHECK(mp.GetElement(i) == addresses[i]);
+    BOOST_CHECK(mp.GetNumElements() == numElements);
+    GDL_CHECK_THROW_DEV_DISABLE(mp.GetElement(numElements), Exception);
+
+    mp.Deallocate(addresses[3]);
+    mp.Deallocate(addresses[5]);
+    BOOST_CHECK_NO_THROW(mp.CheckMemoryConsistency());
+
+    // Never allocated
+    GDL_CHECK_THROW_DEBUG_DISABLE(mp.Deallocate(static_cast<U8*>(addresses[9]) + elementSize.GetNumBytes()),
+                                  Exception);
+
+    BOOST_CHECK(mp.Allocate(elementSize.GetNumBytes()) == addresses[3]);
+    BOOST_CHECK(mp.Allocate(elementSize.GetNumBytes()) == addresses[5]);
+    BOOST_CHECK(static_cast<U8*>(mp.Allocate(elementSize.GetNumBytes())) ==
+                static_cast<U8*>(addresses[9]) + elementSize.GetNumBytes());
+
+    for (U32 i = 11; i < numElements; ++i)
+        mp.Allocate(elementSize.GetNumBytes());
+    BOOST_CHECK_THROW(mp.Allocate(elementSize.GetNumBytes()), Exception);
+    BOOST_CHECK_NO_THROW(mp.CheckMemoryConsistency());
+
+    // Memory of thread caches is also taken lazily
+    MemoryPool mpCached(elementSize, 10, 64, 4, MemoryBacking::TRANSPARENT_HUGE_PAGES);
+    mpCached.Initialize();
+    std::vector<void*> cachedAddresses;
+    for (U32 i = 0; i < 10; ++i)
+        cachedAddresses.push_back(mpCached.Allocate(elementSize.GetNumBytes()));
+    BOOST_CHECK_THROW(mpCached.Allocate(elementSize.GetNumBytes()), Exception);
+    for (void* address : cachedAddresses)
+        mpCached.Deallocate(address);
+    BOOST_CHECK_NO_THROW(mpCached.CheckMemoryConsistency());
+    mpCached.Deinitialize();
+}
@@ -0,0 +1,107 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/resources/memory/memoryRegion.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+
+using namespace GDL;
+
+constexpr std::array<MemoryBacking, 4> backings = {
+        {MemoryBacking::HEAP, MemoryBacking::MAPPED, MemoryBacking::TRANSPARENT_HUGE_PAGES, MemoryBacking::HUGE_PAGES}};
+
+
+
+BOOST_AUTO_TEST_CASE(Construction_Destruction)
+{
+    MemoryRegion empty;
+    BOOST_CHECK(empty.Get() == nullptr);
+    BOOST_CHECK(empty.GetSize() == 0);
+
+    BOOST_CHECK_THROW(MemoryRegion(0), Exception);
+
+    for (MemoryBacking backing : backings)
+    {
+        MemoryRegion region(5000, backing);
+        BOOST_CHECK(region.Get() != nullptr);
+        BOOST_CHECK(region.GetSize() == 5000);
+
+        // The whole region must be writable
+        std::fill(region.Get(), region.Get() + region.GetSize(), 42);
+        BOOST_CHECK(std::all_of(region.Get(), region.Get() + region.GetSize(), [](U8 value) { return value == 42; }));
+
+        region.Reset();
+        BOOST_CHECK(region.Get() == nullptr);
+    }
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Backing)
+{
+    BOOST_CHECK(MemoryRegion(100, MemoryBacking::HEAP).GetBacking() == MemoryBacking::HEAP);
+
+#ifdef __linux__
+    BOOST_CHECK(MemoryRegion(100, MemoryBacking::MAPPED).GetBacking() == MemoryBacking::MAPPED);
+
+    MemoryRegion transparentHugePages(100, MemoryBacking::TRANSPARENT_HUGE_PAGES);
+    BOOST_CHECK(transparentHugePages.GetBacking() == MemoryBacking::TRANSPARENT_HUGE_PAGES);
+    BOOST_CHECK(IsAligned(transparentHugePages.Get(), MemoryRegion::HugePageSize));
+
+    // Falls back to transparent huge pages if the huge page pool is empty
+    MemoryRegion hugePages(100, MemoryBacking::HUGE_PAGES);
+    BOOST_CHECK(hugePages.GetBacking() == MemoryBacking::HUGE_PAGES ||
+                hugePages.GetBacking() == MemoryBacking::TRANSPARENT_HUGE_PAGES);
+    BOOST_CHECK(IsAligned(hugePages.Get(), MemoryRegion::HugePageSize));
+#endif
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Move)
+{
+    MemoryRegion region(100, MemoryBacking::MAPPED);
+    U8* memory = region.Get();
+    const MemoryBacking backing = region.GetBacking();
+
+    MemoryRegion movedRegion(std::move(region));
+    BOOST_CHECK(movedRegion.Get() == memory);
+    BOOST_CHECK(movedRegion.GetSize() == 100);
+    BOOST_CHECK(movedRegion.GetBacking() == backing);
+    BOOST_CHECK(region.Get() == nullptr);
+
+    MemoryRegion assignedRegion(200, MemoryBacking::HEAP);
+    assignedRegion = std::move(movedRegion);
+    BOOST_CHECK(assignedRegion.Get() == memory);
+    BOOST_CHECK(assignedRegion.GetSize() == 100);
+    BOOST_CHECK(movedRegion.Get() == nullptr);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Release)
+{
+    constexpr size_t regionSize = 64 * 1024;
+
+    MemoryRegion heapRegion(regionSize, MemoryBacking::HEAP);
+    BOOST_CHECK(!heapRegion.Release(heapRegion.Get(), regionSize));
+
+#ifdef __linux__
+    MemoryRegion region(regionSize, MemoryBacking::MAPPED);
+    std::fill(region.Get(), region.Get() + regionSize, 1);
+
+    // Ranges without a complete page are ignored
+    BOOST_CHECK(!region.Release(region.Get() + 1, 100));
+    BOOST_CHECK(region.Get()[1] == 1);
+
+    // Partially covered pages keep their content and released pages are zero when they are touched again
+    BOOST_CHECK(region.Release(region.Get() + 1, regionSize - 1));
+    BOOST_CHECK(region.Get()[0] == 1);
+    BOOST_CHECK(region.Get()[1] == 1);
+    BOOST_CHECK(region.Get()[regionSize - 1] == 0);
+#endif
+}
@@ -5,10 +5,12 @@
 #include "gdl/base/functions/alignment.h"
 #include "gdl/resources/memory/memoryStack.h"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <memory>
 #include <thread>
+#include <vector>
 
 using namespace GDL;
 
@@ -207,7 +209,7 @@ BOOST_AUTO_TEST_CASE(Thread_safety_thread_private)
 
         while (!deinitialize)
             std::this_thread::yield();
-        (*ms).Deallocate(address);
+        // The memory was deallocated by the main thread
         (*ms).Deinitialize();
     }};
 
@@ -222,7 +224,8 @@ BOOST_AUTO_TEST_CASE(Thread_safety_thread_private)
         std::this_thread::yield();
 
     GDL_CHECK_THROW_DEV_DISABLE(msRef.Allocate(10), Exception);
-    GDL_CHECK_THROW_DEV_DISABLE(msRef.Deallocate(address), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(msRef.Deallocate(nullptr), Exception);
+    msRef.Deallocate(address);
 
     BOOST_CHECK_THROW(msRef.Deinitialize(), Exception);
     deinitialize = true;
@@ -231,6 +234,73 @@ BOOST_AUTO_TEST_CASE(Thread_safety_thread_private)
 }
 
 
+//! @brief Checks that memory of a thread private memory stack can be deallocated by other threads
+BOOST_AUTO_TEST_CASE(Remote_Deallocation)
+{
+    constexpr U32 numThreads = 4;
+    constexpr U32 numAllocationsPerThread = 100;
+    constexpr size_t allocationSize = 16;
+
+    ThreadPrivateMemoryStack ms{numThreads * numAllocationsPerThread * allocationSize * 1_B};
+    ms.Initialize();
+
+    std::array<std::vector<U8*>, numThreads> buffers;
+    for (U32 i = 0; i < numThreads; ++i)
+        for (U32 j = 0; j < numAllocationsPerThread; ++j)
+            buffers[i].push_back(static_cast<U8*>(ms.Allocate(allocationSize)));
+    U8* firstAddress = buffers[0][0];
+
+    // The last buffer is freed by the owning thread after all other deallocations were reclaimed
+    U8* lastBuffer = buffers[numThreads - 1].back();
+    buffers[numThreads - 1].pop_back();
+
+    std::vector<std::thread> threads;
+    for (U32 i = 0; i < numThreads; ++i)
+        threads.emplace_back([&ms, &buffers, i]() {
+            for (U8* buffer : buffers[i])
+            {
+                std::fill(buffer, buffer + allocationSize, static_cast<U8>(i));
+                ms.Deallocate(buffer);
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    // Remote deallocations are reclaimed by the next access of the owning thread
+    BOOST_CHECK(ms.GetStatistics().mUsedMemorySize == numThreads * numAllocationsPerThread * allocationSize);
+    ms.Deallocate(lastBuffer);
+    BOOST_CHECK(ms.GetStatistics().mUsedMemorySize == 0);
+    BOOST_CHECK(ms.Allocate(allocationSize) == firstAddress);
+
+    // The stack is reset by the next allocation if the remaining memory is freed by another thread
+    std::thread{[&ms, firstAddress]() { ms.Deallocate(firstAddress); }}.join();
+    BOOST_CHECK(ms.Allocate(allocationSize) == firstAddress);
+
+    // Remote deallocations of allocations that existed before a memory stack deallocator was created are kept when its
+    // state is restored. This also works if the deallocation is still pending when the deallocator is destroyed.
+    {
+        auto deallocator = ms.CreateMemoryStackDeallocator();
+        ms.Allocate(allocationSize);
+        std::thread{[&ms, firstAddress]() { ms.Deallocate(firstAddress); }}.join();
+    }
+    BOOST_CHECK(ms.GetStatistics().mUsedMemorySize == 0);
+    BOOST_CHECK(ms.Allocate(allocationSize) == firstAddress);
+
+    // ... and if it was already reclaimed by an allocation during the lifetime of the deallocator
+    {
+        auto deallocator = ms.CreateMemoryStackDeallocator();
+        std::thread{[&ms, firstAddress]() { ms.Deallocate(firstAddress); }}.join();
+        ms.Allocate(allocationSize);
+    }
+    BOOST_CHECK(ms.GetStatistics().mUsedMemorySize == 0);
+    BOOST_CHECK(ms.Allocate(allocationSize) == firstAddress);
+
+    std::thread{[&ms, firstAddress]() { ms.Deallocate(firstAddress); }}.join();
+    ms.Deinitialize();
+}
+
+
+
 BOOST_AUTO_TEST_CASE(Thread_safety_non_thread_private)
 {
     constexpr U32 numAllocations = 500;
@@ -343,3 +413,152 @@ BOOST_AUTO_TEST_CASE(Stack_Deallocator)
     StackDeallocator<true>();
     StackDeallocator<false>();
 }
+
+
+
+template <bool _ThreadPrivate>
+void GrowableAllocation()
+{
+    constexpr U32 numAllocations = 20;
+    constexpr U32 allocationSize = 10;
+    constexpr MemorySize blockSize = allocationSize * 5_B;
+    MemoryStackTemplate<_ThreadPrivate> ms{blockSize, true};
+
+    std::array<U8*, numAllocations> addresses;
+    addresses.fill(nullptr);
+
+    ms.Initialize();
+    BOOST_CHECK(ms.GetStatistics().mNumBlocks == 1);
+
+    for (U32 k = 0; k < 3; ++k)
+    {
+        for (U32 i = 0; i < numAllocations; ++i)
+        {
+            addresses[i] = static_cast<U8*>(ms.Allocate(allocationSize));
+            std::fill(addresses[i], addresses[i] + allocationSize, static_cast<U8>(i));
+        }
+
+        // Check that no allocation overlaps another one
+        for (U32 i = 0; i < numAllocations; ++i)
+            BOOST_CHECK(std::all_of(addresses[i], addresses[i] + allocationSize,
+                                    [i](U8 value) { return value == static_cast<U8>(i); }));
+
+        // Blocks are retained and reused after the stack was reset
+        MemoryStackStatistics statistics = ms.GetStatistics();
+        BOOST_CHECK(statistics.mNumBlocks == numAllocations * allocationSize / blockSize.GetNumBytes());
+        BOOST_CHECK(statistics.mReservedMemorySize == numAllocations * allocationSize);
+        BOOST_CHECK(statistics.mUsedMemorySize == numAllocations * allocationSize);
+
+        for (U32 i = 0; i < numAllocations; ++i)
+            ms.Deallocate(addresses[i]);
+
+        statistics = ms.GetStatistics();
+        BOOST_CHECK(statistics.mUsedMemorySize == 0);
+        BOOST_CHECK(statistics.mHighWaterMark == numAllocations * allocationSize);
+    }
+
+    // Allocations that are larger than the block size get their own block
+    void* address = ms.Allocate(blockSize.GetNumBytes() * 3, 64);
+    BOOST_CHECK(IsAligned(address, 64));
+    BOOST_CHECK(ms.GetStatistics().mReservedMemorySize >=
+                numAllocations * allocationSize + 3 * blockSize.GetNumBytes());
+    ms.Deallocate(address);
+
+    ms.Deinitialize();
+    BOOST_CHECK(ms.GetStatistics().mNumBlocks == 0);
+}
+
+//! @brief Checks if a growable memory stack chains and reuses memory blocks
+BOOST_AUTO_TEST_CASE(Growable_Allocation)
+{
+    GrowableAllocation<true>();
+    GrowableAllocation<false>();
+}
+
+
+
+template <bool _ThreadPrivate>
+void GrowableStackDeallocator()
+{
+    constexpr U32 allocationSize = 16;
+    constexpr MemorySize blockSize = allocationSize * 4_B;
+    MemoryStackTemplate<_ThreadPrivate> ms{blockSize, true};
+
+    ms.Initialize();
+
+    void* frameAddress = ms.Allocate(allocationSize);
+    for (U32 k = 0; k < 3; ++k)
+    {
+        auto stackDeallocator = ms.CreateMemoryStackDeallocator();
+        for (U32 i = 0; i < 10; ++i)
+            ms.Allocate(allocationSize);
+        BOOST_CHECK(ms.GetStatistics().mNumBlocks == 3);
+    }
+
+    // The deallocator restores the first block, so the next allocation directly follows the first one
+    void* address = ms.Allocate(allocationSize);
+    BOOST_CHECK(static_cast<U8*>(address) == static_cast<U8*>(frameAddress) + allocationSize);
+
+    MemoryStackStatistics statistics = ms.GetStatistics();
+    BOOST_CHECK(statistics.mUsedMemorySize == 2 * allocationSize);
+    BOOST_CHECK(statistics.mHighWaterMark == 11 * allocationSize);
+    BOOST_CHECK(statistics.mNumBlocks == 3);
+
+    ms.Deallocate(address);
+    ms.Deallocate(frameAddress);
+    ms.Deinitialize();
+}
+
+//! @brief Checks if the memory stack deallocator resets growable memory stacks to the correct block
+BOOST_AUTO_TEST_CASE(Growable_Stack_Deallocator)
+{
+    GrowableStackDeallocator<true>();
+    GrowableStackDeallocator<false>();
+}
+
+
+
+template <bool _ThreadPrivate>
+void ReleaseUnusedMemory(MemoryBacking backing)
+{
+    constexpr size_t blockSize = 64 * 1024;
+    MemoryStackTemplate<_ThreadPrivate> ms{blockSize * 1_B, true, backing};
+
+    GDL_CHECK_THROW_DEV_DISABLE(ms.ReleaseUnusedMemory(), Exception);
+    ms.Initialize();
+
+    void* address = ms.Allocate(100);
+    std::fill(static_cast<U8*>(address), static_cast<U8*>(address) + 100, 1);
+    for (U32 i = 0; i < 3; ++i)
+    {
+        auto stackDeallocator = ms.CreateMemoryStackDeallocator();
+        U8* blockAddress = static_cast<U8*>(ms.Allocate(blockSize));
+        std::fill(blockAddress, blockAddress + blockSize, 2);
+    }
+    BOOST_CHECK(ms.GetStatistics().mNumBlocks == 2);
+
+    // Retained blocks are freed, memory in use is kept
+    ms.ReleaseUnusedMemory();
+    BOOST_CHECK(ms.GetStatistics().mNumBlocks == 1);
+    BOOST_CHECK(ms.GetStatistics().mReservedMemorySize == blockSize);
+    BOOST_CHECK(std::all_of(static_cast<U8*>(address), static_cast<U8*>(address) + 100,
+                            [](U8 value) { return value == 1; }));
+
+    // Released memory can be used again
+    U8* releasedAddress = static_cast<U8*>(ms.Allocate(blockSize / 2));
+    std::fill(releasedAddress, releasedAddress + blockSize / 2, 3);
+
+    ms.Deallocate(releasedAddress);
+    ms.Deallocate(address);
+    ms.Deinitialize();
+}
+
+//! @brief Checks if unused memory of a memory stack can be released
+BOOST_AUTO_TEST_CASE(Release_Unused_Memory)
+{
+    for (MemoryBacking backing : {MemoryBacking::HEAP, MemoryBacking::MAPPED, MemoryBacking::HUGE_PAGES})
+    {
+        ReleaseUnusedMemory<true>(backing);
+        ReleaseUnusedMemory<false>(backing);
+    }
+}
@@ -0,0 +1,217 @@
+#include <boost/test/unit_test.hpp>
+
+#include "gdl/base/fundamentalTypes.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/resources/memory/heapMemory.h"
+#include "gdl/resources/memory/utility/memoryTracker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+using namespace GDL;
+
+
+//! @brief Gets the statistics of the passed tag. Fails the test if the tag doesn't exist.
+MemoryTagStatistics GetTagStatistics(MemoryTracker& tracker, const std::string& tag)
+{
+    std::vector<MemoryTagStatistics> statistics = tracker.GetStatistics();
+    auto iterator = std::find_if(statistics.begin(), statistics.end(),
+                                 [&tag](const MemoryTagStatistics& entry) { return entry.mTag == tag; });
+    BOOST_REQUIRE(iterator != statistics.end());
+    return *iterator;
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Allocation_Deallocation)
+{
+    HeapMemory heapMemory;
+    MemoryTracker tracker(heapMemory);
+
+    BOOST_CHECK(tracker.GetStatistics().empty());
+
+    void* untagged = tracker.Allocate(100);
+    void* first;
+    void* second;
+    {
+        MemoryTrackingScope scope("outer");
+        first = tracker.Allocate(16, 16);
+        {
+            MemoryTrackingScope innerScope("inner");
+            second = tracker.Allocate(1000);
+        }
+        tracker.Deallocate(first, 16);
+        first = tracker.Allocate(20);
+    }
+
+    BOOST_CHECK(tracker.GetCurrentMemorySize() == 1120);
+    BOOST_CHECK(tracker.GetPeakMemorySize() == 1120);
+
+    tracker.Deallocate(second);
+    tracker.Deallocate(untagged);
+    BOOST_CHECK(tracker.GetCurrentMemorySize() == 20);
+    BOOST_CHECK(tracker.GetPeakMemorySize() == 1120);
+
+    std::vector<MemoryTagStatistics> statistics = tracker.GetStatistics();
+    BOOST_CHECK(statistics.size() == 3);
+
+    MemoryTagStatistics outer = GetTagStatistics(tracker, "outer");
+    BOOST_CHECK(outer.mNumAllocations == 2);
+    BOOST_CHECK(outer.mNumDeallocations == 1);
+    BOOST_CHECK(outer.mAllocatedBytes == 36);
+    BOOST_CHECK(outer.mDeallocatedBytes == 16);
+    BOOST_CHECK(outer.mCurrentBytes == 20);
+    BOOST_CHECK(outer.mPeakBytes == 20);
+    BOOST_CHECK(outer.mSizeHistogram[4] == 2);
+    BOOST_CHECK(outer.mMaxLifetime <= outer.mTotalLifetime);
+
+    MemoryTagStatistics inner = GetTagStatistics(tracker, "inner");
+    BOOST_CHECK(inner.mNumAllocations == 1);
+    BOOST_CHECK(inner.mNumDeallocations == 1);
+    BOOST_CHECK(inner.mCurrentBytes == 0);
+    BOOST_CHECK(inner.mPeakBytes == 1000);
+    BOOST_CHECK(inner.mSizeHistogram[9] == 1);
+
+    MemoryTagStatistics untaggedStatistics = GetTagStatistics(tracker, MemoryTracker::UntaggedTag);
+    BOOST_CHECK(untaggedStatistics.mNumAllocations == 1);
+    BOOST_CHECK(untaggedStatistics.mSizeHistogram[6] == 1);
+
+    tracker.Deallocate(first);
+}
+
+
+
+//! @brief Checks that the allocation header doesn't break the requested alignment and that multiple trackers can be
+//! used by the same thread
+BOOST_AUTO_TEST_CASE(Alignment_and_Multiple_Trackers)
+{
+    HeapMemory heapMemory;
+    MemoryTracker tracker(heapMemory);
+    MemoryTracker otherTracker(static_cast<MemoryInterface&>(tracker));
+
+    for (size_t alignment : {1, 2, 4, 8, 16, 32, 64, 128})
+    {
+        BOOST_CHECK(MemoryTracker::GetHeaderSize(alignment) % MemoryTracker::GetWrappedAlignment(alignment) == 0);
+
+        void* address = tracker.Allocate(3, alignment);
+        void* otherAddress = otherTracker.Allocate(5, alignment);
+        BOOST_CHECK(IsAligned(address, alignment));
+        BOOST_CHECK(IsAligned(otherAddress, alignment));
+        std::memset(address, 0xFF, 3);
+        std::memset(otherAddress, 0xFF, 5);
+
+        // The other tracker allocates its memory including its own header through the first tracker
+        BOOST_CHECK(tracker.GetCurrentMemorySize() == 8 + MemoryTracker::GetHeaderSize(alignment));
+        BOOST_CHECK(otherTracker.GetCurrentMemorySize() == 5);
+
+        otherTracker.Deallocate(otherAddress, alignment);
+        tracker.Deallocate(address, alignment);
+        BOOST_CHECK(tracker.GetCurrentMemorySize() == 0);
+        BOOST_CHECK(otherTracker.GetCurrentMemorySize() == 0);
+    }
+    BOOST_CHECK(GetTagStatistics(otherTracker, MemoryTracker::UntaggedTag).mNumAllocations == 8);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Callsite_Tags)
+{
+    HeapMemory heapMemory;
+    MemoryTracker tracker(heapMemory);
+
+    const char* tag = MEMORY_TRACKING_CALLSITE;
+    for (U32 i = 0; i < 2; ++i)
+    {
+        MemoryTrackingScope scope(tag);
+        tracker.Deallocate(tracker.Allocate(8));
+    }
+
+    std::vector<MemoryTagStatistics> statistics = tracker.GetStatistics();
+    BOOST_REQUIRE(statistics.size() == 1);
+    BOOST_CHECK(statistics[0].mTag == tag);
+    BOOST_CHECK(statistics[0].mTag.find("Test_memoryTracker.cpp:") != std::string::npos);
+    BOOST_CHECK(statistics[0].mNumAllocations == 2);
+}
+
+
+
+//! @brief Checks that the counters of multiple threads are merged correctly
+BOOST_AUTO_TEST_CASE(Thread_Safety)
+{
+    constexpr U32 numThreads = 4;
+    constexpr U32 numAllocationsPerThread = 1000;
+    constexpr size_t allocationSize = 48;
+
+    HeapMemory heapMemory;
+    MemoryTracker tracker(heapMemory);
+
+    std::vector<void*> leftovers(numThreads);
+    std::vector<std::thread> threads;
+    for (U32 i = 0; i < numThreads; ++i)
+        threads.emplace_back([&, i]() {
+            MemoryTrackingScope scope((i % 2 == 0) ? "even" : "odd");
+            std::vector<void*> addresses;
+            for (U32 j = 0; j < numAllocationsPerThread; ++j)
+                addresses.push_back(tracker.Allocate(allocationSize));
+            for (U32 j = 1; j < numAllocationsPerThread; ++j)
+                tracker.Deallocate(addresses[j]);
+            leftovers[i] = addresses[0];
+        });
+    for (auto& thread : threads)
+        thread.join();
+
+    // Memory is freed by a different thread
+    for (void* address : leftovers)
+        tracker.Deallocate(address);
+
+    for (const char* tag : {"even", "odd"})
+    {
+        MemoryTagStatistics statistics = GetTagStatistics(tracker, tag);
+        BOOST_CHECK(statistics.mNumAllocations == numThreads / 2 * numAllocationsPerThread);
+        BOOST_CHECK(statistics.mNumDeallocations == numThreads / 2 * numAllocationsPerThread);
+        BOOST_CHECK(statistics.mCurrentBytes == 0);
+        BOOST_CHECK(statistics.mPeakBytes >= numAllocationsPerThread * allocationSize);
+        BOOST_CHECK(statistics.mPeakBytes <= numThreads / 2 * numAllocationsPerThread * allocationSize);
+        BOOST_CHECK(statistics.mSizeHistogram[5] == numThreads / 2 * numAllocationsPerThread);
+    }
+    BOOST_CHECK(tracker.GetCurrentMemorySize() == 0);
+    BOOST_CHECK(tracker.GetPeakMemorySize() == numThreads * numAllocationsPerThread * allocationSize);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Csv_and_Json_Output)
+{
+    HeapMemory heapMemory;
+    MemoryTracker tracker(heapMemory);
+
+    void* address;
+    {
+        MemoryTrackingScope scope("quoted \"tag\"");
+        address = tracker.Allocate(3);
+    }
+
+    std::stringstream csv;
+    tracker.WriteCsv(csv);
+    std::string header;
+    std::string line;
+    std::getline(csv, header);
+    std::getline(csv, line);
+    BOOST_CHECK(header.find("tag,allocations,deallocations,allocated_bytes") == 0);
+    BOOST_CHECK(std::count(header.begin(), header.end(), ',') == std::count(line.begin(), line.end(), ','));
+    BOOST_CHECK(line.find("\"quoted \"\"tag\"\"\",1,0,3,0,3,3,0,0,0,1,") == 0);
+
+    std::stringstream json;
+    tracker.WriteJson(json);
+    const std::string expectedJsonStart =
+            "{\"current_bytes\":3,\"peak_bytes\":3,\"tags\":[{\"tag\":\"quoted \\\"tag\\\"\"";
+    BOOST_CHECK(json.str().find(expectedJsonStart) == 0);
+    BOOST_CHECK(json.str().find("\"size_histogram\":[0,1,0,") != std::string::npos);
+
+    tracker.Deallocate(address);
+}
@@ -0,0 +1,203 @@
+#include <boost/test/unit_test.hpp>
+#include "test/tools/ExceptionChecks.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/resources/memory/objectPool.h"
+
+#include <vector>
+
+
+using namespace GDL;
+
+
+//! @brief Object that counts its constructions and destructions
+struct CountedObject
+{
+    static I32 mNumInstances;
+    I32 mValue;
+
+    CountedObject(I32 value)
+        : mValue{value}
+    {
+        ++mNumInstances;
+    }
+    CountedObject(const CountedObject&) = delete;
+    CountedObject(CountedObject&&) = delete;
+    CountedObject& operator=(const CountedObject&) = delete;
+    CountedObject& operator=(CountedObject&&) = delete;
+    ~CountedObject()
+    {
+        --mNumInstances;
+    }
+};
+
+I32 CountedObject::mNumInstances = 0;
+
+
+
+//! @brief Object whose constructor throws for negative values
+struct ThrowingObject
+{
+    ThrowingObject(I32 value)
+    {
+        EXCEPTION(value < 0, "Negative value");
+    }
+};
+
+
+
+BOOST_AUTO_TEST_CASE(Construction_Destruction)
+{
+    BOOST_CHECK_THROW(ObjectPool<I32>(0), Exception);
+    BOOST_CHECK_THROW(ObjectPool<I32>(ObjectHandle<I32>::MaxNumObjects + 1), Exception);
+
+    {
+        ObjectPool<CountedObject> objectPool(10);
+        BOOST_CHECK(objectPool.GetCapacity() == 10);
+        BOOST_CHECK(objectPool.GetNumObjects() == 0);
+
+        objectPool.Create(1);
+        objectPool.Create(2);
+        BOOST_CHECK(CountedObject::mNumInstances == 2);
+    }
+    BOOST_CHECK(CountedObject::mNumInstances == 0);
+
+    // Small types get slots that can store the free list pointers of the memory pool
+    BOOST_CHECK(ObjectPool<U8>::SlotSize == sizeof(void*));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Create_Get_Destroy)
+{
+    ObjectPool<CountedObject> objectPool(4);
+
+    ObjectHandle<CountedObject> nullHandle;
+    BOOST_CHECK(nullHandle.IsNull());
+    BOOST_CHECK(!objectPool.IsValid(nullHandle));
+    BOOST_CHECK(objectPool.Get(nullHandle) == nullptr);
+
+    std::vector<ObjectHandle<CountedObject>> handles;
+    for (I32 i = 0; i < 4; ++i)
+        handles.push_back(objectPool.Create(i));
+    BOOST_CHECK_THROW(objectPool.Create(4), Exception);
+    BOOST_CHECK(objectPool.GetNumObjects() == 4);
+
+    for (I32 i = 0; i < 4; ++i)
+    {
+        BOOST_CHECK(!handles[i].IsNull());
+        BOOST_REQUIRE(objectPool.Get(handles[i]) != nullptr);
+        BOOST_CHECK(objectPool.Get(handles[i])->mValue == i);
+        BOOST_CHECK(objectPool.GetHandle(*objectPool.Get(handles[i])) == handles[i]);
+    }
+
+    CountedObject* address = objectPool.Get(handles[1]);
+    objectPool.Destroy(handles[1]);
+    BOOST_CHECK(CountedObject::mNumInstances == 3);
+    BOOST_CHECK(objectPool.GetNumObjects() == 3);
+
+    // The handle of the destroyed object stays invalid, even if its slot is reused
+    BOOST_CHECK(!objectPool.IsValid(handles[1]));
+    BOOST_CHECK(objectPool.Get(handles[1]) == nullptr);
+    GDL_CHECK_THROW_DEV_DISABLE(objectPool.Destroy(handles[1]), Exception);
+
+    ObjectHandle<CountedObject> newHandle = objectPool.Create(10);
+    BOOST_CHECK(newHandle.GetIndex() == handles[1].GetIndex());
+    BOOST_CHECK(newHandle != handles[1]);
+    BOOST_CHECK(objectPool.Get(newHandle) == address);
+    BOOST_CHECK(objectPool.Get(handles[1]) == nullptr);
+    BOOST_CHECK(objectPool.Get(newHandle)->mValue == 10);
+
+    objectPool.Clear();
+    BOOST_CHECK(objectPool.GetNumObjects() == 0);
+    BOOST_CHECK(CountedObject::mNumInstances == 0);
+    BOOST_CHECK(objectPool.Get(newHandle) == nullptr);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Generation_Wrap_Around)
+{
+    ObjectPool<I32> objectPool(1);
+
+    ObjectHandle<I32> firstHandle = objectPool.Create(0);
+    objectPool.Destroy(firstHandle);
+
+    // Handles are only aliased after the generation counter of the slot wrapped around
+    constexpr U32 numGenerations = ObjectHandle<I32>::GenerationMask + 1;
+    for (U32 i = 1; i < numGenerations / 2; ++i)
+    {
+        ObjectHandle<I32> handle = objectPool.Create(static_cast<I32>(i));
+        BOOST_CHECK(handle != firstHandle);
+        BOOST_CHECK(objectPool.Get(firstHandle) == nullptr);
+        objectPool.Destroy(handle);
+    }
+
+    BOOST_CHECK(objectPool.Create(0) == firstHandle);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Exception_Safety)
+{
+    ObjectPool<ThrowingObject> objectPool(1);
+
+    BOOST_CHECK_THROW(objectPool.Create(-1), Exception);
+    BOOST_CHECK(objectPool.GetNumObjects() == 0);
+
+    // The slot of the failed construction is available again
+    BOOST_CHECK(objectPool.IsValid(objectPool.Create(1)));
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Iteration)
+{
+    constexpr I32 numObjects = 200;
+    ObjectPool<CountedObject> objectPool(numObjects);
+
+    std::vector<ObjectHandle<CountedObject>> handles;
+    for (I32 i = 0; i < numObjects; ++i)
+        handles.push_back(objectPool.Create(i));
+    for (I32 i = 0; i < numObjects; i += 3)
+        objectPool.Destroy(handles[i]);
+
+    // Live objects are visited in memory order
+    std::vector<const CountedObject*> visitedObjects;
+    const ObjectPool<CountedObject>& constObjectPool = objectPool;
+    constObjectPool.ForEach([&visitedObjects](const CountedObject& object) { visitedObjects.push_back(&object); });
+
+    BOOST_CHECK(visitedObjects.size() == objectPool.GetNumObjects());
+    for (U32 i = 1; i < visitedObjects.size(); ++i)
+        BOOST_CHECK(visitedObjects[i - 1] < visitedObjects[i]);
+    for (const CountedObject* object : visitedObjects)
+        BOOST_CHECK(object->mValue % 3 != 0);
+
+    // Objects can destroy themselves during the iteration
+    objectPool.ForEach([&objectPool](CountedObject& object) {
+        if (object.mValue % 3 == 1)
+            objectPool.Destroy(objectPool.GetHandle(object));
+        else
+            object.mValue = -1;
+    });
+
+    BOOST_CHECK(CountedObject::mNumInstances == static_cast<I32>(objectPool.GetNumObjects()));
+    objectPool.ForEach([](const CountedObject& object) { BOOST_CHECK(object.mValue == -1); });
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Alignment)
+{
+    struct alignas(64) AlignedObject
+    {
+        U8 mValue;
+    };
+
+    ObjectPool<AlignedObject> objectPool(10, MemoryBacking::MAPPED);
+    BOOST_CHECK(ObjectPool<AlignedObject>::SlotSize == 64);
+
+    for (U32 i = 0; i < 10; ++i)
+        BOOST_CHECK(IsAligned(objectPool.Get(objectPool.Create()), 64));
+}
@@ -0,0 +1,401 @@
+#include <boost/test/unit_test.hpp>
+#include "test/tools/ExceptionChecks.h"
+
+#include "gdl/base/exception.h"
+#include "gdl/base/functions/alignment.h"
+#include "gdl/resources/memory/sizeClassMemory.h"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+using namespace GDL;
+
+BOOST_AUTO_TEST_CASE(Construction_Destruction)
+{
+    BOOST_CHECK_NO_THROW(SizeClassMemory(100_B));
+
+    BOOST_CHECK_THROW(SizeClassMemory(0_B), Exception);
+    BOOST_CHECK_THROW(SizeClassMemory(32_B), Exception);
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Initialization_Deinitialization)
+{
+    SizeClassMemory scm{1_KiB};
+
+    scm.Initialize();
+
+    // already initialized
+    BOOST_CHECK_THROW(scm.Initialize(), Exception);
+
+    void* address = scm.Allocate(20);
+
+    // memory still in use
+    BOOST_CHECK_THROW(scm.Deinitialize(), Exception);
+
+    scm.Deallocate(address);
+    scm.Deinitialize();
+
+    // already deinitialized
+    BOOST_CHECK_THROW(scm.Deinitialize(), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(address), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Allocate(20), Exception);
+}
+
+
+
+//! @brief Tests if neighbouring free blocks are merged during deallocation. All possible edge cases are tested. The
+//! memory is too small for slabs, so that all allocations are served by the TLSF allocator.
+BOOST_AUTO_TEST_CASE(Deallocation_Merging)
+{
+    constexpr U32 numAllocations = 5;
+    constexpr size_t allocationSize = 1000;
+
+    SizeClassMemory scm{8_KiB};
+    std::array<void*, numAllocations> addresses;
+
+    scm.Initialize();
+    const size_t initialFreeMemorySize = scm.GetFreeMemorySize();
+    BOOST_CHECK(scm.CountFreeMemoryBlocks() == 1);
+    BOOST_CHECK(scm.GetLargestFreeMemoryBlockSize() == initialFreeMemorySize);
+
+    for (U32 i = 0; i < numAllocations; ++i)
+        addresses[i] = scm.Allocate(allocationSize);
+    BOOST_CHECK(scm.CountAllocatedMemoryBlocks() == numAllocations);
+    BOOST_CHECK(scm.CountFreeMemoryBlocks() == 1);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    // |xx| - used memory
+    // |  | - free memory
+    // |--| - memory that is going to be deallocated
+
+    // No merge
+    // |xx|--|xx|xx|xx|  |
+    scm.Deallocate(addresses[1]);
+    BOOST_CHECK(scm.CountFreeMemoryBlocks() == 2);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    // Merge with previous
+    // |xx|  |--|xx|xx|  |
+    scm.Deallocate(addresses[2]);
+    BOOST_CHECK(scm.CountFreeMemoryBlocks() == 2);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    // Merge with next
+    // |--|    |xx|xx|  |
+    scm.Deallocate(addresses[0]);
+    BOOST_CHECK(scm.CountFreeMemoryBlocks() == 2);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    // Merge with last free block
+    // |      |xx|--|  |
+    scm.Deallocate(addresses[4]);
+    BOOST_CHECK(scm.CountFreeMemoryBlocks() == 2);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    // Merge with previous and next
+    // |      |--|     |
+    scm.Deallocate(addresses[3]);
+    BOOST_CHECK(scm.CountFreeMemoryBlocks() == 1);
+    BOOST_CHECK(scm.CountAllocatedMemoryBlocks() == 0);
+    BOOST_CHECK(scm.GetFreeMemorySize() == initialFreeMemorySize);
+    BOOST_CHECK(scm.GetLargestFreeMemoryBlockSize() == initialFreeMemorySize);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    scm.Deinitialize();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Slabs)
+{
+    constexpr size_t allocationSize = 32;
+    constexpr U32 numElementsPerSlab =
+            (SizeClassMemory::SlabSize - SizeClassMemory::MaxSlabElementSize) / allocationSize;
+    constexpr U32 numAllocations = numElementsPerSlab + numElementsPerSlab / 2;
+
+    SizeClassMemory scm{1_MiB};
+    std::vector<void*> addresses(numAllocations, nullptr);
+
+    scm.Initialize();
+    const size_t initialFreeMemorySize = scm.GetFreeMemorySize();
+
+    // Two slabs are needed
+    for (U32 i = 0; i < numAllocations; ++i)
+    {
+        addresses[i] = scm.Allocate(allocationSize);
+        BOOST_CHECK(IsAligned(addresses[i], SizeClassMemory::MinAlignment));
+    }
+    BOOST_CHECK(scm.CountAllocatedMemoryBlocks() == numAllocations);
+    BOOST_CHECK(scm.GetFreeMemorySize() < initialFreeMemorySize - 2 * SizeClassMemory::SlabSize);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    // Elements of a slab are adjacent
+    BOOST_CHECK(static_cast<U8*>(addresses[1]) - static_cast<U8*>(addresses[0]) == allocationSize);
+
+    // Freed elements are reused
+    void* address = addresses[numAllocations / 3];
+    scm.Deallocate(address);
+    BOOST_CHECK(scm.Allocate(allocationSize) == address);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    // Other size classes use their own slabs
+    void* otherSizeClassAddress = scm.Allocate(allocationSize + 1);
+    BOOST_CHECK(static_cast<U8*>(otherSizeClassAddress) - static_cast<U8*>(addresses[0]) >=
+                static_cast<std::ptrdiff_t>(SizeClassMemory::SlabSize));
+    scm.Deallocate(otherSizeClassAddress);
+
+    // Empty slabs are returned to the TLSF allocator, but the last one of each size class is kept
+    for (U32 i = 0; i < numAllocations; ++i)
+        scm.Deallocate(addresses[i]);
+    BOOST_CHECK(scm.CountAllocatedMemoryBlocks() == 0);
+    BOOST_CHECK(scm.GetFreeMemorySize() < initialFreeMemorySize - 2 * SizeClassMemory::SlabSize);
+    BOOST_CHECK(scm.GetFreeMemorySize() > initialFreeMemorySize - 3 * SizeClassMemory::SlabSize);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    scm.Deinitialize();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Alignment)
+{
+    constexpr U32 numAlignments = 13;
+    constexpr std::array<size_t, numAlignments> alignmentValues{{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048,
+                                                                  4096}};
+    constexpr std::array<size_t, 4> allocationSizes{{1, 64, 200, 3000}};
+
+    SizeClassMemory scm{1_MiB};
+    std::vector<void*> addresses;
+
+    scm.Initialize();
+    for (size_t allocationSize : allocationSizes)
+        for (size_t alignment : alignmentValues)
+        {
+            addresses.push_back(scm.Allocate(allocationSize, alignment));
+            BOOST_CHECK(IsAligned(addresses.back(), alignment));
+        }
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    for (void* address : addresses)
+        scm.Deallocate(address);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    scm.Deinitialize();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Allocation_Exceptions)
+{
+    constexpr size_t allocationSize = 1000;
+
+    SizeClassMemory scm{4_KiB};
+    std::vector<void*> addresses;
+
+    scm.Initialize();
+
+    // fill the memory
+    while (scm.GetLargestFreeMemoryBlockSize() >= allocationSize)
+        addresses.push_back(scm.Allocate(allocationSize));
+    BOOST_CHECK_THROW(scm.Allocate(allocationSize), Exception);
+    BOOST_CHECK_THROW(scm.Allocate(10 * allocationSize * allocationSize), Exception);
+
+    // size is 0
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Allocate(0), Exception);
+
+    // alignment is not power of 2
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Allocate(10, 5), Exception);
+
+    for (void* address : addresses)
+        scm.Deallocate(address);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    scm.Deinitialize();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Deallocation_Exceptions)
+{
+    constexpr size_t memorySize = 1024 * 1024;
+
+    SizeClassMemory scm{memorySize * 1_B};
+
+    scm.Initialize();
+
+    U8* largeAddress = static_cast<U8*>(scm.Allocate(1000));
+    U8* smallAddress = static_cast<U8*>(scm.Allocate(32));
+
+    // nullptr
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(nullptr), Exception);
+
+    // out of bounds
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(largeAddress - 2 * memorySize), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(largeAddress + 2 * memorySize), Exception);
+
+    // invalid addresses inside valid boundaries
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(smallAddress + 8), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(smallAddress + 64), Exception);
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(largeAddress + 8), Exception);
+
+    // already freed
+    scm.Deallocate(largeAddress);
+    GDL_CHECK_THROW_DEV_DISABLE(scm.Deallocate(largeAddress), Exception);
+
+    scm.Deallocate(smallAddress);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+    scm.Deinitialize();
+}
+
+
+
+//! @brief Allocates and deallocates memory blocks with random sizes and alignments. Each block is filled with a value
+//! that is checked before deallocation to detect overlapping memory blocks.
+BOOST_AUTO_TEST_CASE(Random_Allocations)
+{
+    constexpr U32 numIterations = 20000;
+    constexpr U32 maxNumAllocations = 500;
+
+    struct Allocation
+    {
+        U8* mAddress;
+        size_t mSize;
+        U8 mValue;
+    };
+
+    SizeClassMemory scm{8_MiB};
+    std::vector<Allocation> allocations;
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<U32> smallSizeDistribution(1, 256);
+    std::uniform_int_distribution<U32> largeSizeDistribution(257, 32768);
+    std::uniform_int_distribution<U32> alignmentDistribution(0, 8);
+    std::uniform_int_distribution<U32> percentDistribution(0, 99);
+
+    scm.Initialize();
+
+    for (U32 i = 0; i < numIterations; ++i)
+    {
+        if (allocations.size() < maxNumAllocations && (allocations.empty() || percentDistribution(generator) < 55))
+        {
+            size_t size = (percentDistribution(generator) < 80) ? smallSizeDistribution(generator)
+                                                                  : largeSizeDistribution(generator);
+            size_t alignment = size_t(1) << alignmentDistribution(generator);
+            U8 value = static_cast<U8>(i);
+
+            U8* address = static_cast<U8*>(scm.Allocate(size, alignment));
+            BOOST_REQUIRE(IsAligned(address, alignment));
+            std::memset(address, value, size);
+            allocations.push_back({address, size, value});
+        }
+        else
+        {
+            size_t index = percentDistribution(generator) * allocations.size() / 100;
+            Allocation allocation = allocations[index];
+            allocations[index] = allocations.back();
+            allocations.pop_back();
+
+            for (size_t j = 0; j < allocation.mSize; ++j)
+                BOOST_REQUIRE(allocation.mAddress[j] == allocation.mValue);
+            scm.Deallocate(allocation.mAddress);
+        }
+
+        if (i % 1000 == 0)
+            BOOST_REQUIRE_NO_THROW(scm.CheckMemoryConsistency());
+    }
+
+    BOOST_CHECK(scm.CountAllocatedMemoryBlocks() == allocations.size());
+    for (const Allocation& allocation : allocations)
+        scm.Deallocate(allocation.mAddress);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+    scm.Deinitialize();
+}
+
+
+
+BOOST_AUTO_TEST_CASE(Multiple_Initialization)
+{
+    constexpr U32 numAllocations = 10;
+    constexpr U32 numInitializations = 10;
+
+    SizeClassMemory scm{1_MiB};
+    std::array<void*, numAllocations> addresses;
+
+    for (U32 k = 0; k < numInitializations; ++k)
+    {
+        scm.Initialize();
+        for (U32 i = 0; i < numAllocations; ++i)
+            addresses[i] = scm.Allocate(i * 100 + 1);
+        BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+
+        for (U32 i = 0; i < numAllocations; ++i)
+            scm.Deallocate(addresses[i]);
+        scm.Deinitialize();
+    }
+}
+
+
+
+//! @brief Checks if the public functions of the size class memory are thread safe
+BOOST_AUTO_TEST_CASE(Thread_Safety)
+{
+    constexpr U32 numThreadAllocations = 30;
+    constexpr U32 numAllocationRuns = 100;
+    constexpr U32 numThreads = 4;
+    constexpr std::array<size_t, 3> allocationSizes{{24, 200, 2000}};
+
+    std::atomic_bool kickoff = false;
+    std::atomic_bool exceptionThrown = false;
+
+    SizeClassMemory scm{2_MiB};
+    scm.Initialize();
+
+
+    std::vector<std::thread> threads;
+    for (U32 i = 0; i < numThreads; ++i)
+        threads.emplace_back([&]() {
+            try
+            {
+                std::array<void*, numThreadAllocations> addresses;
+                addresses.fill(nullptr);
+                while (!kickoff)
+                    std::this_thread::yield();
+                for (U32 j = 0; j < numAllocationRuns; ++j)
+                {
+                    for (U32 k = 0; k < numThreadAllocations; ++k)
+                        addresses[k] = scm.Allocate(allocationSizes[k % allocationSizes.size()]);
+
+                    scm.CountAllocatedMemoryBlocks();
+                    scm.CountFreeMemoryBlocks();
+                    scm.CheckMemoryConsistency();
+
+                    for (U32 k = 0; k < numThreadAllocations; ++k)
+                    {
+                        scm.Deallocate(addresses[k]);
+                        addresses[k] = nullptr;
+                    }
+                }
+            }
+            catch (...)
+            {
+                exceptionThrown = true;
+            }
+        });
+
+    kickoff = true;
+
+    for (U32 i = 0; i < threads.size(); ++i)
+        threads[i].join();
+
+
+    BOOST_CHECK(exceptionThrown == false);
+    BOOST_CHECK_NO_THROW(scm.CheckMemoryConsistency());
+    BOOST_CHECK_NO_THROW(scm.Deinitialize());
+}
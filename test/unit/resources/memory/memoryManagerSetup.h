@@ -1,6 +1,8 @@
 #include "gdl/resources/memory/memoryManager.h"
 #include "gdl/resources/memory/memorySize.h"
 
+#include <vector>
+
 using namespace GDL;
 
 
@@ -9,17 +11,26 @@ using namespace GDL;
 MemoryManager& SetupMemoryManager()
 {
     MemoryManager& memoryManager = MemoryManager::Instance();
-#ifndef NO_GENERAL_PURPOSE_MEMORY
+#if defined(SIZE_CLASS_MEMORY)
+    memoryManager.CreateGeneralPurposeMemory(1_MiB, GeneralPurposeMemoryType::SIZE_CLASS);
+#elif !defined(NO_GENERAL_PURPOSE_MEMORY)
     memoryManager.CreateGeneralPurposeMemory(1_MiB);
 #endif
 #ifndef NO_MEMORY_POOL
     memoryManager.CreateMemoryPool(32_B, 1000);
     memoryManager.CreateMemoryPool(64_B, 1000);
     memoryManager.CreateMemoryPool(128_B, 1000);
+#ifdef LARGE_MEMORY_POOL
+    // Exceeds the maximal size of the memory pool lookup table
+    memoryManager.CreateMemoryPool(40008_B, 10, 8);
+#endif
 #endif
 #ifndef NO_MEMORY_STACK
     memoryManager.CreateMemoryStack(1_MiB);
 #endif
+#ifndef NO_FRAME_MEMORY
+    memoryManager.CreateFrameMemory(1_MiB);
+#endif
 #ifndef NO_THREAD_PRIVATE_MEMORY_STACK
     memoryManager.EnableThreadPrivateMemory();
 #endif
@@ -36,6 +47,30 @@ MemoryManager& GetMemoryManager()
 }
 
 
+#ifdef MEMORY_TRACKING
+//! @brief The memory trackers allocate the counters of a thread from the heap when the thread uses them for the first
+//! time. This function does it beforehand, so that the tests can check that the allocators don't use the heap.
+void WarmUpMemoryTrackers()
+{
+    MemoryManager& memoryManager = GetMemoryManager();
+    std::vector<MemoryInterface*> memories = {memoryManager.GetGeneralPurposeMemory(), memoryManager.GetMemoryStack(),
+                                              memoryManager.GetFrameMemory(),
+                                              memoryManager.GetThreadPrivateMemoryStack(),
+                                              memoryManager.GetHeapMemory()};
+    for (size_t elementSize : {32, 64, 128})
+        memories.push_back(memoryManager.GetMemoryPool(elementSize, 1));
+
+    for (MemoryInterface* memory : memories)
+        if (memory != nullptr)
+        {
+            MemoryInterface* trackedMemory = memoryManager.GetTrackedMemory(memory);
+            trackedMemory->Deallocate(trackedMemory->Allocate(1, 1), 1);
+        }
+}
+#endif
+
+
+
 void InitializeMemoryManager()
 {
 #if !(defined(NO_GENERAL_PURPOSE_MEMORY) && defined(NO_MEMORY_POOL) && defined(NO_MEMORY_STACK) &&                     \
@@ -48,6 +83,10 @@ void InitializeMemoryManager()
 #endif
 
 #endif
+
+#ifdef MEMORY_TRACKING
+    WarmUpMemoryTrackers();
+#endif
 }
 
 void DeinitializeMemoryManager()